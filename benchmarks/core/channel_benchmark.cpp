@@ -0,0 +1,234 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Compares the in-process channels available to operator ports:
+//
+// 1. The raw queues: the lock-free SPSC ring vs. a mutex-protected deque, with one producer and
+//    one consumer thread.
+// 2. A two-operator pipeline whose ports use the double-buffer or the lock-free connector, run
+//    with the greedy and the multi-thread scheduler.
+//
+// Usage: CHANNEL_BENCHMARK [num_messages]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <holoscan/holoscan.hpp>
+#include "holoscan/core/gxf/lock_free_queue.hpp"
+
+namespace {
+
+int64_t now_ns() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+class MutexQueue {
+ public:
+  explicit MutexQueue(size_t capacity) : capacity_(capacity) {}
+
+  bool try_push(const int64_t& value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queue_.size() >= capacity_) { return false; }
+    queue_.push_back(value);
+    return true;
+  }
+
+  bool try_pop(int64_t& value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queue_.empty()) { return false; }
+    value = queue_.front();
+    queue_.pop_front();
+    return true;
+  }
+
+ private:
+  size_t capacity_;
+  std::mutex mutex_;
+  std::deque<int64_t> queue_;
+};
+
+struct LatencyStats {
+  double mean_us = 0.0;
+  double p50_us = 0.0;
+  double p99_us = 0.0;
+};
+
+LatencyStats compute_stats(std::vector<int64_t>& latencies_ns) {
+  LatencyStats stats;
+  if (latencies_ns.empty()) { return stats; }
+  std::sort(latencies_ns.begin(), latencies_ns.end());
+  double sum = 0.0;
+  for (auto latency : latencies_ns) { sum += static_cast<double>(latency); }
+  stats.mean_us = sum / latencies_ns.size() / 1e3;
+  stats.p50_us = latencies_ns[latencies_ns.size() / 2] / 1e3;
+  stats.p99_us = latencies_ns[latencies_ns.size() * 99 / 100] / 1e3;
+  return stats;
+}
+
+template <typename QueueT>
+void run_queue_benchmark(const char* name, size_t num_messages) {
+  QueueT queue(16);
+  std::vector<int64_t> latencies_ns;
+  latencies_ns.reserve(num_messages);
+
+  const int64_t start_ns = now_ns();
+  std::thread producer([&queue, num_messages]() {
+    for (size_t i = 0; i < num_messages; ++i) {
+      const int64_t timestamp = now_ns();
+      while (!queue.try_push(timestamp)) { std::this_thread::yield(); }
+    }
+  });
+  int64_t timestamp = 0;
+  while (latencies_ns.size() < num_messages) {
+    if (queue.try_pop(timestamp)) {
+      latencies_ns.push_back(now_ns() - timestamp);
+    } else {
+      std::this_thread::yield();
+    }
+  }
+  producer.join();
+  const double seconds = (now_ns() - start_ns) / 1e9;
+
+  const auto stats = compute_stats(latencies_ns);
+  std::printf("%-40s %14.0f %12.2f %12.2f %12.2f\n",
+              name,
+              num_messages / seconds,
+              stats.mean_us,
+              stats.p50_us,
+              stats.p99_us);
+}
+
+}  // namespace
+
+namespace holoscan {
+
+// The connector used by the benchmark operators' ports (read in setup()).
+static IOSpec::ConnectorType g_connector_type = IOSpec::ConnectorType::kDefault;
+
+namespace ops {
+
+class TimestampTxOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(TimestampTxOp)
+
+  TimestampTxOp() = default;
+
+  void setup(OperatorSpec& spec) override {
+    spec.output<int64_t>("out").connector(g_connector_type, Arg("capacity", 4UL));
+  }
+
+  void compute(InputContext&, OutputContext& op_output, ExecutionContext&) override {
+    auto timestamp = std::make_shared<int64_t>(now_ns());
+    op_output.emit(timestamp, "out");
+  };
+};
+
+class TimestampRxOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(TimestampRxOp)
+
+  TimestampRxOp() = default;
+
+  void setup(OperatorSpec& spec) override {
+    spec.input<int64_t>("in").connector(g_connector_type, Arg("capacity", 4UL));
+  }
+
+  void compute(InputContext& op_input, OutputContext&, ExecutionContext&) override {
+    auto timestamp = op_input.receive<int64_t>("in");
+    if (timestamp) { latencies_ns.push_back(now_ns() - *timestamp); }
+  };
+
+  std::vector<int64_t> latencies_ns;
+};
+
+}  // namespace ops
+
+class ChannelBenchmarkApp : public Application {
+ public:
+  explicit ChannelBenchmarkApp(size_t num_messages) : num_messages_(num_messages) {}
+
+  void compose() override {
+    auto tx = make_operator<ops::TimestampTxOp>(
+        "tx", make_condition<CountCondition>(static_cast<int64_t>(num_messages_)));
+    rx_ = make_operator<ops::TimestampRxOp>("rx");
+    rx_->latencies_ns.reserve(num_messages_);
+    add_flow(tx, rx_);
+  }
+
+  size_t num_messages_ = 0;
+  std::shared_ptr<ops::TimestampRxOp> rx_;
+};
+
+void run_pipeline_benchmark(const char* name, IOSpec::ConnectorType connector_type,
+                            bool multi_thread, size_t num_messages) {
+  g_connector_type = connector_type;
+  auto app = make_application<ChannelBenchmarkApp>(num_messages);
+  if (multi_thread) {
+    app->scheduler(app->make_scheduler<MultiThreadScheduler>(
+        "multithread", Arg("worker_thread_number", 2L), Arg("stop_on_deadlock", true)));
+  }
+
+  const int64_t start_ns = now_ns();
+  app->run();
+  const double seconds = (now_ns() - start_ns) / 1e9;
+
+  const auto stats = compute_stats(app->rx_->latencies_ns);
+  std::printf("%-40s %14.0f %12.2f %12.2f %12.2f\n",
+              name,
+              app->rx_->latencies_ns.size() / seconds,
+              stats.mean_us,
+              stats.p50_us,
+              stats.p99_us);
+}
+
+}  // namespace holoscan
+
+int main(int argc, char** argv) {
+  using holoscan::IOSpec;
+  const size_t num_messages = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 100000;
+
+  holoscan::set_log_level(holoscan::LogLevel::WARN);
+
+  std::printf("%zu messages\n", num_messages);
+  std::printf("%-40s %14s %12s %12s %12s\n", "channel", "msgs/sec", "mean (us)", "p50 (us)",
+              "p99 (us)");
+
+  run_queue_benchmark<holoscan::gxf::SPSCQueue<int64_t>>("queue: lock-free SPSC", num_messages);
+  run_queue_benchmark<MutexQueue>("queue: mutex + deque", num_messages);
+
+  holoscan::run_pipeline_benchmark(
+      "greedy: double-buffer", IOSpec::ConnectorType::kDoubleBuffer, false, num_messages);
+  holoscan::run_pipeline_benchmark(
+      "greedy: lock-free", IOSpec::ConnectorType::kLockFree, false, num_messages);
+  holoscan::run_pipeline_benchmark(
+      "multi-thread: double-buffer", IOSpec::ConnectorType::kDoubleBuffer, true, num_messages);
+  holoscan::run_pipeline_benchmark(
+      "multi-thread: lock-free", IOSpec::ConnectorType::kLockFree, true, num_messages);
+
+  return 0;
+}
@@ -0,0 +1,113 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Measures the host Bayer demosaic of the BayerDemosaic codelet on an 8-bit RGGB image at 720p,
+// 1080p and 4K, with the bilinear and the gradient-corrected interpolations, on the calling thread
+// and split by rows across num_threads threads.
+//
+// Usage: BAYER_DEMOSAIC_BENCHMARK [num_frames] [num_threads] [channels]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+#include "bayer_demosaic/bayer_to_rgb.hpp"
+#include "utils/row_worker_pool.hpp"
+
+namespace holoscan = nvidia::holoscan;
+
+namespace {
+
+template <typename Convert>
+double run_us_per_frame(size_t num_frames, Convert&& convert) {
+  convert();  // warm-up
+  const auto start = std::chrono::steady_clock::now();
+  for (size_t frame = 0; frame < num_frames; frame++) { convert(); }
+  const auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::micro>(end - start).count() / num_frames;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const size_t num_frames = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 100;
+  const size_t num_threads = argc > 2 ? std::strtoull(argv[2], nullptr, 10)
+                                      : std::max(1u, std::thread::hardware_concurrency());
+  const uint32_t channels = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 3;
+  if (num_frames == 0 || num_threads == 0 || (channels != 3 && channels != 4)) { return 1; }
+
+  std::printf("%zu frames, %zu threads, %u channels\n", num_frames, num_threads, channels);
+  std::printf("%-12s %-20s %16s %16s %10s\n",
+              "resolution",
+              "interpolation",
+              "1 thread (us)",
+              "threads (us)",
+              "speedup");
+
+  holoscan::RowWorkerPool pool(num_threads);
+  const struct {
+    const char* name;
+    uint32_t width;
+    uint32_t height;
+  } resolutions[] = {{"720p", 1280, 720}, {"1080p", 1920, 1080}, {"4K", 3840, 2160}};
+  const struct {
+    const char* name;
+    holoscan::BayerInterpolation interpolation;
+  } interpolations[] = {{"bilinear", holoscan::BayerInterpolation::kBilinear},
+                        {"gradient-corrected", holoscan::BayerInterpolation::kGradientCorrected}};
+  for (const auto& resolution : resolutions) {
+    const uint32_t width = resolution.width;
+    const uint32_t height = resolution.height;
+    std::vector<uint8_t> bayer(width * height);
+    for (size_t i = 0; i < bayer.size(); i++) { bayer[i] = static_cast<uint8_t>(i * 7 % 251); }
+    std::vector<uint8_t> rgb(width * channels * height);
+
+    for (const auto& interpolation : interpolations) {
+      auto demosaic = [&](uint32_t begin_row, uint32_t end_row) {
+        holoscan::DemosaicBayer(bayer.data(),
+                                width,
+                                rgb.data(),
+                                width * channels,
+                                width,
+                                height,
+                                begin_row,
+                                end_row,
+                                holoscan::BayerGridPosition::kRGGB,
+                                interpolation.interpolation,
+                                channels,
+                                255);
+      };
+      const double single_us = run_us_per_frame(num_frames, [&]() { demosaic(0, height); });
+      const double threads_us = run_us_per_frame(num_frames, [&]() {
+        pool.run(height, [&](size_t begin_row, size_t end_row) { demosaic(begin_row, end_row); });
+      });
+
+      std::printf("%-12s %-20s %16.1f %16.1f %9.2fx\n",
+                  resolution.name,
+                  interpolation.name,
+                  single_us,
+                  threads_us,
+                  single_us / threads_us);
+    }
+  }
+
+  return 0;
+}
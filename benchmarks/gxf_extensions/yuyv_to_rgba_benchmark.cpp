@@ -0,0 +1,146 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Measures the YUYV to RGBA conversion of the V4L2 source at 720p, 1080p and 4K:
+//
+// 1. The previous implementation, converting each pixel with double precision arithmetic in a
+//    scalar loop.
+// 2. The fixed-point vectorized conversion on the calling thread.
+// 3. The fixed-point vectorized conversion, split by rows across num_threads threads.
+//
+// Usage: YUYV_TO_RGBA_BENCHMARK [num_frames] [num_threads]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+#include "utils/row_worker_pool.hpp"
+#include "v4l2/yuyv_to_rgba.hpp"
+
+namespace holoscan = nvidia::holoscan;
+
+namespace {
+
+/// Previous conversion of the V4L2 source
+void reference_yuyv_to_rgba(const void* yuyv, void* rgba, size_t width, size_t height) {
+  auto r_convert = [](int y, int cr) {
+    double r = y + (1.4065 * (cr - 128));
+    return static_cast<unsigned int>(std::max(0, std::min(255, static_cast<int>(r))));
+  };
+  auto g_convert = [](int y, int cb, int cr) {
+    double g = y - (0.3455 * (cb - 128)) - (0.7169 * (cr - 128));
+    return static_cast<unsigned int>(std::max(0, std::min(255, static_cast<int>(g))));
+  };
+  auto b_convert = [](int y, int cb) {
+    double b = y + (1.7790 * (cb - 128));
+    return static_cast<unsigned int>(std::max(0, std::min(255, static_cast<int>(b))));
+  };
+
+  const unsigned char* yuyv_buf = static_cast<const unsigned char*>(yuyv);
+  unsigned char* rgba_buf = static_cast<unsigned char*>(rgba);
+
+  for (unsigned int i = 0, j = 0; i < width * height * 4; i += 8, j += 4) {
+    int cb = yuyv_buf[j + 1];
+    int cr = yuyv_buf[j + 3];
+
+    int y = yuyv_buf[j];
+    rgba_buf[i] = r_convert(y, cr);
+    rgba_buf[i + 1] = g_convert(y, cb, cr);
+    rgba_buf[i + 2] = b_convert(y, cb);
+    rgba_buf[i + 3] = 1;
+
+    y = yuyv_buf[j + 2];
+    rgba_buf[i + 4] = r_convert(y, cr);
+    rgba_buf[i + 5] = g_convert(y, cb, cr);
+    rgba_buf[i + 6] = b_convert(y, cb);
+    rgba_buf[i + 7] = 1;
+  }
+}
+
+template <typename Convert>
+double run_us_per_frame(size_t num_frames, Convert&& convert) {
+  convert();  // warm-up
+  const auto start = std::chrono::steady_clock::now();
+  for (size_t frame = 0; frame < num_frames; frame++) { convert(); }
+  const auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::micro>(end - start).count() / num_frames;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const size_t num_frames = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 100;
+  const size_t num_threads = argc > 2 ? std::strtoull(argv[2], nullptr, 10)
+                                      : std::max(1u, std::thread::hardware_concurrency());
+  if (num_frames == 0 || num_threads == 0) { return 1; }
+
+  std::printf("%zu frames, %zu threads\n", num_frames, num_threads);
+  std::printf("%-12s %16s %16s %16s %10s\n",
+              "resolution",
+              "previous (us)",
+              "1 thread (us)",
+              "threads (us)",
+              "speedup");
+
+  const auto coefficients = holoscan::GetYUVToRGBCoefficients(holoscan::YUVColorMatrix::kBT601Full);
+  holoscan::RowWorkerPool pool(num_threads);
+  const struct {
+    const char* name;
+    uint32_t width;
+    uint32_t height;
+  } resolutions[] = {{"720p", 1280, 720}, {"1080p", 1920, 1080}, {"4K", 3840, 2160}};
+  for (const auto& resolution : resolutions) {
+    const uint32_t width = resolution.width;
+    const uint32_t height = resolution.height;
+    std::vector<uint8_t> yuyv(width * 2 * height);
+    for (size_t i = 0; i < yuyv.size(); i++) { yuyv[i] = static_cast<uint8_t>(i * 7 % 251); }
+    std::vector<uint8_t> rgba(width * 4 * height);
+
+    const double previous_us = run_us_per_frame(num_frames, [&]() {
+      reference_yuyv_to_rgba(yuyv.data(), rgba.data(), width, height);
+    });
+    const double single_us = run_us_per_frame(num_frames, [&]() {
+      holoscan::ConvertYUYVToRGBA(
+          yuyv.data(), width * 2, rgba.data(), width * 4, width, 0, height, coefficients);
+    });
+    const double threads_us = run_us_per_frame(num_frames, [&]() {
+      pool.run(height, [&](size_t begin_row, size_t end_row) {
+        holoscan::ConvertYUYVToRGBA(yuyv.data(),
+                                    width * 2,
+                                    rgba.data(),
+                                    width * 4,
+                                    width,
+                                    begin_row,
+                                    end_row,
+                                    coefficients);
+      });
+    });
+
+    std::printf("%-12s %16.1f %16.1f %16.1f %9.2fx\n",
+                resolution.name,
+                previous_us,
+                single_us,
+                threads_us,
+                previous_us / std::min(single_us, threads_us));
+  }
+
+  return 0;
+}
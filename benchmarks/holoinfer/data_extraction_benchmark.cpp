@@ -0,0 +1,199 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Measures the per frame cost of the host side of the data extraction of the inference operators:
+// updating the dimensions and the data buffer of each input tensor from the received tensor data.
+//
+// 1. The previous extraction, building a zero filled vector per tensor and frame.
+// 2. The buffer reuse of HoloInfer::update_host_buffer, copying, normalizing or aliasing the data.
+//
+// Heap allocations are counted after a warm-up, the benchmark returns an error if the buffer reuse
+// allocates in steady state.
+//
+// Usage: DATA_EXTRACTION_BENCHMARK [num_frames]
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <map>
+#include <memory>
+#include <new>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <holoinfer_buffer.hpp>
+
+namespace HoloInfer = holoscan::inference;
+
+namespace {
+
+std::atomic<size_t> allocation_count{0};
+
+}  // namespace
+
+void* operator new(std::size_t size) {
+  allocation_count.fetch_add(1, std::memory_order_relaxed);
+  if (void* ptr = std::malloc(size == 0 ? 1 : size)) { return ptr; }
+  throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+  std::free(ptr);
+}
+
+namespace {
+
+constexpr size_t kWarmupFrames = 10;
+
+/// Data of an upstream tensor, as received in a message
+struct InputTensor {
+  std::string name;
+  HoloInfer::holoinfer_datatype type;
+  std::vector<int> dims;
+  std::vector<uint8_t> data;
+};
+
+std::vector<InputTensor> make_input_tensors() {
+  std::vector<InputTensor> tensors{
+      {"source_video", HoloInfer::holoinfer_datatype::hUInt8, {1080, 1920, 3}, {}},
+      {"plax_cham_pre_proc", HoloInfer::holoinfer_datatype::hFloat, {1, 320, 320, 3}, {}},
+      {"token_ids", HoloInfer::holoinfer_datatype::hInt64, {1, 512}, {}}};
+  for (auto& tensor : tensors) {
+    size_t count = std::accumulate(
+        tensor.dims.begin(), tensor.dims.end(), size_t{1}, std::multiplies<size_t>());
+    tensor.data.resize(count * HoloInfer::get_element_size(tensor.type));
+    for (size_t i = 0; i < tensor.data.size(); i++) { tensor.data[i] = i % 251; }
+  }
+  return tensors;
+}
+
+struct Result {
+  double ns_per_frame;
+  double allocations_per_frame;
+};
+
+/// Runs the extraction of all tensors for warm-up and measured frames
+template <typename Extract>
+Result run(size_t num_frames, Extract&& extract) {
+  for (size_t frame = 0; frame < kWarmupFrames; frame++) { extract(); }
+
+  const size_t allocations = allocation_count.load();
+  const auto start = std::chrono::steady_clock::now();
+  for (size_t frame = 0; frame < num_frames; frame++) { extract(); }
+  const auto end = std::chrono::steady_clock::now();
+
+  return {std::chrono::duration<double, std::nano>(end - start).count() / num_frames,
+          static_cast<double>(allocation_count.load() - allocations) / num_frames};
+}
+
+void print(const char* name, const Result& result) {
+  std::printf("%-40s %14.0f %14.2f\n", name, result.ns_per_frame, result.allocations_per_frame);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const size_t num_frames = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 200;
+  if (num_frames == 0) { return 1; }
+
+  auto tensors = make_input_tensors();
+  const std::vector<float> mean{123.675f, 116.28f, 103.53f};
+  const std::vector<float> std_dev{58.395f, 57.12f, 57.375f};
+  const std::vector<float> no_normalization;
+
+  std::printf("%zu frames\n", num_frames);
+  std::printf("%-40s %14s %14s\n", "extraction", "ns/frame", "allocs/frame");
+
+  // previous extraction: dimensions and a zero filled float vector built per tensor and frame
+  {
+    std::map<std::string, std::vector<int>> dims_per_tensor;
+    std::map<std::string, std::vector<float>> data_per_tensor;
+    print("zero filled vector per frame", run(num_frames, [&]() {
+            for (const auto& tensor : tensors) {
+              std::vector<int> dims;
+              for (int dim : tensor.dims) { dims.push_back(dim); }
+              size_t count = std::accumulate(
+                  dims.begin(), dims.end(), size_t{1}, std::multiplies<size_t>());
+              std::vector<float> in_tensor_ptr(count, 0);
+              std::copy_n(tensor.data.data(),
+                          std::min(tensor.data.size(), count * sizeof(float)),
+                          reinterpret_cast<uint8_t*>(in_tensor_ptr.data()));
+              data_per_tensor[tensor.name] = std::move(in_tensor_ptr);
+              dims_per_tensor[tensor.name] = std::move(dims);
+            }
+          }));
+  }
+
+  int failures = 0;
+  const struct {
+    const char* name;
+    bool alias;
+    bool normalize;
+  } modes[] = {{"reused buffers, copy", false, false},
+               {"reused buffers, alias", true, false},
+               {"reused buffers, normalize uint8", false, true}};
+  for (const auto& mode : modes) {
+    std::map<std::string, std::vector<int>> dims_per_tensor;
+    HoloInfer::DataMap data_per_tensor;
+    for (const auto& tensor : tensors) {
+      data_per_tensor.insert({tensor.name, std::make_shared<HoloInfer::DataBuffer>()});
+    }
+
+    bool error = false;
+    auto result = run(num_frames, [&]() {
+      for (auto& tensor : tensors) {
+        auto& dims = dims_per_tensor[tensor.name];
+        dims.resize(tensor.dims.size());
+        std::copy(tensor.dims.begin(), tensor.dims.end(), dims.begin());
+        size_t count =
+            std::accumulate(dims.begin(), dims.end(), size_t{1}, std::multiplies<size_t>());
+
+        const bool normalize =
+            mode.normalize && tensor.type == HoloInfer::holoinfer_datatype::hUInt8;
+        auto status = HoloInfer::update_host_buffer(*data_per_tensor.at(tensor.name),
+                                                    tensor.data.data(),
+                                                    tensor.type,
+                                                    count,
+                                                    mode.alias,
+                                                    normalize ? mean : no_normalization,
+                                                    normalize ? std_dev : no_normalization);
+        if (status.get_code() != HoloInfer::holoinfer_code::H_SUCCESS) { error = true; }
+      }
+    });
+    print(mode.name, result);
+
+    if (error) {
+      std::printf("FAILED: %s, buffer update error\n", mode.name);
+      failures++;
+    }
+    if (result.allocations_per_frame > 0) {
+      std::printf("FAILED: %s, allocations after warm-up\n", mode.name);
+      failures++;
+    }
+  }
+
+  return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,142 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Measures the max_per_channel_scaled postprocessing of the inference toolkit on 512x512xN
+// outputs of float32:
+//
+// 1. The previous implementation, copying the inferred buffer and walking it with a scalar loop
+//    per pixel and channel.
+// 2. The processor context, reading the inferred buffer in place with the vectorized kernel, split
+//    by rows across worker threads.
+//
+// Usage: POSTPROCESSING_BENCHMARK [num_frames]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <holoinfer.hpp>
+#include <holoinfer_buffer.hpp>
+
+namespace HoloInfer = holoscan::inference;
+
+namespace {
+
+constexpr int kSize = 512;
+
+/// Previous max per channel, run on a copy of the inferred buffer
+void reference_max_per_channel(const std::vector<int>& dimensions,
+                               const HoloInfer::HostBuffer& inferred_result,
+                               std::vector<float>& processed_data) {
+  const float* inferred_data = inferred_result.data_as<float>();
+  std::vector<float> out_result(inferred_data, inferred_data + inferred_result.size());
+
+  const size_t rows = dimensions[1];
+  const size_t cols = dimensions[2];
+  const size_t out_channels = dimensions[3];
+  std::vector<unsigned int> max_x_per_channel(out_channels, 0);
+  std::vector<unsigned int> max_y_per_channel(out_channels, 0);
+  std::vector<float> max_value(out_channels, -1999);
+  for (unsigned int i = 0; i < rows; i++) {
+    for (unsigned int j = 0; j < cols; j++) {
+      for (unsigned int c = 1; c < out_channels; c++) {
+        float value = out_result[i * cols * out_channels + j * out_channels + c];
+        if (max_value[c] < value) {
+          max_value[c] = value;
+          max_x_per_channel[c] = i;
+          max_y_per_channel[c] = j;
+        }
+      }
+    }
+  }
+  for (unsigned int c = 0; c < out_channels; c++) {
+    processed_data[2 * c] = static_cast<float>(max_x_per_channel[c]) / static_cast<float>(rows);
+    processed_data[2 * c + 1] = static_cast<float>(max_y_per_channel[c]) / static_cast<float>(cols);
+  }
+}
+
+template <typename Process>
+double run_us_per_frame(size_t num_frames, Process&& process) {
+  process();  // warm-up, starts the worker threads
+  const auto start = std::chrono::steady_clock::now();
+  for (size_t frame = 0; frame < num_frames; frame++) { process(); }
+  const auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::micro>(end - start).count() / num_frames;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const size_t num_frames = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 100;
+  if (num_frames == 0) { return 1; }
+
+  std::printf("%zu frames\n", num_frames);
+  std::printf("%-20s %16s %16s %10s\n", "output", "previous (us)", "current (us)", "speedup");
+
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<float> distribution(-10.f, 10.f);
+  int failures = 0;
+  for (int channels : {2, 4, 8, 16}) {
+    HoloInfer::DataMap inferred_result_map = {
+        {"landmarks", std::make_shared<HoloInfer::DataBuffer>()}};
+    std::map<std::string, std::vector<int>> dims = {{"landmarks", {1, kSize, kSize, channels}}};
+    auto& inferred_result = inferred_result_map.at("landmarks")->host_buffer;
+    inferred_result.resize(kSize * kSize * channels);
+    std::generate_n(inferred_result.data_as<float>(), inferred_result.size(), [&]() {
+      return distribution(generator);
+    });
+
+    std::vector<float> expected(2 * channels);
+    const double previous_us = run_us_per_frame(num_frames, [&]() {
+      reference_max_per_channel(dims.at("landmarks"), inferred_result, expected);
+    });
+
+    HoloInfer::ProcessorContext processor;
+    HoloInfer::MultiMappings tensor_oper_map = {{"landmarks", {"max_per_channel_scaled"}}};
+    HoloInfer::Mappings in_out_tensor_map = {{"landmarks", "landmarks_scaled"}};
+    auto status = processor.initialize(tensor_oper_map);
+    const double current_us = run_us_per_frame(num_frames, [&]() {
+      if (status.get_code() == HoloInfer::holoinfer_code::H_SUCCESS) {
+        status = processor.process(tensor_oper_map, in_out_tensor_map, inferred_result_map, dims);
+      }
+    });
+
+    const std::string name =
+        std::to_string(kSize) + "x" + std::to_string(kSize) + "x" + std::to_string(channels);
+    std::printf("%-20s %16.1f %16.1f %9.2fx\n",
+                name.c_str(),
+                previous_us,
+                current_us,
+                previous_us / current_us);
+
+    const auto& processed = processor.get_processed_data().at("landmarks_scaled")->host_buffer;
+    if (status.get_code() != HoloInfer::holoinfer_code::H_SUCCESS ||
+        !std::equal(expected.begin(), expected.end(), processed.data_as<float>())) {
+      std::printf("FAILED: %s, results differ from the previous implementation\n", name.c_str());
+      failures++;
+    }
+  }
+
+  return failures == 0 ? 0 : 1;
+}
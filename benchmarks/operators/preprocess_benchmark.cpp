@@ -0,0 +1,120 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Measures the preprocessing of a 1080p RGBA image for a 640x640 network input with a CHW float
+// layout, for each resize mode:
+//
+// 1. The chain of the host conversions of FormatConverterOp (resize, RGBA to float RGB with
+//    normalization) followed by the HWC to CHW transpose, with the intermediate images.
+// 2. The fused conversion of PreprocessorOp, in a single pass over the input.
+//
+// Both run on the calling thread.
+//
+// Usage: PREPROCESS_BENCHMARK [num_frames]
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "holoscan/operators/format_converter/format_converter_cpu.hpp"
+
+namespace format_converter = holoscan::ops::format_converter;
+
+namespace {
+
+template <typename Convert>
+double run_us_per_frame(size_t num_frames, Convert&& convert) {
+  convert();  // warm-up
+  const auto start = std::chrono::steady_clock::now();
+  for (size_t frame = 0; frame < num_frames; frame++) { convert(); }
+  const auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::micro>(end - start).count() / num_frames;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const size_t num_frames = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 100;
+  if (num_frames == 0) { return 1; }
+
+  constexpr int32_t kRows = 1080;
+  constexpr int32_t kColumns = 1920;
+  constexpr int32_t kSize = 640;
+  constexpr size_t kPixels = static_cast<size_t>(kSize) * kSize;
+
+  std::vector<uint8_t> rgba(static_cast<size_t>(kRows) * kColumns * 4);
+  for (size_t i = 0; i < rgba.size(); i++) { rgba[i] = static_cast<uint8_t>(i * 7 % 251); }
+  std::vector<uint8_t> resized(kPixels * 4);
+  std::vector<float> scaled(kPixels * 3);
+  std::vector<float> chw(kPixels * 3);
+
+  const int32_t order[3] = {0, 1, 2};
+  const float mean[3] = {0.485f, 0.456f, 0.406f};
+  const float std_dev[3] = {0.229f, 0.224f, 0.225f};
+  float factors[3];
+  float offsets[3];
+  for (int32_t c = 0; c < 3; c++) {
+    factors[c] = 1.f / 255.f / std_dev[c];
+    offsets[c] = -mean[c] / std_dev[c];
+  }
+
+  std::printf("%zu frames, 1 thread\n", num_frames);
+  std::printf("%-12s %16s %16s %10s\n", "resize mode", "chained (us)", "fused (us)", "speedup");
+
+  const struct {
+    const char* name;
+    int32_t mode;
+  } modes[] = {{"nearest", 1}, {"linear", 2}, {"cubic", 4}};
+  for (const auto& mode : modes) {
+    const double chained_us = run_us_per_frame(num_frames, [&]() {
+      format_converter::cpu_resize(
+          rgba.data(), kRows, kColumns, 4, resized.data(), kSize, kSize, mode.mode);
+      format_converter::cpu_scale(
+          resized.data(), 4, scaled.data(), 3, kSize, kSize, order, 0.f, 1.f);
+      for (size_t i = 0; i < kPixels; i++) {
+        for (size_t c = 0; c < 3; c++) {
+          chw[c * kPixels + i] = (scaled[i * 3 + c] - mean[c]) / std_dev[c];
+        }
+      }
+    });
+    const double fused_us = run_us_per_frame(num_frames, [&]() {
+      format_converter::cpu_preprocess(rgba.data(),
+                                       kRows,
+                                       kColumns,
+                                       4,
+                                       chw.data(),
+                                       kSize,
+                                       kSize,
+                                       3,
+                                       order,
+                                       factors,
+                                       offsets,
+                                       true,
+                                       mode.mode);
+    });
+
+    std::printf("%-12s %16.1f %16.1f %9.2fx\n",
+                mode.name,
+                chained_us,
+                fused_us,
+                chained_us / fused_us);
+  }
+
+  return 0;
+}
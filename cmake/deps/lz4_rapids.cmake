@@ -0,0 +1,40 @@
+# SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+
+# https://docs.rapids.ai/api/rapids-cmake/stable/command/rapids_find_package.html#
+include(${rapids-cmake-dir}/cpm/find.cmake)
+
+rapids_cpm_find(lz4 1.9.4
+    GLOBAL_TARGETS LZ4::lz4
+
+    CPM_ARGS
+
+    GITHUB_REPOSITORY lz4/lz4
+    GIT_TAG v1.9.4
+    SOURCE_SUBDIR build/cmake
+    OPTIONS
+    "BUILD_STATIC_LIBS ON"
+    "LZ4_BUILD_CLI OFF"
+    "LZ4_BUILD_LEGACY_LZ4C OFF"
+    "LZ4_POSITION_INDEPENDENT_LIB ON"
+    EXCLUDE_FROM_ALL
+)
+
+if(lz4_ADDED)
+    # lz4 is linked statically so we do not need to install it.
+    target_include_directories(lz4_static INTERFACE $<BUILD_INTERFACE:${lz4_SOURCE_DIR}/lib>)
+    add_library(LZ4::lz4 ALIAS lz4_static)
+endif()
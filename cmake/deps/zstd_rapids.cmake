@@ -0,0 +1,45 @@
+# SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+
+# https://docs.rapids.ai/api/rapids-cmake/stable/command/rapids_find_package.html#
+include(${rapids-cmake-dir}/cpm/find.cmake)
+
+rapids_cpm_find(zstd 1.5.5
+    GLOBAL_TARGETS zstd::zstd
+
+    CPM_ARGS
+
+    GITHUB_REPOSITORY facebook/zstd
+    GIT_TAG v1.5.5
+    SOURCE_SUBDIR build/cmake
+    OPTIONS
+    "ZSTD_BUILD_PROGRAMS OFF"
+    "ZSTD_BUILD_TESTS OFF"
+    "ZSTD_BUILD_CONTRIB OFF"
+    "ZSTD_BUILD_SHARED OFF"
+    "ZSTD_BUILD_STATIC ON"
+    "ZSTD_LEGACY_SUPPORT OFF"
+    "ZSTD_MULTITHREAD_SUPPORT OFF"
+    EXCLUDE_FROM_ALL
+)
+
+if(zstd_ADDED)
+    set_target_properties(libzstd_static PROPERTIES POSITION_INDEPENDENT_CODE ON)
+
+    # zstd is linked statically so we do not need to install it.
+    target_include_directories(libzstd_static INTERFACE $<BUILD_INTERFACE:${zstd_SOURCE_DIR}/lib>)
+    add_library(zstd::zstd ALIAS libzstd_static)
+endif()
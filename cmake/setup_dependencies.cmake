@@ -87,6 +87,8 @@ superbuild_depend(glfw_rapids)
 superbuild_depend(glad_rapids)
 superbuild_depend(tensorrt)
 superbuild_depend(ajantv2_rapids)
+superbuild_depend(lz4_rapids)
+superbuild_depend(zstd_rapids)
 
 # Testing dependencies
 if(HOLOSCAN_BUILD_TESTS)
@@ -18,6 +18,7 @@
 
 #include <cuda_runtime.h>
 
+#include <algorithm>
 #include <iostream>
 
 #include "bayer_demosaic.hpp"
@@ -50,7 +51,8 @@ gxf_result_t BayerDemosaic::registerInterface(nvidia::gxf::Registrar* registrar)
     "Name of the output tensor.", std::string(""));
   result &= registrar->parameter(pool_, "pool", "Pool", "Pool to allocate the output message.");
   result &= registrar->parameter(cuda_stream_pool_, "cuda_stream_pool", "CUDA Stream Pool",
-                                                    "CUDA Stream pool to create CUDA streams.");
+    "CUDA Stream pool to create CUDA streams. Only needed for images in device memory.",
+    gxf::Registrar::NoDefaultParameter(), GXF_PARAMETER_FLAGS_OPTIONAL);
   result &= registrar->parameter(bayer_interp_mode_, "interpolation_mode",
     "Interpolation used for demosaicing",
     "The interpolation model to be used for demosaicing (default UNDEFINED). Values available at:"
@@ -64,13 +66,16 @@ gxf_result_t BayerDemosaic::registerInterface(nvidia::gxf::Registrar* registrar)
     "Generate alpha channel.", false);
   result &= registrar->parameter(alpha_value_, "alpha_value", "Alpha value to be generated",
     "Alpha value to be generated if `generate_alpha` is set to `true` (default `255`).", 255);
+  result &= registrar->parameter(num_threads_, "num_threads", "NumThreads",
+    "Number of threads demosaicing the rows of images in host memory (default `1`).", 1u);
   return nvidia::gxf::ToResultCode(result);
 }
 
 gxf_result_t BayerDemosaic::initialize() {
   // create a CUDA stream from the CUDA stream pool
-  if (!cuda_stream_) {
-    auto maybe_stream = cuda_stream_pool_.get()->allocateStream();
+  const auto cuda_stream_pool = cuda_stream_pool_.try_get();
+  if (cuda_stream_pool && !cuda_stream_) {
+    auto maybe_stream = cuda_stream_pool.value()->allocateStream();
     if (!maybe_stream) {
       GXF_LOG_ERROR("Failed to allocate CUDA stream");
       return gxf::ToResultCode(maybe_stream);
@@ -78,17 +83,26 @@ gxf_result_t BayerDemosaic::initialize() {
     cuda_stream_ = std::move(maybe_stream.value());
   }
 
-  // assign the CUDA stream to the NPP stream context
+  // Without NPP, images in host memory are demosaiced on the CPU
   auto nppStatus = nppGetStreamContext(&npp_stream_ctx_);
-  if (NPP_SUCCESS != nppStatus) {
-    GXF_LOG_ERROR("Failed to get NPP cuda stream context");
-    return GXF_FAILURE;
+  has_npp_ = NPP_SUCCESS == nppStatus;
+  if (!has_npp_) {
+    GXF_LOG_WARNING(
+        "Failed to get NPP cuda stream context, only images in host memory can be demosaiced");
+  } else if (cuda_stream_) {
+    // assign the CUDA stream to the NPP stream context
+    npp_stream_ctx_.hStream = cuda_stream_->stream().value();
   }
-  npp_stream_ctx_.hStream = cuda_stream_->stream().value();
 
   npp_bayer_interp_mode_ = static_cast<NppiInterpolationMode>(bayer_interp_mode_.get());
   npp_bayer_grid_pos_ = static_cast<NppiBayerGridPosition>(bayer_grid_pos_.get());
 
+  if (!ParseBayerGridPosition(bayer_grid_pos_.get(), &grid_position_)) {
+    GXF_LOG_ERROR("Unsupported Bayer grid position: %d", bayer_grid_pos_.get());
+    return GXF_FAILURE;
+  }
+  has_cpu_interpolation_ = ParseBayerInterpolation(bayer_interp_mode_.get(), &interpolation_);
+
   return GXF_SUCCESS;
 }
 
@@ -97,11 +111,13 @@ gxf_result_t BayerDemosaic::deinitialize() {
 }
 
 gxf_result_t BayerDemosaic::start() {
+  row_worker_pool_ = std::make_unique<RowWorkerPool>(num_threads_.get());
   return GXF_SUCCESS;
 }
 
 gxf_result_t BayerDemosaic::stop() {
   device_scratch_buffer_.freeBuffer();
+  row_worker_pool_.reset();
   return GXF_SUCCESS;
 }
 
@@ -120,6 +136,7 @@ gxf_result_t BayerDemosaic::tick() {
   auto input_memory_type = gxf::MemoryStorageType::kHost;
   gxf::PrimitiveType element_type = gxf::PrimitiveType::kCustom;
   uint32_t element_size = gxf::PrimitiveTypeSize(element_type);
+  size_t input_pitch = 0;
 
   // get tensor attached to message by the name defined in the parameters
   auto maybe_video = in_message.value().get<gxf::VideoBuffer>();
@@ -152,26 +169,7 @@ gxf_result_t BayerDemosaic::tick() {
     element_size = gxf::PrimitiveTypeSize(element_type);
     input_memory_type = frame->storage_type();
     input_data_ptr = frame->pointer();
-
-    // if the input tensor is not coming from device then move it to device
-    if (input_memory_type != gxf::MemoryStorageType::kDevice) {
-      size_t buffer_size = rows * columns * in_channels * element_size;
-
-      if (buffer_size > device_scratch_buffer_.size()) {
-        device_scratch_buffer_.resize(pool_, buffer_size, gxf::MemoryStorageType::kDevice);
-        if (!device_scratch_buffer_.pointer()) {
-          GXF_LOG_ERROR("Failed to allocate device scratch buffer (%d bytes)", buffer_size);
-          return GXF_FAILURE;
-        }
-      }
-
-      CUDA_TRY(cudaMemcpy(
-        static_cast<void *>(device_scratch_buffer_.pointer()),
-        static_cast<const void *>(frame->pointer()),
-        buffer_size,
-        cudaMemcpyHostToDevice));
-      input_data_ptr = device_scratch_buffer_.pointer();
-    }
+    input_pitch = buffer_info.color_planes[0].stride;
   } else {
     const auto maybe_tensor = in_message.value().get<gxf::Tensor>(in_tensor_name_.get().c_str());
     if (!maybe_tensor) {
@@ -189,10 +187,53 @@ gxf_result_t BayerDemosaic::tick() {
     element_type = in_tensor->element_type();
     element_size = gxf::PrimitiveTypeSize(element_type);
     input_memory_type = in_tensor->storage_type();
+    input_pitch = columns * in_channels * element_size;
   }
 
   int16_t out_channels = 3 + generate_alpha_;
 
+  // Images in host (pinned or system) memory are copied to the device for NPP, except for the
+  // interpolations only implemented on the CPU. Without NPP they are demosaiced on the CPU, without
+  // copies to the device, and the output is allocated in the same memory as the input.
+  const bool use_npp = has_npp_ && !(has_cpu_interpolation_ &&
+                                     interpolation_ == BayerInterpolation::kGradientCorrected);
+  if (input_memory_type != gxf::MemoryStorageType::kDevice && use_npp) {
+    const size_t buffer_size = rows * input_pitch;
+
+    if (buffer_size > device_scratch_buffer_.size()) {
+      device_scratch_buffer_.resize(pool_, buffer_size, gxf::MemoryStorageType::kDevice);
+      if (!device_scratch_buffer_.pointer()) {
+        GXF_LOG_ERROR("Failed to allocate device scratch buffer (%zu bytes)", buffer_size);
+        return GXF_FAILURE;
+      }
+    }
+
+    if (CUDA_TRY(cudaMemcpy(
+          static_cast<void *>(device_scratch_buffer_.pointer()),
+          static_cast<const void *>(input_data_ptr),
+          buffer_size,
+          cudaMemcpyHostToDevice)) != cudaSuccess) {
+      return GXF_FAILURE;
+    }
+    input_data_ptr = device_scratch_buffer_.pointer();
+    input_memory_type = gxf::MemoryStorageType::kDevice;
+  }
+  const bool is_host_input = input_memory_type != gxf::MemoryStorageType::kDevice;
+  if (is_host_input) {
+    if (in_channels != 1) {
+      GXF_LOG_ERROR("Expected a single channel Bayer image, got %d channels", in_channels);
+      return GXF_FAILURE;
+    }
+    if (!has_cpu_interpolation_) {
+      GXF_LOG_ERROR("Unsupported interpolation mode for images in host memory: %d",
+                    bayer_interp_mode_.get());
+      return GXF_FAILURE;
+    }
+  } else if (!has_npp_) {
+    GXF_LOG_ERROR("Images in device memory can't be demosaiced without NPP");
+    return GXF_FAILURE;
+  }
+
   if (element_type != gxf::PrimitiveType::kUnsigned8 &&
       element_type != gxf::PrimitiveType::kUnsigned16) {
     GXF_LOG_ERROR("Unexpected bytes in element representation %d (size %d)", element_type,
@@ -206,7 +247,7 @@ gxf_result_t BayerDemosaic::tick() {
     pool_,
     {{
       out_tensor_name_.get(),
-      gxf::MemoryStorageType::kDevice,
+      is_host_input ? input_memory_type : gxf::MemoryStorageType::kDevice,
       gxf::Shape{rows, columns, out_channels},
       element_type,
       0,
@@ -227,17 +268,37 @@ gxf_result_t BayerDemosaic::tick() {
   }
 
   void* output_data_ptr = maybe_output_tensor.value()->pointer();
+  const size_t output_pitch = columns * out_channels * element_size;
+
+  if (is_host_input) {
+    row_worker_pool_->run(rows, [&](size_t begin_row, size_t end_row) {
+      if (element_type == gxf::PrimitiveType::kUnsigned8) {
+        DemosaicBayer(static_cast<const uint8_t*>(input_data_ptr), input_pitch,
+                      static_cast<uint8_t*>(output_data_ptr), output_pitch, columns, rows,
+                      begin_row, end_row, grid_position_, interpolation_, out_channels,
+                      static_cast<uint8_t>(std::clamp(alpha_value_.get(), 0, 255)));
+      } else {
+        DemosaicBayer(static_cast<const uint16_t*>(input_data_ptr), input_pitch,
+                      static_cast<uint16_t*>(output_data_ptr), output_pitch, columns, rows,
+                      begin_row, end_row, grid_position_, interpolation_, out_channels,
+                      static_cast<uint16_t>(std::clamp(alpha_value_.get(), 0, 65535)));
+      }
+    });
+
+    const auto result = transmitter_->publish(out_message.value());
+    return gxf::ToResultCode(result);
+  }
 
   // NPP to demosaic
   if (element_type == gxf::PrimitiveType::kUnsigned8) {
     if (generate_alpha_) {
       nppiCFAToRGBA_8u_C1AC4R_Ctx(
         static_cast<const Npp8u*>(input_data_ptr),
-        columns * in_channels * element_size,
+        input_pitch,
         {static_cast<int>(columns), static_cast<int>(rows)},
         {0, 0, static_cast<int>(columns), static_cast<int>(rows)},
         static_cast<Npp8u*>(output_data_ptr),
-        columns * out_channels * element_size,
+        output_pitch,
         npp_bayer_grid_pos_,
         npp_bayer_interp_mode_,
         alpha_value_,
@@ -245,11 +306,11 @@ gxf_result_t BayerDemosaic::tick() {
     } else {
       nppiCFAToRGB_8u_C1C3R_Ctx(
         static_cast<const Npp8u*>(input_data_ptr),
-        columns * in_channels * element_size,
+        input_pitch,
         {static_cast<int>(columns), static_cast<int>(rows)},
         {0, 0, static_cast<int>(columns), static_cast<int>(rows)},
         static_cast<Npp8u*>(output_data_ptr),
-        columns * out_channels * element_size,
+        output_pitch,
         npp_bayer_grid_pos_,
         npp_bayer_interp_mode_,
         npp_stream_ctx_);
@@ -258,11 +319,11 @@ gxf_result_t BayerDemosaic::tick() {
     if (generate_alpha_) {
       nppiCFAToRGBA_16u_C1AC4R_Ctx(
         static_cast<const Npp16u*>(input_data_ptr),
-        columns * in_channels * element_size,
+        input_pitch,
         {static_cast<int>(columns), static_cast<int>(rows)},
         {0, 0, static_cast<int>(columns), static_cast<int>(rows)},
         static_cast<Npp16u*>(output_data_ptr),
-        columns * out_channels * element_size,
+        output_pitch,
         npp_bayer_grid_pos_,
         npp_bayer_interp_mode_,
         alpha_value_,
@@ -270,11 +331,11 @@ gxf_result_t BayerDemosaic::tick() {
     } else {
       nppiCFAToRGB_16u_C1C3R_Ctx(
         static_cast<const Npp16u*>(input_data_ptr),
-        columns * in_channels * element_size,
+        input_pitch,
         {static_cast<int>(columns), static_cast<int>(rows)},
         {0, 0, static_cast<int>(columns), static_cast<int>(rows)},
         static_cast<Npp16u*>(output_data_ptr),
-        columns * out_channels * element_size,
+        output_pitch,
         npp_bayer_grid_pos_,
         npp_bayer_interp_mode_,
         npp_stream_ctx_);
@@ -22,6 +22,7 @@
 
 #include <npp.h>
 
+#include <memory>
 #include <string>
 
 #include "gxf/core/entity.hpp"
@@ -31,12 +32,21 @@
 #include "gxf/cuda/cuda_stream_pool.hpp"
 #include "gxf/std/allocator.hpp"
 #include "gxf/std/codelet.hpp"
+#include "gxf/std/memory_buffer.hpp"
 #include "gxf/std/receiver.hpp"
 #include "gxf/std/transmitter.hpp"
-#include "gxf/std/memory_buffer.hpp"
+
+#include "../utils/row_worker_pool.hpp"
+#include "bayer_to_rgb.hpp"
 
 namespace nvidia::holoscan {
 
+/// @brief Demosaics Bayer images to RGB or RGBA.
+///
+/// Images are demosaiced with NPP, images in host memory are first copied to the device. Without
+/// NPP, or with the gradient-corrected interpolation that NPP does not implement, images in host
+/// memory are demosaiced on the CPU by `num_threads` threads, without copies to the device, and the
+/// output is allocated in the same memory as the input. The CUDA stream pool is optional.
 class BayerDemosaic : public gxf::Codelet {
  public:
   gxf_result_t registerInterface(gxf::Registrar* registrar) override;
@@ -58,14 +68,20 @@ class BayerDemosaic : public gxf::Codelet {
   gxf::Parameter<int> bayer_grid_pos_;
   gxf::Parameter<bool> generate_alpha_;
   gxf::Parameter<int> alpha_value_;
+  gxf::Parameter<uint32_t> num_threads_;
 
   gxf::Handle<gxf::CudaStream> cuda_stream_;
   NppStreamContext npp_stream_ctx_{};
+  bool has_npp_ = false;
+  gxf::MemoryBuffer device_scratch_buffer_;
 
   NppiInterpolationMode npp_bayer_interp_mode_;
   NppiBayerGridPosition npp_bayer_grid_pos_;
 
-  gxf::MemoryBuffer device_scratch_buffer_;
+  BayerGridPosition grid_position_ = BayerGridPosition::kGBRG;
+  BayerInterpolation interpolation_ = BayerInterpolation::kBilinear;
+  bool has_cpu_interpolation_ = false;
+  std::unique_ptr<RowWorkerPool> row_worker_pool_;
 };
 
 }  // namespace nvidia::holoscan
@@ -0,0 +1,272 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "bayer_to_rgb.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include "../utils/cpu_dispatch.hpp"
+
+namespace nvidia {
+namespace holoscan {
+
+namespace {
+
+// Samples read on each side of a pixel, the 5x5 neighborhood of the gradient-corrected
+// interpolation
+constexpr uint32_t kBorder = 2;
+constexpr uint32_t kWindow = 2 * kBorder + 1;
+
+/// Index of the sample at `index` of [0, size) mirrored at the borders, without repeating the
+/// border sample so that the parity of the index, and the Bayer pattern, are kept
+int64_t Mirror(int64_t index, int64_t size) {
+  if (size == 1) { return 0; }
+  while (index < 0 || index >= size) { index = index < 0 ? -index : 2 * size - 2 - index; }
+  return index;
+}
+
+/// Widens a row to 32 bit and mirrors kBorder samples on each side, `out` has
+/// width + 2 * kBorder samples
+template <typename T>
+HOLOSCAN_TARGET_CLONES
+void LoadRow(const T* __restrict in, uint32_t width, int32_t* __restrict out) {
+  for (size_t x = 0; x < width; x++) { out[kBorder + x] = in[x]; }
+  for (uint32_t i = 1; i <= kBorder; i++) {
+    out[kBorder - i] = in[Mirror(-static_cast<int64_t>(i), width)];
+    out[kBorder + width - 1 + i] = in[Mirror(width - 1 + i, width)];
+  }
+}
+
+/// Interpolates the colors of a row from the padded rows y - 2 to y + 2.
+///
+/// The pixels of the row are green or `a`, the color of the row (red or blue), `o` is the third
+/// color. The `a` pixels are the ones with a column parity of `a_parity`. Each kind of pixel is
+/// interpolated by its own loop over every other column, without branches.
+template <bool kGradientCorrected>
+HOLOSCAN_TARGET_CLONES
+void InterpolateRow(const int32_t* const* rows, uint32_t width, uint32_t a_parity,
+                    int32_t max_value, int32_t* __restrict a, int32_t* __restrict g,
+                    int32_t* __restrict o) {
+  // Malvar, He and Cutler filters are scaled by 16, the Laplacian of the center color corrects
+  // the bilinear interpolation
+  auto to_value = [max_value](int32_t value) {
+    return std::min(std::max(value + 8, 0) >> 4, max_value);
+  };
+
+  for (uint32_t parity = 0; parity < 2; parity++) {
+    const bool is_a = parity == a_parity;
+    // signed index, the neighbors of the first pixel are at negative offsets
+    const int32_t count = static_cast<int32_t>((width - parity + 1) / 2);
+    const int32_t* __restrict m2 = rows[0] + kBorder + parity;
+    const int32_t* __restrict m1 = rows[1] + kBorder + parity;
+    const int32_t* __restrict c0 = rows[2] + kBorder + parity;
+    const int32_t* __restrict p1 = rows[3] + kBorder + parity;
+    const int32_t* __restrict p2 = rows[4] + kBorder + parity;
+    int32_t* __restrict a_out = a + parity;
+    int32_t* __restrict g_out = g + parity;
+    int32_t* __restrict o_out = o + parity;
+
+    if (is_a) {
+      for (int32_t i = 0; i < count; i++) {
+        const int32_t x = 2 * i;
+        const int32_t center = c0[x];
+        const int32_t cross = c0[x - 1] + c0[x + 1] + m1[x] + p1[x];
+        const int32_t diagonal = m1[x - 1] + m1[x + 1] + p1[x - 1] + p1[x + 1];
+        a_out[x] = center;
+        if (kGradientCorrected) {
+          const int32_t ring2 = c0[x - 2] + c0[x + 2] + m2[x] + p2[x];
+          g_out[x] = to_value(8 * center + 4 * cross - 2 * ring2);
+          o_out[x] = to_value(12 * center + 4 * diagonal - 3 * ring2);
+        } else {
+          g_out[x] = (cross + 2) >> 2;
+          o_out[x] = (diagonal + 2) >> 2;
+        }
+      }
+    } else {
+      for (int32_t i = 0; i < count; i++) {
+        const int32_t x = 2 * i;
+        const int32_t center = c0[x];
+        const int32_t horizontal = c0[x - 1] + c0[x + 1];
+        const int32_t vertical = m1[x] + p1[x];
+        g_out[x] = center;
+        if (kGradientCorrected) {
+          const int32_t horizontal2 = c0[x - 2] + c0[x + 2];
+          const int32_t vertical2 = m2[x] + p2[x];
+          const int32_t diagonal = m1[x - 1] + m1[x + 1] + p1[x - 1] + p1[x + 1];
+          a_out[x] = to_value(10 * center + 8 * horizontal + vertical2 - 2 * horizontal2 -
+                              2 * diagonal);
+          o_out[x] = to_value(10 * center + 8 * vertical + horizontal2 - 2 * vertical2 -
+                              2 * diagonal);
+        } else {
+          a_out[x] = (horizontal + 1) >> 1;
+          o_out[x] = (vertical + 1) >> 1;
+        }
+      }
+    }
+  }
+}
+
+/// Interleaves the interpolated colors of a row
+template <typename T>
+HOLOSCAN_TARGET_CLONES
+void StoreRow(const int32_t* __restrict r, const int32_t* __restrict g,
+              const int32_t* __restrict b, uint32_t width, uint32_t channels, T alpha,
+              T* __restrict out) {
+  if (channels == 4 && sizeof(T) == 1) {
+    // each pixel is written as one 32 bit little endian word, so that the loop vectorizes with
+    // 32 bit lanes
+    uint32_t* __restrict pixels = reinterpret_cast<uint32_t*>(out);
+    const uint32_t alpha_bits = static_cast<uint32_t>(alpha) << 24;
+    for (size_t x = 0; x < width; x++) {
+      pixels[x] = static_cast<uint32_t>(r[x]) | (static_cast<uint32_t>(g[x]) << 8) |
+                  (static_cast<uint32_t>(b[x]) << 16) | alpha_bits;
+    }
+  } else if (channels == 4) {
+    for (size_t x = 0; x < width; x++) {
+      out[4 * x] = static_cast<T>(r[x]);
+      out[4 * x + 1] = static_cast<T>(g[x]);
+      out[4 * x + 2] = static_cast<T>(b[x]);
+      out[4 * x + 3] = alpha;
+    }
+  } else {
+    for (size_t x = 0; x < width; x++) {
+      out[3 * x] = static_cast<T>(r[x]);
+      out[3 * x + 1] = static_cast<T>(g[x]);
+      out[3 * x + 2] = static_cast<T>(b[x]);
+    }
+  }
+}
+
+template <typename T>
+void Demosaic(const T* bayer, size_t bayer_pitch, T* rgb, size_t rgb_pitch, uint32_t width,
+              uint32_t height, uint32_t begin_row, uint32_t end_row, BayerGridPosition position,
+              BayerInterpolation interpolation, uint32_t channels, T alpha) {
+  end_row = std::min(end_row, height);
+  if (width == 0 || begin_row >= end_row) { return; }
+
+  // row and column parity of the red pixels, the blue ones have the other parities
+  uint32_t red_row = 0;
+  uint32_t red_column = 0;
+  switch (position) {
+    case BayerGridPosition::kBGGR:
+      red_row = 1;
+      red_column = 1;
+      break;
+    case BayerGridPosition::kRGGB:
+      break;
+    case BayerGridPosition::kGBRG:
+      red_row = 1;
+      break;
+    case BayerGridPosition::kGRBG:
+      red_column = 1;
+      break;
+  }
+
+  // kWindow padded rows, a ring of the input rows around the output row, and the three
+  // interpolated colors of the output row. The buffer is kept by each thread between frames.
+  const size_t padded_width = width + 2 * kBorder;
+  thread_local std::vector<int32_t> scratch;
+  scratch.resize(kWindow * padded_width + 3 * width);
+  int32_t* rows[kWindow];
+  for (uint32_t i = 0; i < kWindow; i++) { rows[i] = scratch.data() + i * padded_width; }
+  int32_t* const a = scratch.data() + kWindow * padded_width;
+  int32_t* const g = a + width;
+  int32_t* const o = g + width;
+
+  auto load_row = [&](int64_t row, int32_t* out) {
+    const auto* in = reinterpret_cast<const uint8_t*>(bayer) + Mirror(row, height) * bayer_pitch;
+    LoadRow(reinterpret_cast<const T*>(in), width, out);
+  };
+  for (uint32_t i = 0; i < kWindow; i++) {
+    load_row(static_cast<int64_t>(begin_row) + i - kBorder, rows[i]);
+  }
+
+  const int32_t max_value = std::numeric_limits<T>::max();
+  for (uint32_t row = begin_row; row < end_row; row++) {
+    if (row != begin_row) {
+      // slide the window down by one row
+      int32_t* const first = rows[0];
+      std::copy(rows + 1, rows + kWindow, rows);
+      rows[kWindow - 1] = first;
+      load_row(static_cast<int64_t>(row) + kBorder, first);
+    }
+
+    const bool is_red_row = (row & 1) == red_row;
+    const uint32_t a_parity = is_red_row ? red_column : 1 - red_column;
+    if (interpolation == BayerInterpolation::kGradientCorrected) {
+      InterpolateRow<true>(rows, width, a_parity, max_value, a, g, o);
+    } else {
+      InterpolateRow<false>(rows, width, a_parity, max_value, a, g, o);
+    }
+
+    T* out = reinterpret_cast<T*>(reinterpret_cast<uint8_t*>(rgb) + row * rgb_pitch);
+    if (is_red_row) {
+      StoreRow(a, g, o, width, channels, alpha, out);
+    } else {
+      StoreRow(o, g, a, width, channels, alpha, out);
+    }
+  }
+}
+
+}  // namespace
+
+bool ParseBayerGridPosition(int value, BayerGridPosition* position) {
+  switch (value) {
+    case static_cast<int>(BayerGridPosition::kBGGR):
+    case static_cast<int>(BayerGridPosition::kRGGB):
+    case static_cast<int>(BayerGridPosition::kGBRG):
+    case static_cast<int>(BayerGridPosition::kGRBG):
+      *position = static_cast<BayerGridPosition>(value);
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool ParseBayerInterpolation(int value, BayerInterpolation* interpolation) {
+  switch (value) {
+    case 0:  // NPPI_INTER_UNDEFINED
+    case 2:  // NPPI_INTER_LINEAR
+      *interpolation = BayerInterpolation::kBilinear;
+      return true;
+    case 4:  // NPPI_INTER_CUBIC
+      *interpolation = BayerInterpolation::kGradientCorrected;
+      return true;
+    default:
+      return false;
+  }
+}
+
+void DemosaicBayer(const uint8_t* bayer, size_t bayer_pitch, uint8_t* rgb, size_t rgb_pitch,
+                   uint32_t width, uint32_t height, uint32_t begin_row, uint32_t end_row,
+                   BayerGridPosition position, BayerInterpolation interpolation,
+                   uint32_t channels, uint8_t alpha) {
+  Demosaic(bayer, bayer_pitch, rgb, rgb_pitch, width, height, begin_row, end_row, position,
+           interpolation, channels, alpha);
+}
+
+void DemosaicBayer(const uint16_t* bayer, size_t bayer_pitch, uint16_t* rgb, size_t rgb_pitch,
+                   uint32_t width, uint32_t height, uint32_t begin_row, uint32_t end_row,
+                   BayerGridPosition position, BayerInterpolation interpolation,
+                   uint32_t channels, uint16_t alpha) {
+  Demosaic(bayer, bayer_pitch, rgb, rgb_pitch, width, height, begin_row, end_row, position,
+           interpolation, channels, alpha);
+}
+
+}  // namespace holoscan
+}  // namespace nvidia
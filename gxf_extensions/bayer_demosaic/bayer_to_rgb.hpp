@@ -0,0 +1,79 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef NVIDIA_CLARA_HOLOSCAN_GXF_EXTENSIONS_BAYER_TO_RGB_HPP_
+#define NVIDIA_CLARA_HOLOSCAN_GXF_EXTENSIONS_BAYER_TO_RGB_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace nvidia {
+namespace holoscan {
+
+/// @brief Color of the first two pixels of the first two rows of a Bayer image, the values are the
+/// ones of NppiBayerGridPosition.
+enum class BayerGridPosition {
+  kBGGR = 0,
+  kRGGB = 1,
+  kGBRG = 2,
+  kGRBG = 3,
+};
+
+/// @brief Interpolation of the missing colors of a Bayer image.
+enum class BayerInterpolation {
+  /// Mean of the nearest pixels of the color, from a 3x3 neighborhood
+  kBilinear,
+  /// Bilinear interpolation corrected with the Laplacian of the color of the pixel, from a 5x5
+  /// neighborhood (Malvar, He and Cutler). The correction follows the edges of the image and
+  /// reduces the color fringes along them.
+  kGradientCorrected,
+};
+
+/// @brief Parses a Bayer grid position, a NppiBayerGridPosition value. Returns false if the value
+/// is not supported.
+bool ParseBayerGridPosition(int value, BayerGridPosition* position);
+
+/// @brief Parses an interpolation mode, a NppiInterpolationMode value: NPPI_INTER_UNDEFINED (0)
+/// and NPPI_INTER_LINEAR (2) select kBilinear, NPPI_INTER_CUBIC (4) selects kGradientCorrected.
+/// Returns false if the value is not supported.
+bool ParseBayerInterpolation(int value, BayerInterpolation* interpolation);
+
+/// @brief Demosaics rows [begin_row, end_row) of a Bayer image to RGB or RGBA.
+///
+/// The samples outside of the image are mirrored at the borders, which keeps the Bayer pattern.
+/// Uses integer arithmetic in loops vectorized by the compiler. On x86-64 the kernels are also
+/// compiled for AVX2 and selected at load time when the CPU supports it. Rows can be demosaiced
+/// concurrently, the rows around [begin_row, end_row) are read.
+///
+/// @param bayer Bayer image, `bayer_pitch` bytes per row
+/// @param rgb RGB or RGBA image, `rgb_pitch` bytes per row
+/// @param channels 3 (RGB) or 4 (RGBA)
+/// @param alpha Value of the alpha channel of RGBA images
+void DemosaicBayer(const uint8_t* bayer, size_t bayer_pitch, uint8_t* rgb, size_t rgb_pitch,
+                   uint32_t width, uint32_t height, uint32_t begin_row, uint32_t end_row,
+                   BayerGridPosition position, BayerInterpolation interpolation,
+                   uint32_t channels, uint8_t alpha);
+
+/// @brief DemosaicBayer() for 16-bit images
+void DemosaicBayer(const uint16_t* bayer, size_t bayer_pitch, uint16_t* rgb, size_t rgb_pitch,
+                   uint32_t width, uint32_t height, uint32_t begin_row, uint32_t end_row,
+                   BayerGridPosition position, BayerInterpolation interpolation,
+                   uint32_t channels, uint16_t alpha);
+
+}  // namespace holoscan
+}  // namespace nvidia
+
+#endif  // NVIDIA_CLARA_HOLOSCAN_GXF_EXTENSIONS_BAYER_TO_RGB_HPP_
@@ -283,6 +283,7 @@ gxf_result_t OperatorWrapper::start() {
     HOLOSCAN_LOG_ERROR("OperatorWrapper::start() - Operator is not set");
     return GXF_FAILURE;
   }
+  exec_context_ = std::make_unique<GXFExecutionContext>(context(), op_.get());
   op_->start();
   return GXF_SUCCESS;
 }
@@ -296,10 +297,13 @@ gxf_result_t OperatorWrapper::tick() {
 
   HOLOSCAN_LOG_TRACE("Calling operator: {}", op_->name());
 
-  GXFExecutionContext exec_context(context(), op_.get());
-  InputContext* op_input = exec_context.input();
-  OutputContext* op_output = exec_context.output();
-  op_->compute(*op_input, *op_output, exec_context);
+  if (!exec_context_) {
+    HOLOSCAN_LOG_ERROR("OperatorWrapper::tick() - Operator '{}' is not started", op_->name());
+    return GXF_FAILURE;
+  }
+  InputContext* op_input = exec_context_->input();
+  OutputContext* op_output = exec_context_->output();
+  op_->compute(*op_input, *op_output, *exec_context_);
 
   return GXF_SUCCESS;
 }
@@ -311,6 +315,7 @@ gxf_result_t OperatorWrapper::stop() {
     return GXF_FAILURE;
   }
   op_->stop();
+  exec_context_.reset();
   return GXF_SUCCESS;
 }
 
@@ -0,0 +1,146 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "crc32c.hpp"
+
+#include <array>
+#include <cstring>
+
+#if defined(__x86_64__)
+#include <nmmintrin.h>
+#elif defined(__aarch64__)
+#include <arm_acle.h>
+#include <asm/hwcap.h>
+#include <sys/auxv.h>
+#endif
+
+namespace nvidia::holoscan::stream_playback {
+
+namespace {
+
+// Reflected CRC-32C polynomial
+constexpr uint32_t kPolynomial = 0x82f63b78;
+
+// Lookup tables for slicing-by-8
+using Crc32cTables = std::array<std::array<uint32_t, 256>, 8>;
+
+Crc32cTables MakeTables() {
+  Crc32cTables tables;
+  for (uint32_t i = 0; i < 256; i++) {
+    uint32_t crc = i;
+    for (int bit = 0; bit < 8; bit++) { crc = (crc >> 1) ^ (kPolynomial & (0u - (crc & 1))); }
+    tables[0][i] = crc;
+  }
+  for (uint32_t i = 0; i < 256; i++) {
+    for (size_t t = 1; t < tables.size(); t++) {
+      tables[t][i] = (tables[t - 1][i] >> 8) ^ tables[0][tables[t - 1][i] & 0xff];
+    }
+  }
+  return tables;
+}
+
+uint32_t Crc32cSoftware(const uint8_t* data, size_t size, uint32_t crc) {
+  static const Crc32cTables tables = MakeTables();
+  while (size >= 8) {
+    uint64_t word;
+    std::memcpy(&word, data, sizeof(word));
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    word = __builtin_bswap64(word);
+#endif
+    word ^= crc;
+    crc = tables[7][word & 0xff] ^ tables[6][(word >> 8) & 0xff] ^
+          tables[5][(word >> 16) & 0xff] ^ tables[4][(word >> 24) & 0xff] ^
+          tables[3][(word >> 32) & 0xff] ^ tables[2][(word >> 40) & 0xff] ^
+          tables[1][(word >> 48) & 0xff] ^ tables[0][word >> 56];
+    data += 8;
+    size -= 8;
+  }
+  while (size-- > 0) { crc = (crc >> 8) ^ tables[0][(crc ^ *data++) & 0xff]; }
+  return crc;
+}
+
+#if defined(__x86_64__)
+
+__attribute__((target("sse4.2"))) uint32_t Crc32cHardware(const uint8_t* data, size_t size,
+                                                          uint32_t crc) {
+  uint64_t crc64 = crc;
+  while (size >= 8) {
+    uint64_t word;
+    std::memcpy(&word, data, sizeof(word));
+    crc64 = _mm_crc32_u64(crc64, word);
+    data += 8;
+    size -= 8;
+  }
+  crc = static_cast<uint32_t>(crc64);
+  while (size-- > 0) { crc = _mm_crc32_u8(crc, *data++); }
+  return crc;
+}
+
+bool DetectHardwareCrc32c() {
+  return __builtin_cpu_supports("sse4.2");
+}
+
+#elif defined(__aarch64__)
+
+__attribute__((target("+crc"))) uint32_t Crc32cHardware(const uint8_t* data, size_t size,
+                                                        uint32_t crc) {
+  while (size >= 8) {
+    uint64_t word;
+    std::memcpy(&word, data, sizeof(word));
+    crc = __crc32cd(crc, word);
+    data += 8;
+    size -= 8;
+  }
+  while (size-- > 0) { crc = __crc32cb(crc, *data++); }
+  return crc;
+}
+
+bool DetectHardwareCrc32c() {
+  return (getauxval(AT_HWCAP) & HWCAP_CRC32) != 0;
+}
+
+#else
+
+uint32_t Crc32cHardware(const uint8_t* data, size_t size, uint32_t crc) {
+  return Crc32cSoftware(data, size, crc);
+}
+
+bool DetectHardwareCrc32c() {
+  return false;
+}
+
+#endif
+
+}  // namespace
+
+uint32_t Crc32c(const void* data, size_t size, uint32_t crc) {
+  static const bool hardware = HasHardwareCrc32c();
+  const uint8_t* bytes = static_cast<const uint8_t*>(data);
+  crc = ~crc;
+  crc = hardware ? Crc32cHardware(bytes, size, crc) : Crc32cSoftware(bytes, size, crc);
+  return ~crc;
+}
+
+uint32_t Crc32cSlicingBy8(const void* data, size_t size, uint32_t crc) {
+  return ~Crc32cSoftware(static_cast<const uint8_t*>(data), size, ~crc);
+}
+
+bool HasHardwareCrc32c() {
+  static const bool hardware = DetectHardwareCrc32c();
+  return hardware;
+}
+
+}  // namespace nvidia::holoscan::stream_playback
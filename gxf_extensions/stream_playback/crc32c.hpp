@@ -0,0 +1,40 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef NVIDIA_CLARA_HOLOSCAN_GXF_EXTENSIONS_STREAM_PLAYBACK_CRC32C_HPP_
+#define NVIDIA_CLARA_HOLOSCAN_GXF_EXTENSIONS_STREAM_PLAYBACK_CRC32C_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace nvidia::holoscan::stream_playback {
+
+/// Computes the CRC-32C (Castagnoli) checksum of `size` bytes at `data`.
+///
+/// Pass the checksum of the preceding bytes as `crc` to checksum data in several parts.
+/// Uses the SSE4.2 or ARMv8 CRC32 instructions when the CPU supports them.
+uint32_t Crc32c(const void* data, size_t size, uint32_t crc = 0);
+
+/// Computes the CRC-32C checksum with the slicing-by-8 tables used when the CPU has no CRC32
+/// instructions.
+uint32_t Crc32cSlicingBy8(const void* data, size_t size, uint32_t crc = 0);
+
+/// Whether `Crc32c` uses the CRC32 instructions of the CPU
+bool HasHardwareCrc32c();
+
+}  // namespace nvidia::holoscan::stream_playback
+
+#endif  // NVIDIA_CLARA_HOLOSCAN_GXF_EXTENSIONS_STREAM_PLAYBACK_CRC32C_HPP_
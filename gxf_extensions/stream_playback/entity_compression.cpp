@@ -0,0 +1,248 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "entity_compression.hpp"
+
+#include <lz4.h>
+#include <zstd.h>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "common/logger.hpp"
+#include "crc32c.hpp"
+
+namespace nvidia::holoscan::stream_playback {
+
+namespace {
+
+// Zstandard contexts reused by each thread
+struct ZstdContexts {
+  ZSTD_CCtx* compression = nullptr;
+  ZSTD_DCtx* decompression = nullptr;
+
+  ~ZstdContexts() {
+    if (compression != nullptr) { ZSTD_freeCCtx(compression); }
+    if (decompression != nullptr) { ZSTD_freeDCtx(decompression); }
+  }
+};
+
+ZstdContexts& GetZstdContexts() {
+  thread_local ZstdContexts contexts;
+  return contexts;
+}
+
+}  // namespace
+
+gxf::Expected<CompressionMethod> ParseCompressionMethod(const std::string& name) {
+  if (name == "none") { return CompressionMethod::kNone; }
+  if (name == "lz4") { return CompressionMethod::kLz4; }
+  if (name == "zstd") { return CompressionMethod::kZstd; }
+  GXF_LOG_ERROR("Unsupported compression method '%s'", name.c_str());
+  return gxf::Unexpected{GXF_ARGUMENT_INVALID};
+}
+
+gxf_result_t MemoryEndpoint::write_abi(const void* data, size_t size, size_t* bytes_written) {
+  if (data == nullptr || bytes_written == nullptr) { return GXF_ARGUMENT_NULL; }
+  const auto* bytes = static_cast<const uint8_t*>(data);
+  buffer_.insert(buffer_.end(), bytes, bytes + size);
+  *bytes_written = size;
+  return GXF_SUCCESS;
+}
+
+gxf_result_t MemoryEndpoint::read_abi(void* data, size_t size, size_t* bytes_read) {
+  if (data == nullptr || bytes_read == nullptr) { return GXF_ARGUMENT_NULL; }
+  const size_t count = std::min(size, buffer_.size() - read_offset_);
+  std::memcpy(data, buffer_.data() + read_offset_, count);
+  read_offset_ += count;
+  *bytes_read = count;
+  return count == size ? GXF_SUCCESS : GXF_FAILURE;
+}
+
+void MemoryEndpoint::reset() {
+  buffer_.clear();
+  read_offset_ = 0;
+}
+
+gxf_result_t ChecksumEndpoint::write_abi(const void* data, size_t size, size_t* bytes_written) {
+  if (endpoint_ == nullptr) { return GXF_ARGUMENT_NULL; }
+  const gxf_result_t result = endpoint_->write_abi(data, size, bytes_written);
+  if (result == GXF_SUCCESS) {
+    checksum_ = Crc32c(data, *bytes_written, checksum_);
+    size_ += *bytes_written;
+  }
+  return result;
+}
+
+gxf_result_t ChecksumEndpoint::read_abi(void* data, size_t size, size_t* bytes_read) {
+  if (endpoint_ == nullptr) { return GXF_ARGUMENT_NULL; }
+  const gxf_result_t result = endpoint_->read_abi(data, size, bytes_read);
+  if (result == GXF_SUCCESS) {
+    checksum_ = Crc32c(data, *bytes_read, checksum_);
+    size_ += *bytes_read;
+  }
+  return result;
+}
+
+void ChecksumEndpoint::reset(gxf::Endpoint* endpoint) {
+  endpoint_ = endpoint;
+  size_ = 0;
+  checksum_ = 0;
+}
+
+WorkerPool::WorkerPool(size_t worker_count) {
+  workers_.reserve(worker_count);
+  for (size_t i = 0; i < worker_count; i++) { workers_.emplace_back([this]() { run(); }); }
+}
+
+WorkerPool::~WorkerPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+  }
+  work_cv_.notify_all();
+  for (auto& worker : workers_) { worker.join(); }
+}
+
+void WorkerPool::parallelFor(size_t count, const std::function<void(size_t)>& function) {
+  if (workers_.empty() || count <= 1) {
+    for (size_t i = 0; i < count; i++) { function(i); }
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    function_ = &function;
+    count_ = count;
+    next_ = 0;
+    pending_ = count;
+    generation_++;
+  }
+  work_cv_.notify_all();
+
+  runIterations();
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  done_cv_.wait(lock, [this]() { return pending_ == 0; });
+  function_ = nullptr;
+}
+
+void WorkerPool::run() {
+  uint64_t generation = 0;
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      work_cv_.wait(lock, [&]() { return stopping_ || generation_ != generation; });
+      if (stopping_) { return; }
+      generation = generation_;
+    }
+    runIterations();
+  }
+}
+
+void WorkerPool::runIterations() {
+  while (true) {
+    size_t index;
+    const std::function<void(size_t)>* function;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (next_ >= count_) { return; }
+      index = next_++;
+      function = function_;
+    }
+    (*function)(index);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (--pending_ == 0) { done_cv_.notify_all(); }
+    }
+  }
+}
+
+bool CompressChunk(CompressionMethod method, int32_t level, const uint8_t* src, size_t size,
+                   std::vector<uint8_t>& dst) {
+  switch (method) {
+    case CompressionMethod::kLz4: {
+      if (size > static_cast<size_t>(LZ4_MAX_INPUT_SIZE)) { return false; }
+      dst.resize(LZ4_compressBound(static_cast<int>(size)));
+      const int compressed = LZ4_compress_default(reinterpret_cast<const char*>(src),
+                                                  reinterpret_cast<char*>(dst.data()),
+                                                  static_cast<int>(size),
+                                                  static_cast<int>(dst.size()));
+      if (compressed <= 0 || static_cast<size_t>(compressed) >= size) { return false; }
+      dst.resize(compressed);
+      return true;
+    }
+    case CompressionMethod::kZstd: {
+      auto& contexts = GetZstdContexts();
+      if (contexts.compression == nullptr) { contexts.compression = ZSTD_createCCtx(); }
+      if (contexts.compression == nullptr) { return false; }
+      dst.resize(ZSTD_compressBound(size));
+      const size_t compressed =
+          ZSTD_compressCCtx(contexts.compression, dst.data(), dst.size(), src, size, level);
+      if (ZSTD_isError(compressed) || compressed >= size) { return false; }
+      dst.resize(compressed);
+      return true;
+    }
+    case CompressionMethod::kNone:
+    default:
+      return false;
+  }
+}
+
+gxf::Expected<void> DecompressChunk(CompressionMethod method, const uint8_t* src,
+                                    size_t stored_size, uint8_t* dst, size_t raw_size) {
+  // Chunks which did not compress are stored as is
+  if (stored_size == raw_size) {
+    std::memcpy(dst, src, raw_size);
+    return gxf::Success;
+  }
+
+  switch (method) {
+    case CompressionMethod::kLz4: {
+      if (raw_size > static_cast<size_t>(std::numeric_limits<int>::max()) ||
+          stored_size > static_cast<size_t>(std::numeric_limits<int>::max())) {
+        return gxf::Unexpected{GXF_ARGUMENT_OUT_OF_RANGE};
+      }
+      const int decompressed = LZ4_decompress_safe(reinterpret_cast<const char*>(src),
+                                                   reinterpret_cast<char*>(dst),
+                                                   static_cast<int>(stored_size),
+                                                   static_cast<int>(raw_size));
+      if (decompressed < 0 || static_cast<size_t>(decompressed) != raw_size) {
+        return gxf::Unexpected{GXF_FAILURE};
+      }
+      return gxf::Success;
+    }
+    case CompressionMethod::kZstd: {
+      auto& contexts = GetZstdContexts();
+      if (contexts.decompression == nullptr) { contexts.decompression = ZSTD_createDCtx(); }
+      if (contexts.decompression == nullptr) { return gxf::Unexpected{GXF_OUT_OF_MEMORY}; }
+      const size_t decompressed =
+          ZSTD_decompressDCtx(contexts.decompression, dst, raw_size, src, stored_size);
+      if (ZSTD_isError(decompressed) || decompressed != raw_size) {
+        return gxf::Unexpected{GXF_FAILURE};
+      }
+      return gxf::Success;
+    }
+    case CompressionMethod::kNone:
+    default:
+      return gxf::Unexpected{GXF_FAILURE};
+  }
+}
+
+}  // namespace nvidia::holoscan::stream_playback
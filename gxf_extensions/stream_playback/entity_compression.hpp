@@ -0,0 +1,135 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef NVIDIA_CLARA_HOLOSCAN_GXF_EXTENSIONS_STREAM_PLAYBACK_ENTITY_COMPRESSION_HPP_
+#define NVIDIA_CLARA_HOLOSCAN_GXF_EXTENSIONS_STREAM_PLAYBACK_ENTITY_COMPRESSION_HPP_
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gxf/core/expected.hpp"
+#include "gxf/serialization/endpoint.hpp"
+
+namespace nvidia::holoscan::stream_playback {
+
+/// Compression applied to the components of an entity, stored in the low byte of
+/// `VideoStreamSerializer::EntityHeader::flags`.
+enum class CompressionMethod : uint32_t {
+  kNone = 0,  // Components are stored as serialized
+  kLz4 = 1,   // LZ4 block compression, fast
+  kZstd = 2,  // Zstandard compression with a configurable level, for archival
+};
+
+/// Mask of the compression method in the entity header flags
+constexpr uint32_t kCompressionMethodMask = 0xff;
+/// Entity header flag set when components may be encoded as a delta to the previous entity
+constexpr uint32_t kDeltaEncodingFlag = 0x100;
+
+/// Parses "none", "lz4" or "zstd"
+gxf::Expected<CompressionMethod> ParseCompressionMethod(const std::string& name);
+
+/// Endpoint backed by a growable memory buffer.
+///
+/// Writes append to the buffer and reads consume it from the front, so that a component can be
+/// serialized to memory before being compressed, and deserialized from memory once decompressed.
+class MemoryEndpoint : public gxf::Endpoint {
+ public:
+  gxf_result_t write_abi(const void* data, size_t size, size_t* bytes_written) override;
+  gxf_result_t read_abi(void* data, size_t size, size_t* bytes_read) override;
+
+  /// Clears the buffer and rewinds the read position
+  void reset();
+
+  std::vector<uint8_t>& buffer() { return buffer_; }
+  const std::vector<uint8_t>& buffer() const { return buffer_; }
+
+ private:
+  std::vector<uint8_t> buffer_;
+  size_t read_offset_ = 0;
+};
+
+/// Endpoint forwarding reads and writes to another endpoint while computing the size and the
+/// CRC-32C of the bytes passing through it, so that entities are checksummed as they are streamed.
+class ChecksumEndpoint : public gxf::Endpoint {
+ public:
+  gxf_result_t write_abi(const void* data, size_t size, size_t* bytes_written) override;
+  gxf_result_t read_abi(void* data, size_t size, size_t* bytes_read) override;
+
+  /// Forwards to `endpoint` from now on and restarts the size and checksum
+  void reset(gxf::Endpoint* endpoint);
+
+  uint64_t size() const { return size_; }
+  uint32_t checksum() const { return checksum_; }
+
+ private:
+  gxf::Endpoint* endpoint_ = nullptr;
+  uint64_t size_ = 0;
+  uint32_t checksum_ = 0;
+};
+
+/// Fixed-size pool of threads running the iterations of a loop in parallel.
+///
+/// The calling thread takes part in the loop, so a pool with no worker runs it sequentially.
+class WorkerPool {
+ public:
+  explicit WorkerPool(size_t worker_count);
+  ~WorkerPool();
+
+  WorkerPool(const WorkerPool&) = delete;
+  WorkerPool& operator=(const WorkerPool&) = delete;
+
+  /// Calls `function(i)` for every `i` in [0, count) and returns once all calls are done
+  void parallelFor(size_t count, const std::function<void(size_t)>& function);
+
+ private:
+  void run();
+  void runIterations();
+
+  std::vector<std::thread> workers_;
+  std::mutex mutex_;
+  std::condition_variable work_cv_;
+  std::condition_variable done_cv_;
+  const std::function<void(size_t)>* function_ = nullptr;
+  size_t count_ = 0;
+  size_t next_ = 0;
+  size_t pending_ = 0;
+  uint64_t generation_ = 0;
+  bool stopping_ = false;
+};
+
+/// Size of a chunk before and after compression
+struct CompressedChunk {
+  uint64_t raw_size;
+  uint64_t stored_size;
+};
+
+/// Compresses `src` into `dst`, resizing it to the compressed size.
+/// Returns false if the data does not compress, in which case it should be stored as is.
+bool CompressChunk(CompressionMethod method, int32_t level, const uint8_t* src, size_t size,
+                   std::vector<uint8_t>& dst);
+
+/// Decompresses exactly `raw_size` bytes from `src` into `dst`
+gxf::Expected<void> DecompressChunk(CompressionMethod method, const uint8_t* src,
+                                    size_t stored_size, uint8_t* dst, size_t raw_size);
+
+}  // namespace nvidia::holoscan::stream_playback
+
+#endif  // NVIDIA_CLARA_HOLOSCAN_GXF_EXTENSIONS_STREAM_PLAYBACK_ENTITY_COMPRESSION_HPP_
@@ -18,10 +18,13 @@
 
 #include <endian.h>
 
+#include <algorithm>
 #include <chrono>
 #include <cinttypes>
 #include <cstring>
 #include <string>
+#include <thread>
+#include <utility>
 
 namespace nvidia {
 namespace holoscan {
@@ -83,6 +86,68 @@ gxf::Expected<VideoStreamSerializer::ComponentHeader> DeserializeComponentHeader
   });
 }
 
+// Serializes CompressedComponentHeader
+gxf::Expected<size_t> SerializeCompressedComponentHeader(
+    VideoStreamSerializer::CompressedComponentHeader header, gxf::Endpoint* endpoint) {
+  if (!endpoint) { return gxf::Unexpected{GXF_ARGUMENT_NULL}; }
+  header.raw_size = htole64(header.raw_size);
+  header.reference_sequence = htole64(header.reference_sequence);
+  header.chunk_count = htole32(header.chunk_count);
+  header.reserved = htole32(header.reserved);
+  return endpoint->writeTrivialType(&header).substitute(sizeof(header));
+}
+
+// Deserializes CompressedComponentHeader
+gxf::Expected<VideoStreamSerializer::CompressedComponentHeader>
+DeserializeCompressedComponentHeader(gxf::Endpoint* endpoint) {
+  if (!endpoint) { return gxf::Unexpected{GXF_ARGUMENT_NULL}; }
+  VideoStreamSerializer::CompressedComponentHeader header;
+  return endpoint->readTrivialType(&header).and_then([&]() {
+    header.raw_size = le64toh(header.raw_size);
+    header.reference_sequence = le64toh(header.reference_sequence);
+    header.chunk_count = le32toh(header.chunk_count);
+    header.reserved = le32toh(header.reserved);
+    return header;
+  });
+}
+
+// Serializes EntityTrailer
+gxf::Expected<size_t> SerializeEntityTrailer(VideoStreamSerializer::EntityTrailer trailer,
+                                             gxf::Endpoint* endpoint) {
+  if (!endpoint) { return gxf::Unexpected{GXF_ARGUMENT_NULL}; }
+  trailer.serialized_size = htole64(trailer.serialized_size);
+  trailer.checksum = htole32(trailer.checksum);
+  return endpoint->writeTrivialType(&trailer).substitute(sizeof(trailer));
+}
+
+// Deserializes EntityTrailer
+gxf::Expected<VideoStreamSerializer::EntityTrailer> DeserializeEntityTrailer(
+    gxf::Endpoint* endpoint) {
+  if (!endpoint) { return gxf::Unexpected{GXF_ARGUMENT_NULL}; }
+  VideoStreamSerializer::EntityTrailer trailer;
+  return endpoint->readTrivialType(&trailer).and_then([&]() {
+    trailer.serialized_size = le64toh(trailer.serialized_size);
+    trailer.checksum = le32toh(trailer.checksum);
+    return trailer;
+  });
+}
+
+// XORs `size` bytes of `lhs` and `rhs` into `dst`, which may alias `lhs`
+void XorBuffers(uint8_t* dst, const uint8_t* lhs, const uint8_t* rhs, size_t size) {
+  size_t i = 0;
+  for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+    uint64_t a, b;
+    std::memcpy(&a, lhs + i, sizeof(a));
+    std::memcpy(&b, rhs + i, sizeof(b));
+    a ^= b;
+    std::memcpy(dst + i, &a, sizeof(a));
+  }
+  for (; i < size; i++) { dst[i] = lhs[i] ^ rhs[i]; }
+}
+
+// Upper bound on the number of compression threads
+constexpr uint64_t kMaxCompressionThreads = 16;
+
 }  // namespace
 
 struct VideoStreamSerializer::ComponentEntry {
@@ -97,32 +162,107 @@ gxf_result_t VideoStreamSerializer::registerInterface(gxf::Registrar* registrar)
   result &=
       registrar->parameter(component_serializers_, "component_serializers", "Component serializers",
                            "List of serializers for serializing and deserializing components");
+  result &= registrar->parameter(compression_, "compression", "Compression",
+                                 "Compression of serialized components: 'none', 'lz4' or 'zstd'",
+                                 std::string("none"));
+  result &= registrar->parameter(compression_level_, "compression_level", "Compression level",
+                                 "Compression level used by zstd (1 to 22)", 3);
+  result &= registrar->parameter(
+      delta_encoding_, "delta_encoding", "Delta encoding",
+      "Encode components as a lossless delta to the same component of the previous entity",
+      false);
+  result &= registrar->parameter(
+      keyframe_interval_, "keyframe_interval", "Keyframe interval",
+      "Number of entities between two entities stored without delta encoding (0 for none)",
+      static_cast<uint64_t>(30));
+  result &= registrar->parameter(compression_chunk_size_, "compression_chunk_size",
+                                 "Compression chunk size",
+                                 "Size of the chunks compressed in parallel, in bytes",
+                                 static_cast<uint64_t>(1 << 20));
+  result &= registrar->parameter(
+      compression_threads_, "compression_threads", "Compression threads",
+      "Number of threads compressing chunks (0 to use the number of hardware threads)",
+      static_cast<uint64_t>(0));
+  result &= registrar->parameter(
+      verify_checksum_, "verify_checksum", "Verify checksum",
+      "Verify the checksum of entities while deserializing them, failing on mismatch", false);
   return gxf::ToResultCode(result);
 }
 
+gxf_result_t VideoStreamSerializer::initialize() {
+  const auto method = ParseCompressionMethod(compression_.get());
+  if (!method) {
+    GXF_LOG_ERROR("Unknown compression '%s'", compression_.get().c_str());
+    return gxf::ToResultCode(method);
+  }
+  compression_method_ = method.value();
+  if (compression_chunk_size_.get() == 0) {
+    GXF_LOG_ERROR("Compression chunk size must be positive");
+    return GXF_ARGUMENT_INVALID;
+  }
+
+  if (compression_method_ != CompressionMethod::kNone || delta_encoding_.get()) {
+    uint64_t thread_count = compression_threads_.get();
+    if (thread_count == 0) {
+      thread_count = std::min<uint64_t>(std::thread::hardware_concurrency(),
+                                        kMaxCompressionThreads);
+    }
+    // The calling thread takes part in the work
+    worker_pool_ = std::make_unique<WorkerPool>(thread_count > 1 ? thread_count - 1 : 0);
+  } else {
+    // Replay still needs a pool to decompress recordings made with compression
+    worker_pool_ = std::make_unique<WorkerPool>(0);
+  }
+  return GXF_SUCCESS;
+}
+
+gxf_result_t VideoStreamSerializer::deinitialize() {
+  worker_pool_.reset();
+  outgoing_references_.clear();
+  incoming_references_.clear();
+  return GXF_SUCCESS;
+}
+
 gxf_result_t VideoStreamSerializer::serialize_entity_abi(gxf_uid_t eid, gxf::Endpoint* endpoint,
                                                          uint64_t* size) {
   if (endpoint == nullptr || size == nullptr) { return GXF_ARGUMENT_NULL; }
   FixedVector<gxf::UntypedHandle, kMaxComponents> components;
   FixedVector<ComponentEntry, kMaxComponents> entries;
+  const auto result = gxf::Entity::Shared(context(), eid)
+                          .map([&](gxf::Entity entity) { return entity.findAll(components); })
+                          .and_then([&]() { return createComponentEntries(components); })
+                          .assign_to(entries);
+  if (!result) { return gxf::ToResultCode(result); }
+
+  EntityHeader entity_header;
+  entity_header.serialized_size = 0;
+  entity_header.checksum = 0;
+  entity_header.sequence_number = outgoing_sequence_number_++;
+  entity_header.flags = static_cast<uint32_t>(compression_method_) |
+                        (delta_encoding_.get() ? kDeltaEncodingFlag : 0);
+  entity_header.component_count = entries.size();
+  entity_header.reserved = 0;
+  const bool compressed = entity_header.flags != 0;
+  entity_header.flags |= kChecksumFlag;
+
+  // Checksum the components as they are written, and write their size and checksum after them
+  checksum_endpoint_.reset(endpoint);
   return gxf::ToResultCode(
-      gxf::Entity::Shared(context(), eid)
-          .map([&](gxf::Entity entity) { return entity.findAll(components); })
-          .and_then([&]() { return createComponentEntries(components); })
-          .assign_to(entries)
+      SerializeEntityHeader(entity_header, endpoint)
+          .assign_to(*size)
           .and_then([&]() {
-            EntityHeader entity_header;
-            entity_header.serialized_size = 0;  // How can we compute this before serializing?
-            entity_header.checksum = 0x00000000;
-            entity_header.sequence_number = outgoing_sequence_number_++;
-            entity_header.flags = 0x00000000;
-            entity_header.component_count = entries.size();
-            entity_header.reserved = 0;
-            return SerializeEntityHeader(entity_header, endpoint);
+            return compressed ? serializeCompressedComponents(entries,
+                                                              entity_header.sequence_number,
+                                                              &checksum_endpoint_)
+                              : serializeComponents(entries, &checksum_endpoint_);
           })
-          .assign_to(*size)
-          .and_then([&]() { return serializeComponents(entries, endpoint); })
-          .map([&](size_t serialized_size) { *size += serialized_size; }));
+          .map([&](size_t payload_size) {
+            *size += payload_size;
+            const EntityTrailer trailer = {checksum_endpoint_.size(),
+                                           checksum_endpoint_.checksum()};
+            return SerializeEntityTrailer(trailer, endpoint);
+          })
+          .map([&](size_t trailer_size) { *size += trailer_size; }));
 }
 
 gxf::Expected<gxf::Entity> VideoStreamSerializer::deserialize_entity_header_abi(
@@ -138,11 +278,14 @@ gxf::Expected<gxf::Entity> VideoStreamSerializer::deserialize_entity_header_abi(
               incoming_sequence_number_ = entity_header.sequence_number;
             }
             incoming_sequence_number_++;
-            return deserializeComponents(entity_header.component_count, entity, endpoint);
+            return deserializeEntityComponents(entity_header, entity, endpoint);
           })
           .substitute(entity));
 
-  if (result != GXF_SUCCESS) { GXF_LOG_ERROR("Deserialize entity header failed"); }
+  if (result != GXF_SUCCESS) {
+    GXF_LOG_ERROR("Deserialize entity header failed");
+    return gxf::Unexpected{result};
+  }
   return entity;
 }
 
@@ -169,11 +312,50 @@ gxf_result_t VideoStreamSerializer::deserialize_entity_abi(gxf_uid_t eid, gxf::E
                                    incoming_sequence_number_ = entity_header.sequence_number;
                                  }
                                  incoming_sequence_number_++;
-                                 return deserializeComponents(entity_header.component_count, entity,
-                                                              endpoint);
+                                 return deserializeEntityComponents(entity_header, entity,
+                                                                    endpoint);
                                }));
 }
 
+gxf::Expected<void> VideoStreamSerializer::deserializeEntityComponents(
+    const EntityHeader& entity_header, gxf::Entity entity, gxf::Endpoint* endpoint) {
+  const bool has_trailer = (entity_header.flags & kChecksumFlag) != 0;
+  const bool verify = verify_checksum_.get() && has_trailer;
+  if (verify_checksum_.get() && !has_trailer && !warned_missing_checksum_) {
+    GXF_LOG_WARNING("Entity %" PRIu64 " has no checksum and cannot be verified",
+                    entity_header.sequence_number);
+    warned_missing_checksum_ = true;
+  }
+
+  // Checksum the components as they are read
+  gxf::Endpoint* components_endpoint = endpoint;
+  if (verify) {
+    checksum_endpoint_.reset(endpoint);
+    components_endpoint = &checksum_endpoint_;
+  }
+
+  // Entities without compression flags were stored uncompressed, which keeps older recordings
+  // readable
+  const auto result =
+      (entity_header.flags & (kCompressionMethodMask | kDeltaEncodingFlag)) == 0
+          ? deserializeComponents(entity_header.component_count, entity, components_endpoint)
+          : deserializeCompressedComponents(entity_header, entity, components_endpoint);
+  if (!result || !has_trailer) { return result; }
+
+  // The trailer is read even when checksums are not verified, to stay at entity boundaries
+  const auto trailer = DeserializeEntityTrailer(endpoint);
+  if (!trailer) { return gxf::ForwardError(trailer); }
+  if (verify && (trailer->serialized_size != checksum_endpoint_.size() ||
+                 trailer->checksum != checksum_endpoint_.checksum())) {
+    GXF_LOG_ERROR("Checksum mismatch for entity %" PRIu64 " of %" PRIu64
+                  " bytes: expected 0x%08x, computed 0x%08x over %" PRIu64 " bytes",
+                  entity_header.sequence_number, trailer->serialized_size, trailer->checksum,
+                  checksum_endpoint_.checksum(), checksum_endpoint_.size());
+    return gxf::Unexpected{GXF_FAILURE};
+  }
+  return gxf::Success;
+}
+
 gxf::Expected<FixedVector<VideoStreamSerializer::ComponentEntry, kMaxComponents>>
 VideoStreamSerializer::createComponentEntries(
     const FixedVectorBase<gxf::UntypedHandle>& components) {
@@ -225,6 +407,105 @@ gxf::Expected<size_t> VideoStreamSerializer::serializeComponents(
   return size;
 }
 
+gxf::Expected<size_t> VideoStreamSerializer::serializeCompressedComponents(
+    const FixedVectorBase<ComponentEntry>& entries, uint64_t sequence_number,
+    gxf::Endpoint* endpoint) {
+  const size_t chunk_size = compression_chunk_size_.get();
+  const uint64_t keyframe_interval = keyframe_interval_.get();
+  // Keyframes are stored without delta encoding so that replay can start from them
+  const bool keyframe = !delta_encoding_.get() ||
+                        (keyframe_interval > 0 && sequence_number % keyframe_interval == 0);
+
+  size_t size = 0;
+  for (size_t i = 0; i < entries.size(); i++) {
+    const auto& entry = entries[i];
+    if (!entry) { return gxf::Unexpected{GXF_ARGUMENT_OUT_OF_RANGE}; }
+
+    // Serialize the component to memory
+    raw_endpoint_.reset();
+    const auto serialized =
+        entry->serializer->serializeComponent(entry->component, &raw_endpoint_);
+    if (!serialized) { return gxf::ForwardError(serialized); }
+    std::vector<uint8_t>& raw = raw_endpoint_.buffer();
+
+    // Encode as a delta to the previous entity if the component kept the same size
+    CompressedComponentHeader compressed_header;
+    compressed_header.raw_size = raw.size();
+    compressed_header.reference_sequence = kNoReference;
+    compressed_header.reserved = 0;
+    const uint8_t* source = raw.data();
+    const std::string name(entry->component.name(), entry->header.name_size);
+    ReferenceComponent* reference = nullptr;
+    if (delta_encoding_.get()) {
+      reference = &outgoing_references_[name];
+      if (!keyframe && reference->sequence_number != kNoReference &&
+          reference->sequence_number + 1 == sequence_number &&
+          reference->data.size() == raw.size()) {
+        delta_buffer_.resize(raw.size());
+        XorBuffers(delta_buffer_.data(), raw.data(), reference->data.data(), raw.size());
+        source = delta_buffer_.data();
+        compressed_header.reference_sequence = reference->sequence_number;
+      }
+    }
+
+    // Compress chunks in parallel, keeping the ones which do not compress as is
+    const size_t chunk_count = (raw.size() + chunk_size - 1) / chunk_size;
+    compressed_header.chunk_count = chunk_count;
+    chunk_table_.resize(chunk_count);
+    if (chunk_buffers_.size() < chunk_count) { chunk_buffers_.resize(chunk_count); }
+    worker_pool_->parallelFor(chunk_count, [&](size_t chunk) {
+      const size_t offset = chunk * chunk_size;
+      const size_t raw_size = std::min(chunk_size, raw.size() - offset);
+      chunk_table_[chunk].raw_size = raw_size;
+      chunk_table_[chunk].stored_size =
+          CompressChunk(compression_method_, compression_level_.get(), source + offset, raw_size,
+                        chunk_buffers_[chunk])
+              ? chunk_buffers_[chunk].size()
+              : raw_size;
+    });
+
+    ComponentHeader component_header = entry->header;
+    component_header.serialized_size =
+        sizeof(CompressedComponentHeader) + chunk_count * sizeof(CompressedChunk);
+    for (const auto& chunk : chunk_table_) {
+      component_header.serialized_size += chunk.stored_size;
+    }
+
+    auto result =
+        SerializeComponentHeader(component_header, endpoint)
+            .map([&](size_t component_header_size) { size += component_header_size; })
+            .and_then([&]() { return endpoint->write(name.data(), name.size()); })
+            .and_then([&]() { size += name.size(); })
+            .and_then([&]() {
+              return SerializeCompressedComponentHeader(compressed_header, endpoint);
+            })
+            .map([&](size_t compressed_header_size) { size += compressed_header_size; });
+    if (!result) { return gxf::ForwardError(result); }
+    for (const auto& chunk : chunk_table_) {
+      const CompressedChunk stored_chunk = {htole64(chunk.raw_size), htole64(chunk.stored_size)};
+      result = endpoint->writeTrivialType(&stored_chunk);
+      if (!result) { return gxf::ForwardError(result); }
+    }
+    size += chunk_count * sizeof(CompressedChunk);
+    for (size_t chunk = 0; chunk < chunk_count; chunk++) {
+      const auto& entry_chunk = chunk_table_[chunk];
+      const uint8_t* data = entry_chunk.stored_size == entry_chunk.raw_size
+                                ? source + chunk * chunk_size
+                                : chunk_buffers_[chunk].data();
+      result = endpoint->write(data, entry_chunk.stored_size);
+      if (!result) { return gxf::ForwardError(result); }
+      size += entry_chunk.stored_size;
+    }
+
+    // Keep the serialized component as reference for the next entity
+    if (reference) {
+      reference->sequence_number = sequence_number;
+      reference->data.swap(raw);
+    }
+  }
+  return size;
+}
+
 gxf::Expected<void> VideoStreamSerializer::deserializeComponents(size_t component_count,
                                                                  gxf::Entity entity,
                                                                  gxf::Endpoint* endpoint) {
@@ -255,6 +536,130 @@ gxf::Expected<void> VideoStreamSerializer::deserializeComponents(size_t componen
   return gxf::Success;
 }
 
+gxf::Expected<void> VideoStreamSerializer::deserializeCompressedComponents(
+    const EntityHeader& entity_header, gxf::Entity entity, gxf::Endpoint* endpoint) {
+  const uint32_t method_value = entity_header.flags & kCompressionMethodMask;
+  if (method_value > static_cast<uint32_t>(CompressionMethod::kZstd)) {
+    GXF_LOG_ERROR("Unknown compression method %u", method_value);
+    return gxf::Unexpected{GXF_FAILURE};
+  }
+  const CompressionMethod method = static_cast<CompressionMethod>(method_value);
+  const bool delta_encoded = (entity_header.flags & kDeltaEncodingFlag) != 0;
+
+  for (size_t i = 0; i < entity_header.component_count; i++) {
+    ComponentEntry entry;
+    std::string name;
+    CompressedComponentHeader compressed_header;
+    auto result =
+        DeserializeComponentHeader(endpoint)
+            .assign_to(entry.header)
+            .and_then([&]() { return findComponentSerializer(entry.header.tid); })
+            .assign_to(entry.serializer)
+            .and_then([&]() -> gxf::Expected<void> {
+              try {
+                name.assign(entry.header.name_size, '\0');
+              } catch (const std::exception& exception) {
+                GXF_LOG_ERROR("Failed to deserialize component name: %s", exception.what());
+                return gxf::Unexpected{GXF_OUT_OF_MEMORY};
+              }
+              return endpoint->read(name.data(), name.size());
+            })
+            .and_then([&]() { return DeserializeCompressedComponentHeader(endpoint); })
+            .assign_to(compressed_header);
+    if (!result) { return gxf::ForwardError(result); }
+
+    // Read the chunk table and check it against the headers before allocating
+    const size_t chunk_count = compressed_header.chunk_count;
+    if (entry.header.serialized_size <
+        sizeof(CompressedComponentHeader) + chunk_count * sizeof(CompressedChunk)) {
+      GXF_LOG_ERROR("Invalid chunk count %zu for component '%s'", chunk_count, name.c_str());
+      return gxf::Unexpected{GXF_FAILURE};
+    }
+    chunk_table_.resize(chunk_count);
+    uint64_t raw_size = 0;
+    uint64_t stored_size = 0;
+    for (auto& chunk : chunk_table_) {
+      result = endpoint->readTrivialType(&chunk);
+      if (!result) { return gxf::ForwardError(result); }
+      chunk.raw_size = le64toh(chunk.raw_size);
+      chunk.stored_size = le64toh(chunk.stored_size);
+      raw_size += chunk.raw_size;
+      stored_size += chunk.stored_size;
+    }
+    const uint64_t expected_size =
+        sizeof(CompressedComponentHeader) + chunk_count * sizeof(CompressedChunk) + stored_size;
+    if (raw_size != compressed_header.raw_size || expected_size != entry.header.serialized_size) {
+      GXF_LOG_ERROR("Corrupted chunk table for component '%s'", name.c_str());
+      return gxf::Unexpected{GXF_FAILURE};
+    }
+
+    // Decompress chunks in parallel
+    try {
+      stored_buffer_.resize(stored_size);
+      raw_endpoint_.reset();
+      raw_endpoint_.buffer().resize(raw_size);
+    } catch (const std::exception& exception) {
+      GXF_LOG_ERROR("Failed to allocate component '%s': %s", name.c_str(), exception.what());
+      return gxf::Unexpected{GXF_OUT_OF_MEMORY};
+    }
+    result = endpoint->read(stored_buffer_.data(), stored_size);
+    if (!result) { return gxf::ForwardError(result); }
+    std::vector<std::pair<uint64_t, uint64_t>> offsets(chunk_count);
+    for (size_t chunk = 0, raw_offset = 0, stored_offset = 0; chunk < chunk_count; chunk++) {
+      offsets[chunk] = {raw_offset, stored_offset};
+      raw_offset += chunk_table_[chunk].raw_size;
+      stored_offset += chunk_table_[chunk].stored_size;
+    }
+    uint8_t* raw = raw_endpoint_.buffer().data();
+    std::vector<gxf::Expected<void>> chunk_results(chunk_count, gxf::Success);
+    worker_pool_->parallelFor(chunk_count, [&](size_t chunk) {
+      const auto& stored_chunk = chunk_table_[chunk];
+      const uint8_t* src = stored_buffer_.data() + offsets[chunk].second;
+      uint8_t* dst = raw + offsets[chunk].first;
+      if (stored_chunk.stored_size == stored_chunk.raw_size) {
+        std::memcpy(dst, src, stored_chunk.raw_size);
+      } else {
+        chunk_results[chunk] =
+            DecompressChunk(method, src, stored_chunk.stored_size, dst, stored_chunk.raw_size);
+      }
+    });
+    for (const auto& chunk_result : chunk_results) {
+      if (!chunk_result) { return gxf::ForwardError(chunk_result); }
+    }
+
+    // Undo the delta encoding against the component of the previous entity
+    if (compressed_header.reference_sequence != kNoReference) {
+      const auto search = incoming_references_.find(name);
+      if (search == incoming_references_.end() ||
+          search->second.sequence_number != compressed_header.reference_sequence ||
+          search->second.data.size() != raw_size) {
+        // Readers with random access try the preceding entities until they find a keyframe
+        GXF_LOG_DEBUG(
+            "Component '%s' of entity %" PRIu64 " is a delta to entity %" PRIu64
+            " which was not read before it",
+            name.c_str(), entity_header.sequence_number, compressed_header.reference_sequence);
+        return gxf::Unexpected{GXF_FAILURE};
+      }
+      XorBuffers(raw, raw, search->second.data.data(), raw_size);
+    }
+
+    result = entity.add(entry.header.tid, name.c_str())
+                 .assign_to(entry.component)
+                 .and_then([&]() {
+                   return entry.serializer->deserializeComponent(entry.component, &raw_endpoint_);
+                 });
+    if (!result) { return gxf::ForwardError(result); }
+
+    // Keep the serialized component as reference for the next entity
+    if (delta_encoded) {
+      auto& reference = incoming_references_[name];
+      reference.sequence_number = entity_header.sequence_number;
+      reference.data.swap(raw_endpoint_.buffer());
+    }
+  }
+  return gxf::Success;
+}
+
 gxf::Expected<gxf::Handle<gxf::ComponentSerializer>> VideoStreamSerializer::findComponentSerializer(
     gxf_tid_t tid) {
   // Search cache for valid serializer
@@ -17,13 +17,18 @@
 #ifndef NVIDIA_CLARA_HOLOSCAN_GXF_EXTENSIONS_STREAM_PLAYBACK_VIDEO_STREAM_SERIALIZER_HPP_
 #define NVIDIA_CLARA_HOLOSCAN_GXF_EXTENSIONS_STREAM_PLAYBACK_VIDEO_STREAM_SERIALIZER_HPP_
 
+#include <memory>
+#include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "common/fixed_vector.hpp"
 #include "gxf/serialization/component_serializer.hpp"
 #include "gxf/serialization/entity_serializer.hpp"
 #include "gxf/serialization/tid_hash.hpp"
 
+#include "entity_compression.hpp"
+
 namespace nvidia::holoscan::stream_playback {
 
 /// @brief Data marshalling codelet for video stream entities.
@@ -39,6 +44,24 @@ namespace nvidia::holoscan::stream_playback {
 /// Each component will be preceded by a component header and the name of the component.
 /// The component itself will be serialized with a component serializer.
 /// An entity header will be added at the beginning.
+///
+/// Components can be compressed with LZ4 or Zstandard, and encoded as a delta to the same
+/// component of the previous entity. The low byte of the entity header flags holds the
+/// CompressionMethod and kDeltaEncodingFlag marks delta encoding. A compressed component is then
+/// stored as follows after its header and name:
+///
+///   | Compressed Component Header | Chunk Table | Chunk | ... |
+///
+/// The serialized component is split into chunks of `compression_chunk_size` bytes which are
+/// compressed in parallel. Chunks that do not compress are stored as is. Entities without
+/// compression flags are stored uncompressed, as by previous versions.
+///
+/// When kChecksumFlag is set in the entity header, the components are followed by an entity
+/// trailer holding their size and CRC-32C, which readers use to detect corrupted entities. The
+/// checksum is computed as the components are written to the endpoint, so the size and checksum
+/// fields of the entity header are left to zero, as in recordings from previous versions:
+///
+///   | Entity Header || Component Header | Component Name | Component | ... || Entity Trailer |
 class VideoStreamSerializer : gxf::EntitySerializer {
  public:
 #pragma pack(push, 1)
@@ -62,9 +85,32 @@ class VideoStreamSerializer : gxf::EntitySerializer {
   };
 #pragma pack(pop)
 
+#pragma pack(push, 1)
+  // Header following the name of compressed components
+  struct CompressedComponentHeader {
+    uint64_t raw_size;            // Size of the serialized component before compression
+    uint64_t reference_sequence;  // Sequence number of the delta reference, or kNoReference
+    uint32_t chunk_count;         // Number of chunks following the chunk table
+    uint32_t reserved;            // Bytes reserved for future use
+  };
+#pragma pack(pop)
+
+#pragma pack(push, 1)
+  // Trailer following the components of entities with kChecksumFlag
+  struct EntityTrailer {
+    uint64_t serialized_size;  // Size of the serialized components in bytes
+    uint32_t checksum;         // CRC-32C of the serialized components
+  };
+#pragma pack(pop)
+
+  // Reference sequence number of components which are not delta-encoded
+  static constexpr uint64_t kNoReference = ~0ULL;
+  // Entity header flag set when the components are followed by an EntityTrailer
+  static constexpr uint32_t kChecksumFlag = 0x200;
+
   gxf_result_t registerInterface(gxf::Registrar* registrar) override;
-  gxf_result_t initialize() override { return GXF_SUCCESS; }
-  gxf_result_t deinitialize() override { return GXF_SUCCESS; }
+  gxf_result_t initialize() override;
+  gxf_result_t deinitialize() override;
 
   gxf_result_t serialize_entity_abi(gxf_uid_t eid, gxf::Endpoint* endpoint,
                                     uint64_t* size) override;
@@ -82,9 +128,22 @@ class VideoStreamSerializer : gxf::EntitySerializer {
   // Returns the total number of bytes serialized
   gxf::Expected<size_t> serializeComponents(const FixedVectorBase<ComponentEntry>& entries,
                                             gxf::Endpoint* endpoint);
+  // Serializes a list of components, compresses them and writes them to an endpoint
+  // Returns the total number of bytes written
+  gxf::Expected<size_t> serializeCompressedComponents(
+      const FixedVectorBase<ComponentEntry>& entries, uint64_t sequence_number,
+      gxf::Endpoint* endpoint);
   // Reads from an endpoint and deserializes a list of components
   gxf::Expected<void> deserializeComponents(size_t component_count, gxf::Entity entity,
                                             gxf::Endpoint* endpoint);
+  // Reads from an endpoint, decompresses and deserializes a list of components
+  gxf::Expected<void> deserializeCompressedComponents(const EntityHeader& entity_header,
+                                                      gxf::Entity entity,
+                                                      gxf::Endpoint* endpoint);
+  // Deserializes the components following an entity header, and verifies them against the
+  // entity trailer when checksums are verified
+  gxf::Expected<void> deserializeEntityComponents(const EntityHeader& entity_header,
+                                                  gxf::Entity entity, gxf::Endpoint* endpoint);
   // Searches for a component serializer that supports the given type ID
   // Uses the first valid serializer found and caches it for subsequent lookups
   // Returns an Unexpected if no valid serializer is found
@@ -92,14 +151,42 @@ class VideoStreamSerializer : gxf::EntitySerializer {
 
   gxf::Parameter<FixedVector<gxf::Handle<gxf::ComponentSerializer>, kMaxComponents>>
       component_serializers_;
+  gxf::Parameter<std::string> compression_;
+  gxf::Parameter<int32_t> compression_level_;
+  gxf::Parameter<bool> delta_encoding_;
+  gxf::Parameter<uint64_t> keyframe_interval_;
+  gxf::Parameter<uint64_t> compression_chunk_size_;
+  gxf::Parameter<uint64_t> compression_threads_;
+  gxf::Parameter<bool> verify_checksum_;
+
+  // Serialized component and the sequence number of its entity, kept as delta reference
+  struct ReferenceComponent {
+    uint64_t sequence_number = kNoReference;
+    std::vector<uint8_t> data;
+  };
+
+  CompressionMethod compression_method_ = CompressionMethod::kNone;
+  std::unique_ptr<WorkerPool> worker_pool_;
+  // Buffers reused across entities
+  MemoryEndpoint raw_endpoint_;
+  ChecksumEndpoint checksum_endpoint_;
+  std::vector<uint8_t> delta_buffer_;
+  std::vector<uint8_t> stored_buffer_;
+  std::vector<std::vector<uint8_t>> chunk_buffers_;
+  std::vector<CompressedChunk> chunk_table_;
+  // Delta references of outgoing and incoming components, by component name
+  std::unordered_map<std::string, ReferenceComponent> outgoing_references_;
+  std::unordered_map<std::string, ReferenceComponent> incoming_references_;
+  // Whether an entity without checksum was read while verifying checksums
+  bool warned_missing_checksum_ = false;
 
   // Table that caches type ID with a valid component serializer
   std::unordered_map<gxf_tid_t, gxf::Handle<gxf::ComponentSerializer>, gxf::TidHash>
       serializer_cache_;
   // Sequence number for outgoing messages
-  uint64_t outgoing_sequence_number_;
+  uint64_t outgoing_sequence_number_ = 0;
   // Sequence number for incoming messages
-  uint64_t incoming_sequence_number_;
+  uint64_t incoming_sequence_number_ = 0;
 };
 
 }  // namespace nvidia::holoscan::stream_playback
@@ -0,0 +1,41 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GXF_EXTENSIONS_UTILS_CPU_DISPATCH_HPP
+#define GXF_EXTENSIONS_UTILS_CPU_DISPATCH_HPP
+
+/**
+ * HOLOSCAN_TARGET_CLONES selects the best implementation of a function for the CPU at runtime.
+ *
+ * The function is compiled for each target and the implementation is selected when the library
+ * is loaded. The selection runs before ThreadSanitizer is initialized, so the attribute is left
+ * out of ThreadSanitizer builds.
+ *
+ * Usage: put HOLOSCAN_TARGET_CLONES before the declaration of a vectorized loop.
+ */
+#ifndef HOLOSCAN_TARGET_CLONES
+#if defined(__x86_64__) && defined(__has_attribute) && !defined(__SANITIZE_THREAD__)
+#if __has_attribute(target_clones)
+#define HOLOSCAN_TARGET_CLONES __attribute__((target_clones("avx2", "default")))
+#endif
+#endif
+#endif
+#ifndef HOLOSCAN_TARGET_CLONES
+#define HOLOSCAN_TARGET_CLONES
+#endif
+
+#endif /* GXF_EXTENSIONS_UTILS_CPU_DISPATCH_HPP */
@@ -0,0 +1,163 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GXF_EXTENSIONS_UTILS_ROW_WORKER_POOL_HPP
+#define GXF_EXTENSIONS_UTILS_ROW_WORKER_POOL_HPP
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace nvidia {
+namespace holoscan {
+
+/**
+ * This class splits the rows of an image across a set of long-lived threads, for codelets
+ * processing images on the CPU.
+ *
+ * The calling thread processes the first block of rows and the worker threads the following
+ * ones, blocks have the same size. The threads are started by the constructor and reused by each
+ * call to run(), which does not allocate memory.
+ *
+ * Usage:
+ * - add an instance of RowWorkerPool to your codelet, created in start() with the number of
+ *   threads to use
+ * - in the tick() function call RowWorkerPool::run() with the row count and a function processing
+ *   a range of rows
+ */
+class RowWorkerPool {
+ public:
+  /**
+   * @brief Construct a new RowWorkerPool object
+   *
+   * @param thread_count Number of threads processing rows, including the calling thread
+   */
+  explicit RowWorkerPool(size_t thread_count) : thread_count_(std::max<size_t>(thread_count, 1)) {
+    workers_.reserve(thread_count_ - 1);
+    for (size_t i = 1; i < thread_count_; i++) {
+      workers_.emplace_back([this, i]() { work(i); });
+    }
+  }
+
+  /**
+   * @brief Destroy the RowWorkerPool object, waits for the threads to exit
+   */
+  ~RowWorkerPool() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stopping_ = true;
+    }
+    start_cv_.notify_all();
+    for (auto& worker : workers_) { worker.join(); }
+  }
+
+  RowWorkerPool(const RowWorkerPool&) = delete;
+  RowWorkerPool& operator=(const RowWorkerPool&) = delete;
+
+  /**
+   * @brief Get the number of threads processing rows, including the calling thread
+   */
+  size_t threadCount() const { return thread_count_; }
+
+  /**
+   * @brief Process rows [0, row_count) and wait for all of them to be processed
+   *
+   * @param row_count Number of rows
+   * @param function Called with (begin_row, end_row) for each block of rows, concurrently
+   */
+  template <typename Function>
+  void run(size_t row_count, Function&& function) {
+    const size_t rows_per_thread = (row_count + thread_count_ - 1) / thread_count_;
+    if (workers_.empty() || rows_per_thread == 0 || rows_per_thread == row_count) {
+      function(size_t{0}, row_count);
+      return;
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      context_ = const_cast<void*>(static_cast<const void*>(&function));
+      invoke_ = [](void* context, size_t begin_row, size_t end_row) {
+        (*static_cast<std::remove_reference_t<Function>*>(context))(begin_row, end_row);
+      };
+      row_count_ = row_count;
+      rows_per_thread_ = rows_per_thread;
+      pending_ = workers_.size();
+      generation_++;
+    }
+    start_cv_.notify_all();
+
+    function(size_t{0}, rows_per_thread);
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_cv_.wait(lock, [this]() { return pending_ == 0; });
+  }
+
+ private:
+  void work(size_t index) {
+    uint64_t generation = 0;
+    while (true) {
+      void* context;
+      void (*invoke)(void*, size_t, size_t);
+      size_t begin_row, end_row;
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        start_cv_.wait(lock,
+                       [this, generation]() { return stopping_ || generation_ != generation; });
+        if (stopping_) { return; }
+        generation = generation_;
+        context = context_;
+        invoke = invoke_;
+        begin_row = std::min(index * rows_per_thread_, row_count_);
+        end_row = std::min(begin_row + rows_per_thread_, row_count_);
+      }
+
+      if (begin_row < end_row) { invoke(context, begin_row, end_row); }
+
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        pending_--;
+        if (pending_ != 0) { continue; }
+      }
+      done_cv_.notify_one();
+    }
+  }
+
+  const size_t thread_count_;
+  std::vector<std::thread> workers_;
+
+  std::mutex mutex_;
+  std::condition_variable start_cv_;
+  std::condition_variable done_cv_;
+  uint64_t generation_ = 0;
+  size_t pending_ = 0;
+  bool stopping_ = false;
+
+  void* context_ = nullptr;
+  void (*invoke_)(void*, size_t, size_t) = nullptr;
+  size_t row_count_ = 0;
+  size_t rows_per_thread_ = 0;
+};
+
+}  // namespace holoscan
+}  // namespace nvidia
+
+#endif /* GXF_EXTENSIONS_UTILS_ROW_WORKER_POOL_HPP */
@@ -0,0 +1,402 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "v4l2_device.hpp"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <linux/videodev2.h>
+#include <poll.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "common/logger.hpp"
+#include "gxf/multimedia/video.hpp"
+
+namespace nvidia {
+namespace holoscan {
+
+namespace {
+
+std::string FourccToString(uint32_t fourcc) {
+  std::string name(4, ' ');
+  for (int i = 0; i < 4; i++) { name[i] = static_cast<char>((fourcc >> (8 * i)) & 0xff); }
+  return name;
+}
+
+/// ioctl, retried when interrupted by a signal
+int Ioctl(int fd, unsigned long request, void* arg) {  // NOLINT(runtime/int)
+  int result;
+  do { result = ioctl(fd, request, arg); } while (result < 0 && errno == EINTR);
+  return result;
+}
+
+gxf::ColorPlane MakeColorPlane(const char* color_space, uint8_t bytes_per_pixel, uint32_t stride,
+                               uint32_t offset, uint32_t width, uint32_t height) {
+  gxf::ColorPlane plane(color_space, bytes_per_pixel, stride);
+  plane.offset = offset;
+  plane.width = width;
+  plane.height = height;
+  plane.size = static_cast<uint64_t>(stride) * height;
+  return plane;
+}
+
+}  // namespace
+
+gxf::Expected<uint32_t> ParseV4L2PixelFormat(const std::string& name) {
+  if (name == "YUYV") { return V4L2_PIX_FMT_YUYV; }
+  if (name == "NV12") { return V4L2_PIX_FMT_NV12; }
+  if (name == "MJPG" || name == "MJPEG") { return V4L2_PIX_FMT_MJPEG; }
+  if (name == "GREY") { return V4L2_PIX_FMT_GREY; }
+  GXF_LOG_ERROR("Unsupported pixel format '%s'", name.c_str());
+  return gxf::Unexpected{GXF_ARGUMENT_INVALID};
+}
+
+gxf::Expected<V4L2Memory> ParseV4L2Memory(const std::string& name) {
+  if (name == "mmap") { return V4L2Memory::kMmap; }
+  if (name == "userptr") { return V4L2Memory::kUserPtr; }
+  GXF_LOG_ERROR("Unsupported V4L2 memory type '%s'", name.c_str());
+  return gxf::Unexpected{GXF_ARGUMENT_INVALID};
+}
+
+V4L2Device::~V4L2Device() {
+  stop();
+
+  for (const auto& buffer : buffers_) {
+    if (memory_ == V4L2Memory::kMmap) {
+      if (munmap(buffer.ptr, buffer.length) < 0) {
+        GXF_LOG_ERROR("Failed to unmap buffer from %s", path_.c_str());
+      }
+    } else {
+      std::free(buffer.ptr);
+    }
+  }
+  buffers_.clear();
+
+  if (fd_ >= 0) {
+    close(fd_);
+    fd_ = -1;
+  }
+}
+
+gxf::Expected<void> V4L2Device::open(const std::string& path, uint32_t width, uint32_t height,
+                                     uint32_t pixel_format, V4L2Memory memory,
+                                     uint32_t num_buffers, uint32_t max_in_flight) {
+  if (fd_ >= 0) {
+    GXF_LOG_ERROR("%s is already open", path_.c_str());
+    return gxf::Unexpected{GXF_FAILURE};
+  }
+  path_ = path;
+  memory_ = memory;
+
+  // Open the device, frames are waited for with poll() so that a dequeue never blocks
+  fd_ = ::open(path.c_str(), O_RDWR | O_NONBLOCK);
+  if (fd_ < 0) {
+    GXF_LOG_ERROR("Failed to open %s: %s", path.c_str(), strerror(errno));
+    return gxf::Unexpected{GXF_FAILURE};
+  }
+
+  // Get and check the device capabilities
+  v4l2_capability caps = {};
+  if (Ioctl(fd_, VIDIOC_QUERYCAP, &caps) < 0) {
+    GXF_LOG_ERROR("%s is not a v4l2 device.", path.c_str());
+    return gxf::Unexpected{GXF_FAILURE};
+  }
+  if (!(caps.capabilities & V4L2_CAP_VIDEO_CAPTURE)) {
+    GXF_LOG_ERROR("%s is not a video capture device.", path.c_str());
+    return gxf::Unexpected{GXF_FAILURE};
+  }
+  if (!(caps.capabilities & V4L2_CAP_STREAMING)) {
+    GXF_LOG_ERROR("%s does not support streaming I/O.", path.c_str());
+    return gxf::Unexpected{GXF_FAILURE};
+  }
+
+  auto result = setFormat(width, height, pixel_format);
+  if (!result) { return result; }
+
+  // Request buffers from the device
+  const uint32_t v4l2_memory =
+      memory == V4L2Memory::kMmap ? V4L2_MEMORY_MMAP : V4L2_MEMORY_USERPTR;
+  v4l2_requestbuffers req = {};
+  req.count = num_buffers;
+  req.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+  req.memory = v4l2_memory;
+  if (Ioctl(fd_, VIDIOC_REQBUFS, &req) < 0 || req.count == 0) {
+    GXF_LOG_ERROR("Could not request %s buffers from %s, VIDIOC_REQBUFS",
+                  memory == V4L2Memory::kMmap ? "mmap" : "userptr", path.c_str());
+    return gxf::Unexpected{GXF_FAILURE};
+  }
+
+  // Map or allocate the buffers, the driver may have changed their count
+  const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  for (uint32_t i = 0; i < req.count; i++) {
+    if (memory == V4L2Memory::kMmap) {
+      v4l2_buffer buf = {};
+      buf.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+      buf.memory = V4L2_MEMORY_MMAP;
+      buf.index = i;
+      if (Ioctl(fd_, VIDIOC_QUERYBUF, &buf) < 0) {
+        GXF_LOG_ERROR("Failed to query buffer from %s", path.c_str());
+        return gxf::Unexpected{GXF_FAILURE};
+      }
+      void* ptr =
+          mmap(nullptr, buf.length, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, buf.m.offset);
+      if (ptr == MAP_FAILED) {
+        GXF_LOG_ERROR("Failed to map buffer provided by %s", path.c_str());
+        return gxf::Unexpected{GXF_FAILURE};
+      }
+      buffers_.push_back({ptr, buf.length});
+    } else {
+      const size_t length = (size_image_ + page_size - 1) / page_size * page_size;
+      void* ptr = std::aligned_alloc(page_size, length);
+      if (ptr == nullptr) {
+        GXF_LOG_ERROR("Failed to allocate a buffer of %zu bytes for %s", length, path.c_str());
+        return gxf::Unexpected{GXF_OUT_OF_MEMORY};
+      }
+      buffers_.push_back({ptr, length});
+    }
+  }
+
+  // The driver keeps at least one buffer to capture into
+  max_in_flight_ = std::clamp<uint32_t>(max_in_flight, 1, std::max<uint32_t>(req.count - 1, 1));
+
+  // Queue all buffers and start streaming
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (uint32_t i = 0; i < buffers_.size(); i++) {
+    result = queueLocked(i);
+    if (!result) { return result; }
+  }
+  v4l2_buf_type type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+  if (Ioctl(fd_, VIDIOC_STREAMON, &type) < 0) {
+    GXF_LOG_ERROR("Could not start streaming, VIDIOC_STREAMON");
+    return gxf::Unexpected{GXF_FAILURE};
+  }
+  streaming_ = true;
+  in_flight_ = 0;
+
+  return gxf::Success;
+}
+
+gxf::Expected<void> V4L2Device::setFormat(uint32_t width, uint32_t height,
+                                          uint32_t pixel_format) {
+  // Check that the device supports the pixel format
+  std::string supported_formats;
+  bool is_supported = false;
+  v4l2_fmtdesc fmtdesc = {};
+  fmtdesc.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+  for (fmtdesc.index = 0; Ioctl(fd_, VIDIOC_ENUM_FMT, &fmtdesc) == 0; fmtdesc.index++) {
+    if (fmtdesc.pixelformat == pixel_format) { is_supported = true; }
+    supported_formats += (supported_formats.empty() ? "" : ", ") +
+                         FourccToString(fmtdesc.pixelformat);
+  }
+  if (!is_supported) {
+    GXF_LOG_ERROR("Pixel format %s is not supported by %s, supported formats: %s",
+                  FourccToString(pixel_format).c_str(), path_.c_str(), supported_formats.c_str());
+    return gxf::Unexpected{GXF_FAILURE};
+  }
+
+  // Set image format
+  v4l2_format fmt = {};
+  fmt.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+  fmt.fmt.pix.width = width;
+  fmt.fmt.pix.height = height;
+  fmt.fmt.pix.pixelformat = pixel_format;
+  fmt.fmt.pix.field = V4L2_FIELD_NONE;
+  if (Ioctl(fd_, VIDIOC_S_FMT, &fmt) < 0) {
+    GXF_LOG_ERROR("Failed to set the image format on %s (%dx%d, format = %s)", path_.c_str(),
+                  width, height, FourccToString(pixel_format).c_str());
+    return gxf::Unexpected{GXF_FAILURE};
+  }
+  if (fmt.fmt.pix.width != width || fmt.fmt.pix.height != height ||
+      fmt.fmt.pix.pixelformat != pixel_format) {
+    GXF_LOG_ERROR("Format %dx%d %s not supported by %s, the closest is %dx%d %s", width, height,
+                  FourccToString(pixel_format).c_str(), path_.c_str(), fmt.fmt.pix.width,
+                  fmt.fmt.pix.height, FourccToString(fmt.fmt.pix.pixelformat).c_str());
+    return gxf::Unexpected{GXF_FAILURE};
+  }
+
+  width_ = fmt.fmt.pix.width;
+  height_ = fmt.fmt.pix.height;
+  pixel_format_ = fmt.fmt.pix.pixelformat;
+  bytes_per_line_ = fmt.fmt.pix.bytesperline;
+  size_image_ = fmt.fmt.pix.sizeimage;
+  return gxf::Success;
+}
+
+gxf::Expected<void> V4L2Device::stop() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!streaming_) { return gxf::Success; }
+  streaming_ = false;
+  buffer_returned_.notify_all();
+
+  v4l2_buf_type type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+  if (Ioctl(fd_, VIDIOC_STREAMOFF, &type) < 0) {
+    GXF_LOG_ERROR("Could not end streaming, VIDIOC_STREAMOFF");
+    return gxf::Unexpected{GXF_FAILURE};
+  }
+  return gxf::Success;
+}
+
+gxf::Expected<bool> V4L2Device::dequeue(int timeout_ms, V4L2Frame* frame) {
+  const auto deadline =
+      std::chrono::steady_clock::now() + std::chrono::milliseconds(std::max(timeout_ms, 0));
+  {
+    // Wait for the consumers to return a buffer when all the buffers they may hold are dequeued
+    std::unique_lock<std::mutex> lock(mutex_);
+    const auto can_dequeue = [this] { return !streaming_ || in_flight_ < max_in_flight_; };
+    if (timeout_ms < 0) {
+      buffer_returned_.wait(lock, can_dequeue);
+    } else {
+      buffer_returned_.wait_until(lock, deadline, can_dequeue);
+    }
+    if (!streaming_) {
+      GXF_LOG_ERROR("%s is not streaming", path_.c_str());
+      return gxf::Unexpected{GXF_FAILURE};
+    }
+    if (in_flight_ >= max_in_flight_) { return false; }
+  }
+
+  // Poll for the rest of the timeout
+  int poll_timeout_ms = -1;
+  if (timeout_ms >= 0) {
+    const auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+        deadline - std::chrono::steady_clock::now());
+    poll_timeout_ms = static_cast<int>(std::max<int64_t>(remaining.count(), 0));
+  }
+  pollfd poll_fd = {fd_, POLLIN, 0};
+  const int ready = poll(&poll_fd, 1, poll_timeout_ms);
+  if (ready < 0) {
+    if (errno == EINTR) { return false; }
+    GXF_LOG_ERROR("Failed to poll %s: %s", path_.c_str(), strerror(errno));
+    return gxf::Unexpected{GXF_FAILURE};
+  }
+  if (ready == 0) { return false; }
+  if (poll_fd.revents & (POLLERR | POLLHUP | POLLNVAL)) {
+    GXF_LOG_ERROR("Failed to poll %s, the device reported an error", path_.c_str());
+    return gxf::Unexpected{GXF_FAILURE};
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  v4l2_buffer buf = {};
+  buf.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+  buf.memory = memory_ == V4L2Memory::kMmap ? V4L2_MEMORY_MMAP : V4L2_MEMORY_USERPTR;
+  if (Ioctl(fd_, VIDIOC_DQBUF, &buf) < 0) {
+    if (errno == EAGAIN) { return false; }
+    GXF_LOG_ERROR("Failed to dequeue buffer from %s", path_.c_str());
+    return gxf::Unexpected{GXF_FAILURE};
+  }
+  in_flight_++;
+
+  frame->index = buf.index;
+  frame->data = buffers_[buf.index].ptr;
+  frame->bytes_used = buf.bytesused;
+  return true;
+}
+
+gxf::Expected<void> V4L2Device::queue(uint32_t index) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (index >= buffers_.size()) {
+    GXF_LOG_ERROR("Invalid buffer index %u for %s", index, path_.c_str());
+    return gxf::Unexpected{GXF_ARGUMENT_OUT_OF_RANGE};
+  }
+  if (in_flight_ > 0) {
+    in_flight_--;
+    buffer_returned_.notify_one();
+  }
+  if (!streaming_) { return gxf::Success; }
+  return queueLocked(index);
+}
+
+gxf::Expected<void> V4L2Device::queueLocked(uint32_t index) {
+  v4l2_buffer buf = {};
+  buf.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+  buf.index = index;
+  if (memory_ == V4L2Memory::kMmap) {
+    buf.memory = V4L2_MEMORY_MMAP;
+  } else {
+    buf.memory = V4L2_MEMORY_USERPTR;
+    buf.m.userptr = reinterpret_cast<unsigned long>(buffers_[index].ptr);  // NOLINT(runtime/int)
+    buf.length = buffers_[index].length;
+  }
+  if (Ioctl(fd_, VIDIOC_QBUF, &buf) < 0) {
+    GXF_LOG_ERROR("Failed to queue buffer %u on %s", index, path_.c_str());
+    return gxf::Unexpected{GXF_FAILURE};
+  }
+  return gxf::Success;
+}
+
+uint32_t V4L2Device::inFlight() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return in_flight_;
+}
+
+gxf::Expected<void> WrapV4L2Frame(const std::shared_ptr<V4L2Device>& device,
+                                  const V4L2Frame& frame, gxf::VideoBuffer* video_buffer) {
+  const uint32_t width = device->width();
+  const uint32_t height = device->height();
+  const uint32_t stride = device->bytesPerLine();
+
+  gxf::VideoFormat color_format = gxf::VideoFormat::GXF_VIDEO_FORMAT_CUSTOM;
+  std::vector<gxf::ColorPlane> color_planes;
+  uint64_t size = device->sizeImage();
+  switch (device->pixelFormat()) {
+    case V4L2_PIX_FMT_YUYV:
+      color_planes.push_back(MakeColorPlane("YUYV", 2, stride, 0, width, height));
+      break;
+    case V4L2_PIX_FMT_NV12:
+      color_format = gxf::VideoFormat::GXF_VIDEO_FORMAT_NV12;
+      color_planes.push_back(MakeColorPlane("Y", 1, stride, 0, width, height));
+      color_planes.push_back(
+          MakeColorPlane("UV", 2, stride, stride * height, width / 2, height / 2));
+      break;
+    case V4L2_PIX_FMT_GREY:
+      color_format = gxf::VideoFormat::GXF_VIDEO_FORMAT_GRAY;
+      color_planes.push_back(MakeColorPlane("gray", 1, stride, 0, width, height));
+      break;
+    default:
+      // compressed frame, a single row of the size of the frame data
+      size = frame.bytes_used;
+      color_planes.push_back(
+          MakeColorPlane("MJPG", 1, frame.bytes_used, 0, frame.bytes_used, 1));
+      break;
+  }
+  gxf::VideoBufferInfo info{width, height, color_format, color_planes,
+                            gxf::SurfaceLayout::GXF_SURFACE_LAYOUT_PITCH_LINEAR};
+
+  // The buffer is returned to the driver when the video buffer is destroyed, the device is kept
+  // alive until then
+  std::shared_ptr<V4L2Device> owner = device;
+  const uint32_t index = frame.index;
+  const auto result =
+      video_buffer->wrapMemory(info, size, gxf::MemoryStorageType::kSystem, frame.data,
+                               [owner, index](void*) { return owner->queue(index); });
+  if (!result) {
+    GXF_LOG_ERROR("Failed to wrap V4L2 buffer %u", index);
+    device->queue(index);
+  }
+  return result;
+}
+
+}  // namespace holoscan
+}  // namespace nvidia
@@ -0,0 +1,145 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef NVIDIA_CLARA_HOLOSCAN_GXF_V4L2_DEVICE_HPP_
+#define NVIDIA_CLARA_HOLOSCAN_GXF_V4L2_DEVICE_HPP_
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "gxf/core/expected.hpp"
+
+namespace nvidia {
+namespace gxf {
+class VideoBuffer;
+}  // namespace gxf
+
+namespace holoscan {
+
+/// Parses a pixel format name: "YUYV", "NV12", "MJPG" (or "MJPEG") or "GREY", and returns its
+/// V4L2 fourcc code
+gxf::Expected<uint32_t> ParseV4L2PixelFormat(const std::string& name);
+
+/// Memory of the V4L2 capture buffers
+enum class V4L2Memory {
+  kMmap,     // Buffers allocated by the driver and mapped in the process
+  kUserPtr,  // Buffers allocated by the process
+};
+
+/// Parses "mmap" or "userptr"
+gxf::Expected<V4L2Memory> ParseV4L2Memory(const std::string& name);
+
+/// A capture buffer dequeued from the device, owned by the caller until it is queued again.
+struct V4L2Frame {
+  uint32_t index;
+  void* data;
+  size_t bytes_used;
+};
+
+/// @brief Capture stream of a V4L2 device.
+///
+/// Negotiates the image format, sets up the capture buffers and streams frames to the caller
+/// without copies. Dequeued buffers are owned by the caller until queue() returns them to the
+/// driver, at most `max_in_flight` buffers are dequeued at a time so that the driver always keeps
+/// a buffer to capture into.
+///
+/// queue() can be called from any thread, and after the stream is stopped. The device and the
+/// buffers are released by the destructor, so an instance is shared with the consumers of its
+/// buffers when they can outlive the capture.
+class V4L2Device {
+ public:
+  V4L2Device() = default;
+  ~V4L2Device();
+
+  V4L2Device(const V4L2Device&) = delete;
+  V4L2Device& operator=(const V4L2Device&) = delete;
+
+  /// Opens the device, sets the format, allocates and queues the buffers, and starts streaming.
+  ///
+  /// Fails with the list of the formats of the device when the format is not supported.
+  gxf::Expected<void> open(const std::string& path, uint32_t width, uint32_t height,
+                           uint32_t pixel_format, V4L2Memory memory, uint32_t num_buffers,
+                           uint32_t max_in_flight);
+
+  /// Stops streaming, the buffers still dequeued stay valid until the device is destroyed
+  gxf::Expected<void> stop();
+
+  /// Waits up to `timeout_ms` for a captured frame and dequeues it, waits forever when
+  /// `timeout_ms` is negative.
+  ///
+  /// When `max_in_flight` buffers are already dequeued, first waits for queue() to return one
+  /// within the same timeout. Returns false when no frame is captured in time.
+  gxf::Expected<bool> dequeue(int timeout_ms, V4L2Frame* frame);
+
+  /// Returns a dequeued buffer to the driver, does nothing once the stream is stopped. Wakes up a
+  /// dequeue() waiting for a buffer.
+  gxf::Expected<void> queue(uint32_t index);
+
+  uint32_t width() const { return width_; }
+  uint32_t height() const { return height_; }
+  uint32_t pixelFormat() const { return pixel_format_; }
+  /// Bytes per row of the image, or 0 for compressed formats
+  uint32_t bytesPerLine() const { return bytes_per_line_; }
+  /// Maximum size of a frame in bytes
+  uint32_t sizeImage() const { return size_image_; }
+  uint32_t numBuffers() const { return static_cast<uint32_t>(buffers_.size()); }
+  uint32_t maxInFlight() const { return max_in_flight_; }
+  /// Number of buffers currently dequeued
+  uint32_t inFlight();
+
+ private:
+  struct Buffer {
+    void* ptr;
+    size_t length;
+  };
+
+  gxf::Expected<void> setFormat(uint32_t width, uint32_t height, uint32_t pixel_format);
+  gxf::Expected<void> queueLocked(uint32_t index);
+
+  int fd_ = -1;
+  std::string path_;
+  V4L2Memory memory_ = V4L2Memory::kMmap;
+  std::vector<Buffer> buffers_;
+  uint32_t width_ = 0;
+  uint32_t height_ = 0;
+  uint32_t pixel_format_ = 0;
+  uint32_t bytes_per_line_ = 0;
+  uint32_t size_image_ = 0;
+  uint32_t max_in_flight_ = 1;
+
+  std::mutex mutex_;
+  // Signalled when a buffer is returned or the stream is stopped
+  std::condition_variable buffer_returned_;
+  bool streaming_ = false;
+  uint32_t in_flight_ = 0;
+};
+
+/// Wraps a frame dequeued from `device` in `video_buffer` without copy. The buffer is queued back
+/// to the device when the video buffer releases the memory, the device is kept alive until then.
+///
+/// The frame is queued back right away when it can not be wrapped.
+gxf::Expected<void> WrapV4L2Frame(const std::shared_ptr<V4L2Device>& device,
+                                  const V4L2Frame& frame, gxf::VideoBuffer* video_buffer);
+
+}  // namespace holoscan
+}  // namespace nvidia
+
+#endif  // NVIDIA_CLARA_HOLOSCAN_GXF_V4L2_DEVICE_HPP_
@@ -16,13 +16,8 @@
  */
 #include "v4l2_source.hpp"
 
-#include <fcntl.h>
 #include <linux/videodev2.h>
-#include <sys/ioctl.h>
-#include <sys/mman.h>
-#include <unistd.h>
 
-#include <algorithm>
 #include <string>
 #include <utility>
 
@@ -36,6 +31,13 @@ static constexpr char kDefaultDevice[] = "/dev/video0";
 static constexpr uint32_t kDefaultWidth = 640;
 static constexpr uint32_t kDefaultHeight = 480;
 static constexpr uint32_t kDefaultNumBuffers = 2;
+static constexpr char kDefaultColorMatrix[] = "bt601_full";
+static constexpr uint32_t kDefaultNumThreads = 1;
+static constexpr char kDefaultPixelFormat[] = "YUYV";
+static constexpr char kDefaultMemoryType[] = "mmap";
+static constexpr bool kDefaultPassThrough = false;
+static constexpr uint32_t kDefaultMaxInFlightBuffers = 1;
+static constexpr int32_t kDefaultDequeueTimeoutMs = 10;
 
 gxf_result_t V4L2Source::registerInterface(gxf::Registrar* registrar) {
   gxf::Expected<void> result;
@@ -49,105 +51,75 @@ gxf_result_t V4L2Source::registerInterface(gxf::Registrar* registrar) {
       registrar->parameter(height_, "height", "Height", "Height of the V4L2 image", kDefaultHeight);
   result &= registrar->parameter(num_buffers_, "numBuffers", "NumBuffers",
                                  "Number of V4L2 buffers to use", kDefaultNumBuffers);
+  result &= registrar->parameter(color_matrix_, "color_matrix", "ColorMatrix",
+                                 "Color matrix and range of the YUYV data: bt601_full, "
+                                 "bt601_limited, bt709_full or bt709_limited",
+                                 std::string(kDefaultColorMatrix));
+  result &= registrar->parameter(num_threads_, "num_threads", "NumThreads",
+                                 "Number of threads converting the rows of the YUYV data to RGBA",
+                                 kDefaultNumThreads);
+  result &= registrar->parameter(pixel_format_, "pixel_format", "PixelFormat",
+                                 "Pixel format captured from the device: YUYV, NV12, MJPG or "
+                                 "GREY. Only YUYV can be converted to RGBA.",
+                                 std::string(kDefaultPixelFormat));
+  result &= registrar->parameter(memory_type_, "memory_type", "MemoryType",
+                                 "Memory of the V4L2 buffers: mmap (allocated by the driver) or "
+                                 "userptr (allocated by the codelet)",
+                                 std::string(kDefaultMemoryType));
+  result &= registrar->parameter(pass_through_, "pass_through", "PassThrough",
+                                 "Publish the V4L2 buffers in the pixel format of the device "
+                                 "without copy, instead of converting them to RGBA",
+                                 kDefaultPassThrough);
+  result &= registrar->parameter(max_in_flight_buffers_, "max_in_flight_buffers",
+                                 "MaxInFlightBuffers",
+                                 "Maximum number of V4L2 buffers held downstream in pass-through "
+                                 "mode, at most numBuffers - 1",
+                                 kDefaultMaxInFlightBuffers);
+  result &= registrar->parameter(dequeue_timeout_ms_, "dequeue_timeout_ms", "DequeueTimeoutMs",
+                                 "Maximum time a tick waits for a frame, in milliseconds, "
+                                 "including the wait for a buffer held downstream to be "
+                                 "returned. No message is published when no frame is captured "
+                                 "in time.",
+                                 kDefaultDequeueTimeoutMs);
   return gxf::ToResultCode(result);
 }
 
 gxf_result_t V4L2Source::start() {
-  // Open the device
-  fd_ = open(device_.get().c_str(), O_RDWR);
-  if (fd_ < 0) {
-    perror("Failed to open device, OPEN");
+  YUVColorMatrix color_matrix;
+  if (!ParseYUVColorMatrix(color_matrix_.get(), &color_matrix)) {
+    GXF_LOG_ERROR("Unsupported color matrix %s", color_matrix_.get().c_str());
     return GXF_FAILURE;
   }
+  yuv_to_rgb_coefficients_ = GetYUVToRGBCoefficients(color_matrix);
 
-  // Ask the device if it can capture frames
-  v4l2_capability capability;
-  if (ioctl(fd_, VIDIOC_QUERYCAP, &capability) < 0) {
-    perror("Failed to get device capabilities, VIDIOC_QUERYCAP");
+  const auto pixel_format = ParseV4L2PixelFormat(pixel_format_.get());
+  if (!pixel_format) { return gxf::ToResultCode(pixel_format); }
+  if (!pass_through_.get() && pixel_format.value() != V4L2_PIX_FMT_YUYV) {
+    GXF_LOG_ERROR("Pixel format %s can't be converted to RGBA, enable pass_through",
+                  pixel_format_.get().c_str());
     return GXF_FAILURE;
   }
+  const auto memory = ParseV4L2Memory(memory_type_.get());
+  if (!memory) { return gxf::ToResultCode(memory); }
 
-  // Get and check the device capabilities
-  v4l2_capability caps;
-  if (ioctl(fd_, VIDIOC_QUERYCAP, &caps) < 0) {
-    GXF_LOG_ERROR("%s is not a v4l2 device.", device_);
-    return GXF_FAILURE;
-  }
-  if (!(caps.capabilities & V4L2_CAP_VIDEO_CAPTURE)) {
-    GXF_LOG_ERROR("%s is not a video capture device.", device_);
-    return GXF_FAILURE;
-  }
-  if (!(caps.capabilities & V4L2_CAP_STREAMING)) {
-    GXF_LOG_ERROR("%s does not support streaming I/O.", device_);
-    return GXF_FAILURE;
+  if (!pass_through_.get()) {
+    row_worker_pool_ = std::make_unique<RowWorkerPool>(num_threads_.get());
   }
 
-  // Set image format
-  v4l2_format fmt;
-  uint32_t pixel_format = V4L2_PIX_FMT_YUYV;
-  fmt.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
-  fmt.fmt.pix.width = width_.get();
-  fmt.fmt.pix.height = height_.get();
-  fmt.fmt.pix.pixelformat = pixel_format;
-  fmt.fmt.pix.field = V4L2_FIELD_NONE;
-  if (ioctl(fd_, VIDIOC_S_FMT, &fmt) < 0) {
-    GXF_LOG_ERROR("Failed to set the image format on %s (%dx%d, format = %d)", device_,
-                  width_.get(), height_.get(), pixel_format);
-    return GXF_FAILURE;
-  }
-  if (fmt.fmt.pix.width != width_.get() || fmt.fmt.pix.height != height_.get() ||
-      fmt.fmt.pix.pixelformat != pixel_format) {
-    GXF_LOG_ERROR("Format not supported by %s", device_);
-    return GXF_FAILURE;
+  // In conversion mode a buffer is returned to the driver before the next one is dequeued
+  const uint32_t max_in_flight = pass_through_.get() ? max_in_flight_buffers_.get() : 1;
+  v4l2_device_ = std::make_shared<V4L2Device>();
+  const auto result = v4l2_device_->open(device_.get(), width_.get(), height_.get(),
+                                         pixel_format.value(), memory.value(),
+                                         num_buffers_.get(), max_in_flight);
+  if (!result) {
+    v4l2_device_.reset();
+    return gxf::ToResultCode(result);
   }
-
-  // Request buffers from the device
-  v4l2_requestbuffers req = {0};
-  req.count = num_buffers_.get();
-  req.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
-  req.memory = V4L2_MEMORY_MMAP;
-  if (ioctl(fd_, VIDIOC_REQBUFS, &req) < 0) {
-    GXF_LOG_ERROR("Could not request buffer from device, VIDIOC_REQBUFS");
-    return GXF_FAILURE;
-  }
-
-  // Retrieve and map the buffers.
-  for (size_t i = 0; i < req.count; i++) {
-    v4l2_buffer buf = {0};
-    buf.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
-    buf.memory = V4L2_MEMORY_MMAP;
-    buf.index = i;
-    if (ioctl(fd_, VIDIOC_QUERYBUF, &buf) < 0) {
-      GXF_LOG_ERROR("Failed to query buffer from %s", device_);
-      return GXF_FAILURE;
-    }
-
-    void* ptr = mmap(nullptr, buf.length, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, buf.m.offset);
-    if (!ptr) {
-      GXF_LOG_ERROR("Failed to map buffer provided by %s", device_);
-      return GXF_FAILURE;
-    }
-
-    buffers_.push_back(Buffer(ptr, buf.length));
-  }
-
-  // Queue all buffers.
-  for (size_t i = 0; i < buffers_.size(); i++) {
-    v4l2_buffer buf = {0};
-    buf.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
-    buf.memory = V4L2_MEMORY_MMAP;
-    buf.index = i;
-    if (ioctl(fd_, VIDIOC_QBUF, &buf) < 0) {
-      GXF_LOG_ERROR("Failed to queue buffer %d on %s", i, device_);
-      return GXF_FAILURE;
-    }
-  }
-
-  // Start streaming.
-  v4l2_buf_type type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
-  if (ioctl(fd_, VIDIOC_STREAMON, &type) < 0) {
-    GXF_LOG_ERROR("Could not start streaming, VIDIOC_STREAMON");
-    return GXF_FAILURE;
+  if (pass_through_.get() && v4l2_device_->maxInFlight() != max_in_flight) {
+    GXF_LOG_WARNING("%s has %u buffers, at most %u buffers are held downstream",
+                    device_.get().c_str(), v4l2_device_->numBuffers(),
+                    v4l2_device_->maxInFlight());
   }
 
   return GXF_SUCCESS;
@@ -156,110 +128,74 @@ gxf_result_t V4L2Source::start() {
 gxf_result_t V4L2Source::stop() {
   gxf_result_t result = GXF_SUCCESS;
 
-  // Stop streaming.
-  v4l2_buf_type type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
-  if (ioctl(fd_, VIDIOC_STREAMOFF, &type) < 0) {
-    GXF_LOG_ERROR("Could not end streaming, VIDIOC_STREAMOFF");
-    result = GXF_FAILURE;
+  // The device is closed once the buffers still held downstream are released
+  if (v4l2_device_) {
+    result = gxf::ToResultCode(v4l2_device_->stop());
+    v4l2_device_.reset();
   }
-
-  // Unmap the buffers.
-  for (const auto& buffer : buffers_) {
-    if (munmap(buffer.ptr, buffer.length) < 0) {
-      GXF_LOG_ERROR("Failed to unmap buffer from %s", device_);
-      result = GXF_FAILURE;
-    }
-  }
-  buffers_.clear();
-
-  close(fd_);
-  fd_ = -1;
+  row_worker_pool_.reset();
 
   return result;
 }
 
 gxf_result_t V4L2Source::tick() {
+  // Wait for a returned buffer and the next captured frame without blocking the scheduler thread
+  // for longer than the timeout
+  V4L2Frame frame;
+  const auto dequeued = v4l2_device_->dequeue(dequeue_timeout_ms_.get(), &frame);
+  if (!dequeued) { return gxf::ToResultCode(dequeued); }
+  // no frame captured in time, or all buffers are held downstream
+  if (!dequeued.value()) { return GXF_SUCCESS; }
+
   auto message = gxf::Entity::New(context());
   if (!message) {
     GXF_LOG_ERROR("Failed to allocate message");
+    v4l2_device_->queue(frame.index);
     return GXF_FAILURE;
   }
 
-  auto rgba_buf = message.value().add<gxf::VideoBuffer>();
-  if (!rgba_buf) {
-    GXF_LOG_ERROR("Failed to allocate RGBA buffer");
+  auto video_buffer = message.value().add<gxf::VideoBuffer>();
+  if (!video_buffer) {
+    GXF_LOG_ERROR("Failed to allocate video buffer");
+    v4l2_device_->queue(frame.index);
     return GXF_FAILURE;
   }
 
-  // Dequeue the next available buffer.
-  v4l2_buffer v4l2_buf = {0};
-  v4l2_buf.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
-  v4l2_buf.memory = V4L2_MEMORY_MMAP;
-  if (ioctl(fd_, VIDIOC_DQBUF, &v4l2_buf) < 0) {
-    GXF_LOG_ERROR("Failed to dequeue buffer from %s", device_);
-    return GXF_FAILURE;
-  }
-  Buffer& buf = buffers_[v4l2_buf.index];
+  const auto result = pass_through_.get()
+                          ? WrapV4L2Frame(v4l2_device_, frame, video_buffer.value().get())
+                          : convertFrame(frame, video_buffer.value().get());
+  if (!result) { return gxf::ToResultCode(result); }
+
+  return gxf::ToResultCode(signal_->publish(std::move(message.value())));
+}
 
+gxf::Expected<void> V4L2Source::convertFrame(const V4L2Frame& frame,
+                                             gxf::VideoBuffer* video_buffer) {
   // Allocate and convert to an RGBA output buffer.
-  rgba_buf.value()->resize<gxf::VideoFormat::GXF_VIDEO_FORMAT_RGBA>(
+  video_buffer->resize<gxf::VideoFormat::GXF_VIDEO_FORMAT_RGBA>(
       width_, height_, gxf::SurfaceLayout::GXF_SURFACE_LAYOUT_PITCH_LINEAR,
       gxf::MemoryStorageType::kHost, allocator_);
-  if (!rgba_buf.value()->pointer()) {
+  if (!video_buffer->pointer()) {
     GXF_LOG_ERROR("Failed to allocate RGBA buffer.");
-    return GXF_FAILURE;
+    v4l2_device_->queue(frame.index);
+    return gxf::Unexpected{GXF_FAILURE};
   }
-  YUYVToRGBA(buf.ptr, rgba_buf.value()->pointer(), width_, height_);
+  const size_t rgba_pitch = video_buffer->video_frame_info().color_planes[0].stride;
+  YUYVToRGBA(frame.data, video_buffer->pointer(), rgba_pitch);
 
   // Return (queue) the buffer.
-  if (ioctl(fd_, VIDIOC_QBUF, &v4l2_buf) < 0) {
-    GXF_LOG_ERROR("Failed to queue buffer %d on %s", v4l2_buf.index, device_);
-    return GXF_FAILURE;
-  }
-
-  const auto result = signal_->publish(std::move(message.value()));
-
-  return gxf::ToResultCode(message);
+  return v4l2_device_->queue(frame.index);
 }
 
-void V4L2Source::YUYVToRGBA(const void* yuyv, void* rgba, size_t width, size_t height) {
-  auto r_convert = [](int y, int cr) {
-    double r = y + (1.4065 * (cr - 128));
-    return static_cast<unsigned int>(std::max(0, std::min(255, static_cast<int>(r))));
-  };
-  auto g_convert = [](int y, int cb, int cr) {
-    double g = y - (0.3455 * (cb - 128)) - (0.7169 * (cr - 128));
-    return static_cast<unsigned int>(std::max(0, std::min(255, static_cast<int>(g))));
-  };
-  auto b_convert = [](int y, int cb) {
-    double b = y + (1.7790 * (cb - 128));
-    return static_cast<unsigned int>(std::max(0, std::min(255, static_cast<int>(b))));
-  };
-
-  const unsigned char* yuyv_buf = static_cast<const unsigned char*>(yuyv);
-  unsigned char* rgba_buf = static_cast<unsigned char*>(rgba);
-
-  for (unsigned int i = 0, j = 0; i < width * height * 4; i += 8, j += 4) {
-    int cb = yuyv_buf[j + 1];
-    int cr = yuyv_buf[j + 3];
-
-    // First pixel
-    int y = yuyv_buf[j];
-    rgba_buf[i] = r_convert(y, cr);
-    rgba_buf[i + 1] = g_convert(y, cb, cr);
-    rgba_buf[i + 2] = b_convert(y, cb);
-    rgba_buf[i + 3] = 1;
-
-    // Second pixel
-    y = yuyv_buf[j + 2];
-    rgba_buf[i + 4] = r_convert(y, cr);
-    rgba_buf[i + 5] = g_convert(y, cb, cr);
-    rgba_buf[i + 6] = b_convert(y, cb);
-    rgba_buf[i + 7] = 1;
-  }
+void V4L2Source::YUYVToRGBA(const void* yuyv, void* rgba, size_t rgba_pitch) {
+  const uint8_t* yuyv_buf = static_cast<const uint8_t*>(yuyv);
+  uint8_t* rgba_buf = static_cast<uint8_t*>(rgba);
+  const size_t yuyv_pitch = v4l2_device_->bytesPerLine();
+  row_worker_pool_->run(height_.get(), [&](size_t begin_row, size_t end_row) {
+    ConvertYUYVToRGBA(yuyv_buf, yuyv_pitch, rgba_buf, rgba_pitch, width_.get(), begin_row,
+                      end_row, yuv_to_rgb_coefficients_);
+  });
 }
 
-V4L2Source::Buffer::Buffer(void* _ptr, size_t _length) : ptr(_ptr), length(_length) {}
-
 }  // namespace holoscan
 }  // namespace nvidia
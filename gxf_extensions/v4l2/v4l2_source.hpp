@@ -17,13 +17,18 @@
 #ifndef NVIDIA_CLARA_HOLOSCAN_GXF_V4L2_SOURCE_HPP_
 #define NVIDIA_CLARA_HOLOSCAN_GXF_V4L2_SOURCE_HPP_
 
+#include <memory>
 #include <string>
-#include <vector>
 
+#include "gxf/multimedia/video.hpp"
 #include "gxf/std/allocator.hpp"
 #include "gxf/std/codelet.hpp"
 #include "gxf/std/transmitter.hpp"
 
+#include "../utils/row_worker_pool.hpp"
+#include "v4l2_device.hpp"
+#include "yuyv_to_rgba.hpp"
+
 namespace nvidia {
 namespace holoscan {
 
@@ -31,7 +36,10 @@ namespace holoscan {
 ///
 /// Provides a codelet for a realtime V4L2 source supporting USB cameras and other media inputs
 /// on Linux.
-/// The output is a VideoBuffer object.
+/// The output is a VideoBuffer object. By default YUYV frames are converted to an RGBA buffer
+/// allocated by `allocator`. In pass-through mode the V4L2 buffer of the frame, in the pixel format
+/// of the device, is published without copy and returned to the driver when the last consumer
+/// releases the message.
 class V4L2Source : public gxf::Codelet {
  public:
   gxf_result_t registerInterface(gxf::Registrar* registrar) override;
@@ -41,14 +49,8 @@ class V4L2Source : public gxf::Codelet {
   gxf_result_t stop() override;
 
  private:
-  struct Buffer {
-    Buffer(void* _ptr, size_t _length);
-
-    void* ptr;
-    size_t length;
-  };
-
-  void YUYVToRGBA(const void* yuyv, void* rgba, size_t width, size_t height);
+  gxf::Expected<void> convertFrame(const V4L2Frame& frame, gxf::VideoBuffer* video_buffer);
+  void YUYVToRGBA(const void* yuyv, void* rgba, size_t rgba_pitch);
 
   gxf::Parameter<gxf::Handle<gxf::Transmitter>> signal_;
   gxf::Parameter<gxf::Handle<gxf::Allocator>> allocator_;
@@ -56,9 +58,18 @@ class V4L2Source : public gxf::Codelet {
   gxf::Parameter<uint32_t> width_;
   gxf::Parameter<uint32_t> height_;
   gxf::Parameter<uint32_t> num_buffers_;
+  gxf::Parameter<std::string> color_matrix_;
+  gxf::Parameter<uint32_t> num_threads_;
+  gxf::Parameter<std::string> pixel_format_;
+  gxf::Parameter<std::string> memory_type_;
+  gxf::Parameter<bool> pass_through_;
+  gxf::Parameter<uint32_t> max_in_flight_buffers_;
+  gxf::Parameter<int32_t> dequeue_timeout_ms_;
 
-  int fd_;
-  std::vector<Buffer> buffers_;
+  // shared with the buffers published in pass-through mode, which can outlive the codelet
+  std::shared_ptr<V4L2Device> v4l2_device_;
+  YUVToRGBCoefficients yuv_to_rgb_coefficients_;
+  std::unique_ptr<RowWorkerPool> row_worker_pool_;
 };
 
 }  // namespace holoscan
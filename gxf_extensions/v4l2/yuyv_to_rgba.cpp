@@ -0,0 +1,127 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "yuyv_to_rgba.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "../utils/cpu_dispatch.hpp"
+
+namespace nvidia {
+namespace holoscan {
+
+namespace {
+
+constexpr int32_t kRound = 1 << (kYUVToRGBShift - 1);
+constexpr int32_t kMax = 255 << kYUVToRGBShift;
+
+int32_t ToFixedPoint(double value) {
+  return static_cast<int32_t>(std::lround(value * (1 << kYUVToRGBShift)));
+}
+
+inline uint32_t ToUInt8(int32_t value) {
+  return static_cast<uint32_t>(std::min(std::max(value, 0), kMax) >> kYUVToRGBShift);
+}
+
+HOLOSCAN_TARGET_CLONES
+void ConvertYUYVRow(const uint8_t* __restrict yuyv, uint8_t* __restrict rgba, uint32_t width,
+                    YUVToRGBCoefficients k) {
+  // A pair of pixels is read as one 32 bit word and each pixel written as one 32 bit word, so that
+  // the loop vectorizes with 32 bit lanes. The words are little endian, like on x86-64 and
+  // aarch64.
+  const uint32_t* __restrict pairs = reinterpret_cast<const uint32_t*>(yuyv);
+  uint32_t* __restrict pixels = reinterpret_cast<uint32_t*>(rgba);
+  const uint32_t pair_count = width / 2;
+  for (uint32_t i = 0; i < pair_count; i++) {
+    const uint32_t pair = pairs[i];
+    const int32_t y0 = (static_cast<int32_t>(pair & 0xff) - k.y_offset) * k.y + kRound;
+    const int32_t cb = static_cast<int32_t>((pair >> 8) & 0xff) - 128;
+    const int32_t y1 = (static_cast<int32_t>((pair >> 16) & 0xff) - k.y_offset) * k.y + kRound;
+    const int32_t cr = static_cast<int32_t>(pair >> 24) - 128;
+
+    const int32_t r = k.r_cr * cr;
+    const int32_t g = -k.g_cb * cb - k.g_cr * cr;
+    const int32_t b = k.b_cb * cb;
+
+    pixels[2 * i] = ToUInt8(y0 + r) | (ToUInt8(y0 + g) << 8) | (ToUInt8(y0 + b) << 16) |
+                    0xff000000u;
+    pixels[2 * i + 1] = ToUInt8(y1 + r) | (ToUInt8(y1 + g) << 8) | (ToUInt8(y1 + b) << 16) |
+                        0xff000000u;
+  }
+
+  // an odd width ends with a single pixel, using the chroma of its pair
+  if (width % 2) {
+    const int32_t y0 = (yuyv[4 * pair_count] - k.y_offset) * k.y + kRound;
+    const int32_t cb = yuyv[4 * pair_count + 1] - 128;
+    const int32_t cr = yuyv[4 * pair_count + 3] - 128;
+    rgba[8 * pair_count] = ToUInt8(y0 + k.r_cr * cr);
+    rgba[8 * pair_count + 1] = ToUInt8(y0 - k.g_cb * cb - k.g_cr * cr);
+    rgba[8 * pair_count + 2] = ToUInt8(y0 + k.b_cb * cb);
+    rgba[8 * pair_count + 3] = 255;
+  }
+}
+
+}  // namespace
+
+bool ParseYUVColorMatrix(const std::string& name, YUVColorMatrix* matrix) {
+  if (name == "bt601_full") {
+    *matrix = YUVColorMatrix::kBT601Full;
+  } else if (name == "bt601_limited") {
+    *matrix = YUVColorMatrix::kBT601Limited;
+  } else if (name == "bt709_full") {
+    *matrix = YUVColorMatrix::kBT709Full;
+  } else if (name == "bt709_limited") {
+    *matrix = YUVColorMatrix::kBT709Limited;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+YUVToRGBCoefficients GetYUVToRGBCoefficients(YUVColorMatrix matrix) {
+  const bool is_bt709 =
+      matrix == YUVColorMatrix::kBT709Full || matrix == YUVColorMatrix::kBT709Limited;
+  const bool is_limited =
+      matrix == YUVColorMatrix::kBT601Limited || matrix == YUVColorMatrix::kBT709Limited;
+
+  const double kr = is_bt709 ? 0.2126 : 0.299;
+  const double kb = is_bt709 ? 0.0722 : 0.114;
+  const double kg = 1.0 - kr - kb;
+  // limited range: Y in [16, 235] and Cb, Cr in [16, 240]
+  const double y_scale = is_limited ? 255.0 / 219.0 : 1.0;
+  const double c_scale = is_limited ? 255.0 / 224.0 : 1.0;
+
+  YUVToRGBCoefficients coefficients;
+  coefficients.y_offset = is_limited ? 16 : 0;
+  coefficients.y = ToFixedPoint(y_scale);
+  coefficients.r_cr = ToFixedPoint(2.0 * (1.0 - kr) * c_scale);
+  coefficients.g_cb = ToFixedPoint(2.0 * kb * (1.0 - kb) / kg * c_scale);
+  coefficients.g_cr = ToFixedPoint(2.0 * kr * (1.0 - kr) / kg * c_scale);
+  coefficients.b_cb = ToFixedPoint(2.0 * (1.0 - kb) * c_scale);
+  return coefficients;
+}
+
+void ConvertYUYVToRGBA(const uint8_t* yuyv, size_t yuyv_pitch, uint8_t* rgba, size_t rgba_pitch,
+                       uint32_t width, uint32_t begin_row, uint32_t end_row,
+                       const YUVToRGBCoefficients& coefficients) {
+  for (uint32_t row = begin_row; row < end_row; row++) {
+    ConvertYUYVRow(yuyv + row * yuyv_pitch, rgba + row * rgba_pitch, width, coefficients);
+  }
+}
+
+}  // namespace holoscan
+}  // namespace nvidia
@@ -0,0 +1,70 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef NVIDIA_CLARA_HOLOSCAN_GXF_V4L2_YUYV_TO_RGBA_HPP_
+#define NVIDIA_CLARA_HOLOSCAN_GXF_V4L2_YUYV_TO_RGBA_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace nvidia {
+namespace holoscan {
+
+/// @brief Color matrix and range of YUV data.
+enum class YUVColorMatrix {
+  kBT601Full,
+  kBT601Limited,
+  kBT709Full,
+  kBT709Limited,
+};
+
+/// @brief Fixed-point coefficients of a YUV to RGB conversion, scaled by 2^kYUVToRGBShift.
+struct YUVToRGBCoefficients {
+  int32_t y_offset;
+  int32_t y;
+  int32_t r_cr;
+  int32_t g_cb;
+  int32_t g_cr;
+  int32_t b_cb;
+};
+
+constexpr int32_t kYUVToRGBShift = 16;
+
+/// @brief Parses a color matrix name: "bt601_full", "bt601_limited", "bt709_full" or
+/// "bt709_limited". Returns false if the name is not supported.
+bool ParseYUVColorMatrix(const std::string& name, YUVColorMatrix* matrix);
+
+/// @brief Returns the fixed-point conversion coefficients of a color matrix.
+YUVToRGBCoefficients GetYUVToRGBCoefficients(YUVColorMatrix matrix);
+
+/// @brief Converts rows [begin_row, end_row) of a YUYV (YUV 4:2:2) image to RGBA, with an opaque
+/// alpha channel.
+///
+/// Uses fixed-point arithmetic in loops vectorized by the compiler. On x86-64 the kernel is also
+/// compiled for AVX2 and selected at load time when the CPU supports it, on aarch64 NEON is always
+/// used. Rows can be converted concurrently.
+///
+/// @param yuyv YUYV image, `yuyv_pitch` bytes per row
+/// @param rgba RGBA image, `rgba_pitch` bytes per row
+void ConvertYUYVToRGBA(const uint8_t* yuyv, size_t yuyv_pitch, uint8_t* rgba, size_t rgba_pitch,
+                       uint32_t width, uint32_t begin_row, uint32_t end_row,
+                       const YUVToRGBCoefficients& coefficients);
+
+}  // namespace holoscan
+}  // namespace nvidia
+
+#endif  // NVIDIA_CLARA_HOLOSCAN_GXF_V4L2_YUYV_TO_RGBA_HPP_
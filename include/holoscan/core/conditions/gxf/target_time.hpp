@@ -0,0 +1,57 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_CONDITIONS_GXF_TARGET_TIME_HPP
+#define HOLOSCAN_CORE_CONDITIONS_GXF_TARGET_TIME_HPP
+
+#include <cstdint>
+#include <string>
+
+#include "../../gxf/gxf_condition.hpp"
+#include "../../gxf/target_time_scheduling_term.hpp"
+
+namespace holoscan {
+
+/**
+ * @brief Condition that keeps an operator from executing before a target time.
+ *
+ * The target time is a `std::chrono::steady_clock` time point in nanoseconds. While it lies in
+ * the future, the scheduler is told to wait until then, so an operator pacing its own output
+ * does not need to sleep inside `compute()`. The condition is ready when no target is set.
+ */
+class TargetTimeCondition : public gxf::GXFCondition {
+ public:
+  HOLOSCAN_CONDITION_FORWARD_ARGS_SUPER(TargetTimeCondition, GXFCondition)
+
+  TargetTimeCondition() = default;
+  TargetTimeCondition(const std::string& name, gxf::TargetTimeSchedulingTerm* term);
+
+  const char* gxf_typename() const override { return "holoscan::gxf::TargetTimeSchedulingTerm"; }
+
+  void initialize() override;
+
+  void target_time(int64_t steady_clock_ns);
+  int64_t target_time() const;
+  void clear_target_time();
+
+ private:
+  int64_t target_ns_ = 0;
+};
+
+}  // namespace holoscan
+
+#endif /* HOLOSCAN_CORE_CONDITIONS_GXF_TARGET_TIME_HPP */
@@ -41,12 +41,16 @@ enum class FlowType;
 class Graph;
 class GXFParameterAdaptor;
 class InputContext;
+template <typename DataT>
+class InputPort;
 class IOSpec;
 class Logger;
 class Message;
 class Operator;
 class OperatorSpec;
 class OutputContext;
+template <typename DataT>
+class OutputPort;
 
 template <typename ValueT>
 class MetaParameter;
@@ -56,7 +60,9 @@ using Parameter = MetaParameter<ValueT>;
 
 class ParameterWrapper;
 enum class ParameterFlag;
+class Profiler;
 class Resource;
+class Scheduler;
 
 // holoscan::gxf
 namespace gxf {
@@ -66,6 +72,7 @@ class GXFCondition;
 class GXFInputContext;
 class GXFOutputContext;
 class GXFResource;
+class GXFScheduler;
 class GXFExtensionManager;
 }  // namespace gxf
 
@@ -88,6 +95,11 @@ class StdComponentSerializer;
 class UnboundedAllocator;
 class VideoStreamSerializer;
 
+// Schedulers
+class EventBasedScheduler;
+class GreedyScheduler;
+class MultiThreadScheduler;
+
 // Domain objects
 class Tensor;
 
@@ -29,6 +29,8 @@
 #include "config.hpp"
 #include "executor.hpp"
 #include "graph.hpp"
+#include "profiler.hpp"
+#include "scheduler.hpp"
 
 namespace holoscan {
 
@@ -156,6 +158,61 @@ class Fragment {
    */
   Executor& executor();
 
+  /**
+   * @brief Get the operator profiler of the fragment.
+   *
+   * The profiler is disabled by default. Enable it before running the fragment to record the
+   * `compute()` latency and tick interval of each native operator:
+   *
+   * ```cpp
+   * app->profiler().enable();
+   * app->profiler().output_file("profile.json");
+   * app->run();
+   * ```
+   *
+   * @return The reference to the profiler of the fragment (`Profiler` object.)
+   */
+  Profiler& profiler();
+
+  /**
+   * @brief Set the scheduler of the fragment.
+   *
+   * The scheduler is created by `make_scheduler()` and used by the executor when the graph is
+   * run. It can be set before `run()` is called or from within `compose()`.
+   *
+   * Example:
+   *
+   * ```cpp
+   * app->scheduler(app->make_scheduler<holoscan::MultiThreadScheduler>(
+   *     "scheduler", holoscan::Arg("worker_thread_number", 4L)));
+   * app->run();
+   * ```
+   *
+   * @param scheduler The scheduler to be used by the fragment.
+   */
+  void scheduler(const std::shared_ptr<Scheduler>& scheduler);
+
+  /**
+   * @brief Get the scheduler of the fragment.
+   *
+   * If no scheduler was set, one is created from the `scheduler` section of the configuration
+   * file. The `type` field selects the scheduler (`greedy`, `multi_thread` or `event_based`) and
+   * the remaining fields are passed to it as arguments:
+   *
+   * ```yaml
+   * scheduler:
+   *   type: multi_thread
+   *   worker_thread_number: 4
+   *   stop_on_deadlock: true
+   * ```
+   *
+   * If the configuration has no `scheduler` section, a `GreedyScheduler` is created. An unknown
+   * `type` throws `std::runtime_error`.
+   *
+   * @return The shared pointer to the scheduler of the fragment.
+   */
+  std::shared_ptr<Scheduler> scheduler();
+
   /**
    * @brief Get the Argument(s) from the configuration file.
    *
@@ -306,6 +363,46 @@ class Fragment {
     return condition;
   }
 
+  /**
+   * @brief Create a new scheduler.
+   *
+   * The scheduler is not used until it is set to the fragment with `scheduler()`.
+   *
+   * @tparam SchedulerT The type of the scheduler.
+   * @param name The name of the scheduler.
+   * @param args The arguments for the scheduler.
+   * @return The shared pointer to the scheduler.
+   */
+  template <typename SchedulerT, typename StringT, typename... ArgsT,
+            typename = std::enable_if_t<std::is_constructible_v<std::string, StringT>>>
+  std::shared_ptr<SchedulerT> make_scheduler(const StringT& name, ArgsT&&... args) {
+    HOLOSCAN_LOG_DEBUG("Creating scheduler '{}'", name);
+    auto scheduler = std::make_shared<SchedulerT>(std::forward<ArgsT>(args)...);
+    scheduler->name(name);
+    scheduler->fragment(this);
+    auto spec = std::make_shared<ComponentSpec>(this);
+    scheduler->setup(*spec.get());
+    scheduler->spec(spec);
+
+    // Skip initialization. `scheduler->initialize()` is done in GXFExecutor::run()
+
+    return scheduler;
+  }
+
+  /**
+   * @brief Create a new scheduler.
+   *
+   * @tparam SchedulerT The type of the scheduler.
+   * @param args The arguments for the scheduler.
+   * @return The shared pointer to the scheduler.
+   */
+  template <typename SchedulerT, typename... ArgsT>
+  std::shared_ptr<SchedulerT> make_scheduler(ArgsT&&... args) {
+    HOLOSCAN_LOG_DEBUG("Creating scheduler");
+    auto scheduler = make_scheduler<SchedulerT>("", std::forward<ArgsT>(args)...);
+    return scheduler;
+  }
+
   /**
    * @brief Add an operator to the graph.
    *
@@ -456,11 +553,13 @@ class Fragment {
     return std::make_unique<ExecutorT>(std::forward<ArgsT>(args)...);
   }
 
-  std::string name_;                    ///< The name of the fragment.
-  Application* app_ = nullptr;          ///< The application that this fragment belongs to.
-  std::unique_ptr<Config> config_;      ///< The configuration of the fragment.
-  std::unique_ptr<Graph> graph_;        ///< The graph of the fragment.
-  std::unique_ptr<Executor> executor_;  ///< The executor for the fragment.
+  std::string name_;                      ///< The name of the fragment.
+  Application* app_ = nullptr;            ///< The application that this fragment belongs to.
+  std::unique_ptr<Config> config_;        ///< The configuration of the fragment.
+  std::unique_ptr<Graph> graph_;          ///< The graph of the fragment.
+  std::unique_ptr<Executor> executor_;    ///< The executor for the fragment.
+  std::shared_ptr<Scheduler> scheduler_;  ///< The scheduler of the fragment.
+  std::unique_ptr<Profiler> profiler_;    ///< The operator profiler of the fragment.
 };
 
 }  // namespace holoscan
@@ -47,6 +47,8 @@ class GXFComponent {
   std::string& gxf_cname() { return gxf_cname_; }
   void gxf_cname(const std::string& name) { gxf_cname_ = name; }
 
+  void* gxf_cptr() const { return gxf_cptr_; }
+
   void gxf_initialize() {
     if (gxf_context_ == nullptr) {
       HOLOSCAN_LOG_ERROR("Initializing with null GXF context");
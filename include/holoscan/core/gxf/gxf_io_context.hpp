@@ -19,13 +19,27 @@
 #define HOLOSCAN_CORE_GXF_GXF_IO_CONTEXT_HPP
 
 #include <string>
+#include <typeinfo>
 #include <unordered_map>
 #include <memory>
 
 #include "../io_context.hpp"
+#include "./message_pool.hpp"
 
 namespace holoscan::gxf {
 
+/**
+ * @brief Resolve the GXF receiver/transmitter of the given input/output port.
+ *
+ * The resolved pointer is cached in the IOSpec (`IOSpec::connector_ptr()`) so that subsequent calls
+ * return it without querying the GXF runtime.
+ *
+ * @param io_spec The pointer to the IOSpec of the input/output port.
+ * @return The pointer to `nvidia::gxf::Receiver` (input) or `nvidia::gxf::Transmitter` (output),
+ * or nullptr if the port has no GXF resource.
+ */
+void* resolve_connector(IOSpec* io_spec);
+
 /**
  * @brief Class to hold the input context for a GXF Operator.
  *
@@ -60,8 +74,14 @@ class GXFInputContext : public InputContext {
 
  protected:
   std::any receive_impl(const char* name = nullptr, bool no_error_message = false) override;
+  std::any receive_impl(IOSpec* io_spec) override;
+  std::any receive_impl(IOSpec* io_spec, const std::type_info& typeinfo,
+                        std::shared_ptr<void>& shared_value) override;
 
  private:
+  std::any receive_message(IOSpec* io_spec, const std::type_info* typeinfo,
+                           std::shared_ptr<void>& shared_value);
+
   gxf_context_t gxf_context_ = nullptr;  ///< The pointer to the GXF context.
 };
 
@@ -101,9 +121,17 @@ class GXFOutputContext : public OutputContext {
  protected:
   void emit_impl(std::any data, const char* name = nullptr,
                  OutputType out_type = OutputType::kSharedPointer) override;
+  void emit_impl(std::any data, IOSpec* io_spec,
+                 OutputType out_type = OutputType::kSharedPointer) override;
+  void emit_impl(Message&& message, IOSpec* io_spec) override;
 
  private:
+  /// Get the pool of the message entities for the given output port.
+  MessagePool& message_pool(IOSpec* io_spec);
+
   gxf_context_t gxf_context_ = nullptr;     ///< The pointer to the GXF context.
+  /// The pools of the message entities, one per output port.
+  std::unordered_map<IOSpec*, std::unique_ptr<MessagePool>> message_pools_;
 };
 
 }  // namespace holoscan::gxf
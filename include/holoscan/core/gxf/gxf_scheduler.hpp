@@ -0,0 +1,44 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_GXF_GXF_SCHEDULER_HPP
+#define HOLOSCAN_CORE_GXF_GXF_SCHEDULER_HPP
+
+#include <string>
+
+#include "../scheduler.hpp"
+#include "./gxf_component.hpp"
+
+namespace holoscan::gxf {
+
+class GXFScheduler : public holoscan::Scheduler, public gxf::GXFComponent {
+ public:
+  HOLOSCAN_SCHEDULER_FORWARD_ARGS_SUPER(GXFScheduler, holoscan::Scheduler)
+  GXFScheduler() = default;
+
+  /**
+   * @brief Initialize the scheduler.
+   *
+   * The GXF entity that holds the scheduler (`gxf_eid()`) must be set before calling this method.
+   * The `clock` handle of the GXF scheduler is not part of the spec and is set by the executor.
+   */
+  void initialize() override;
+};
+
+}  // namespace holoscan::gxf
+
+#endif /* HOLOSCAN_CORE_GXF_GXF_SCHEDULER_HPP */
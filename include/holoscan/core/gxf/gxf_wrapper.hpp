@@ -18,7 +18,11 @@
 #ifndef HOLOSCAN_CORE_GXF_GXF_WRAPPER_HPP
 #define HOLOSCAN_CORE_GXF_GXF_WRAPPER_HPP
 
+#include <memory>
+
+#include "holoscan/core/gxf/gxf_execution_context.hpp"
 #include "holoscan/core/gxf/gxf_operator.hpp"
+#include "holoscan/core/profiler.hpp"
 
 #include "gxf/std/codelet.hpp"
 #include "gxf/std/parameter_parser_std.hpp"
@@ -48,8 +52,23 @@ class GXFWrapper : public nvidia::gxf::Codelet {
    */
   void set_operator(Operator* op) { op_ = op; }
 
+  /**
+   * @brief Set the profiler that records the ticks of the wrapped operator.
+   *
+   * @param profiler The pointer to the profiler (nullptr disables profiling).
+   * @param op_index The index of the operator returned by `Profiler::register_operator()`.
+   */
+  void set_profiler(Profiler* profiler, size_t op_index) {
+    profiler_ = profiler;
+    profiler_op_index_ = op_index;
+  }
+
  private:
   Operator* op_ = nullptr;
+  /// The execution context created at start() and reused for every tick.
+  std::unique_ptr<GXFExecutionContext> exec_context_;
+  Profiler* profiler_ = nullptr;
+  size_t profiler_op_index_ = 0;
 };
 
 }  // namespace holoscan::gxf
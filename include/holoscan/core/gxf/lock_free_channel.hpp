@@ -0,0 +1,159 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_GXF_LOCK_FREE_CHANNEL_HPP
+#define HOLOSCAN_CORE_GXF_LOCK_FREE_CHANNEL_HPP
+
+#include <gxf/core/gxf.h>
+
+#include <cstdint>
+#include <memory>
+
+#include <gxf/std/parameter_parser_std.hpp>
+#include <gxf/std/receiver.hpp>
+#include <gxf/std/transmitter.hpp>
+
+#include "./lock_free_queue.hpp"
+
+namespace holoscan::gxf {
+
+/**
+ * @brief Policy applied when an entity is pushed to a full lock-free queue.
+ *
+ * The first three values match the `policy` parameter of the GXF double-buffer
+ * receiver/transmitter.
+ */
+enum class OverflowPolicy : uint64_t {
+  kPop = 0,     ///< Drop the oldest entity to make room for the new one.
+  kReject = 1,  ///< Drop the new entity.
+  kFault = 2,   ///< Drop the new entity and return an error.
+  /// Wait until there is room, then fail after a timeout. The consumer must be able to run
+  /// meanwhile, so the executor rejects it with a single-threaded scheduler.
+  kBlock = 3,
+};
+
+/**
+ * @brief Queue of entity IDs shared by LockFreeReceiver and LockFreeTransmitter.
+ *
+ * The queue owns one reference to each entity it holds: `push()` takes a reference and `pop()`
+ * hands it over to the caller. A single-producer/single-consumer ring is used unless several
+ * threads may push, or the producer may drop the oldest entity (OverflowPolicy::kPop), in which
+ * case a multi-producer/multi-consumer ring is used.
+ */
+class LockFreeEntityQueue {
+ public:
+  LockFreeEntityQueue() = default;
+  ~LockFreeEntityQueue();
+
+  /**
+   * @brief Allocate the ring. Any entity still in the queue is released first.
+   *
+   * @param context The GXF context.
+   * @param capacity The maximum number of entities in the queue.
+   * @param policy The overflow policy.
+   * @param multi_producer Whether more than one thread may push at the same time.
+   * @param block_timeout_ms How long a push waits for room with OverflowPolicy::kBlock.
+   */
+  void init(gxf_context_t context, size_t capacity, OverflowPolicy policy, bool multi_producer,
+            uint64_t block_timeout_ms);
+  /// Release every entity in the queue.
+  void clear();
+
+  gxf_result_t push(gxf_uid_t uid);
+  gxf_result_t pop(gxf_uid_t* uid);
+  gxf_result_t peek(gxf_uid_t* uid, int32_t index) const;
+  size_t size() const;
+  size_t capacity() const;
+
+ private:
+  bool try_push(gxf_uid_t uid);
+  bool try_pop(gxf_uid_t& uid);
+
+  gxf_context_t context_ = nullptr;
+  OverflowPolicy policy_ = OverflowPolicy::kFault;
+  uint64_t block_timeout_ms_ = 0;
+  std::unique_ptr<SPSCQueue<gxf_uid_t>> spsc_;
+  std::unique_ptr<MPMCQueue<gxf_uid_t>> mpmc_;
+};
+
+/**
+ * @brief Receiver backed by a lock-free ring buffer.
+ *
+ * Unlike `nvidia::gxf::DoubleBufferReceiver`, an entity pushed by the upstream router is
+ * visible to the consumer immediately (there is no back stage to synchronize) and no mutex is
+ * taken on push or pop. When built against a GXF release with entity events, each push notifies
+ * the receiving entity so that the event-based scheduler can re-evaluate it right away.
+ *
+ * The executor sets `multi_producer` when several transmitters are connected to the receiver.
+ */
+class LockFreeReceiver : public nvidia::gxf::Receiver {
+ public:
+  gxf_result_t registerInterface(nvidia::gxf::Registrar* registrar) override;
+  gxf_result_t initialize() override;
+  gxf_result_t deinitialize() override;
+
+  gxf_result_t pop_abi(gxf_uid_t* uid) override;
+  gxf_result_t push_abi(gxf_uid_t other) override;
+  gxf_result_t peek_abi(gxf_uid_t* uid, int32_t index) override;
+  gxf_result_t peek_back_abi(gxf_uid_t* uid, int32_t index) override;
+  size_t capacity_abi() override;
+  size_t size_abi() override;
+  gxf_result_t receive_abi(gxf_uid_t* uid) override;
+  size_t back_size_abi() override;
+  gxf_result_t sync_abi() override;
+
+ private:
+  nvidia::gxf::Parameter<uint64_t> capacity_;
+  nvidia::gxf::Parameter<uint64_t> policy_;
+  nvidia::gxf::Parameter<bool> multi_producer_;
+  nvidia::gxf::Parameter<uint64_t> block_timeout_ms_;
+
+  LockFreeEntityQueue queue_;
+};
+
+/**
+ * @brief Transmitter backed by a lock-free ring buffer.
+ *
+ * Published entities are handed to the router as they are (there is no back stage to
+ * synchronize).
+ */
+class LockFreeTransmitter : public nvidia::gxf::Transmitter {
+ public:
+  gxf_result_t registerInterface(nvidia::gxf::Registrar* registrar) override;
+  gxf_result_t initialize() override;
+  gxf_result_t deinitialize() override;
+
+  gxf_result_t pop_abi(gxf_uid_t* uid) override;
+  gxf_result_t push_abi(gxf_uid_t other) override;
+  gxf_result_t peek_abi(gxf_uid_t* uid, int32_t index) override;
+  size_t capacity_abi() override;
+  size_t size_abi() override;
+  gxf_result_t publish_abi(gxf_uid_t uid) override;
+  size_t back_size_abi() override;
+  gxf_result_t sync_abi() override;
+
+ private:
+  nvidia::gxf::Parameter<uint64_t> capacity_;
+  nvidia::gxf::Parameter<uint64_t> policy_;
+  nvidia::gxf::Parameter<uint64_t> block_timeout_ms_;
+
+  LockFreeEntityQueue queue_;
+};
+
+}  // namespace holoscan::gxf
+
+#endif /* HOLOSCAN_CORE_GXF_LOCK_FREE_CHANNEL_HPP */
@@ -0,0 +1,285 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_GXF_LOCK_FREE_QUEUE_HPP
+#define HOLOSCAN_CORE_GXF_LOCK_FREE_QUEUE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+namespace holoscan::gxf {
+
+/// The size of a cache line, used to keep the producer and consumer indices apart.
+constexpr size_t kCacheLineSize = 64;
+
+/**
+ * @brief Bounded single-producer/single-consumer queue.
+ *
+ * `try_push()` must only be called from one thread at a time and `try_pop()`/`peek()` from
+ * another (or the same) single thread. No locks are taken and no memory is allocated after
+ * construction.
+ *
+ * @tparam T The type of the elements. It must be default-constructible and copy-assignable.
+ */
+template <typename T>
+class SPSCQueue {
+ public:
+  /**
+   * @brief Construct a new SPSCQueue object.
+   *
+   * @param capacity The maximum number of elements in the queue (at least 1).
+   */
+  explicit SPSCQueue(size_t capacity)
+      : capacity_(capacity > 0 ? capacity : 1), buffer_(new T[capacity_]) {}
+
+  SPSCQueue(const SPSCQueue&) = delete;
+  SPSCQueue& operator=(const SPSCQueue&) = delete;
+
+  /**
+   * @brief Add an element to the back of the queue.
+   *
+   * @param value The element to add.
+   * @return true if the element was added, false if the queue is full.
+   */
+  bool try_push(const T& value) {
+    const size_t tail = tail_.load(std::memory_order_relaxed);
+    if (tail - head_cache_ >= capacity_) {
+      head_cache_ = head_.load(std::memory_order_acquire);
+      if (tail - head_cache_ >= capacity_) { return false; }
+    }
+    buffer_[tail % capacity_] = value;
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * @brief Remove the element at the front of the queue.
+   *
+   * @param value The removed element.
+   * @return true if an element was removed, false if the queue is empty.
+   */
+  bool try_pop(T& value) {
+    const size_t head = head_.load(std::memory_order_relaxed);
+    if (head == tail_cache_) {
+      tail_cache_ = tail_.load(std::memory_order_acquire);
+      if (head == tail_cache_) { return false; }
+    }
+    value = buffer_[head % capacity_];
+    head_.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * @brief Read an element without removing it. Must be called from the consumer thread.
+   *
+   * @param index The index of the element, counted from the front of the queue.
+   * @param value The element at the given index.
+   * @return true if the element exists, false otherwise.
+   */
+  bool peek(size_t index, T& value) const {
+    const size_t head = head_.load(std::memory_order_relaxed);
+    const size_t tail = tail_.load(std::memory_order_acquire);
+    if (tail - head <= index) { return false; }
+    value = buffer_[(head + index) % capacity_];
+    return true;
+  }
+
+  /**
+   * @brief Get the number of elements in the queue.
+   *
+   * The value is exact only when neither the producer nor the consumer is active.
+   *
+   * @return The number of elements in the queue.
+   */
+  size_t size() const {
+    // Load the head first so that the (monotonic) tail can never be behind it.
+    const size_t head = head_.load(std::memory_order_acquire);
+    const size_t tail = tail_.load(std::memory_order_acquire);
+    return tail - head;
+  }
+
+  /**
+   * @brief Get the maximum number of elements in the queue.
+   *
+   * @return The capacity of the queue.
+   */
+  size_t capacity() const { return capacity_; }
+
+ private:
+  const size_t capacity_;
+  std::unique_ptr<T[]> buffer_;
+
+  alignas(kCacheLineSize) std::atomic<size_t> head_{0};  ///< Written by the consumer.
+  size_t tail_cache_ = 0;                                 ///< Consumer's copy of tail_.
+
+  alignas(kCacheLineSize) std::atomic<size_t> tail_{0};  ///< Written by the producer.
+  size_t head_cache_ = 0;                                 ///< Producer's copy of head_.
+};
+
+/**
+ * @brief Bounded multi-producer/multi-consumer queue.
+ *
+ * Each slot carries a sequence number that tells producers and consumers whether the slot is
+ * ready for them, so that both sides only need a compare-and-swap on their own index (Vyukov's
+ * bounded queue). It is used when more than one thread may push, or when a producer has to drop
+ * the oldest element while the consumer is popping.
+ *
+ * The sequence scheme needs at least two slots, so the ring is rounded up to a power of two
+ * (at least 2) and the requested capacity is enforced separately by `try_push()`.
+ *
+ * @tparam T The type of the elements. It must be default-constructible and copy-assignable.
+ */
+template <typename T>
+class MPMCQueue {
+ public:
+  /**
+   * @brief Construct a new MPMCQueue object.
+   *
+   * @param capacity The maximum number of elements in the queue (at least 1).
+   */
+  explicit MPMCQueue(size_t capacity)
+      : capacity_(capacity > 0 ? capacity : 1),
+        mask_(slot_count(capacity_) - 1),
+        cells_(new Cell[mask_ + 1]) {
+    for (size_t i = 0; i <= mask_; ++i) {
+      cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  MPMCQueue(const MPMCQueue&) = delete;
+  MPMCQueue& operator=(const MPMCQueue&) = delete;
+
+  /**
+   * @brief Add an element to the back of the queue.
+   *
+   * @param value The element to add.
+   * @return true if the element was added, false if the queue is full.
+   */
+  bool try_push(const T& value) {
+    size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+    Cell* cell;
+    while (true) {
+      // The ring may have more slots than the requested capacity. A stale `pos` gives a negative
+      // count and is refreshed by the sequence check below.
+      const auto count =
+          static_cast<std::ptrdiff_t>(pos - dequeue_pos_.load(std::memory_order_acquire));
+      if (count >= static_cast<std::ptrdiff_t>(capacity_)) { return false; }
+      cell = &cells_[pos & mask_];
+      const size_t sequence = cell->sequence.load(std::memory_order_acquire);
+      const auto diff = static_cast<std::ptrdiff_t>(sequence - pos);
+      if (diff == 0) {
+        if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) { break; }
+      } else if (diff < 0) {
+        return false;
+      } else {
+        pos = enqueue_pos_.load(std::memory_order_relaxed);
+      }
+    }
+    cell->value = value;
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * @brief Remove the element at the front of the queue.
+   *
+   * @param value The removed element.
+   * @return true if an element was removed, false if the queue is empty.
+   */
+  bool try_pop(T& value) {
+    size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+    Cell* cell;
+    while (true) {
+      cell = &cells_[pos & mask_];
+      const size_t sequence = cell->sequence.load(std::memory_order_acquire);
+      const auto diff = static_cast<std::ptrdiff_t>(sequence - (pos + 1));
+      if (diff == 0) {
+        if (dequeue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) { break; }
+      } else if (diff < 0) {
+        return false;
+      } else {
+        pos = dequeue_pos_.load(std::memory_order_relaxed);
+      }
+    }
+    value = cell->value;
+    cell->sequence.store(pos + mask_ + 1, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * @brief Read an element without removing it.
+   *
+   * The result is only reliable when no other thread pops concurrently.
+   *
+   * @param index The index of the element, counted from the front of the queue.
+   * @param value The element at the given index.
+   * @return true if the element exists, false otherwise.
+   */
+  bool peek(size_t index, T& value) const {
+    if (index >= capacity_) { return false; }
+    const size_t pos = dequeue_pos_.load(std::memory_order_relaxed) + index;
+    const Cell& cell = cells_[pos & mask_];
+    if (cell.sequence.load(std::memory_order_acquire) != pos + 1) { return false; }
+    value = cell.value;
+    return true;
+  }
+
+  /**
+   * @brief Get the number of elements in the queue.
+   *
+   * The value is exact only when no producer or consumer is active.
+   *
+   * @return The number of elements in the queue.
+   */
+  size_t size() const {
+    const size_t dequeue_pos = dequeue_pos_.load(std::memory_order_acquire);
+    const size_t enqueue_pos = enqueue_pos_.load(std::memory_order_acquire);
+    return enqueue_pos > dequeue_pos ? enqueue_pos - dequeue_pos : 0;
+  }
+
+  /**
+   * @brief Get the maximum number of elements in the queue.
+   *
+   * @return The capacity of the queue.
+   */
+  size_t capacity() const { return capacity_; }
+
+ private:
+  struct Cell {
+    std::atomic<size_t> sequence{0};
+    T value{};
+  };
+
+  /// Round the capacity up to a power of two with room for at least two slots.
+  static size_t slot_count(size_t capacity) {
+    size_t count = 2;
+    while (count < capacity) { count <<= 1; }
+    return count;
+  }
+
+  const size_t capacity_;
+  const size_t mask_;
+  std::unique_ptr<Cell[]> cells_;
+
+  alignas(kCacheLineSize) std::atomic<size_t> enqueue_pos_{0};
+  alignas(kCacheLineSize) std::atomic<size_t> dequeue_pos_{0};
+};
+
+}  // namespace holoscan::gxf
+
+#endif /* HOLOSCAN_CORE_GXF_LOCK_FREE_QUEUE_HPP */
@@ -0,0 +1,94 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_GXF_MESSAGE_POOL_HPP
+#define HOLOSCAN_CORE_GXF_MESSAGE_POOL_HPP
+
+#include <gxf/core/gxf.h>
+
+#include <vector>
+
+#include "./entity.hpp"
+#include "../message.hpp"
+
+namespace holoscan::gxf {
+
+/**
+ * @brief Class to recycle the message entities published to an output port.
+ *
+ * Creating a GXF entity with a `holoscan::Message` component for every message is expensive. The
+ * pool keeps the entities it created and hands one out again once all the downstream receivers
+ * have released it, i.e., when the pool holds the only reference to the entity.
+ *
+ * If every pooled entity is still in flight and the pool is full, a new entity that is not
+ * pooled is created.
+ *
+ * The payload of a released entity is destroyed by the next call to `acquire()`, so a port keeps
+ * at most the value of messages released since it last emitted.
+ */
+class MessagePool {
+ public:
+  /// The default maximum number of entities kept by a pool.
+  static constexpr size_t kDefaultCapacity = 8;
+
+  /**
+   * @brief Construct a new MessagePool object.
+   *
+   * @param context The pointer to the GXF context.
+   * @param capacity The maximum number of entities kept by the pool.
+   */
+  explicit MessagePool(gxf_context_t context, size_t capacity = kDefaultCapacity);
+
+  /**
+   * @brief Get an entity with an empty `holoscan::Message` component.
+   *
+   * The messages of all the entities released by the downstream receivers are reset.
+   *
+   * @param message The pointer to the Message component of the returned entity.
+   * @return The entity, or an error if a new entity could not be created.
+   */
+  nvidia::gxf::Expected<nvidia::gxf::Entity> acquire(Message*& message);
+
+  /**
+   * @brief Get the number of entities kept by the pool.
+   *
+   * @return The number of entities kept by the pool.
+   */
+  size_t size() const { return entries_.size(); }
+
+  /**
+   * @brief Get the maximum number of entities kept by the pool.
+   *
+   * @return The maximum number of entities kept by the pool.
+   */
+  size_t capacity() const { return capacity_; }
+
+ private:
+  struct Entry {
+    nvidia::gxf::Entity entity;
+    Message* message = nullptr;
+  };
+
+  gxf_context_t context_ = nullptr;
+  size_t capacity_ = kDefaultCapacity;
+  std::vector<Entry> entries_;
+  size_t next_ = 0;  ///< The index of the entry to check first.
+};
+
+}  // namespace holoscan::gxf
+
+#endif /* HOLOSCAN_CORE_GXF_MESSAGE_POOL_HPP */
@@ -0,0 +1,61 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_GXF_TARGET_TIME_SCHEDULING_TERM_HPP
+#define HOLOSCAN_CORE_GXF_TARGET_TIME_SCHEDULING_TERM_HPP
+
+#include <gxf/core/gxf.h>
+
+#include <atomic>
+#include <cstdint>
+
+#include <gxf/std/scheduling_term.hpp>
+
+namespace holoscan::gxf {
+
+/**
+ * @brief Scheduling term which keeps an entity waiting until a target time is reached.
+ *
+ * The target is a `std::chrono::steady_clock` time point in nanoseconds and is usually set by
+ * the codelet itself (e.g., a replayer pacing its output). The term reports `WAIT_TIME` to the
+ * scheduler so that no worker thread sleeps inside the codelet while waiting. The target is
+ * converted to the scheduler's clock on each check, so no `Clock` component is required.
+ *
+ * When no target is set (the default), the term is always ready.
+ */
+class TargetTimeSchedulingTerm : public nvidia::gxf::SchedulingTerm {
+ public:
+  gxf_result_t initialize() override;
+
+  gxf_result_t check_abi(int64_t timestamp, nvidia::gxf::SchedulingConditionType* type,
+                         int64_t* target_timestamp) const override;
+  gxf_result_t onExecute_abi(int64_t dt) override;
+
+  /// Set the steady-clock time (in nanoseconds) before which the entity must not execute.
+  void set_target_time(int64_t steady_clock_ns);
+  /// Remove the target time so that the entity is ready again.
+  void clear_target_time();
+  /// The current target time in steady-clock nanoseconds, or zero if none is set.
+  int64_t target_time() const;
+
+ private:
+  std::atomic<int64_t> target_ns_{0};
+};
+
+}  // namespace holoscan::gxf
+
+#endif /* HOLOSCAN_CORE_GXF_TARGET_TIME_SCHEDULING_TERM_HPP */
@@ -113,20 +113,9 @@ class InputContext {
                                 !holoscan::is_vector_v<DataT> &&
                                 !holoscan::is_one_of_v<DataT, holoscan::gxf::Entity, std::any>>>
   std::shared_ptr<DataT> receive(const char* name = nullptr) {
-    auto value = receive_impl(name);
-
-    // If the received data is nullptr, return a null shared pointer.
-    if (value.type() == typeid(nullptr_t)) { return nullptr; }
-
-    try {
-      return std::any_cast<std::shared_ptr<DataT>>(value);
-    } catch (const std::bad_any_cast& e) {
-      HOLOSCAN_LOG_ERROR(
-          "Unable to cast the received data to the specified type (std::shared_ptr<"
-          "DataT>): {}",
-          e.what());
-      return nullptr;
-    }
+    IOSpec* io_spec = find_input(name);
+    if (io_spec == nullptr) { return nullptr; }
+    return receive_shared<DataT>(io_spec);
   }
 
   /**
@@ -246,6 +235,51 @@ class InputContext {
     return value;
   }
 
+  /**
+   * @brief Receive message data from the input port referred to by the given port handle.
+   *
+   * This is the same as the name-based `receive()` but the port is identified by a typed handle
+   * (`InputPort<DataT>`) so no port-name lookup is needed. The return type depends on `DataT`:
+   * `holoscan::gxf::Entity` and `std::any` are returned as they are, and any other type is
+   * returned as `std::shared_ptr<DataT>`.
+   *
+   * Example:
+   *
+   * ```cpp
+   * void setup(OperatorSpec& spec) override { in_ = spec.input<ValueData>("in"); }
+   *
+   * void compute(InputContext& op_input, OutputContext&, ExecutionContext&) override {
+   *   // The type of `value` is `std::shared_ptr<ValueData>`
+   *   auto value = op_input.receive(in_);
+   * }
+   * ```
+   *
+   * @tparam DataT The type of the data to receive.
+   * @param port The handle to the input port.
+   * @return The received data.
+   */
+  template <typename DataT>
+  auto receive(const InputPort<DataT>& port) {
+    static_assert(!holoscan::is_vector_v<DataT>,
+                  "Port handles cannot be used with the 'std::vector<IOSpec*>' parameter");
+    if constexpr (std::is_same_v<DataT, std::any>) {
+      return receive_impl(port.spec());
+    } else if constexpr (std::is_same_v<DataT, holoscan::gxf::Entity>) {
+      auto value = receive_impl(port.spec());
+      if (value.type() == typeid(nullptr_t)) { return holoscan::gxf::Entity{}; }
+      try {
+        return std::any_cast<holoscan::gxf::Entity>(value);
+      } catch (const std::bad_any_cast& e) {
+        throw std::runtime_error(
+            fmt::format("Unable to cast the received data to the specified type (holoscan::gxf::"
+                        "Entity): {}",
+                        e.what()));
+      }
+    } else {
+      return receive_shared<DataT>(port.spec());
+    }
+  }
+
   /**
    * @brief Receive a vector of the shared pointers to the message data from the receivers with the
    * given name.
@@ -580,6 +614,75 @@ class InputContext {
     return nullptr;
   }
 
+  /**
+   * @brief The implementation of the port-handle based `receive` method.
+   *
+   * @param io_spec The pointer to the IOSpec of the input port.
+   * @return The data received from the input port.
+   */
+  virtual std::any receive_impl(IOSpec* io_spec) {
+    (void)io_spec;
+    return nullptr;
+  }
+
+  /**
+   * @brief The implementation of the `receive` method for shared pointers.
+   *
+   * If the received message holds a shared pointer whose element type is `typeinfo`, the shared
+   * pointer is returned through `shared_value` without going through `std::any`. Otherwise, the
+   * received data is returned as in `receive_impl(IOSpec*)`.
+   *
+   * @param io_spec The pointer to the IOSpec of the input port.
+   * @param typeinfo The type info of the element type of the shared pointer to receive.
+   * @param shared_value The shared pointer received from the input port.
+   * @return The data received from the input port if it is not returned through `shared_value`.
+   */
+  virtual std::any receive_impl(IOSpec* io_spec, const std::type_info& typeinfo,
+                                std::shared_ptr<void>& shared_value) {
+    (void)typeinfo;
+    (void)shared_value;
+    return receive_impl(io_spec);
+  }
+
+  /**
+   * @brief Find the input port with the given name.
+   *
+   * If the name is empty and the operator has a single input port, that port is returned.
+   *
+   * @param name The name of the input port.
+   * @param no_error_message Whether to print an error message when the input port is not
+   * found.
+   * @return The pointer to the IOSpec of the input port, or nullptr if it is not found.
+   */
+  IOSpec* find_input(const char* name, bool no_error_message = false) const;
+
+  /**
+   * @brief Receive a shared pointer to the message data from the given input port.
+   *
+   * @tparam DataT The type of the data to receive.
+   * @param io_spec The pointer to the IOSpec of the input port.
+   * @return The shared pointer to the data.
+   */
+  template <typename DataT>
+  std::shared_ptr<DataT> receive_shared(IOSpec* io_spec) {
+    std::shared_ptr<void> shared_value;
+    auto value = receive_impl(io_spec, typeid(DataT), shared_value);
+    if (shared_value) { return std::static_pointer_cast<DataT>(shared_value); }
+
+    // If the received data is nullptr, return a null shared pointer.
+    if (value.type() == typeid(nullptr_t)) { return nullptr; }
+
+    try {
+      return std::any_cast<std::shared_ptr<DataT>>(value);
+    } catch (const std::bad_any_cast& e) {
+      HOLOSCAN_LOG_ERROR(
+          "Unable to cast the received data to the specified type (std::shared_ptr<"
+          "DataT>): {}",
+          e.what());
+      return nullptr;
+    }
+  }
+
   Operator* op_ = nullptr;  ///< The operator that this context is associated with.
   std::unordered_map<std::string, std::unique_ptr<IOSpec>>& inputs_;  ///< The inputs.
 };
@@ -663,7 +766,11 @@ class OutputContext {
    */
   template <typename DataT>
   void emit(std::shared_ptr<DataT>& data, const char* name = nullptr) {
-    emit_impl(data, name);
+    IOSpec* io_spec = find_output(name);
+    if (io_spec == nullptr) { return; }
+    Message message;
+    message.set_value(data);
+    emit_impl(std::move(message), io_spec);
   }
 
   /**
@@ -720,6 +827,33 @@ class OutputContext {
     emit_impl(data, name, OutputType::kGXFEntity);
   }
 
+  /**
+   * @brief Send a shared pointer of the message data to the output port referred to by the given
+   * port handle.
+   *
+   * This is the same as the name-based `emit()` but no port-name lookup is needed.
+   *
+   * @tparam DataT The type of the data to send.
+   * @param data The shared pointer to the data.
+   * @param port The handle to the output port.
+   */
+  template <typename DataT>
+  void emit(std::shared_ptr<DataT>& data, const OutputPort<DataT>& port) {
+    Message message;
+    message.set_value(data);
+    emit_impl(std::move(message), port.spec());
+  }
+
+  /**
+   * @brief Send message data (GXF Entity) to the output port referred to by the given port handle.
+   *
+   * @param data The entity object to send (`holoscan::gxf::Entity`).
+   * @param port The handle to the output port.
+   */
+  void emit(holoscan::gxf::Entity& data, const OutputPort<holoscan::gxf::Entity>& port) {
+    emit_impl(data, port.spec(), OutputType::kGXFEntity);
+  }
+
  protected:
   /**
    * @brief The implementation of the `emit` method.
@@ -738,6 +872,43 @@ class OutputContext {
     (void)out_type;
   }
 
+  /**
+   * @brief The implementation of the port-handle based `emit` method.
+   *
+   * @param data The data to send.
+   * @param io_spec The pointer to the IOSpec of the output port.
+   * @param out_type The type of the message data.
+   */
+  virtual void emit_impl(std::any data, IOSpec* io_spec,
+                         OutputType out_type = OutputType::kSharedPointer) {
+    (void)data;
+    (void)io_spec;
+    (void)out_type;
+  }
+
+  /**
+   * @brief The implementation of the `emit` method for shared pointers.
+   *
+   * The message holds the shared pointer to send so that it doesn't need to be wrapped with
+   * `std::any`.
+   *
+   * @param message The message to send.
+   * @param io_spec The pointer to the IOSpec of the output port.
+   */
+  virtual void emit_impl(Message&& message, IOSpec* io_spec) {
+    emit_impl(message.value(), io_spec);
+  }
+
+  /**
+   * @brief Find the output port with the given name.
+   *
+   * If the name is empty and the operator has a single output port, that port is returned.
+   *
+   * @param name The name of the output port.
+   * @return The pointer to the IOSpec of the output port, or nullptr if it is not found.
+   */
+  IOSpec* find_output(const char* name) const;
+
   Operator* op_ = nullptr;  ///< The operator that this context is associated with.
   std::unordered_map<std::string, std::unique_ptr<IOSpec>>& outputs_;  ///< The outputs.
 };
@@ -30,6 +30,10 @@
 #include "./conditions/gxf/downstream_affordable.hpp"
 #include "./conditions/gxf/message_available.hpp"
 #include "./gxf/entity.hpp"
+#include "./resources/gxf/double_buffer_receiver.hpp"
+#include "./resources/gxf/double_buffer_transmitter.hpp"
+#include "./resources/gxf/lock_free_receiver.hpp"
+#include "./resources/gxf/lock_free_transmitter.hpp"
 #include "./common.hpp"
 namespace holoscan {
 
@@ -48,6 +52,15 @@ class IOSpec {
    */
   enum class IOType { kInput, kOutput };
 
+  /**
+   * @brief Type of the connector (receiver/transmitter) used by this input/output.
+   */
+  enum class ConnectorType {
+    kDefault,       ///< Let the executor choose (currently a double-buffer connector).
+    kDoubleBuffer,  ///< `nvidia::gxf::DoubleBufferReceiver`/`DoubleBufferTransmitter`.
+    kLockFree,      ///< `holoscan::gxf::LockFreeReceiver`/`LockFreeTransmitter`.
+  };
+
   /**
    * @brief Construct a new IOSpec object.
    *
@@ -112,7 +125,108 @@ class IOSpec {
    *
    * @param resource The resource of this input/output.
    */
-  void resource(std::shared_ptr<Resource> resource) { resource_ = resource; }
+  void resource(std::shared_ptr<Resource> resource) {
+    resource_ = resource;
+    connector_ptr_ = nullptr;
+  }
+
+  /**
+   * @brief Get the pointer to the underlying connector (receiver/transmitter) of this
+   * input/output.
+   *
+   * The pointer is resolved from the resource once the graph is activated so that
+   * `receive()`/`emit()` don't need to look it up on every call. For GXF-based operators, this is
+   * a pointer to `nvidia::gxf::Receiver` (input) or `nvidia::gxf::Transmitter` (output).
+   *
+   * @return The pointer to the connector, or nullptr if it is not resolved yet.
+   */
+  void* connector_ptr() const { return connector_ptr_; }
+  /**
+   * @brief Set the pointer to the underlying connector (receiver/transmitter) of this
+   * input/output.
+   *
+   * @param connector_ptr The pointer to the connector.
+   */
+  void connector_ptr(void* connector_ptr) { connector_ptr_ = connector_ptr; }
+
+  /**
+   * @brief Get the pointers to the additional transmitters of this output.
+   *
+   * When the output of a native operator is connected to several inputs, the executor adds one
+   * transmitter per additional input next to the one of `resource()`. Emitting to the output
+   * publishes the same message entity to all of them, so every consumer receives a reference to
+   * the same message.
+   *
+   * @return The pointers to the additional transmitters (`nvidia::gxf::Transmitter` for GXF).
+   */
+  const std::vector<void*>& fanout_connector_ptrs() const { return fanout_connector_ptrs_; }
+  /**
+   * @brief Add a pointer to an additional transmitter of this output.
+   *
+   * @param connector_ptr The pointer to the transmitter.
+   */
+  void add_fanout_connector_ptr(void* connector_ptr) {
+    fanout_connector_ptrs_.push_back(connector_ptr);
+  }
+  /// @brief Remove the additional transmitters of this output, before the graph is built again.
+  void clear_fanout_connector_ptrs() { fanout_connector_ptrs_.clear(); }
+
+  /**
+   * @brief Get the connector type of this input/output.
+   *
+   * @return The connector type of this input/output.
+   */
+  ConnectorType connector_type() const { return connector_type_; }
+
+  /**
+   * @brief Set the connector (receiver for an input, transmitter for an output) of this
+   * input/output.
+   *
+   * The following ConnectorTypes are supported:
+   *
+   * - ConnectorType::kDefault
+   * - ConnectorType::kDoubleBuffer
+   * - ConnectorType::kLockFree
+   *
+   * The arguments are forwarded to the connector resource (e.g., `Arg("capacity", 4UL)`,
+   * `Arg("policy", 0UL)`). The resource is initialized by the executor when the graph is built.
+   *
+   * ```cpp
+   * spec.input<gxf::Entity>("in").connector(IOSpec::ConnectorType::kLockFree,
+   *                                         Arg("capacity", 4UL),
+   *                                         Arg("policy", 0UL));  // drop the oldest message
+   * ```
+   *
+   * @param type The type of the connector.
+   * @param args The arguments of the connector.
+   *
+   * @return The reference to this IOSpec.
+   */
+  template <typename... ArgsT>
+  IOSpec& connector(ConnectorType type, ArgsT&&... args) {
+    connector_type_ = type;
+    const bool is_input = io_type_ == IOType::kInput;
+    switch (type) {
+      case ConnectorType::kDefault:
+        resource(nullptr);
+        break;
+      case ConnectorType::kDoubleBuffer:
+        if (is_input) {
+          resource(std::make_shared<DoubleBufferReceiver>(std::forward<ArgsT>(args)...));
+        } else {
+          resource(std::make_shared<DoubleBufferTransmitter>(std::forward<ArgsT>(args)...));
+        }
+        break;
+      case ConnectorType::kLockFree:
+        if (is_input) {
+          resource(std::make_shared<LockFreeReceiver>(std::forward<ArgsT>(args)...));
+        } else {
+          resource(std::make_shared<LockFreeTransmitter>(std::forward<ArgsT>(args)...));
+        }
+        break;
+    }
+    return *this;
+  }
 
   /**
    * @brief Get the conditions of this input/output.
@@ -172,9 +286,83 @@ class IOSpec {
   IOType io_type_;
   const std::type_info* typeinfo_ = nullptr;
   std::shared_ptr<Resource> resource_;
+  void* connector_ptr_ = nullptr;
+  std::vector<void*> fanout_connector_ptrs_;
+  ConnectorType connector_type_ = ConnectorType::kDefault;
   std::vector<std::pair<ConditionType, std::shared_ptr<Condition>>> conditions_;
 };
 
+/**
+ * @brief Typed handle to an input port of an Operator.
+ *
+ * The handle is assigned from the IOSpec returned by `OperatorSpec::input<DataT>()` and can be
+ * passed to `InputContext::receive()` instead of the port name. Receiving through a handle skips
+ * the port-name lookup and uses the connector resolved at graph activation.
+ *
+ * ```cpp
+ * void setup(OperatorSpec& spec) override { in_ = spec.input<ValueData>("in"); }
+ *
+ * void compute(InputContext& op_input, OutputContext&, ExecutionContext&) override {
+ *   auto value = op_input.receive(in_);  // std::shared_ptr<ValueData>
+ * }
+ *
+ * InputPort<ValueData> in_;
+ * ```
+ *
+ * @tparam DataT The type of the data received from the port.
+ */
+template <typename DataT>
+class InputPort {
+ public:
+  InputPort() = default;
+  InputPort(IOSpec& spec) : spec_(&spec) {}  // NOLINT(runtime/explicit)
+
+  /**
+   * @brief Get the IOSpec of this port.
+   *
+   * @return The pointer to the IOSpec, or nullptr if the handle is not assigned.
+   */
+  IOSpec* spec() const { return spec_; }
+
+  /**
+   * @brief Check whether the handle is assigned to a port.
+   */
+  explicit operator bool() const { return spec_ != nullptr; }
+
+ private:
+  IOSpec* spec_ = nullptr;
+};
+
+/**
+ * @brief Typed handle to an output port of an Operator.
+ *
+ * The handle is assigned from the IOSpec returned by `OperatorSpec::output<DataT>()` and can be
+ * passed to `OutputContext::emit()` instead of the port name.
+ *
+ * @tparam DataT The type of the data sent to the port.
+ */
+template <typename DataT>
+class OutputPort {
+ public:
+  OutputPort() = default;
+  OutputPort(IOSpec& spec) : spec_(&spec) {}  // NOLINT(runtime/explicit)
+
+  /**
+   * @brief Get the IOSpec of this port.
+   *
+   * @return The pointer to the IOSpec, or nullptr if the handle is not assigned.
+   */
+  IOSpec* spec() const { return spec_; }
+
+  /**
+   * @brief Check whether the handle is assigned to a port.
+   */
+  explicit operator bool() const { return spec_ != nullptr; }
+
+ private:
+  IOSpec* spec_ = nullptr;
+};
+
 }  // namespace holoscan
 
 #endif /* HOLOSCAN_CORE_IO_SPEC_HPP */
@@ -20,6 +20,8 @@
 
 #include <any>
 #include <memory>
+#include <typeinfo>
+#include <utility>
 
 #include "./common.hpp"
 
@@ -31,6 +33,10 @@ namespace holoscan {
  * A message is a data structure that is used to pass data between operators.
  * It wraps a `std::any` object and provides a type-safe interface to access the data.
  *
+ * Shared pointers (`std::shared_ptr<T>`) are kept in a dedicated slot with their type info
+ * instead of a `std::any` object, so that passing them between native operators doesn't require
+ * a heap allocation per message.
+ *
  * This class is used by the `holoscan::gxf::GXFWrapper` to support the Holoscan native operator.
  * The `holoscan::gxf::GXFWrapper` will hold the object of this class and delegate the message to the
  * Holoscan native operator.
@@ -57,7 +63,26 @@ class Message {
    */
   template <typename ValueT>
   void set_value(ValueT value) {
-    value_ = value;
+    reset();
+    value_ = std::move(value);
+  }
+
+  /**
+   * @brief Set the value object to a shared pointer.
+   *
+   * The shared pointer is stored without type erasure through `std::any`.
+   *
+   * @tparam ValueT The element type of the shared pointer.
+   * @param value The shared pointer to be wrapped by the message.
+   */
+  template <typename ValueT>
+  void set_value(std::shared_ptr<ValueT> value) {
+    value_.reset();
+    shared_value_ = std::move(value);
+    shared_typeinfo_ = &typeid(ValueT);
+    shared_to_any_ = [](const std::shared_ptr<void>& ptr) -> std::any {
+      return std::static_pointer_cast<ValueT>(ptr);
+    };
   }
 
   /**
@@ -65,7 +90,42 @@ class Message {
    *
    * @return The value wrapped by the message.
    */
-  std::any value() const { return value_; }
+  std::any value() const {
+    if (shared_typeinfo_) { return shared_to_any_(shared_value_); }
+    return value_;
+  }
+
+  /**
+   * @brief Get the shared pointer wrapped by the message if it has the given element type.
+   *
+   * @param typeinfo The type info of the element type of the shared pointer.
+   * @return The shared pointer, or nullptr if the message doesn't hold a shared pointer of the
+   * given type.
+   */
+  std::shared_ptr<void> shared_value(const std::type_info& typeinfo) const {
+    if (shared_typeinfo_ && *shared_typeinfo_ == typeinfo) { return shared_value_; }
+    return nullptr;
+  }
+
+  /**
+   * @brief Check whether the message holds a shared pointer of the given element type.
+   *
+   * @param typeinfo The type info of the element type of the shared pointer.
+   * @return true if the message holds a shared pointer of the given type.
+   */
+  bool holds_shared_value(const std::type_info& typeinfo) const {
+    return shared_typeinfo_ && *shared_typeinfo_ == typeinfo;
+  }
+
+  /**
+   * @brief Clear the value wrapped by the message.
+   */
+  void reset() {
+    value_.reset();
+    shared_value_.reset();
+    shared_typeinfo_ = nullptr;
+    shared_to_any_ = nullptr;
+  }
 
   /**
    * @brief Get the value object as a specific type.
@@ -75,7 +135,11 @@ class Message {
    */
   template <typename ValueT>
   std::shared_ptr<ValueT> as() const {
+    if (holds_shared_value(typeid(ValueT))) {
+      return std::static_pointer_cast<ValueT>(shared_value_);
+    }
     try {
+      if (shared_typeinfo_) { return std::any_cast<std::shared_ptr<ValueT>>(value()); }
       return std::any_cast<std::shared_ptr<ValueT>>(value_);
     } catch (const std::bad_any_cast& e) {
       HOLOSCAN_LOG_ERROR("The message doesn't have a value of type '{}': {}",
@@ -86,7 +150,11 @@ class Message {
   }
 
  private:
-  std::any value_;  ///< The value wrapped by the message.
+  std::any value_;                                   ///< The value wrapped by the message.
+  std::shared_ptr<void> shared_value_;               ///< The shared pointer wrapped by the message.
+  const std::type_info* shared_typeinfo_ = nullptr;  ///< The element type of `shared_value_`.
+  /// Converts `shared_value_` back to `std::any` holding `std::shared_ptr<ValueT>`.
+  std::any (*shared_to_any_)(const std::shared_ptr<void>&) = nullptr;
 };
 
 }  // namespace holoscan
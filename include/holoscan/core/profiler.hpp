@@ -0,0 +1,243 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_PROFILER_HPP
+#define HOLOSCAN_CORE_PROFILER_HPP
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace holoscan {
+
+/**
+ * @brief Summary of the tick statistics of an operator.
+ *
+ * All durations are in milliseconds. Percentiles are estimated from a log-linear histogram and
+ * have a relative error of at most 1/16 (6.25%); count, min, mean and max are exact.
+ */
+struct OperatorProfile {
+  std::string name;               ///< The name of the operator.
+  uint64_t count = 0;             ///< The number of `compute()` calls.
+  double total_ms = 0.0;          ///< The total time spent in `compute()`.
+  double min_ms = 0.0;            ///< The minimum `compute()` time.
+  double mean_ms = 0.0;           ///< The average `compute()` time.
+  double p50_ms = 0.0;            ///< The median `compute()` time.
+  double p99_ms = 0.0;            ///< The 99th percentile of the `compute()` time.
+  double max_ms = 0.0;            ///< The maximum `compute()` time.
+  double interval_mean_ms = 0.0;  ///< The average time between the starts of two ticks.
+  double interval_p50_ms = 0.0;   ///< The median time between the starts of two ticks.
+  double interval_p99_ms = 0.0;   ///< The 99th percentile of the time between two ticks.
+  double interval_max_ms = 0.0;   ///< The maximum time between the starts of two ticks.
+  double throughput_hz = 0.0;     ///< The number of ticks per second.
+};
+
+/**
+ * @brief Per-operator tick latency profiler.
+ *
+ * When enabled, `holoscan::gxf::GXFWrapper` measures each `compute()` call of a native operator
+ * and records the duration and the interval since the previous tick in a buffer owned by the
+ * calling thread. Recording is wait-free: a thread only takes a lock the first time it records a
+ * tick. When the profiler is disabled (the default), no buffer is allocated and the cost per tick
+ * is a single branch.
+ *
+ * The statistics can be queried while the application is running with `operator_profiles()`, and
+ * are written to `output_file()` (if set) when the graph execution completes.
+ *
+ * ```cpp
+ * auto app = holoscan::make_application<MyApp>();
+ * app->profiler().enable();
+ * app->profiler().output_file("profile.json");  // or "profile.csv"
+ * app->run();
+ * for (auto& profile : app->profiler().operator_profiles()) { ... }
+ * ```
+ */
+class Profiler {
+ public:
+  Profiler();
+  ~Profiler();
+
+  Profiler(const Profiler&) = delete;
+  Profiler& operator=(const Profiler&) = delete;
+
+  /**
+   * @brief Enable or disable profiling.
+   *
+   * Profiling must be enabled before the application is run.
+   *
+   * @param enabled Whether profiling is enabled.
+   */
+  void enable(bool enabled = true) { enabled_ = enabled; }
+
+  /**
+   * @brief Check whether profiling is enabled.
+   *
+   * @return true if profiling is enabled.
+   */
+  bool enabled() const { return enabled_; }
+
+  /**
+   * @brief Set the path of the file the statistics are written to when the graph execution
+   * completes.
+   *
+   * The file is written in CSV format if the path ends with `.csv`, and in JSON format otherwise.
+   * If the path is empty (the default), no file is written.
+   *
+   * @param path The path of the output file.
+   */
+  void output_file(const std::string& path) { output_file_ = path; }
+
+  /**
+   * @brief Get the path of the file the statistics are written to.
+   *
+   * @return The path of the output file.
+   */
+  const std::string& output_file() const { return output_file_; }
+
+  /**
+   * @brief Register an operator to be profiled.
+   *
+   * Registering the same name again returns the same index.
+   *
+   * @param name The name of the operator.
+   * @return The index of the operator to be passed to `record()`.
+   */
+  size_t register_operator(const std::string& name);
+
+  /**
+   * @brief Record a tick of an operator.
+   *
+   * @param op_index The index returned by `register_operator()`.
+   * @param start_ns The time (from `now_ns()`) at which `compute()` was called.
+   * @param end_ns The time (from `now_ns()`) at which `compute()` returned.
+   */
+  void record(size_t op_index, int64_t start_ns, int64_t end_ns);
+
+  /**
+   * @brief Get the statistics of all registered operators.
+   *
+   * This can be called while the application is running.
+   *
+   * @return The statistics, in the order in which the operators were registered.
+   */
+  std::vector<OperatorProfile> operator_profiles() const;
+
+  /**
+   * @brief Clear all recorded statistics.
+   *
+   * Ticks that are being recorded while this method is called may be partially kept.
+   */
+  void reset();
+
+  /**
+   * @brief Get the statistics in JSON format.
+   *
+   * @return The JSON string.
+   */
+  std::string to_json() const;
+
+  /**
+   * @brief Get the statistics in CSV format (with a header row).
+   *
+   * @return The CSV string.
+   */
+  std::string to_csv() const;
+
+  /**
+   * @brief Write the statistics to a file.
+   *
+   * The file is written in CSV format if the path ends with `.csv`, and in JSON format otherwise.
+   *
+   * @param path The path of the output file.
+   * @return true if the file was written.
+   */
+  bool dump(const std::string& path) const;
+
+  /**
+   * @brief Get the current time of the monotonic clock used by the profiler.
+   *
+   * @return The time in nanoseconds.
+   */
+  static int64_t now_ns();
+
+ private:
+  /// Number of linear buckets (one per nanosecond) below the first exponential bucket.
+  static constexpr int kLinearBuckets = 16;
+  /// Number of sub-buckets per power of two.
+  static constexpr int kSubBucketBits = 3;
+  /// Largest tracked power of two (2^40 ns is about 18 minutes); larger values are clamped.
+  static constexpr int kMaxExponent = 40;
+  static constexpr int kBucketCount =
+      kLinearBuckets + (kMaxExponent - 4 + 1) * (1 << kSubBucketBits);
+
+  /// Histogram and running totals that are only written by the thread owning them.
+  struct Histogram {
+    std::atomic<uint64_t> count{0};
+    std::atomic<uint64_t> sum{0};
+    std::atomic<uint64_t> min{UINT64_MAX};
+    std::atomic<uint64_t> max{0};
+    std::array<std::atomic<uint64_t>, kBucketCount> buckets{};
+
+    void add(uint64_t value);
+    void clear();
+  };
+
+  /// State shared by all threads for an operator.
+  struct OperatorEntry {
+    std::string name;
+    std::atomic<int64_t> first_start_ns{0};
+    std::atomic<int64_t> last_start_ns{0};
+  };
+
+  struct OperatorSlot {
+    OperatorEntry* entry = nullptr;
+    Histogram compute;
+    Histogram interval;
+  };
+
+  /// Buffer owned by a single recording thread, with one slot per registered operator.
+  struct ThreadBuffer {
+    explicit ThreadBuffer(size_t size) : slots(size) {}
+    std::vector<OperatorSlot> slots;
+  };
+
+  static int bucket_index(uint64_t value);
+  static uint64_t bucket_value(int index);
+
+  ThreadBuffer* thread_buffer();
+
+  const uint64_t id_;  ///< Unique id of this profiler (used to validate thread-local caches).
+  bool enabled_ = false;
+  std::string output_file_;
+
+  mutable std::mutex mutex_;  ///< Guards the containers below.
+  std::vector<std::unique_ptr<OperatorEntry>> operators_;
+  std::vector<std::unique_ptr<ThreadBuffer>> thread_buffers_;
+  std::unordered_map<std::thread::id, ThreadBuffer*> buffer_by_thread_;
+  /// Incremented when an operator is registered so that threads reacquire a large enough buffer.
+  std::atomic<uint64_t> generation_{0};
+};
+
+}  // namespace holoscan
+
+#endif /* HOLOSCAN_CORE_PROFILER_HPP */
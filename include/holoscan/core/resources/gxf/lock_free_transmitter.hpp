@@ -0,0 +1,52 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_RESOURCES_GXF_LOCK_FREE_TRANSMITTER_HPP
+#define HOLOSCAN_CORE_RESOURCES_GXF_LOCK_FREE_TRANSMITTER_HPP
+
+#include <string>
+
+#include "../../gxf/lock_free_channel.hpp"
+#include "./transmitter.hpp"
+
+namespace holoscan {
+
+/**
+ * @brief Transmitter backed by a lock-free ring buffer (`holoscan::gxf::LockFreeTransmitter`).
+ *
+ * It can be used instead of DoubleBufferTransmitter for a port with
+ * `IOSpec::connector(IOSpec::ConnectorType::kLockFree, ...)`.
+ */
+class LockFreeTransmitter : public Transmitter {
+ public:
+  HOLOSCAN_RESOURCE_FORWARD_ARGS_SUPER(LockFreeTransmitter, Transmitter)
+  LockFreeTransmitter() = default;
+  LockFreeTransmitter(const std::string& name, holoscan::gxf::LockFreeTransmitter* component);
+
+  const char* gxf_typename() const override { return "holoscan::gxf::LockFreeTransmitter"; }
+
+  void setup(ComponentSpec& spec) override;
+
+ private:
+  Parameter<uint64_t> capacity_;
+  Parameter<uint64_t> policy_;
+  Parameter<uint64_t> block_timeout_ms_;
+};
+
+}  // namespace holoscan
+
+#endif /* HOLOSCAN_CORE_RESOURCES_GXF_LOCK_FREE_TRANSMITTER_HPP */
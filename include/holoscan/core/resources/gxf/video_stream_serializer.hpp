@@ -19,6 +19,7 @@
 #define HOLOSCAN_CORE_RESOURCES_GXF_VIDEO_STREAM_SERIALIZER_HPP
 
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "../../gxf/gxf_resource.hpp"
@@ -40,6 +41,13 @@ class VideoStreamSerializer : public gxf::GXFResource {
 
  private:
   Parameter<std::vector<std::shared_ptr<holoscan::Resource>>> component_serializers_;
+  Parameter<std::string> compression_;
+  Parameter<int32_t> compression_level_;
+  Parameter<bool> delta_encoding_;
+  Parameter<uint64_t> keyframe_interval_;
+  Parameter<uint64_t> compression_chunk_size_;
+  Parameter<uint64_t> compression_threads_;
+  Parameter<bool> verify_checksum_;
 };
 
 }  // namespace holoscan
@@ -0,0 +1,49 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_SCHEDULERS_GXF_EVENT_BASED_SCHEDULER_HPP
+#define HOLOSCAN_CORE_SCHEDULERS_GXF_EVENT_BASED_SCHEDULER_HPP
+
+#include "../../gxf/gxf_scheduler.hpp"
+
+namespace holoscan {
+
+/**
+ * @brief Event-based scheduler.
+ *
+ * Like the multi-thread scheduler, but operators are only re-evaluated when an event (e.g., a
+ * message arriving at one of their inputs) occurs instead of being polled periodically.
+ *
+ * @note This scheduler requires a GXF release that provides `nvidia::gxf::EventBasedScheduler`.
+ */
+class EventBasedScheduler : public gxf::GXFScheduler {
+ public:
+  HOLOSCAN_SCHEDULER_FORWARD_ARGS_SUPER(EventBasedScheduler, GXFScheduler)
+  EventBasedScheduler() = default;
+
+  const char* gxf_typename() const override { return "nvidia::gxf::EventBasedScheduler"; }
+
+  void setup(ComponentSpec& spec) override;
+
+ private:
+  Parameter<int64_t> worker_thread_number_;
+  Parameter<bool> stop_on_deadlock_;
+};
+
+}  // namespace holoscan
+
+#endif /* HOLOSCAN_CORE_SCHEDULERS_GXF_EVENT_BASED_SCHEDULER_HPP */
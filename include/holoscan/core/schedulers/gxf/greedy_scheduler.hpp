@@ -0,0 +1,47 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_SCHEDULERS_GXF_GREEDY_SCHEDULER_HPP
+#define HOLOSCAN_CORE_SCHEDULERS_GXF_GREEDY_SCHEDULER_HPP
+
+#include "../../gxf/gxf_scheduler.hpp"
+
+namespace holoscan {
+
+/**
+ * @brief Greedy scheduler.
+ *
+ * Executes all operators of the fragment on a single thread, always picking the first operator
+ * that is ready to run. This is the default scheduler of a fragment.
+ */
+class GreedyScheduler : public gxf::GXFScheduler {
+ public:
+  HOLOSCAN_SCHEDULER_FORWARD_ARGS_SUPER(GreedyScheduler, GXFScheduler)
+  GreedyScheduler() = default;
+
+  const char* gxf_typename() const override { return "nvidia::gxf::GreedyScheduler"; }
+
+  void setup(ComponentSpec& spec) override;
+
+ private:
+  Parameter<bool> stop_on_deadlock_;
+  Parameter<double> check_recession_period_ms_;
+};
+
+}  // namespace holoscan
+
+#endif /* HOLOSCAN_CORE_SCHEDULERS_GXF_GREEDY_SCHEDULER_HPP */
@@ -0,0 +1,48 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_SCHEDULERS_GXF_MULTITHREAD_SCHEDULER_HPP
+#define HOLOSCAN_CORE_SCHEDULERS_GXF_MULTITHREAD_SCHEDULER_HPP
+
+#include "../../gxf/gxf_scheduler.hpp"
+
+namespace holoscan {
+
+/**
+ * @brief Multi-thread scheduler.
+ *
+ * Dispatches ready operators to a pool of worker threads so that independent operators (e.g., the
+ * branches downstream of a broadcast) are executed concurrently.
+ */
+class MultiThreadScheduler : public gxf::GXFScheduler {
+ public:
+  HOLOSCAN_SCHEDULER_FORWARD_ARGS_SUPER(MultiThreadScheduler, GXFScheduler)
+  MultiThreadScheduler() = default;
+
+  const char* gxf_typename() const override { return "nvidia::gxf::MultiThreadScheduler"; }
+
+  void setup(ComponentSpec& spec) override;
+
+ private:
+  Parameter<int64_t> worker_thread_number_;
+  Parameter<bool> stop_on_deadlock_;
+  Parameter<double> check_recession_period_ms_;
+};
+
+}  // namespace holoscan
+
+#endif /* HOLOSCAN_CORE_SCHEDULERS_GXF_MULTITHREAD_SCHEDULER_HPP */
@@ -31,7 +31,9 @@
 #include "./core/io_context.hpp"
 #include "./core/message.hpp"
 #include "./core/operator.hpp"
+#include "./core/profiler.hpp"
 #include "./core/resource.hpp"
+#include "./core/scheduler.hpp"
 
 // Domain objects
 #include "./core/gxf/entity.hpp"
@@ -41,6 +43,7 @@
 #include "./core/conditions/gxf/count.hpp"
 #include "./core/conditions/gxf/downstream_affordable.hpp"
 #include "./core/conditions/gxf/message_available.hpp"
+#include "./core/conditions/gxf/target_time.hpp"
 
 // Resources
 #include "./core/resources/gxf/block_memory_pool.hpp"
@@ -49,6 +52,11 @@
 #include "./core/resources/gxf/unbounded_allocator.hpp"
 #include "./core/resources/gxf/video_stream_serializer.hpp"
 
+// Schedulers
+#include "./core/schedulers/gxf/event_based_scheduler.hpp"
+#include "./core/schedulers/gxf/greedy_scheduler.hpp"
+#include "./core/schedulers/gxf/multithread_scheduler.hpp"
+
 // Operators
 #include "./core/gxf/gxf_operator.hpp"
 
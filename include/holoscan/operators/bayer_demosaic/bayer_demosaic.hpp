@@ -29,6 +29,10 @@ namespace holoscan::ops {
  * @brief Operator class to demosaic the input video stream.
  *
  * This wraps a GXF Codelet(`nvidia::holoscan::BayerDemosaic`).
+ *
+ * Images are demosaiced with NPP, images in host memory are first copied to the device. Without
+ * NPP, or with the gradient-corrected interpolation, images in host memory are demosaiced on the
+ * CPU, with the rows split across `num_threads` threads, and the output stays in host memory.
  */
 class BayerDemosaicOp : public holoscan::ops::GXFOperator {
  public:
@@ -53,6 +57,7 @@ class BayerDemosaicOp : public holoscan::ops::GXFOperator {
   Parameter<int> bayer_grid_pos_;
   Parameter<bool> generate_alpha_;
   Parameter<int> alpha_value_;
+  Parameter<uint32_t> num_threads_;
 };
 
 }  // namespace holoscan::ops
@@ -26,6 +26,7 @@
 
 #include "holoscan/core/gxf/gxf_operator.hpp"
 #include "holoscan/utils/cuda_stream_handler.hpp"
+#include "holoscan/utils/row_worker_pool.hpp"
 
 namespace holoscan::ops {
 
@@ -70,7 +71,21 @@ class FormatConverterOp : public holoscan::Operator {
                            const int32_t columns, const int16_t in_channels,
                            const int16_t out_channels);
 
+  /// resizeImage() for an input in host memory, on the CPU
+  nvidia::gxf::Expected<void*> resizeImageOnHost(const void* in_tensor_data, const int32_t rows,
+                                                 const int32_t columns, const int16_t channels,
+                                                 const nvidia::gxf::PrimitiveType primitive_type,
+                                                 const int32_t resize_width,
+                                                 const int32_t resize_height);
+  /// convertTensorFormat() for input and output tensors in host memory, on the CPU
+  void convertTensorFormatOnHost(const void* in_tensor_data, void* out_tensor_data,
+                                 const int32_t rows, const int32_t columns,
+                                 const int16_t in_channels, const int16_t out_channels);
+
  private:
+  /// Returns the pool processing a host image, or nullptr to process it on the calling thread
+  RowWorkerPool* hostRowWorkerPool(int32_t rows, int32_t columns);
+
   Parameter<holoscan::IOSpec*> in_;
   Parameter<holoscan::IOSpec*> out_;
 
@@ -85,6 +100,7 @@ class FormatConverterOp : public holoscan::Operator {
   Parameter<std::vector<int>> out_channel_order_;
 
   Parameter<std::shared_ptr<Allocator>> pool_;
+  Parameter<uint32_t> num_threads_;
 
   Parameter<std::string> in_dtype_str_;
   Parameter<std::string> out_dtype_str_;
@@ -99,9 +115,14 @@ class FormatConverterOp : public holoscan::Operator {
   nvidia::gxf::MemoryBuffer resize_buffer_;
   nvidia::gxf::MemoryBuffer channel_buffer_;
   nvidia::gxf::MemoryBuffer device_scratch_buffer_;
+  std::vector<uint8_t> host_resize_buffer_;
   NppStreamContext npp_stream_ctx_{};
+  bool has_npp_ = false;
 
   CudaStreamHandler cuda_stream_handler_;
+
+  // Threads processing the rows of host images without GPU, reused from one frame to the next
+  std::unique_ptr<RowWorkerPool> row_worker_pool_;
 };
 
 }  // namespace holoscan::ops
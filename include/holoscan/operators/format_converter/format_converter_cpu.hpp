@@ -0,0 +1,149 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_OPERATORS_FORMAT_CONVERTER_FORMAT_CONVERTER_CPU_HPP
+#define HOLOSCAN_OPERATORS_FORMAT_CONVERTER_FORMAT_CONVERTER_CPU_HPP
+
+#include <cstdint>
+
+// Host implementations of the NPP functions used by FormatConverterOp, for images in host memory.
+//
+// The images are channel-packed with rows of `columns * channels` values, except for the planar
+// YUV formats. The loops are vectorized by the compiler and the rows of the output are split
+// across the threads of `row_worker_pool`. Without pool the image is processed on the calling
+// thread.
+namespace holoscan {
+class RowWorkerPool;
+}  // namespace holoscan
+
+namespace holoscan::ops::format_converter {
+
+/// Value of `channel_order` entries filling an output channel with the constant `fill_value`
+constexpr int32_t kFillChannel = -1;
+
+/**
+ * @brief Returns true if the resize mode, a NppiInterpolationMode value, is supported by
+ * cpu_resize().
+ *
+ * Nearest neighbor (1), linear (2) and the cubic modes (4 to 7) are supported.
+ */
+bool cpu_resize_mode_supported(int32_t resize_mode);
+
+/**
+ * @brief Resizes an 8-bit image, like nppiResize_8u_C{3,4}R.
+ *
+ * Output pixel centers are mapped to the input with the scale of each axis and the samples
+ * outside of the input repeat its border.
+ *
+ * @param resize_mode NppiInterpolationMode value, see cpu_resize_mode_supported()
+ */
+void cpu_resize(const uint8_t* src, int32_t src_rows, int32_t src_columns, int32_t channels,
+                uint8_t* dst, int32_t dst_rows, int32_t dst_columns, int32_t resize_mode,
+                RowWorkerPool* row_worker_pool = nullptr);
+
+/**
+ * @brief Resizes an 8-bit image and converts it to a normalized 32-bit floating point image in a
+ * single pass.
+ *
+ * This is the chain of cpu_resize(), of the channel selection and of cpu_scale(), up to the
+ * rounding of the resized values, without the intermediate images. Output channel `c` is
+ * `value * factors[c] + offsets[c]`, where `value` is input channel `channel_order[c]`
+ * interpolated like in cpu_resize(). A null `channel_order` keeps the first `out_channels`
+ * channels.
+ *
+ * The output columns are processed in tiles: the input rows of a tile are blended into a buffer
+ * kept in the L1 cache, which is then resampled and normalized one output channel at a time.
+ *
+ * @param planar If true the output is CHW, with one plane per channel, else it is HWC
+ * @param resize_mode NppiInterpolationMode value, see cpu_resize_mode_supported()
+ */
+void cpu_preprocess(const uint8_t* src, int32_t src_rows, int32_t src_columns,
+                    int32_t in_channels, float* dst, int32_t dst_rows, int32_t dst_columns,
+                    int32_t out_channels, const int32_t* channel_order, const float* factors,
+                    const float* offsets, bool planar, int32_t resize_mode,
+                    RowWorkerPool* row_worker_pool = nullptr);
+
+/**
+ * @brief Copies the channels of an 8-bit image, like nppiSwapChannels_8u.
+ *
+ * Output channel `c` is input channel `channel_order[c]`, or `fill_value` when
+ * `channel_order[c]` is kFillChannel. A null `channel_order` keeps the first `out_channels`
+ * channels and fills the ones past the input channels.
+ */
+void cpu_swap_channels(const uint8_t* src, int32_t in_channels, uint8_t* dst,
+                       int32_t out_channels, int32_t rows, int32_t columns,
+                       const int32_t* channel_order, uint8_t fill_value = 0,
+                       RowWorkerPool* row_worker_pool = nullptr);
+
+/// @brief cpu_swap_channels() for 32-bit floating point images
+void cpu_swap_channels(const float* src, int32_t in_channels, float* dst, int32_t out_channels,
+                       int32_t rows, int32_t columns, const int32_t* channel_order,
+                       float fill_value = 0.f, RowWorkerPool* row_worker_pool = nullptr);
+
+/**
+ * @brief Converts an 8-bit image to 32-bit floating point, mapping [0, 255] to
+ * [scale_min, scale_max] like nppiScale_8u32f. The channels are selected like in
+ * cpu_swap_channels().
+ */
+void cpu_scale(const uint8_t* src, int32_t in_channels, float* dst, int32_t out_channels,
+               int32_t rows, int32_t columns, const int32_t* channel_order, float scale_min,
+               float scale_max, RowWorkerPool* row_worker_pool = nullptr);
+
+/**
+ * @brief Converts a 32-bit floating point image to 8-bit, mapping [scale_min, scale_max] to
+ * [0, 255] with saturation like nppiScale_32f8u. The channels are selected like in
+ * cpu_swap_channels().
+ */
+void cpu_scale(const float* src, int32_t in_channels, uint8_t* dst, int32_t out_channels,
+               int32_t rows, int32_t columns, const int32_t* channel_order, float scale_min,
+               float scale_max, RowWorkerPool* row_worker_pool = nullptr);
+
+/**
+ * @brief Converts an RGB888 image to planar YUV420, like nppiRGBToYUV420_8u_C3P3R.
+ *
+ * The chroma planes have (columns + 1) / 2 by (rows + 1) / 2 samples, each one computed from the
+ * mean of a 2x2 block of pixels.
+ *
+ * @param yuv Y, U and V planes
+ * @param yuv_steps Bytes per row of each plane
+ */
+void cpu_rgb_to_yuv420(const uint8_t* src, int32_t rows, int32_t columns, uint8_t* const yuv[3],
+                       const int32_t yuv_steps[3], RowWorkerPool* row_worker_pool = nullptr);
+
+/**
+ * @brief Converts a planar YUV420 image to RGB888 or RGBA8888, like nppiYUV420ToRGB_8u_P3C3R and
+ * nppiYUV420ToRGB_8u_P3AC4R. The alpha channel is set to 255.
+ *
+ * @param out_channels 3 or 4
+ */
+void cpu_yuv420_to_rgb(const uint8_t* const yuv[3], const int32_t yuv_steps[3], uint8_t* dst,
+                       int32_t out_channels, int32_t rows, int32_t columns,
+                       RowWorkerPool* row_worker_pool = nullptr);
+
+/**
+ * @brief Converts an NV12 image with BT.709 limited range values to RGB888, like
+ * nppiNV12ToRGB_709HDTV_8u_P2C3R.
+ *
+ * @param step Bytes per row of both the Y and the interleaved UV planes
+ */
+void cpu_nv12_to_rgb_709hdtv(const uint8_t* y, const uint8_t* uv, int32_t step, uint8_t* dst,
+                             int32_t rows, int32_t columns,
+                             RowWorkerPool* row_worker_pool = nullptr);
+
+}  // namespace holoscan::ops::format_converter
+
+#endif /* HOLOSCAN_OPERATORS_FORMAT_CONVERTER_FORMAT_CONVERTER_CPU_HPP */
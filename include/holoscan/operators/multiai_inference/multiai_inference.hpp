@@ -24,6 +24,7 @@
 #include <vector>
 
 #include "holoscan/core/gxf/gxf_operator.hpp"
+#include "holoscan/utils/holoinfer_utils.hpp"
 
 #include "holoinfer.hpp"
 #include "holoinfer_utils.hpp"
@@ -80,13 +81,14 @@ class MultiAIInferenceOp : public holoscan::Operator {
   };
 
  private:
-  ///  @brief Map with key as model name and value as inferred tensor name
-  Parameter<DataMap> inference_map_;
+  ///  @brief Map with key as model name and value as inferred tensor names, one per model output
+  Parameter<DataVecMap> inference_map_;
 
   ///  @brief Map with key as model name and value as model file path
   Parameter<DataMap> model_path_map_;
 
-  ///  @brief Map with key as model name and value as vector of input tensor names
+  ///  @brief Map with key as model name and value as vector of input tensor names, one per model
+  ///  input
   Parameter<DataVecMap> pre_processor_map_;
 
   ///  @brief Input tensor names
@@ -105,6 +107,45 @@ class MultiAIInferenceOp : public holoscan::Operator {
   ///  @brief Flag to enable parallel inference. Default is True.
   Parameter<bool> parallel_inference_;
 
+  ///  @brief Number of threads running models in parallel. Default is 0, for one per model.
+  Parameter<size_t> inference_threads_;
+
+  ///  @brief Maximum number of samples run in one inference call (only supported by onnxruntime,
+  ///  for models with a dynamic batch dimension). Default is 1.
+  Parameter<size_t> batch_size_;
+
+  ///  @brief Maximum time in microseconds an inference waits for others to fill its batch.
+  ///  Default is 0.
+  Parameter<int64_t> batch_timeout_us_;
+
+  ///  @brief Onnxruntime threads running an operator of a model, 0 for the onnxruntime default.
+  ///  Default is 1.
+  Parameter<int32_t> intra_op_threads_;
+
+  ///  @brief Onnxruntime threads running independent operators of a model in parallel execution
+  ///  mode, 0 for the onnxruntime default. Default is 0.
+  Parameter<int32_t> inter_op_threads_;
+
+  ///  @brief Flag to run independent operators of a model in parallel (onnxruntime execution
+  ///  mode). Default is False.
+  Parameter<bool> parallel_execution_;
+
+  ///  @brief Onnxruntime graph optimization level: "disable", "basic", "extended" or "all".
+  ///  Default is "extended".
+  Parameter<std::string> graph_optimization_level_;
+
+  ///  @brief Directory where onnxruntime saves the optimized models and loads them from. Default
+  ///  is empty, for no cache.
+  Parameter<std::string> optimized_model_cache_path_;
+
+  ///  @brief Per channel mean normalizing uint8 input tensors to float32, with channels
+  ///  interleaved in the last dimension. Default is empty, for uint8 tensors passed as is.
+  Parameter<std::vector<float>> input_mean_;
+
+  ///  @brief Per channel standard deviation normalizing uint8 input tensors to float32, of the
+  ///  size of input_mean. Default is empty.
+  Parameter<std::vector<float>> input_std_;
+
   ///  @brief Flag showing if input buffers are on CUDA. Default is True.
   Parameter<bool> input_on_cuda_;
 
@@ -138,13 +179,18 @@ class MultiAIInferenceOp : public holoscan::Operator {
   /// Pointer to multi ai inference specifications
   std::shared_ptr<HoloInfer::MultiAISpecs> multiai_specs_;
 
-  /// Data type of message to be transmitted. Supported value: float32
-  nvidia::gxf::PrimitiveType data_type_ = nvidia::gxf::PrimitiveType::kFloat32;
-
   /// Map holding dimensions per model. Key is model name and value is a vector with
   /// dimensions.
   std::map<std::string, std::vector<int>> dims_per_tensor_;
 
+  /// Messages received by the last data extraction, holding the input tensors aliased by the
+  /// data buffers, and the message index of each tensor.
+  holoscan::utils::ReceivedMessages received_messages_;
+
+  /// Map with output tensor name as both key and value, used to look up the output dimensions
+  /// per tensor on transmission.
+  HoloInfer::Mappings output_tensor_map_;
+
   /// Codelet Identifier, used in reporting.
   const std::string module_{"Multi AI Inference Codelet"};
 };
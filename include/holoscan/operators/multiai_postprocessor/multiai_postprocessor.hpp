@@ -24,6 +24,7 @@
 #include <vector>
 
 #include "holoscan/core/gxf/gxf_operator.hpp"
+#include "holoscan/utils/holoinfer_utils.hpp"
 
 #include "holoinfer.hpp"
 #include "holoinfer_utils.hpp"
@@ -78,8 +79,12 @@ class MultiAIPostprocessorOp : public holoscan::Operator {
   };
 
  private:
-  ///  @brief Map with key as tensor name and value as vector of supported operations.
-  ///  Supported operations: "max_per_channel_scaled"
+  ///  @brief Map with key as tensor name and value as vector of supported operations, run in
+  ///  sequence. An operation is "name" or "name,arg1,arg2". Built-in operations:
+  ///  "max_per_channel_scaled", "print", "print_custom_binary_classification,<first>,<second>",
+  ///  "softmax", "sigmoid", "argmax", "top_k,<k>", "threshold,<value>",
+  ///  "nms,<iou_threshold>[,<score_threshold>]" and "resize_mask,<height>,<width>". Operations
+  ///  registered with HoloInfer::register_process_operation are also supported.
   Parameter<DataVecMap> process_operations_;
 
   ///  @brief Map with key as input tensor name and value as processed tensor name
@@ -126,6 +131,10 @@ class MultiAIPostprocessorOp : public holoscan::Operator {
   /// dimensions.
   std::map<std::string, std::vector<int>> dims_per_tensor_;
 
+  /// Messages received by the last data extraction, holding the input tensors aliased by the
+  /// data buffers, and the message index of each tensor.
+  holoscan::utils::ReceivedMessages received_messages_;
+
   /// Codelet Identifier, used in reporting.
   const std::string module_{"Multi AI Postprocessor Codelet"};
 };
@@ -0,0 +1,87 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_OPERATORS_PREPROCESSOR_PREPROCESSOR_HPP
+#define HOLOSCAN_OPERATORS_PREPROCESSOR_PREPROCESSOR_HPP
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "holoscan/core/gxf/gxf_operator.hpp"
+#include "holoscan/utils/row_worker_pool.hpp"
+
+namespace holoscan::ops {
+
+/**
+ * @brief Operator class to prepare an image for the inference of a network, on the CPU.
+ *
+ * Resizes an 8-bit RGB or RGBA image, selects and reorders its channels, converts it to 32-bit
+ * floating point with a per-channel normalization and writes it with the HWC or CHW layout,
+ * in a single pass over the input. This replaces a chain of FormatConverterOp instances (resize,
+ * RGBA to RGB, uint8 to float32) followed by a layout transpose for inputs in host memory.
+ *
+ * Output channel `c` is `((value * (scale_max - scale_min) / 255 + scale_min) - mean[c]) / std[c]`
+ * where `value` is the resized input channel `out_channel_order[c]`.
+ *
+ * The input is a Tensor or a RGBA VideoBuffer in host memory, the output tensor is allocated in
+ * the same kind of memory. Inputs in device memory are not supported, use FormatConverterOp.
+ */
+class PreprocessorOp : public holoscan::Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(PreprocessorOp)
+
+  PreprocessorOp() = default;
+
+  void setup(OperatorSpec& spec) override;
+  void start() override;
+  void compute(InputContext& op_input, OutputContext& op_output,
+               ExecutionContext& context) override;
+
+ private:
+  Parameter<holoscan::IOSpec*> in_;
+  Parameter<holoscan::IOSpec*> out_;
+
+  Parameter<std::string> in_tensor_name_;
+  Parameter<std::string> out_tensor_name_;
+  Parameter<int32_t> resize_width_;
+  Parameter<int32_t> resize_height_;
+  Parameter<int32_t> resize_mode_;
+  Parameter<std::vector<int>> out_channel_order_;
+  Parameter<float> scale_min_;
+  Parameter<float> scale_max_;
+  Parameter<std::vector<float>> mean_;
+  Parameter<std::vector<float>> std_;
+  Parameter<std::string> out_layout_;
+
+  Parameter<std::shared_ptr<Allocator>> pool_;
+  Parameter<uint32_t> num_threads_;
+
+  // internal state
+  int32_t resize_mode_value_ = 0;
+  bool planar_ = false;
+  std::vector<int32_t> channel_order_;
+  std::vector<float> factors_;
+  std::vector<float> offsets_;
+
+  // Threads processing the rows of the output, reused from one frame to the next
+  std::unique_ptr<RowWorkerPool> row_worker_pool_;
+};
+
+}  // namespace holoscan::ops
+
+#endif /* HOLOSCAN_OPERATORS_PREPROCESSOR_PREPROCESSOR_HPP */
@@ -19,6 +19,10 @@
 
 #include <cstdint>
 
+namespace holoscan {
+class RowWorkerPool;
+}  // namespace holoscan
+
 namespace holoscan::ops {
 namespace segmentation_postprocessor {
 
@@ -45,5 +49,17 @@ void cuda_postprocess(enum NetworkOutputType network_output_type, enum DataForma
                       Shape shape, const float* input, output_type_t* output,
                       cudaStream_t cuda_stream = cudaStreamDefault);
 
+/**
+ * @brief Host implementation of cuda_postprocess, for input and output in host memory.
+ *
+ * The rows of the output are split across the threads of the pool. The results are the same as
+ * the ones of the CUDA kernel.
+ *
+ * @param row_worker_pool Threads processing the rows, null to process them on the calling thread
+ */
+void cpu_postprocess(enum NetworkOutputType network_output_type, enum DataFormat data_format,
+                     Shape shape, const float* input, output_type_t* output,
+                     RowWorkerPool* row_worker_pool = nullptr);
+
 }  // namespace segmentation_postprocessor
 }  // namespace holoscan::ops
@@ -24,6 +24,7 @@
 
 #include "holoscan/core/operator.hpp"
 #include "holoscan/utils/cuda_stream_handler.hpp"
+#include "holoscan/utils/row_worker_pool.hpp"
 #include "segmentation_postprocessor.cuh"
 
 using holoscan::ops::segmentation_postprocessor::DataFormat;
@@ -55,8 +56,12 @@ class SegmentationPostprocessorOp : public Operator {
   Parameter<std::string> in_tensor_name_;
   Parameter<std::string> network_output_type_;
   Parameter<std::string> data_format_;
+  Parameter<uint32_t> num_threads_;
 
   CudaStreamHandler cuda_stream_handler_;
+
+  // Threads processing the rows of host inputs, reused from one frame to the next
+  std::unique_ptr<RowWorkerPool> row_worker_pool_;
 };
 
 }  // namespace holoscan::ops
@@ -0,0 +1,94 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_OPERATORS_VIDEO_STREAM_RECORDER_BLOCK_FILE_ENDPOINT_HPP
+#define HOLOSCAN_OPERATORS_VIDEO_STREAM_RECORDER_BLOCK_FILE_ENDPOINT_HPP
+
+#include <gxf/core/gxf.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "gxf/core/expected.hpp"
+#include "gxf/serialization/endpoint.hpp"
+
+namespace holoscan::ops {
+
+/**
+ * @brief Write-only endpoint which coalesces small writes into large blocks.
+ *
+ * Serializers issue one write per header and per component, which is costly when each one goes
+ * to the kernel. This endpoint appends them to an aligned buffer and writes the buffer to the
+ * file once it holds `block_size` bytes, or when flush() is called.
+ *
+ * With direct I/O (`O_DIRECT`), every write covers whole blocks of `kAlignment` bytes: the last
+ * partial block is padded on flush() and kept in the buffer, so that it is written again at the
+ * same offset once it has more data. The file is truncated to its actual size on close(). If the
+ * file system does not support direct I/O, buffered I/O is used instead.
+ */
+class BlockFileEndpoint : public nvidia::gxf::Endpoint {
+ public:
+  /// Alignment of the buffer, and of the offset and size of direct I/O writes.
+  static constexpr size_t kAlignment = 4096;
+
+  BlockFileEndpoint() = default;
+  ~BlockFileEndpoint() override;
+
+  BlockFileEndpoint(const BlockFileEndpoint&) = delete;
+  BlockFileEndpoint& operator=(const BlockFileEndpoint&) = delete;
+
+  /**
+   * @brief Create (or truncate) a file for writing.
+   *
+   * @param filename The file path.
+   * @param block_size The size of the write buffer, rounded up to a multiple of kAlignment.
+   * @param direct_io Whether to bypass the page cache with `O_DIRECT`.
+   */
+  nvidia::gxf::Expected<void> open(const std::string& filename, size_t block_size,
+                                   bool direct_io);
+  /// Write the buffered data and close the file.
+  nvidia::gxf::Expected<void> close();
+  /// Write the buffered data to the file.
+  nvidia::gxf::Expected<void> flush();
+  /// Write the buffered data and wait for the file data to reach the storage device.
+  nvidia::gxf::Expected<void> sync();
+
+  bool is_open() const { return fd_ >= 0; }
+  bool direct_io() const { return direct_io_; }
+  /// Number of bytes written to the endpoint so far.
+  uint64_t size() const { return size_; }
+
+  gxf_result_t write_abi(const void* data, size_t size, size_t* bytes_written) override;
+  gxf_result_t read_abi(void* data, size_t size, size_t* bytes_read) override;
+
+ private:
+  nvidia::gxf::Expected<void> write_buffer();
+
+  int fd_ = -1;
+  bool direct_io_ = false;
+  uint8_t* buffer_ = nullptr;
+  size_t capacity_ = 0;
+  // Number of bytes in the buffer and file offset of the first one
+  size_t used_ = 0;
+  uint64_t buffer_offset_ = 0;
+  uint64_t size_ = 0;
+};
+
+}  // namespace holoscan::ops
+
+#endif /* HOLOSCAN_OPERATORS_VIDEO_STREAM_RECORDER_BLOCK_FILE_ENDPOINT_HPP */
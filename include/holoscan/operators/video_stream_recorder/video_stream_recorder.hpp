@@ -18,19 +18,39 @@
 #ifndef HOLOSCAN_OPERATORS_STREAM_PLAYBACK_VIDEO_STREAM_RECORDER_HPP
 #define HOLOSCAN_OPERATORS_STREAM_PLAYBACK_VIDEO_STREAM_RECORDER_HPP
 
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
 #include "holoscan/core/gxf/gxf_operator.hpp"
 #include "holoscan/core/fragment.hpp"
+#include "gxf/serialization/entity_serializer.hpp"
 #include "gxf/serialization/file_stream.hpp"
+#include "./block_file_endpoint.hpp"
 
 namespace holoscan::ops {
 
 /**
  * @brief Operator class to record the video stream to a file.
+ *
+ * Small writes are coalesced into blocks of `write_block_size` bytes, optionally written with
+ * direct I/O. When `queue_size` is non-zero, `compute()` only queues a reference to the received
+ * entity and a writer thread serializes it, so a slow disk does not stall the pipeline. When the
+ * queue is full, the operator waits for room (backpressure) unless `drop_on_overflow` is set.
+ * File data is synced to the device every `fsync_interval_ms` milliseconds and/or every
+ * `fsync_bytes` bytes.
+ *
+ * Entities can be compressed with LZ4 or zstd (`compression`), and encoded as a lossless delta to
+ * the previous entity (`delta_encoding`) with a keyframe every `keyframe_interval` entities.
+ * These parameters are forwarded to the VideoStreamSerializer created by the operator, and
+ * VideoStreamReplayerOp reads such recordings without configuration.
  */
 class VideoStreamRecorderOp : public holoscan::Operator {
  public:
@@ -44,22 +64,74 @@ class VideoStreamRecorderOp : public holoscan::Operator {
 
   void initialize() override;
   // void deinitialize() override;
+  void start() override;
+  void stop() override;
   void compute(InputContext& op_input, OutputContext& op_output,
                ExecutionContext& context) override;
 
+  /// Recording statistics
+  struct Statistics {
+    uint64_t frames_received = 0;       ///< Entities received by compute()
+    uint64_t frames_written = 0;        ///< Entities written to the files
+    uint64_t frames_dropped = 0;        ///< Entities dropped because the queue was full
+    uint64_t backpressure_waits = 0;    ///< Times compute() waited for room in the queue
+    uint64_t backpressure_time_ns = 0;  ///< Total time compute() waited for room in the queue
+    uint64_t max_queue_depth = 0;       ///< Largest number of entities waiting to be written
+    uint64_t bytes_written = 0;         ///< Serialized bytes written to the entity file
+    uint64_t syncs = 0;                 ///< Times the files were synced to the device
+  };
+
+  /// Get a snapshot of the recording statistics.
+  Statistics statistics() const;
+
  private:
+  // An entity waiting to be written, with the time at which it was received
+  struct RecordRequest {
+    nvidia::gxf::Entity entity;
+    uint64_t log_time = 0;
+  };
+
+  void write_entity(const nvidia::gxf::Entity& entity, uint64_t log_time);
+  void write_entities();
+  void stop_writer();
+
   Parameter<holoscan::IOSpec*> receiver_;
   Parameter<std::shared_ptr<holoscan::Resource>> entity_serializer_;
   Parameter<std::string> directory_;
   Parameter<std::string> basename_;
   Parameter<bool> flush_on_tick_;
+  Parameter<size_t> queue_size_;
+  Parameter<bool> drop_on_overflow_;
+  Parameter<size_t> write_block_size_;
+  Parameter<bool> direct_io_;
+  Parameter<uint64_t> fsync_interval_ms_;
+  Parameter<uint64_t> fsync_bytes_;
+  Parameter<std::string> compression_;
+  Parameter<int32_t> compression_level_;
+  Parameter<bool> delta_encoding_;
+  Parameter<uint64_t> keyframe_interval_;
+
+  nvidia::gxf::EntitySerializer* entity_serializer_ptr_ = nullptr;
 
   // File stream for data index
-  nvidia::gxf::FileStream index_file_stream_;
+  BlockFileEndpoint index_file_stream_;
   // File stream for binary data
-  nvidia::gxf::FileStream binary_file_stream_;
+  BlockFileEndpoint binary_file_stream_;
   // Offset into binary file
   size_t binary_file_offset_;
+  // Bytes written and time of the last sync
+  uint64_t bytes_since_sync_ = 0;
+  std::chrono::steady_clock::time_point last_sync_time_;
+
+  // Queue drained by the writer thread
+  std::thread writer_thread_;
+  mutable std::mutex writer_mutex_;
+  std::condition_variable writer_ready_cv_;
+  std::condition_variable writer_space_cv_;
+  std::deque<RecordRequest> write_queue_;
+  bool writer_stopping_ = false;
+  std::string writer_error_;
+  Statistics statistics_;
 };
 
 }  // namespace holoscan::ops
@@ -0,0 +1,187 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_OPERATORS_VIDEO_STREAM_REPLAYER_MAPPED_ENTITY_FILE_HPP
+#define HOLOSCAN_OPERATORS_VIDEO_STREAM_REPLAYER_MAPPED_ENTITY_FILE_HPP
+
+#include <gxf/core/gxf.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "gxf/core/entity.hpp"
+#include "gxf/core/expected.hpp"
+#include "gxf/serialization/endpoint.hpp"
+#include "gxf/serialization/entity_serializer.hpp"
+#include "gxf/serialization/file_stream.hpp"
+
+namespace holoscan::ops {
+
+/**
+ * @brief Read-only memory mapping of a whole file.
+ */
+class MappedFile {
+ public:
+  MappedFile() = default;
+  ~MappedFile();
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  /// Map the file. Throws std::runtime_error if it cannot be opened or mapped.
+  void open(const std::string& filename);
+  void close();
+
+  const uint8_t* data() const { return data_; }
+  size_t size() const { return size_; }
+
+  /// Hint the kernel that the given byte range will be read soon.
+  void will_need(size_t offset, size_t size) const;
+
+ private:
+  uint8_t* data_ = nullptr;
+  size_t size_ = 0;
+};
+
+/**
+ * @brief Endpoint reading a serialized entity straight out of a MappedFile.
+ *
+ * Deserialized components are copied once, from the mapping into their own memory, instead of
+ * going through the stdio buffer of `nvidia::gxf::FileStream`. Writing is not supported.
+ */
+class MappedFileEndpoint : public nvidia::gxf::Endpoint {
+ public:
+  /// Restrict reads to `size` bytes starting at `offset` in `file`.
+  void set_range(const MappedFile* file, size_t offset, size_t size);
+  /// Number of bytes left in the current range.
+  size_t remaining() const { return end_ - position_; }
+
+  gxf_result_t write_abi(const void* data, size_t size, size_t* bytes_written) override;
+  gxf_result_t read_abi(void* data, size_t size, size_t* bytes_read) override;
+
+ private:
+  const MappedFile* file_ = nullptr;
+  size_t position_ = 0;
+  size_t end_ = 0;
+};
+
+/**
+ * @brief Random access to an entity recording (`.gxf_index` and `.gxf_entities` files).
+ *
+ * The whole index table is loaded when the recording is opened, and entities are deserialized
+ * from a memory mapping of the entity file, so any frame can be read without scanning the ones
+ * before it.
+ */
+class MappedEntityRecording {
+ public:
+  /// Open `<path>.gxf_index` and `<path>.gxf_entities`. Throws std::runtime_error on failure.
+  void open(const std::string& path);
+  void close();
+
+  /// Number of frames in the recording.
+  size_t size() const { return indices_.size(); }
+  const nvidia::gxf::EntityIndex& index(size_t frame) const { return indices_[frame]; }
+
+  /**
+   * @brief Find the first frame logged at or after a timestamp.
+   *
+   * The search is a binary search when the log times are sorted (the usual case) and a linear
+   * scan otherwise.
+   *
+   * @param log_time The timestamp to look for.
+   * @return The frame number, or size() if every frame was logged before `log_time`.
+   */
+  size_t frame_at_time(uint64_t log_time) const;
+
+  /**
+   * @brief Deserialize a frame, and hint the kernel to page in `next_frame` (if valid) meanwhile.
+   *
+   * A frame of a delta-encoded recording can only be decoded right after the frame it refers
+   * to. When it is read out of order (seek, range start, reverse playback), the frames are
+   * decoded again from the closest preceding one that decodes on its own (a keyframe).
+   */
+  nvidia::gxf::Expected<nvidia::gxf::Entity> read(gxf_context_t context,
+                                                  nvidia::gxf::EntitySerializer* serializer,
+                                                  size_t frame, size_t next_frame);
+
+ private:
+  // Deserialize a single frame and remember it as the last one read.
+  nvidia::gxf::Expected<nvidia::gxf::Entity> deserialize(gxf_context_t context,
+                                                         nvidia::gxf::EntitySerializer* serializer,
+                                                         size_t frame);
+  // Decode the frames from the closest preceding keyframe up to `frame`.
+  nvidia::gxf::Expected<nvidia::gxf::Entity> read_from_keyframe(
+      gxf_context_t context, nvidia::gxf::EntitySerializer* serializer, size_t frame);
+
+  MappedFile entity_file_;
+  std::vector<nvidia::gxf::EntityIndex> indices_;
+  bool sorted_ = true;
+  MappedFileEndpoint endpoint_;
+  // Last frame deserialized successfully, or -1
+  int64_t last_frame_ = -1;
+  // Frames known not to decode on their own, skipped when looking for a keyframe
+  std::vector<bool> delta_frames_;
+};
+
+/**
+ * @brief Order in which the frames of a playback range are played.
+ *
+ * The range is played forward, in reverse, or forward then in reverse (ping-pong, without
+ * repeating the frames at the turning points). With `repeat`, playback starts over at the end
+ * of the range, else it stops there.
+ */
+class PlaybackCursor {
+ public:
+  enum class Mode { kForward, kReverse, kPingPong };
+
+  /// Start playing the frames [range_begin, range_end) from the first one in `mode` order.
+  void reset(int64_t range_begin, int64_t range_end, Mode mode, bool repeat);
+
+  /**
+   * @brief Move to the next frame.
+   *
+   * @param frame The frame to play.
+   * @param rewound Set when the frame does not follow the previous one: playback started over,
+   * or a seek was applied.
+   * @return false at the end of playback.
+   */
+  bool next(int64_t* frame, bool* rewound);
+
+  /// Frame following the last one returned by next(), or -1 at the end of the range.
+  int64_t upcoming() const;
+
+  /// Continue from the given frame, clamped to the range.
+  void seek(uint64_t frame);
+
+  int64_t range_begin() const { return range_begin_; }
+  int64_t range_end() const { return range_end_; }
+
+ private:
+  int64_t range_begin_ = 0;
+  int64_t range_end_ = 0;
+  Mode mode_ = Mode::kForward;
+  bool repeat_ = false;
+  int64_t cursor_ = 0;
+  int64_t direction_ = 1;
+  bool jumped_ = false;
+};
+
+}  // namespace holoscan::ops
+
+#endif /* HOLOSCAN_OPERATORS_VIDEO_STREAM_REPLAYER_MAPPED_ENTITY_FILE_HPP */
@@ -18,18 +18,39 @@
 #ifndef HOLOSCAN_OPERATORS_STREAM_PLAYBACK_VIDEO_STREAM_REPLAYER_HPP
 #define HOLOSCAN_OPERATORS_STREAM_PLAYBACK_VIDEO_STREAM_REPLAYER_HPP
 
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
+#include "holoscan/core/conditions/gxf/target_time.hpp"
 #include "holoscan/core/gxf/gxf_operator.hpp"
+#include "gxf/serialization/entity_serializer.hpp"
 #include "gxf/serialization/file_stream.hpp"
+#include "./mapped_entity_file.hpp"
 
 namespace holoscan::ops {
 
 /**
  * @brief Operator class to replay a video stream from a file.
+ *
+ * When `prefetch_size` is non-zero, entities are read and deserialized on a background thread
+ * into a queue of up to `prefetch_size` entities, so that file I/O does not stall `compute()`.
+ * Realtime playback is paced by a TargetTimeCondition: the operator tells the scheduler when
+ * the next frame is due instead of sleeping in `compute()`. The condition is only added when
+ * `realtime` is set.
+ *
+ * With `memory_mapped` enabled, the whole index table is loaded up front and entities are
+ * deserialized from a memory mapping of the recording. This mode supports playing a range of
+ * frames (`start_frame`, `end_frame`), reverse and ping-pong playback (`playback_mode`), and
+ * seeking to a frame or a timestamp while running. It is enabled automatically when any of these
+ * features is requested.
  */
 class VideoStreamReplayerOp : public holoscan::Operator {
  public:
@@ -42,9 +63,32 @@ class VideoStreamReplayerOp : public holoscan::Operator {
   void setup(OperatorSpec& spec) override;
 
   void initialize() override;
+  void start() override;
+  void stop() override;
   void compute(InputContext& op_input, OutputContext& op_output,
                ExecutionContext& context) override;
 
+  /**
+   * @brief Continue playback from the given frame.
+   *
+   * The frame is clamped to the playback range. The seek is applied on the next tick, so it may
+   * be requested from any thread. It requires the memory-mapped mode.
+   */
+  void seek(uint64_t frame);
+
+  /**
+   * @brief Find the first frame logged at or after a timestamp.
+   *
+   * Requires the memory-mapped mode. The lookup is O(log n) for recordings with sorted log times.
+   *
+   * @param log_time The timestamp, in the clock domain of the recording.
+   * @return The frame number, or frame_count() if every frame was logged before `log_time`.
+   */
+  uint64_t frame_at_time(uint64_t log_time) const;
+
+  /// Number of frames in the recording (memory-mapped mode only, zero otherwise).
+  uint64_t frame_count() const;
+
  private:
   Parameter<holoscan::IOSpec*> transmitter_;
   Parameter<std::shared_ptr<holoscan::Resource>> entity_serializer_;
@@ -57,6 +101,34 @@ class VideoStreamReplayerOp : public holoscan::Operator {
   Parameter<bool> realtime_;
   Parameter<bool> repeat_;
   Parameter<uint64_t> count_;
+  Parameter<size_t> prefetch_size_;
+  Parameter<bool> memory_mapped_;
+  Parameter<uint64_t> start_frame_;
+  Parameter<uint64_t> end_frame_;
+  Parameter<std::string> playback_mode_;
+  Parameter<bool> verify_checksum_;
+
+  // An entity read from the file streams, or the end of the stream
+  struct ReplayEntity {
+    nvidia::gxf::EntityIndex index{};
+    nvidia::gxf::Entity entity;
+    bool rewound = false;
+    bool end = false;
+    gxf_result_t error = GXF_SUCCESS;
+  };
+
+  ReplayEntity read_entity(gxf_context_t context);
+  ReplayEntity read_mapped_entity(gxf_context_t context);
+  void apply_seek(gxf_context_t context, uint64_t frame);
+  void start_prefetching(gxf_context_t context);
+  ReplayEntity next_entity(gxf_context_t context);
+  bool fetch_pending_entity(gxf_context_t context);
+  void prefetch_entities(gxf_context_t context);
+  void stop_prefetching();
+
+  // Only set for realtime playback
+  std::shared_ptr<TargetTimeCondition> target_time_condition_;
+  nvidia::gxf::EntitySerializer* entity_serializer_ptr_ = nullptr;
 
   // Internal state
   // File stream for entities
@@ -66,11 +138,28 @@ class VideoStreamReplayerOp : public holoscan::Operator {
 
   uint64_t playback_index_ = 0;
   uint64_t playback_count_ = 0;
-  uint64_t index_start_timestamp_ = 0;
-  uint64_t index_last_timestamp_ = 0;
-  uint64_t index_timestamp_duration_ = 0;
-  uint64_t index_frame_count_ = 1;
-  uint64_t playback_start_timestamp_ = 0;
+  uint64_t last_log_time_ = 0;
+  uint64_t playback_time_offset_ = 0;
+  int64_t playback_start_timestamp_ = 0;
+
+  // Memory-mapped playback
+  bool use_memory_mapping_ = false;
+  MappedEntityRecording recording_;
+  PlaybackCursor cursor_;
+  std::atomic<int64_t> seek_frame_{-1};
+
+  // Next entity to emit and the steady-clock time (ns) at which it is due
+  nvidia::gxf::Entity pending_entity_;
+  bool has_pending_entity_ = false;
+  int64_t pending_due_time_ = 0;
+
+  // Read-ahead queue filled by the prefetch thread
+  std::thread prefetch_thread_;
+  std::mutex prefetch_mutex_;
+  std::condition_variable prefetch_ready_cv_;
+  std::condition_variable prefetch_space_cv_;
+  std::deque<ReplayEntity> prefetch_queue_;
+  bool prefetch_stopping_ = false;
 };
 
 }  // namespace holoscan::ops
@@ -30,17 +30,65 @@ namespace HoloInfer = holoscan::inference;
 
 namespace holoscan::utils {
 
+/**
+ * Messages received by the last data extraction of an operator, and the message each input tensor
+ * was found in. Holding the messages keeps the tensor memory aliased by host buffers valid until
+ * the next extraction.
+ */
+struct ReceivedMessages {
+  std::vector<holoscan::gxf::Entity> messages;
+  std::map<std::string, size_t> message_index_per_tensor;
+};
+
+/**
+ * Extracts the input tensors of the receivers into data buffers of the tensor data type.
+ *
+ * @param op_input              Input context of the operator
+ * @param in_tensors            Input tensor names
+ * @param data_per_input_tensor Map is updated with tensor name as key mapped to data buffer
+ * @param dims_per_tensor       Map is updated with tensor name as key mapped to dimension of
+ *                              input tensor
+ * @param received_messages     Messages of the previous extraction, replaced by the received ones.
+ *                              Host resident, contiguous tensors are aliased by host buffers
+ *                              instead of copied.
+ * @param cuda_buffer_out       Flag defining the location of output memory (Device or Host)
+ * @param module                Module that called for data extraction
+ * @param input_mean            Per channel mean normalizing uint8 tensors to float32, empty for
+ *                              no normalization
+ * @param input_std             Per channel standard deviation normalizing uint8 tensors
+ *
+ * @returns GXF result code
+ */
 gxf_result_t multiai_get_data_per_model(InputContext& op_input,
                                         const std::vector<std::string>& in_tensors,
                                         HoloInfer::DataMap& data_per_input_tensor,
                                         std::map<std::string, std::vector<int>>& dims_per_tensor,
-                                        bool cuda_buffer_out, const std::string& module);
+                                        ReceivedMessages& received_messages, bool cuda_buffer_out,
+                                        const std::string& module,
+                                        const std::vector<float>& input_mean = {},
+                                        const std::vector<float>& input_std = {});
 
+/**
+ * Transmits data buffers as tensors of the buffer data type in a single message.
+ *
+ * @param cont                  GXF context for transmission
+ * @param model_to_tensor_map   Map of model name as key, mapped to a tensor name
+ * @param input_data_map        Map of tensor name as key, mapped to the data buffer
+ * @param op_output             Output context of the operator
+ * @param out_tensors           Output tensor names
+ * @param tensor_out_dims_map   Map of model name as key, mapped to the dimension of the tensor
+ * @param cuda_buffer_in        Flag to demonstrate if memory storage of data buffers is on CUDA
+ * @param cuda_buffer_out       Flag to demonstrate if memory storage of output message is on CUDA
+ * @param allocator_            GXF Memory allocator
+ * @param module                Module that called for data transmission
+ *
+ * @returns GXF result code
+ */
 gxf_result_t multiai_transmit_data_per_model(
     gxf_context_t& cont, const HoloInfer::Mappings& model_to_tensor_map,
     HoloInfer::DataMap& input_data_map, OutputContext& op_output,
     const std::vector<std::string>& out_tensors, HoloInfer::DimType& tensor_out_dims_map,
-    bool cuda_buffer_in, bool cuda_buffer_out, const nvidia::gxf::PrimitiveType& element_type,
+    bool cuda_buffer_in, bool cuda_buffer_out,
     const nvidia::gxf::Handle<nvidia::gxf::Allocator>& allocator_, const std::string& module);
 
 }  // namespace holoscan::utils
@@ -17,6 +17,7 @@
 #ifndef _HOLOSCAN_INFER_API_H
 #define _HOLOSCAN_INFER_API_H
 
+#include <functional>
 #include <iostream>
 #include <map>
 #include <memory>
@@ -47,9 +48,10 @@ class _HOLOSCAN_EXTERNAL_API_ InferContext {
 
   /**
    * Executes the inference
-   * Toolkit supports one input per model, in float32 type
+   * Toolkit supports float32 type. Models with several inputs read them by input tensor name.
    *
-   * @param preprocess_data_map   Map of model names as key mapped to the preprocessed input data
+   * @param preprocess_data_map   Map of model names (or input tensor names for models with
+   *                              several inputs) as key mapped to the preprocessed input data
    * @param output_data_map       Map of tensor names as key mapped to the inferred data
    *
    * @returns InferStatus with appropriate holoinfer_code and message.
@@ -62,8 +64,52 @@ class _HOLOSCAN_EXTERNAL_API_ InferContext {
    * @returns Map of model as key mapped to the output dimension (of inferred data)
    */
   DimType get_output_dimensions() const;
+
+  /**
+   * Gets output dimension per output tensor, following the batch of the last inference
+   *
+   * @returns Map of output tensor name as key mapped to the output dimension
+   */
+  DimType get_output_tensor_dimensions() const;
+
+  /**
+   * Gets inference latencies per model, accumulated over all inferences. The histograms are
+   * updated in place by execute_inference, and must not be read concurrently with it.
+   *
+   * @returns Map of model name as key mapped to its latency histogram
+   */
+  const LatencyMap& get_latencies() const;
 };
 
+/**
+ * Data processing operation, compiled from its configuration by a ProcessOperationFactory.
+ * Reads float32 input data of the given dimensions, and writes float32 output data and its
+ * dimensions. Operations that generate no output, like printing, leave out_dims empty: the next
+ * operation of the chain then reads their input.
+ */
+using ProcessOperation =
+    std::function<InferStatus(const std::vector<int64_t>& in_dims, const HostBuffer& in_data,
+                              std::vector<int64_t>& out_dims, HostBuffer& out_data)>;
+
+/**
+ * Compiles a data processing operation from the arguments following its name in the
+ * configuration, "name,arg1,arg2". Arguments are validated once, when processing is initialized.
+ */
+using ProcessOperationFactory =
+    std::function<InferStatus(const std::vector<std::string>& args, ProcessOperation& operation)>;
+
+/**
+ * Registers a data processing operation, used by processor contexts initialized afterwards.
+ * Registered operations take precedence over built-in operations of the same name.
+ *
+ * @param name      Name of the operation in the configuration, without commas
+ * @param factory   Function compiling the operation from its arguments
+ *
+ * @returns InferStatus with appropriate holoinfer_code and message.
+ */
+_HOLOSCAN_EXTERNAL_API_ InferStatus register_process_operation(const std::string& name,
+                                                               ProcessOperationFactory factory);
+
 /**
  * Processor Context class
  */
@@ -71,7 +117,8 @@ class _HOLOSCAN_EXTERNAL_API_ ProcessorContext {
  public:
   ProcessorContext();
   /**
-   * Initialize the preprocessor context
+   * Initialize the preprocessor context, compiling the operations of each tensor. Operations are
+   * "name" or "name,arg1,arg2", each one reading the output of the previous one.
    *
    * @param process_operations   Map of tensor name as key, mapped to list of operations to be
    *                             applied in sequence on the tensor
@@ -85,7 +132,7 @@ class _HOLOSCAN_EXTERNAL_API_ ProcessorContext {
    * Toolkit supports one tensor input and output per model
    *
    * @param tensor_oper_map       Map of tensor name as key, mapped to list of operations to be
-   *                              applied in sequence on the tensor
+   *                              applied in sequence on the tensor, as given at initialization
    * @param in_out_tensor_map     Map of input tensor name mapped to output tensor name after
    *                              processing
    * @param processed_result_map  Map is updated with output tensor name as key mapped to processed
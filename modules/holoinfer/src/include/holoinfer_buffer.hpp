@@ -42,12 +42,38 @@ namespace inference {
 /**
  * @brief Get the element size
  *
- * @param element_type Input data type. Float32 is the only supported element type.
+ * @param element_type Input data type
  *
- * @returns Bytes used in storing element type
+ * @returns Bytes used in storing element type, 0 for an unsupported type
  */
 uint32_t get_element_size(holoinfer_datatype t) noexcept;
 
+/**
+ * @brief Get the name of a data type
+ *
+ * @param element_type Data type
+ *
+ * @returns Name of the data type
+ */
+std::string get_datatype_name(holoinfer_datatype element_type);
+
+/**
+ * @brief Converts uint8 data to float32 and normalizes it per channel, computing
+ * (value - mean) / std_dev. Channels are interleaved, element i belonging to channel i % channels
+ * where channels is the size of mean and std_dev.
+ *
+ * @param in Input data
+ * @param out Output data, holding count elements
+ * @param count Number of elements
+ * @param mean Mean of each channel, in the range of the input data
+ * @param std_dev Standard deviation of each channel, in the range of the input data
+ *
+ * @returns InferStatus with appropriate code and message
+ */
+InferStatus normalize_uint8_to_float(const uint8_t* in, float* out, size_t count,
+                                     const std::vector<float>& mean,
+                                     const std::vector<float>& std_dev);
+
 /**
  * @brief Cuda memory allocator Functor
  */
@@ -112,12 +138,27 @@ class DeviceBuffer {
    */
   void resize(size_t element_size);
 
+  /**
+   * @brief Get the data type of the buffer
+   *
+   * @returns Data type
+   */
+  holoinfer_datatype get_datatype() const;
+
+  /**
+   * @brief Set the data type of the buffer, keeping its number of elements
+   *
+   * @param type Data type
+   */
+  void set_datatype(holoinfer_datatype type);
+
   /**
    * @brief Destructor
    */
   ~DeviceBuffer();
 
  private:
+  /// @brief Number of elements, and bytes allocated
   size_t size_{0}, capacity_{0};
   holoinfer_datatype type_ = holoinfer_datatype::hFloat;
   void* buffer_ = nullptr;
@@ -126,17 +167,132 @@ class DeviceBuffer {
 };
 
 /**
- * @brief Multi AI DataBuffer Class. Holds CPU based buffer as float32 vector and device buffer as a
- * shared pointer.
+ * @brief Host Buffer Class. Holds the elements of any supported data type as raw bytes.
+ */
+class HostBuffer {
+ public:
+  /**
+   * @brief Construction with default type
+   *
+   * @param type Data type, defaults to float32
+   */
+  explicit HostBuffer(holoinfer_datatype type = holoinfer_datatype::hFloat);
+
+  /**
+   * @brief Get the data buffer
+   *
+   * @returns Void pointer to the buffer
+   */
+  void* data();
+  const void* data() const;
+
+  /**
+   * @brief Get the data buffer as elements of type T, which must match the data type
+   *
+   * @returns Pointer to the elements
+   */
+  template <typename T>
+  T* data_as() {
+    return static_cast<T*>(data());
+  }
+  template <typename T>
+  const T* data_as() const {
+    return static_cast<const T*>(data());
+  }
+
+  /**
+   * @brief Get the number of elements in the buffer
+   *
+   * @returns size
+   */
+  size_t size() const;
+
+  /**
+   * @brief Get the bytes used by the elements
+   *
+   * @returns bytes
+   */
+  size_t get_bytes() const;
+
+  /**
+   * @brief Resize the underlying buffer, keeping its allocation when shrinking. Elements added when
+   * growing are not initialized. An external buffer is replaced by the owned one, without copying
+   * its elements.
+   *
+   * @param number_of_elements Size to be resized with
+   */
+  void resize(size_t number_of_elements);
+
+  /**
+   * @brief Use memory owned by someone else as the buffer, without copying it. The memory must
+   * stay valid until the buffer is resized, its type changed or another external buffer set.
+   *
+   * @param data Pointer to the elements, of the data type of the buffer
+   * @param number_of_elements Number of elements
+   */
+  void set_external(void* data, size_t number_of_elements);
+
+  /**
+   * @brief Whether the buffer uses external memory
+   *
+   * @returns True if set with set_external and not resized since
+   */
+  bool is_external() const { return external_ != nullptr; }
+
+  /**
+   * @brief Get the data type of the buffer
+   *
+   * @returns Data type
+   */
+  holoinfer_datatype get_datatype() const;
+
+  /**
+   * @brief Set the data type of the buffer, keeping its number of elements
+   *
+   * @param type Data type
+   */
+  void set_datatype(holoinfer_datatype type);
+
+ private:
+  /// Grows the owned storage to hold bytes, keeping the first kept_bytes of the elements
+  void reserve(size_t bytes, size_t kept_bytes);
+
+  size_t size_ = 0;
+  size_t capacity_ = 0;
+  holoinfer_datatype type_ = holoinfer_datatype::hFloat;
+  std::unique_ptr<uint8_t[]> buffer_;
+  void* external_ = nullptr;
+};
+
+/**
+ * @brief Multi AI DataBuffer Class. Holds CPU based buffer and device buffer of the same data
+ * type, the device buffer as a shared pointer.
  */
 class DataBuffer {
  public:
   /**
    * @brief Constructor
+   *
+   * @param type Data type, defaults to float32
    */
-  DataBuffer();
+  explicit DataBuffer(holoinfer_datatype type = holoinfer_datatype::hFloat);
+
+  /**
+   * @brief Get the data type of the host and device buffers
+   *
+   * @returns Data type
+   */
+  holoinfer_datatype get_datatype() const { return host_buffer.get_datatype(); }
+
+  /**
+   * @brief Set the data type of the host and device buffers, keeping their number of elements
+   *
+   * @param type Data type
+   */
+  void set_datatype(holoinfer_datatype type);
+
   std::shared_ptr<DeviceBuffer> device_buffer;
-  std::vector<float> host_buffer;
+  HostBuffer host_buffer;
 };
 
 using DataMap = std::map<std::string, std::shared_ptr<DataBuffer>>;
@@ -190,6 +346,16 @@ struct MultiAISpecs {
   /// @brief Map with key as model name and value as inferred tensor name
   Mappings inference_map_;
 
+  /// @brief Map with key as model name and value as input tensor names, one per model input in
+  /// the order of the model inputs. Only needed for models with several inputs, which read each
+  /// input from the preprocessed data map by tensor name instead of model name.
+  MultiMappings input_tensor_map_;
+
+  /// @brief Map with key as model name and value as output tensor names, one per model output in
+  /// the order of the model outputs. Only needed for models with several outputs, the first name
+  /// must be the one in inference_map_.
+  MultiMappings output_tensor_map_;
+
   /// @brief Flag showing if input model path is path to engine files
   bool is_engine_path_ = false;
 
@@ -199,6 +365,40 @@ struct MultiAISpecs {
   ///  @brief Flag to enable parallel inference. Default is True.
   bool parallel_processing_ = false;
 
+  ///  @brief Number of threads running models in parallel. Each model always runs on the same
+  ///  thread. Default is 0, for one thread per model.
+  size_t inference_threads_ = 0;
+
+  ///  @brief Maximum number of samples run in one inference call, only supported by onnxrt for
+  ///  models with a dynamic batch dimension. With a value greater than one, the inference
+  ///  contexts running the same model share its session and batch their concurrent requests.
+  ///  Default is 1.
+  size_t batch_size_ = 1;
+
+  ///  @brief Maximum time in microseconds a request waits for others to fill its batch. Default
+  ///  is 0, only batching the requests already waiting.
+  int64_t batch_timeout_us_ = 0;
+
+  ///  @brief Onnxruntime threads running an operator of a model, 0 for the onnxruntime default.
+  ///  Default is 1.
+  int32_t intra_op_threads_ = 1;
+
+  ///  @brief Onnxruntime threads running independent operators of a model in parallel execution
+  ///  mode, 0 for the onnxruntime default. Default is 0.
+  int32_t inter_op_threads_ = 0;
+
+  ///  @brief Flag to run independent operators of a model in parallel (onnxruntime execution
+  ///  mode). Default is False.
+  bool parallel_execution_ = false;
+
+  ///  @brief Onnxruntime graph optimization level: "disable", "basic", "extended" or "all".
+  ///  Default is "extended".
+  std::string graph_optimization_level_{"extended"};
+
+  ///  @brief Directory where onnxruntime saves the optimized models, and loads them from on the
+  ///  next runs. Default is empty, for no cache.
+  std::string optimized_model_cache_path_;
+
   ///  @brief Flag showing if trt engine file conversion will use FP16. Default is False.
   bool use_fp16_ = false;
 
@@ -225,10 +425,12 @@ struct MultiAISpecs {
  * is populated in this function.
  * @param dims Dimension of the allocation
  * @param keyname Storage name in the map against the created DataBuffer
+ * @param type Data type of the buffers
  * @returns InferStatus with appropriate code and message
  */
-InferStatus allocate_host_device_buffers(DataMap& buffers, std::vector<int64_t>& dims_map,
-                                         const std::string& mappings);
+InferStatus allocate_host_device_buffers(
+    DataMap& buffers, std::vector<int64_t>& dims_map, const std::string& mappings,
+    holoinfer_datatype type = holoinfer_datatype::hFloat);
 
 /**
  * @brief Allocate buffer on host
@@ -237,10 +439,31 @@ InferStatus allocate_host_device_buffers(DataMap& buffers, std::vector<int64_t>&
  * is populated in this function.
  * @param dims Dimension of the allocation
  * @param keyname Storage name in the map against the created DataBuffer
+ * @param type Data type of the buffers
  * @returns InferStatus with appropriate code and message
  */
 InferStatus allocate_host_buffers(DataMap& buffers, std::vector<int64_t>& dims,
-                                  const std::string& keyname);
+                                  const std::string& keyname,
+                                  holoinfer_datatype type = holoinfer_datatype::hFloat);
+
+/**
+ * @brief Update the host buffer of a data buffer with new data, reusing its storage. uint8 data is
+ * normalized to float32 if mean and std_dev are given, see normalize_uint8_to_float. Otherwise
+ * the data is copied, or aliased without copying if alias is set, in which case it must stay valid
+ * while the buffer is in use.
+ *
+ * @param buffer Data buffer, its data type is set from type
+ * @param data Pointer to the data
+ * @param type Data type of the data
+ * @param count Number of elements
+ * @param alias Use the data as the host buffer instead of copying it
+ * @param mean Mean of each channel for normalization, empty for no normalization
+ * @param std_dev Standard deviation of each channel for normalization
+ * @returns InferStatus with appropriate code and message
+ */
+InferStatus update_host_buffer(DataBuffer& buffer, void* data, holoinfer_datatype type,
+                               size_t count, bool alias, const std::vector<float>& mean = {},
+                               const std::vector<float>& std_dev = {});
 }  // namespace inference
 }  // namespace holoscan
 
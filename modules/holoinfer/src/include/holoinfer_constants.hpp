@@ -21,6 +21,9 @@
 #include <sys/stat.h>
 
 #include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
 #include <fstream>
 #include <iostream>
 #include <iterator>
@@ -39,7 +42,17 @@
 namespace holoscan {
 namespace inference {
 
-enum class holoinfer_datatype { hFloat = 0 };
+/// @brief Data types of the inference buffers
+enum class holoinfer_datatype {
+  hFloat = 0,
+  hFloat16 = 1,
+  hUInt8 = 2,
+  hInt8 = 3,
+  hInt32 = 4,
+  hInt64 = 5,
+  hUnsupported = 6
+};
+
 /// @brief Data processor implementation codes
 enum class holoinfer_data_processor { CUDA = 0, HOST = 1, CUDA_AND_HOST = 2 };
 
@@ -49,6 +62,70 @@ enum class holoinfer_data_storage_format { NHWC = 0, NCHW = 1 };
 /// @brief Holoscan Inference Toolkit status codes
 enum class holoinfer_code { H_SUCCESS, H_ERROR, H_EXCEPTION, H_WARNING };
 
+/// @brief Histogram of latencies in power-of-two microsecond buckets
+class _HOLOSCAN_EXTERNAL_API_ LatencyHistogram {
+ public:
+  /// Number of buckets. Bucket i counts latencies in [2^(i-1), 2^i) microseconds, and the last
+  /// bucket every latency above.
+  static constexpr size_t kBucketCount = 32;
+
+  /**
+   * @brief Add a latency to the histogram
+   *
+   * @param latency Measured latency
+   */
+  void record(std::chrono::nanoseconds latency) {
+    const uint64_t us = static_cast<uint64_t>(
+        std::max<int64_t>(std::chrono::duration_cast<std::chrono::microseconds>(latency).count(),
+                          0));
+    size_t bucket = 0;
+    while (bucket + 1 < kBucketCount && (us >> bucket) != 0) { bucket++; }
+    buckets_[bucket]++;
+    count_++;
+    total_us_ += us;
+    min_us_ = count_ == 1 ? us : std::min(min_us_, us);
+    max_us_ = std::max(max_us_, us);
+  }
+
+  /// @brief Number of latencies recorded
+  uint64_t count() const { return count_; }
+  /// @brief Smallest latency recorded, in microseconds
+  uint64_t min_us() const { return min_us_; }
+  /// @brief Largest latency recorded, in microseconds
+  uint64_t max_us() const { return max_us_; }
+  /// @brief Mean latency, in microseconds
+  double mean_us() const { return count_ ? static_cast<double>(total_us_) / count_ : 0.0; }
+  /// @brief Number of latencies per bucket
+  const std::array<uint64_t, kBucketCount>& buckets() const { return buckets_; }
+
+  /**
+   * @brief Get an upper bound of a latency percentile
+   *
+   * @param percentile Percentile in [0, 100]
+   * @returns Upper bound of the bucket holding the percentile, in microseconds
+   */
+  uint64_t percentile_us(double percentile) const {
+    if (count_ == 0) { return 0; }
+    const double rank = std::clamp(percentile, 0.0, 100.0) / 100.0 * count_;
+    uint64_t seen = 0;
+    for (size_t bucket = 0; bucket < kBucketCount; bucket++) {
+      seen += buckets_[bucket];
+      if (seen >= rank && seen > 0) { return std::min(max_us_, (uint64_t{1} << bucket) - 1); }
+    }
+    return max_us_;
+  }
+
+ private:
+  std::array<uint64_t, kBucketCount> buckets_{};
+  uint64_t count_ = 0;
+  uint64_t total_us_ = 0;
+  uint64_t min_us_ = 0;
+  uint64_t max_us_ = 0;
+};
+
+/// @brief Map with model name as key and latency histogram as value
+using LatencyMap = std::map<std::string, LatencyHistogram>;
+
 /// @brief Holoscan Inference toolkit status class
 /// contains status code and related message
 class _HOLOSCAN_EXTERNAL_API_ InferStatus {
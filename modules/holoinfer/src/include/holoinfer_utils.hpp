@@ -97,7 +97,8 @@ gxf_result_t _HOLOSCAN_EXTERNAL_API_ multiai_transmit_data_per_model(
     const nvidia::gxf::Handle<nvidia::gxf::Allocator>& allocator);
 
 /**
- * @brief Maps data per tensor to data per model
+ * @brief Maps data per tensor to data per model. Models with several input tensors get them keyed
+ * by tensor name instead.
  * @param model_data_mapping Model to tensor mapping
  * @param data_per_model Map to be populated with model as key name and value as DataBuffer
  * @param data_per_input_tensor Map with key as tensor name and value as DataBuffer
@@ -139,6 +140,22 @@ InferStatus multiai_inference_validity_check(const Mappings& model_path_map,
                                              const std::vector<std::string>& in_tensor_names,
                                              const std::vector<std::string>& out_tensor_names);
 
+/**
+ * @brief Checks for correctness of inference parameters from configuration, for models with
+ * several outputs.
+ * @param model_path_map Map with model name as key, path to model as value
+ * @param pre_processor_map Map of model name as key, mapped to vector of input tensor names
+ * @param inference_map Map with model name as key, mapped to vector of output tensor names
+ * @param in_tensor_names Input tensor names
+ * @param out_tensor_names Output tensor names
+ * @return InferStatus with appropriate code and message
+ */
+InferStatus multiai_inference_validity_check(const Mappings& model_path_map,
+                                             const MultiMappings& pre_processor_map,
+                                             const MultiMappings& inference_map,
+                                             const std::vector<std::string>& in_tensor_names,
+                                             const std::vector<std::string>& out_tensor_names);
+
 /**
  * @brief Checks for correctness of processing parameters from configuration.
  * @param processed_map Map with input tensor name as key, output tensor name as value
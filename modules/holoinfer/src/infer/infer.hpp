@@ -30,6 +30,8 @@ namespace inference {
  */
 class InferBase {
  public:
+  virtual ~InferBase() = default;
+
   /**
    * @brief Does the Core inference
    * @param input_data Input DataBuffer
@@ -41,6 +43,22 @@ class InferBase {
     return InferStatus();
   }
 
+  /**
+   * @brief Does the Core inference of a model with several inputs or outputs
+   * @param input_buffers Input DataBuffers, one per model input in the order of the model inputs
+   * @param output_buffers Output DataBuffers, one per model output in the order of the model
+   * outputs, are populated with inferred results
+   * @return InferStatus
+   * */
+  virtual InferStatus do_inference(std::vector<std::shared_ptr<DataBuffer>>& input_buffers,
+                                   std::vector<std::shared_ptr<DataBuffer>>& output_buffers) {
+    if (input_buffers.size() != 1 || output_buffers.size() != 1) {
+      return InferStatus(holoinfer_code::H_ERROR,
+                         "Inference core, Backend supports one input and one output per model");
+    }
+    return do_inference(input_buffers[0], output_buffers[0]);
+  }
+
   /**
    * @brief Get input data dimensions to the model
    * @return Vector of values as dimension
@@ -52,6 +70,39 @@ class InferBase {
    * @return Vector of values as dimension
    * */
   virtual std::vector<int64_t> get_output_dims() const { return {}; }
+
+  /**
+   * @brief Get input data dimensions of every model input
+   * @return Vector of dimensions, in the order of the model inputs
+   * */
+  virtual std::vector<std::vector<int64_t>> get_input_node_dims() const {
+    return {get_input_dims()};
+  }
+
+  /**
+   * @brief Get output data dimensions of every model output, as produced by the last inference
+   * @return Vector of dimensions, in the order of the model outputs
+   * */
+  virtual std::vector<std::vector<int64_t>> get_output_node_dims() const {
+    return {get_output_dims()};
+  }
+
+  /**
+   * @brief Get the data type of every model input
+   * @return Vector of data types, in the order of the model inputs
+   * */
+  virtual std::vector<holoinfer_datatype> get_input_datatypes() const {
+    return {holoinfer_datatype::hFloat};
+  }
+
+  /**
+   * @brief Get the data type of every model output
+   * @return Vector of data types, in the order of the model outputs
+   * */
+  virtual std::vector<holoinfer_datatype> get_output_datatypes() const {
+    return {holoinfer_datatype::hFloat};
+  }
+
   virtual void cleanup() {}
 };
 
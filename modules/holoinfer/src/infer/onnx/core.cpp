@@ -19,132 +19,460 @@
 namespace holoscan {
 namespace inference {
 
-void OnnxInfer::print_model_details() {
+namespace {
+
+/// Sessions shared by the instances of a model with batching enabled
+std::mutex shared_sessions_mutex;
+std::map<std::string, std::weak_ptr<OnnxSession>> shared_sessions;
+
+size_t sample_size(const std::vector<int64_t>& dims, bool dynamic_batch) {
+  return accumulate(
+      dims.begin() + (dynamic_batch ? 1 : 0), dims.end(), 1, std::multiplies<size_t>());
+}
+
+holoinfer_datatype get_datatype(ONNXTensorElementDataType type) {
+  switch (type) {
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT:
+      return holoinfer_datatype::hFloat;
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT16:
+      return holoinfer_datatype::hFloat16;
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT8:
+      return holoinfer_datatype::hUInt8;
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_INT8:
+      return holoinfer_datatype::hInt8;
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_INT32:
+      return holoinfer_datatype::hInt32;
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_INT64:
+      return holoinfer_datatype::hInt64;
+    default:
+      return holoinfer_datatype::hUnsupported;
+  }
+}
+
+const std::map<std::string, GraphOptimizationLevel> graph_optimization_levels = {
+    {"disable", GraphOptimizationLevel::ORT_DISABLE_ALL},
+    {"basic", GraphOptimizationLevel::ORT_ENABLE_BASIC},
+    {"extended", GraphOptimizationLevel::ORT_ENABLE_EXTENDED},
+    {"all", GraphOptimizationLevel::ORT_ENABLE_ALL}};
+
+}  // namespace
+
+InferStatus get_graph_optimization_level(const std::string& level_name,
+                                         GraphOptimizationLevel& level) {
+  auto it = graph_optimization_levels.find(level_name);
+  if (it == graph_optimization_levels.end()) {
+    return InferStatus(holoinfer_code::H_ERROR,
+                       "ONNX inference core: Unknown graph optimization level " + level_name +
+                           ", must be one of disable, basic, extended or all");
+  }
+  level = it->second;
+  return InferStatus();
+}
+
+void OnnxSession::print_model_details() {
   HOLOSCAN_LOG_INFO("Input node count: {}", input_nodes_);
   HOLOSCAN_LOG_INFO("Output node count: {}", output_nodes_);
-  HOLOSCAN_LOG_INFO("Input names: [{}]", fmt::join(input_names_, ", "));
-  HOLOSCAN_LOG_INFO("Input dims: [{}]", fmt::join(input_dims_, ", "));
-  HOLOSCAN_LOG_INFO("Input Type: {}", input_type_);
-  HOLOSCAN_LOG_INFO("Output names: [{}]", fmt::join(output_names_, ", "));
-  HOLOSCAN_LOG_INFO("Output dims: [{}]", fmt::join(output_dims_, ", "));
-  HOLOSCAN_LOG_INFO("Output Type: {}", output_type_);
+  for (size_t i = 0; i < input_nodes_; i++) {
+    HOLOSCAN_LOG_INFO("Input {}: name: {}, dims: [{}], type: {}",
+                      i,
+                      input_names_[i],
+                      fmt::join(input_dims_[i], ", "),
+                      get_datatype_name(input_datatypes_[i]));
+  }
+  for (size_t i = 0; i < output_nodes_; i++) {
+    HOLOSCAN_LOG_INFO("Output {}: name: {}, dims: [{}], type: {}",
+                      i,
+                      output_names_[i],
+                      fmt::join(output_dims_[i], ", "),
+                      get_datatype_name(output_datatypes_[i]));
+  }
+  if (dynamic_batch_) { HOLOSCAN_LOG_INFO("Dynamic batch, batch size: {}", batch_size_); }
 }
 
-void OnnxInfer::populate_model_details() {
+void OnnxSession::populate_model_details() {
   input_nodes_ = session_->GetInputCount();
   output_nodes_ = session_->GetOutputCount();
 
-  const char* input_name = session_->GetInputName(0, allocator_);
-  input_names_.push_back(input_name);
+  auto read_node = [this](bool is_input, size_t index) {
+    char* name = is_input ? session_->GetInputName(index, allocator_)
+                          : session_->GetOutputName(index, allocator_);
+    (is_input ? input_names_ : output_names_).push_back(name);
+    allocator_.Free(name);
 
-  Ort::TypeInfo input_type_info = session_->GetInputTypeInfo(0);
-  auto input_tensor_info = input_type_info.GetTensorTypeAndShapeInfo();
+    Ort::TypeInfo type_info =
+        is_input ? session_->GetInputTypeInfo(index) : session_->GetOutputTypeInfo(index);
+    auto tensor_info = type_info.GetTensorTypeAndShapeInfo();
+    auto type = tensor_info.GetElementType();
+    auto datatype = get_datatype(type);
+    if (datatype == holoinfer_datatype::hUnsupported) {
+      std::string node = is_input ? "Input " : "Output ";
+      throw std::runtime_error("ONNX inference core: " + node + std::to_string(index) +
+                               " has unsupported type " + std::to_string(type) +
+                               ", supported types are float32, float16, uint8, int8, int32 and "
+                               "int64");
+    }
+    (is_input ? input_types_ : output_types_).push_back(type);
+    (is_input ? input_datatypes_ : output_datatypes_).push_back(datatype);
+    (is_input ? input_dims_ : output_dims_).push_back(tensor_info.GetShape());
+  };
 
-  input_type_ = input_tensor_info.GetElementType();
-  input_dims_ = input_tensor_info.GetShape();
+  for (size_t i = 0; i < input_nodes_; i++) { read_node(true, i); }
+  for (size_t i = 0; i < output_nodes_; i++) { read_node(false, i); }
 
-  const char* output_name = session_->GetOutputName(0, allocator_);
-  output_names_.push_back(output_name);
+  if (input_nodes_ == 0 || output_nodes_ == 0) {
+    throw std::runtime_error("ONNX inference core: Model without input or output");
+  }
+  for (const auto& name : input_names_) { input_name_ptrs_.push_back(name.c_str()); }
+  for (const auto& name : output_names_) { output_name_ptrs_.push_back(name.c_str()); }
 
-  Ort::TypeInfo output_type_info = session_->GetOutputTypeInfo(0);
-  auto output_tensor_info = output_type_info.GetTensorTypeAndShapeInfo();
+  // Symbolic dimensions are reported as -1. Only the batch dimension, the first one, can be
+  // dynamic, and it must be dynamic for every input and output at once.
+  dynamic_batch_ = !input_dims_[0].empty() && input_dims_[0][0] <= 0;
+  auto check_dims = [this](std::vector<int64_t>& dims, const std::string& name) {
+    if (dims.empty()) { throw std::runtime_error("ONNX inference core: Scalar " + name); }
+    if ((dims[0] <= 0) != dynamic_batch_) {
+      throw std::runtime_error("ONNX inference core: Batch dimension of " + name +
+                               " must be dynamic for all or none of the inputs and outputs");
+    }
+    for (size_t d = 1; d < dims.size(); d++) {
+      if (dims[d] <= 0) {
+        throw std::runtime_error("ONNX inference core: Dimension " + std::to_string(d) + " of " +
+                                 name + " is dynamic, only the batch dimension can be dynamic");
+      }
+    }
+    if (dynamic_batch_) { dims[0] = 1; }
+  };
+  for (size_t i = 0; i < input_nodes_; i++) {
+    check_dims(input_dims_[i], input_names_[i]);
+    input_sample_sizes_.push_back(sample_size(input_dims_[i], dynamic_batch_));
+  }
+  for (size_t i = 0; i < output_nodes_; i++) {
+    check_dims(output_dims_[i], output_names_[i]);
+    output_sample_sizes_.push_back(sample_size(output_dims_[i], dynamic_batch_));
+  }
 
-  output_type_ = output_tensor_info.GetElementType();
-  output_dims_ = output_tensor_info.GetShape();
+  if (!dynamic_batch_ && batch_size_ > 1) {
+    HOLOSCAN_LOG_WARN("ONNX model {} has a static batch dimension, batching is disabled",
+                      model_path_);
+    batch_size_ = 1;
+  }
 
-  input_dims_[0] = 1;
-  output_dims_[0] = 1;
+  for (size_t i = 0; i < input_nodes_; i++) { input_tensors_.emplace_back(nullptr); }
+  for (size_t i = 0; i < output_nodes_; i++) { output_tensors_.emplace_back(nullptr); }
+  bound_inputs_.assign(input_nodes_, {nullptr, 0});
+  bound_outputs_.assign(output_nodes_, {nullptr, 0});
+  for (auto datatype : input_datatypes_) { input_batches_.emplace_back(datatype); }
+  for (auto datatype : output_datatypes_) { output_batches_.emplace_back(datatype); }
 
   print_model_details();
 }
 
-int OnnxInfer::set_holoscan_inf_onnx_session_options() {
-  session_options_.SetIntraOpNumThreads(1);
+std::string OnnxSession::set_holoscan_inf_onnx_session_options() {
+  session_options_.SetIntraOpNumThreads(settings_.intra_op_threads);
+  session_options_.SetInterOpNumThreads(settings_.inter_op_threads);
+  session_options_.SetExecutionMode(settings_.parallel_execution ? ExecutionMode::ORT_PARALLEL
+                                                                 : ExecutionMode::ORT_SEQUENTIAL);
   if (use_cuda_) { session_options_.AppendExecutionProvider_CUDA(cuda_options_); }
 
-  session_options_.SetGraphOptimizationLevel(GraphOptimizationLevel::ORT_ENABLE_EXTENDED);
-  return 0;
+  session_options_.SetGraphOptimizationLevel(settings_.optimization_level);
+  if (settings_.optimized_model_cache_path.empty()) { return model_path_; }
+
+  // The optimized model depends on the optimization level and on the execution provider. It is
+  // named after the absolute path of the model, and replaced when older than the model.
+  namespace fs = std::filesystem;
+  std::error_code ec;
+  fs::path model_path = fs::absolute(model_path_, ec);
+  auto level_name = std::find_if(
+      graph_optimization_levels.begin(),
+      graph_optimization_levels.end(),
+      [this](const auto& level) { return level.second == settings_.optimization_level; });
+  std::string cache_name = model_path.stem().string() + "_" +
+                           fmt::format("{:016x}", std::hash<std::string>{}(model_path.string())) +
+                           "_" + level_name->first + (use_cuda_ ? "_cuda" : "_cpu") + ".onnx";
+  fs::path cache_path = fs::path(settings_.optimized_model_cache_path) / cache_name;
+
+  auto cache_time = fs::last_write_time(cache_path, ec);
+  if (!ec && cache_time >= fs::last_write_time(model_path, ec) && !ec) {
+    HOLOSCAN_LOG_INFO("Loading optimized ONNX model {}", cache_path.string());
+    session_options_.SetGraphOptimizationLevel(GraphOptimizationLevel::ORT_DISABLE_ALL);
+    return cache_path.string();
+  }
+
+  fs::create_directories(settings_.optimized_model_cache_path, ec);
+  if (ec) {
+    HOLOSCAN_LOG_WARN("Cannot create the ONNX model cache {}: {}",
+                      settings_.optimized_model_cache_path,
+                      ec.message());
+    return model_path_;
+  }
+  HOLOSCAN_LOG_INFO("Saving optimized ONNX model to {}", cache_path.string());
+  session_options_.SetOptimizedModelFilePath(cache_path.c_str());
+  return model_path_;
 }
 
-OnnxInfer::OnnxInfer(const std::string& model_file_path, bool cuda_flag)
-    : model_path_(model_file_path), use_cuda_(cuda_flag) {
-  set_holoscan_inf_onnx_session_options();
+OnnxSession::OnnxSession(const std::string& model_file_path, bool cuda_flag,
+                         const OnnxSettings& settings)
+    : model_path_(model_file_path),
+      use_cuda_(cuda_flag),
+      settings_(settings),
+      batch_size_(std::max<size_t>(settings.batch_size, 1)),
+      batch_timeout_(std::max<int64_t>(settings.batch_timeout_us, 0)) {
+  std::string model_file = set_holoscan_inf_onnx_session_options();
   auto env_local = std::make_unique<Ort::Env>(ORT_LOGGING_LEVEL_WARNING, "test");
   env_ = std::move(env_local);
-  auto _session = std::make_unique<Ort::Session>(*env_, model_file_path.c_str(), session_options_);
+  auto _session = std::make_unique<Ort::Session>(*env_, model_file.c_str(), session_options_);
   session_ = std::move(_session);
+  io_binding_ = std::make_unique<Ort::IoBinding>(*session_);
 
   populate_model_details();
+  batcher_ = std::make_unique<RequestBatcher<OnnxRequest>>(batch_size_, batch_timeout_);
 }
 
-InferStatus OnnxInfer::do_inference(std::shared_ptr<DataBuffer>& input_buffer,
-                                    std::shared_ptr<DataBuffer>& output_buffer) {
+InferStatus OnnxSession::validate(OnnxRequest& request) const {
   InferStatus status = InferStatus(holoinfer_code::H_ERROR);
 
-  if (input_buffer->host_buffer.size() == 0) {
-    status.set_message(" ONNX inference core: Input Host buffer empty.");
+  if (request.input_buffers->size() != input_nodes_) {
+    status.set_message(" ONNX inference core: Model has " + std::to_string(input_nodes_) +
+                       " inputs, found " + std::to_string(request.input_buffers->size()) +
+                       " input buffers.");
+    return status;
+  }
+  if (request.output_buffers->size() != output_nodes_) {
+    status.set_message(" ONNX inference core: Model has " + std::to_string(output_nodes_) +
+                       " outputs, found " + std::to_string(request.output_buffers->size()) +
+                       " output buffers.");
     return status;
   }
 
-  if (output_buffer->host_buffer.size() == 0) {
-    status.set_message(" ONNX inference core: Output Host buffer empty.");
+  for (size_t i = 0; i < input_nodes_; i++) {
+    const auto& input_buffer = (*request.input_buffers)[i];
+    if (!input_buffer || input_buffer->host_buffer.size() == 0) {
+      status.set_message(" ONNX inference core: Input Host buffer empty.");
+      return status;
+    }
+    if (input_buffer->get_datatype() != input_datatypes_[i]) {
+      status.set_message(" ONNX inference core: Input " + input_names_[i] + " is of type " +
+                         get_datatype_name(input_datatypes_[i]) + ", found buffer of type " +
+                         get_datatype_name(input_buffer->get_datatype()) + ".");
+      return status;
+    }
+    size_t buffer_size = input_buffer->host_buffer.size();
+    if (buffer_size % input_sample_sizes_[i] != 0) {
+      status.set_message(" ONNX inference core: Input buffer size of " + input_names_[i] +
+                         " is not a multiple of the sample size.");
+      return status;
+    }
+    int64_t batch = buffer_size / input_sample_sizes_[i];
+    if (i == 0) {
+      request.batch = batch;
+    } else if (batch != request.batch) {
+      status.set_message(" ONNX inference core: Inputs have different batch sizes.");
+      return status;
+    }
+  }
+  if (!dynamic_batch_ && request.batch != 1) {
+    status.set_message(" ONNX inference core: Input buffer size does not match the model.");
     return status;
   }
 
-  auto input_tensor = input_buffer->host_buffer;
-  input_tensors_.clear();
-  output_tensors_.clear();
+  for (size_t i = 0; i < output_nodes_; i++) {
+    const auto& output_buffer = (*request.output_buffers)[i];
+    if (!output_buffer || output_buffer->host_buffer.size() == 0) {
+      status.set_message(" ONNX inference core: Output Host buffer empty.");
+      return status;
+    }
+    if (output_buffer->get_datatype() != output_datatypes_[i]) {
+      status.set_message(" ONNX inference core: Output " + output_names_[i] + " is of type " +
+                         get_datatype_name(output_datatypes_[i]) + ", found buffer of type " +
+                         get_datatype_name(output_buffer->get_datatype()) + ".");
+      return status;
+    }
+  }
+  return InferStatus();
+}
 
-  size_t input_tensor_size =
-      accumulate(input_dims_.begin(), input_dims_.end(), 1, std::multiplies<size_t>());
-  input_tensor_values_.assign(input_tensor.begin(), input_tensor.end());
+void OnnxSession::bind(bool is_input, size_t index, void* data, int64_t batch) {
+  auto& bound = is_input ? bound_inputs_[index] : bound_outputs_[index];
+  if (bound.first == data && bound.second == batch) { return; }
 
-  size_t output_tensor_size =
-      accumulate(output_dims_.begin(), output_dims_.end(), 1, std::multiplies<size_t>());
-  output_tensor_values_.assign(output_tensor_size, 0);
+  shape_ = is_input ? input_dims_[index] : output_dims_[index];
+  if (dynamic_batch_) { shape_[0] = batch; }
+  size_t size = (is_input ? input_sample_sizes_[index] : output_sample_sizes_[index]) * batch;
+  auto datatype = is_input ? input_datatypes_[index] : output_datatypes_[index];
+  auto& tensor = is_input ? input_tensors_[index] : output_tensors_[index];
+  tensor = Ort::Value::CreateTensor(memory_info_,
+                                    data,
+                                    size * get_element_size(datatype),
+                                    shape_.data(),
+                                    shape_.size(),
+                                    is_input ? input_types_[index] : output_types_[index]);
+  if (is_input) {
+    io_binding_->BindInput(input_name_ptrs_[index], tensor);
+  } else {
+    io_binding_->BindOutput(output_name_ptrs_[index], tensor);
+  }
+  bound = {data, batch};
+}
 
-  Ort::Value i_tensor = Ort::Value::CreateTensor<float>(memory_info_,
-                                                        input_tensor_values_.data(),
-                                                        input_tensor_size,
-                                                        input_dims_.data(),
-                                                        input_dims_.size());
-  if (!i_tensor) {
-    status.set_message(" Onnxruntime: Error creating Ort tensor.");
-    return status;
+void OnnxSession::run(std::vector<OnnxRequest*>& requests) {
+  try {
+    int64_t batch = 0;
+    for (const auto* request : requests) { batch += request->batch; }
+
+    // A single request is run in place on its buffers, several requests are copied to a batch
+    bool in_place = requests.size() == 1;
+
+    for (size_t i = 0; i < input_nodes_; i++) {
+      size_t size = input_sample_sizes_[i] * batch;
+      void* data = nullptr;
+      if (in_place) {
+        data = (*requests[0]->input_buffers)[i]->host_buffer.data();
+      } else {
+        auto& input_batch = input_batches_[i];
+        input_batch.resize(size);
+        auto offset = input_batch.data_as<uint8_t>();
+        for (const auto* request : requests) {
+          const auto& host_buffer = (*request->input_buffers)[i]->host_buffer;
+          offset = std::copy_n(host_buffer.data_as<uint8_t>(), host_buffer.get_bytes(), offset);
+        }
+        data = input_batch.data();
+      }
+      bind(true, i, data, batch);
+    }
+
+    for (size_t i = 0; i < output_nodes_; i++) {
+      size_t size = output_sample_sizes_[i] * batch;
+      void* data = nullptr;
+      if (in_place) {
+        auto& host_buffer = (*requests[0]->output_buffers)[i]->host_buffer;
+        if (host_buffer.size() < size) { host_buffer.resize(size); }
+        data = host_buffer.data();
+      } else {
+        output_batches_[i].resize(size);
+        data = output_batches_[i].data();
+      }
+      bind(false, i, data, batch);
+    }
+
+    session_->Run(Ort::RunOptions{nullptr}, *io_binding_);
+
+    if (!in_place) {
+      for (size_t i = 0; i < output_nodes_; i++) {
+        auto offset = output_batches_[i].data_as<uint8_t>();
+        for (auto* request : requests) {
+          size_t size = output_sample_sizes_[i] * request->batch;
+          auto& host_buffer = (*request->output_buffers)[i]->host_buffer;
+          if (host_buffer.size() < size) { host_buffer.resize(size); }
+          size_t bytes = size * get_element_size(output_datatypes_[i]);
+          std::copy_n(offset, bytes, host_buffer.data_as<uint8_t>());
+          offset += bytes;
+        }
+      }
+    }
+    for (auto* request : requests) { request->status = InferStatus(); }
+  } catch (const std::exception& e) {
+    for (auto* request : requests) {
+      request->status = InferStatus(holoinfer_code::H_ERROR,
+                                    " Onnxruntime: Inference failed: " + std::string(e.what()));
+    }
   }
-  input_tensors_.push_back(std::move(i_tensor));
+}
 
-  Ort::Value o_tensor = Ort::Value::CreateTensor<float>(memory_info_,
-                                                        output_tensor_values_.data(),
-                                                        output_tensor_size,
-                                                        output_dims_.data(),
-                                                        output_dims_.size());
-  if (!o_tensor) {
-    status.set_message(" Onnxruntime: Error creating output Ort tensor.");
-    return status;
+void OnnxSession::submit(OnnxRequest& request) {
+  batcher_->submit(request, [this](std::vector<OnnxRequest*>& requests) { run(requests); });
+}
+
+OnnxInfer::OnnxInfer(const std::string& model_file_path, bool cuda_flag,
+                     const OnnxSettings& settings)
+    : input_buffers_(1), output_buffers_(1) {
+  if (settings.batch_size <= 1) {
+    session_ = std::make_shared<OnnxSession>(model_file_path, cuda_flag, settings);
+  } else {
+    std::string key = fmt::format("{}:{}:{}:{}:{}:{}:{}:{}:{}",
+                                  model_file_path,
+                                  cuda_flag,
+                                  settings.intra_op_threads,
+                                  settings.inter_op_threads,
+                                  settings.parallel_execution,
+                                  static_cast<int>(settings.optimization_level),
+                                  settings.optimized_model_cache_path,
+                                  settings.batch_size,
+                                  settings.batch_timeout_us);
+    std::lock_guard<std::mutex> lock(shared_sessions_mutex);
+    session_ = shared_sessions[key].lock();
+    if (!session_) {
+      session_ = std::make_shared<OnnxSession>(model_file_path, cuda_flag, settings);
+      shared_sessions[key] = session_;
+    }
   }
-  output_tensors_.push_back(std::move(o_tensor));
+  session_->attach();
+}
 
-  session_->Run(Ort::RunOptions{nullptr},
-                input_names_.data(),
-                input_tensors_.data(),
-                1,
-                output_names_.data(),
-                output_tensors_.data(),
-                1);
+OnnxInfer::~OnnxInfer() {
+  cleanup();
+}
 
-  memcpy(output_buffer->host_buffer.data(),
-         output_tensors_.front().GetTensorMutableData<float>(),
-         output_tensor_size * sizeof(float));
-  return InferStatus();
+void OnnxInfer::cleanup() {
+  if (session_) {
+    session_->detach();
+    session_.reset();
+  }
+}
+
+InferStatus OnnxInfer::do_inference(std::shared_ptr<DataBuffer>& input_buffer,
+                                    std::shared_ptr<DataBuffer>& output_buffer) {
+  input_buffers_[0] = input_buffer;
+  output_buffers_[0] = output_buffer;
+  auto status = do_inference(input_buffers_, output_buffers_);
+  input_buffers_[0].reset();
+  output_buffers_[0].reset();
+  return status;
+}
+
+InferStatus OnnxInfer::do_inference(std::vector<std::shared_ptr<DataBuffer>>& input_buffers,
+                                    std::vector<std::shared_ptr<DataBuffer>>& output_buffers) {
+  if (!session_) {
+    return InferStatus(holoinfer_code::H_ERROR, " ONNX inference core: Session not available.");
+  }
+
+  OnnxRequest request;
+  request.input_buffers = &input_buffers;
+  request.output_buffers = &output_buffers;
+
+  auto status = session_->validate(request);
+  if (status.get_code() != holoinfer_code::H_SUCCESS) { return status; }
+
+  session_->submit(request);
+  if (request.status.get_code() == holoinfer_code::H_SUCCESS) { batch_ = request.batch; }
+  return request.status;
 }
 
 std::vector<int64_t> OnnxInfer::get_input_dims() const {
-  return input_dims_;
+  return session_->get_input_dims()[0];
 }
 
 std::vector<int64_t> OnnxInfer::get_output_dims() const {
-  return output_dims_;
+  return get_output_node_dims()[0];
+}
+
+std::vector<std::vector<int64_t>> OnnxInfer::get_input_node_dims() const {
+  return session_->get_input_dims();
+}
+
+std::vector<holoinfer_datatype> OnnxInfer::get_input_datatypes() const {
+  return session_->get_input_datatypes();
+}
+
+std::vector<holoinfer_datatype> OnnxInfer::get_output_datatypes() const {
+  return session_->get_output_datatypes();
+}
+
+std::vector<std::vector<int64_t>> OnnxInfer::get_output_node_dims() const {
+  auto dims = session_->get_output_dims();
+  if (session_->has_dynamic_batch()) {
+    for (auto& node_dims : dims) { node_dims[0] = batch_; }
+  }
+  return dims;
 }
 
 }  // namespace inference
@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2022 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -23,43 +23,93 @@
 #include <onnxruntime_c_api.h>
 #include <onnxruntime_cxx_api.h>
 
+#include <algorithm>
 #include <chrono>
 #include <cmath>
 #include <exception>
+#include <filesystem>
 #include <fstream>
 #include <iostream>
 #include <limits>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <numeric>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <holoinfer_constants.hpp>
 #include <infer/infer.hpp>
+#include <infer/request_batcher.hpp>
 
 namespace holoscan {
 namespace inference {
 /**
- * Onnxruntime based inference class
+ * @brief Onnxruntime session settings
  * */
-class OnnxInfer : public InferBase {
+struct OnnxSettings {
+  /// @brief Threads running an operator of the model, 0 for the onnxruntime default
+  int32_t intra_op_threads = 1;
+
+  /// @brief Threads running independent operators in parallel execution mode, 0 for the
+  /// onnxruntime default
+  int32_t inter_op_threads = 0;
+
+  /// @brief Run independent operators of the model in parallel
+  bool parallel_execution = false;
+
+  /// @brief Graph optimization level
+  GraphOptimizationLevel optimization_level = GraphOptimizationLevel::ORT_ENABLE_EXTENDED;
+
+  /// @brief Directory where the optimized models are saved and loaded from, empty to disable
+  std::string optimized_model_cache_path;
+
+  /// @brief Maximum number of samples run in one call
+  size_t batch_size = 1;
+
+  /// @brief Maximum time in microseconds a request waits for more requests to fill the batch
+  int64_t batch_timeout_us = 0;
+};
+
+/**
+ * @brief Get the onnxruntime graph optimization level from its name
+ * @param level_name One of "disable", "basic", "extended" or "all"
+ * @param level Set to the optimization level
+ * @return InferStatus
+ * */
+InferStatus get_graph_optimization_level(const std::string& level_name,
+                                         GraphOptimizationLevel& level);
+
+/**
+ * @brief Inference request of one caller. Input and output buffers are in the order of the model
+ * inputs and outputs.
+ * */
+struct OnnxRequest {
+  std::vector<std::shared_ptr<DataBuffer>>* input_buffers = nullptr;
+  std::vector<std::shared_ptr<DataBuffer>>* output_buffers = nullptr;
+
+  /// @brief Number of samples in the input buffers
+  int64_t batch = 1;
+
+  InferStatus status;
+  bool done = false;
+};
+
+/**
+ * Onnxruntime session of a model. With a batch size greater than one, the session is shared by
+ * every OnnxInfer instance of the model, and the requests submitted concurrently by them are run
+ * together in one call.
+ * */
+class OnnxSession {
  public:
   /**
    * @brief Constructor
    * @param model_file_path Path to onnx model file
    * @param cuda_flag Flag to show if inference will happen using CUDA
+   * @param settings Session settings
    * */
-  OnnxInfer(const std::string& model_file_path, bool cuda_flag);
-
-  /**
-   * @brief Does the Core inference using Onnxruntime. Input and output buffer are supported on
-   * Host. Inference is supported on host and device.
-   * @param input_data Input DataBuffer
-   * @param output_buffer Output DataBuffer, is populated with inferred results
-   * @return InferStatus
-   * */
-  InferStatus do_inference(std::shared_ptr<DataBuffer>& input_data,
-                           std::shared_ptr<DataBuffer>& output_buffer);
+  OnnxSession(const std::string& model_file_path, bool cuda_flag, const OnnxSettings& settings);
 
   /**
    * @brief Populate class parameters with model details and values
@@ -73,29 +123,84 @@ class OnnxInfer : public InferBase {
 
   /**
    * @brief Create session options for inference
+   * @return Path of the model file to load, the cached optimized model when there is one
    * */
-  int set_holoscan_inf_onnx_session_options();
+  std::string set_holoscan_inf_onnx_session_options();
 
   /**
-   * @brief Get input data dimensions to the model
-   * @return Vector of values as dimension
+   * @brief Checks the buffers of a request against the model and computes its batch
+   * @param request Inference request
+   * @return InferStatus
    * */
-  std::vector<int64_t> get_input_dims() const;
+  InferStatus validate(OnnxRequest& request) const;
 
   /**
-   * @brief Get output data dimensions from the model
-   * @return Vector of values as dimension
+   * @brief Registers a user of the session, which submits one request at a time. Requests are
+   * only held back to fill a batch while another user may still submit one.
    * */
-  std::vector<int64_t> get_output_dims() const;
+  void attach() { batcher_->attach(); }
+
+  /**
+   * @brief Unregisters a user registered with attach()
+   * */
+  void detach() { batcher_->detach(); }
+
+  /**
+   * @brief Runs a request, batched with the requests submitted concurrently when the batch size
+   * is greater than one. Returns once the request is done.
+   * @param request Validated inference request, its status is updated
+   * */
+  void submit(OnnxRequest& request);
+
+  /**
+   * @brief Get input data dimensions of every model input, with a batch of one when the batch
+   * dimension is dynamic
+   * */
+  const std::vector<std::vector<int64_t>>& get_input_dims() const { return input_dims_; }
+
+  /**
+   * @brief Get output data dimensions of every model output, with a batch of one when the batch
+   * dimension is dynamic
+   * */
+  const std::vector<std::vector<int64_t>>& get_output_dims() const { return output_dims_; }
+
+  /**
+   * @brief Get the data type of every model input
+   * */
+  const std::vector<holoinfer_datatype>& get_input_datatypes() const { return input_datatypes_; }
 
-  void cleanup() {
-    session_.reset();
-    env_.reset();
+  /**
+   * @brief Get the data type of every model output
+   * */
+  const std::vector<holoinfer_datatype>& get_output_datatypes() const {
+    return output_datatypes_;
   }
 
+  /**
+   * @brief Whether the first dimension of the model inputs and outputs is dynamic
+   * */
+  bool has_dynamic_batch() const { return dynamic_batch_; }
+
  private:
+  /**
+   * @brief Runs the requests in one session call and updates their status
+   * @param requests Validated inference requests
+   * */
+  void run(std::vector<OnnxRequest*>& requests);
+
+  /**
+   * @brief Binds a buffer to a model input or output, unless it is bound already with the same
+   * batch
+   * @param is_input Whether the node is an input
+   * @param index Index of the node
+   * @param data Buffer of the node, holding elements of the node type
+   * @param batch Number of samples in the buffer
+   * */
+  void bind(bool is_input, size_t index, void* data, int64_t batch);
+
   std::string model_path_{""};
   bool use_cuda_ = true;
+  OnnxSettings settings_;
 
   Ort::SessionOptions session_options_;
   OrtCUDAProviderOptions cuda_options_{};
@@ -107,29 +212,135 @@ class OnnxInfer : public InferBase {
 
   size_t input_nodes_{0}, output_nodes_{0};
 
-  std::vector<int64_t> input_dims_{};
-  std::vector<int64_t> output_dims_{};
+  std::vector<std::string> input_names_;
+  std::vector<std::string> output_names_;
+  std::vector<const char*> input_name_ptrs_;
+  std::vector<const char*> output_name_ptrs_;
 
-  ONNXTensorElementDataType input_type_, output_type_;
+  std::vector<std::vector<int64_t>> input_dims_;
+  std::vector<std::vector<int64_t>> output_dims_;
 
-  std::vector<const char*> input_names_;
-  std::vector<const char*> output_names_;
+  std::vector<ONNXTensorElementDataType> input_types_;
+  std::vector<ONNXTensorElementDataType> output_types_;
+  std::vector<holoinfer_datatype> input_datatypes_;
+  std::vector<holoinfer_datatype> output_datatypes_;
 
-  std::vector<Ort::Value> input_tensors_;
-  std::vector<Ort::Value> output_tensors_;
+  /// @brief Element count of one sample per input and output
+  std::vector<size_t> input_sample_sizes_;
+  std::vector<size_t> output_sample_sizes_;
 
-  std::vector<Ort::Value> input_tensors_gpu_;
-  std::vector<Ort::Value> output_tensors_gpu_;
+  bool dynamic_batch_ = false;
 
   Ort::MemoryInfo memory_info_ = Ort::MemoryInfo::CreateCpu(OrtAllocatorType::OrtArenaAllocator,
                                                             OrtMemType::OrtMemTypeDefault);
 
-  std::vector<float> input_tensor_values_;
-  std::vector<float> output_tensor_values_;
+  /// @brief Tensors bound to the session, with the buffer and batch they were created for. The
+  /// session reads and writes the buffers directly, and a tensor is only created again when the
+  /// buffer or batch changes.
+  std::unique_ptr<Ort::IoBinding> io_binding_;
+  std::vector<Ort::Value> input_tensors_;
+  std::vector<Ort::Value> output_tensors_;
+  std::vector<std::pair<void*, int64_t>> bound_inputs_;
+  std::vector<std::pair<void*, int64_t>> bound_outputs_;
+  std::vector<int64_t> shape_;
+
+  /// @brief Batched data when several requests are run together
+  std::vector<HostBuffer> input_batches_;
+  std::vector<HostBuffer> output_batches_;
+
+  size_t batch_size_ = 1;
+  std::chrono::microseconds batch_timeout_{0};
+  std::unique_ptr<RequestBatcher<OnnxRequest>> batcher_;
+};
+
+/**
+ * Onnxruntime based inference class
+ * */
+class OnnxInfer : public InferBase {
+ public:
+  /**
+   * @brief Constructor
+   * @param model_file_path Path to onnx model file
+   * @param cuda_flag Flag to show if inference will happen using CUDA
+   * @param settings Session settings. With a batch size greater than one, the instances created
+   * for the same model and settings share their session and batch their requests.
+   * */
+  OnnxInfer(const std::string& model_file_path, bool cuda_flag,
+            const OnnxSettings& settings = OnnxSettings());
+
+  /**
+   * @brief Destructor
+   * */
+  ~OnnxInfer();
+
+  /**
+   * @brief Does the Core inference using Onnxruntime. Input and output buffer are supported on
+   * Host. Inference is supported on host and device.
+   * @param input_data Input DataBuffer
+   * @param output_buffer Output DataBuffer, is populated with inferred results
+   * @return InferStatus
+   * */
+  InferStatus do_inference(std::shared_ptr<DataBuffer>& input_data,
+                           std::shared_ptr<DataBuffer>& output_buffer);
+
+  /**
+   * @brief Does the Core inference using Onnxruntime, for models with several inputs or outputs.
+   * When the batch dimension of the model is dynamic, the input buffers may hold several samples,
+   * and the output buffers are resized accordingly.
+   * @param input_buffers Input DataBuffers, one per model input
+   * @param output_buffers Output DataBuffers, one per model output
+   * @return InferStatus
+   * */
+  InferStatus do_inference(std::vector<std::shared_ptr<DataBuffer>>& input_buffers,
+                           std::vector<std::shared_ptr<DataBuffer>>& output_buffers);
+
+  /**
+   * @brief Get input data dimensions to the model
+   * @return Vector of values as dimension
+   * */
+  std::vector<int64_t> get_input_dims() const;
+
+  /**
+   * @brief Get output data dimensions from the model
+   * @return Vector of values as dimension
+   * */
+  std::vector<int64_t> get_output_dims() const;
+
+  /**
+   * @brief Get input data dimensions of every model input
+   * @return Vector of dimensions, in the order of the model inputs
+   * */
+  std::vector<std::vector<int64_t>> get_input_node_dims() const;
+
+  /**
+   * @brief Get output data dimensions of every model output, with the batch of the last inference
+   * @return Vector of dimensions, in the order of the model outputs
+   * */
+  std::vector<std::vector<int64_t>> get_output_node_dims() const;
+
+  /**
+   * @brief Get the data type of every model input
+   * @return Vector of data types, in the order of the model inputs
+   * */
+  std::vector<holoinfer_datatype> get_input_datatypes() const;
+
+  /**
+   * @brief Get the data type of every model output
+   * @return Vector of data types, in the order of the model outputs
+   * */
+  std::vector<holoinfer_datatype> get_output_datatypes() const;
+
+  void cleanup();
+
+ private:
+  std::shared_ptr<OnnxSession> session_;
+
+  /// @brief Buffers of the single input and output inference
+  std::vector<std::shared_ptr<DataBuffer>> input_buffers_;
+  std::vector<std::shared_ptr<DataBuffer>> output_buffers_;
 
-  Ort::MemoryInfo memory_info_cuda_ =
-      Ort::MemoryInfo("Cuda", OrtAllocatorType::OrtArenaAllocator, 0, OrtMemTypeDefault);
-  std::unique_ptr<Ort::Allocator> memory_allocator_cuda_;
+  /// @brief Batch of the last inference
+  int64_t batch_ = 1;
 };
 
 }  // namespace inference
@@ -0,0 +1,141 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef _HOLOSCAN_INFER_REQUEST_BATCHER_H
+#define _HOLOSCAN_INFER_REQUEST_BATCHER_H
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace holoscan {
+namespace inference {
+
+/**
+ * @brief Gathers the requests submitted concurrently by the users of a shared model, and runs
+ * them together.
+ *
+ * The first caller to find no batch being formed leads the next one: it waits for the batch to
+ * fill, or for the timeout, runs it and hands over to a pending request once done. The leader
+ * only waits while another user is attached and has no request pending yet, so a model used by a
+ * single caller never waits for the timeout.
+ *
+ * Request must have an int64_t batch member, the number of samples of the request, and a bool
+ * done member.
+ */
+template <typename Request>
+class RequestBatcher {
+ public:
+  /**
+   * @brief Constructor
+   *
+   * @param batch_size Maximum number of samples run together
+   * @param batch_timeout Maximum time the leader waits for the batch to fill
+   */
+  RequestBatcher(size_t batch_size, std::chrono::microseconds batch_timeout)
+      : batch_size_(static_cast<int64_t>(std::max<size_t>(batch_size, 1))),
+        batch_timeout_(batch_timeout) {}
+
+  RequestBatcher(const RequestBatcher&) = delete;
+  RequestBatcher& operator=(const RequestBatcher&) = delete;
+
+  /**
+   * @brief Registers a user, which may submit one request at a time
+   */
+  void attach() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    users_++;
+  }
+
+  /**
+   * @brief Unregisters a user attached before
+   */
+  void detach() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    users_--;
+    cv_.notify_all();
+  }
+
+  /**
+   * @brief Runs a request, together with the requests submitted concurrently. Returns once the
+   * request is done.
+   *
+   * @param request Request to run
+   * @param run Function called with the requests to run together, must not throw
+   */
+  template <typename Run>
+  void submit(Request& request, Run&& run) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    request.done = false;
+    pending_.push_back(&request);
+    pending_samples_ += request.batch;
+    cv_.notify_all();
+
+    while (!request.done) {
+      if (leader_active_ ||
+          std::find(pending_.begin(), pending_.end(), &request) == pending_.end()) {
+        cv_.wait(lock);
+        continue;
+      }
+      leader_active_ = true;
+      cv_.wait_until(lock, std::chrono::steady_clock::now() + batch_timeout_, [this] {
+        return pending_samples_ >= batch_size_ || pending_.size() >= users_;
+      });
+
+      // Take the pending requests up to the batch size, and always at least one
+      running_.clear();
+      int64_t samples = 0;
+      auto it = pending_.begin();
+      while (it != pending_.end() &&
+             (running_.empty() || samples + (*it)->batch <= batch_size_)) {
+        samples += (*it)->batch;
+        running_.push_back(*it);
+        ++it;
+      }
+      pending_.erase(pending_.begin(), it);
+      pending_samples_ -= samples;
+
+      // Requests arriving during the run are batched by the next leader
+      lock.unlock();
+      run(running_);
+      lock.lock();
+
+      for (auto* running : running_) { running->done = true; }
+      leader_active_ = false;
+      cv_.notify_all();
+    }
+  }
+
+ private:
+  int64_t batch_size_;
+  std::chrono::microseconds batch_timeout_;
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::vector<Request*> pending_;
+  std::vector<Request*> running_;
+  int64_t pending_samples_ = 0;
+  size_t users_ = 0;
+  bool leader_active_ = false;
+};
+
+}  // namespace inference
+}  // namespace holoscan
+
+#endif
@@ -22,6 +22,29 @@
 namespace holoscan {
 namespace inference {
 
+namespace {
+
+holoinfer_datatype get_datatype(nvinfer1::DataType type) {
+  switch (type) {
+    case nvinfer1::DataType::kFLOAT:
+      return holoinfer_datatype::hFloat;
+    case nvinfer1::DataType::kHALF:
+      return holoinfer_datatype::hFloat16;
+    case nvinfer1::DataType::kINT8:
+      return holoinfer_datatype::hInt8;
+    case nvinfer1::DataType::kINT32:
+      return holoinfer_datatype::hInt32;
+#if NV_TENSORRT_MAJOR > 8 || (NV_TENSORRT_MAJOR == 8 && NV_TENSORRT_MINOR >= 5)
+    case nvinfer1::DataType::kUINT8:
+      return holoinfer_datatype::hUInt8;
+#endif
+    default:
+      return holoinfer_datatype::hUnsupported;
+  }
+}
+
+}  // namespace
+
 TrtInfer::TrtInfer(const std::string& model_path, const std::string& model_name, bool enable_fp16,
                    bool is_engine_path, bool cuda_buf_in, bool cuda_buf_out)
     : model_path_(model_path),
@@ -112,6 +135,14 @@ std::vector<int64_t> TrtInfer::get_output_dims() const {
   return output_dims_;
 }
 
+std::vector<holoinfer_datatype> TrtInfer::get_input_datatypes() const {
+  return {input_type_};
+}
+
+std::vector<holoinfer_datatype> TrtInfer::get_output_datatypes() const {
+  return {output_type_};
+}
+
 bool TrtInfer::initialize_parameters() {
   auto dims = engine_->getBindingDimensions(0);
   auto out_dims = engine_->getBindingDimensions(1);
@@ -132,6 +163,13 @@ bool TrtInfer::initialize_parameters() {
   std::vector<int64_t> outdim = {1, out_dims.d[1], out_dims.d[2], out_dims.d[3]};
   output_dims_ = std::move(outdim);
 
+  input_type_ = get_datatype(engine_->getBindingDataType(0));
+  output_type_ = get_datatype(engine_->getBindingDataType(1));
+  if (input_type_ == holoinfer_datatype::hUnsupported ||
+      output_type_ == holoinfer_datatype::hUnsupported) {
+    throw std::runtime_error("Error, unsupported input or output binding type.");
+  }
+
   return true;
 }
 
@@ -147,6 +185,11 @@ InferStatus TrtInfer::do_inference(std::shared_ptr<DataBuffer>& input_buffer,
     status.set_message(" TRT inference core: Data in Input Device buffer is null.");
     return status;
   }
+  if (input_buffer->get_datatype() != input_type_ ||
+      output_buffer->get_datatype() != output_type_) {
+    status.set_message(" TRT inference core: Buffer types do not match the engine bindings.");
+    return status;
+  }
 
   //  Host to Device transfer
   if (!cuda_buf_in_) {
@@ -65,6 +65,18 @@ class TrtInfer : public InferBase {
    * */
   std::vector<int64_t> get_output_dims() const;
 
+  /**
+   * @brief Get the data type of the model input
+   * @return Vector with the data type of the input binding
+   * */
+  std::vector<holoinfer_datatype> get_input_datatypes() const;
+
+  /**
+   * @brief Get the data type of the model output
+   * @return Vector with the data type of the output binding
+   * */
+  std::vector<holoinfer_datatype> get_output_datatypes() const;
+
   void cleanup() {}
 
  private:
@@ -80,6 +92,12 @@ class TrtInfer : public InferBase {
   /// @brief Dimensions of output buffer
   std::vector<int64_t> output_dims_;
 
+  /// @brief Data type of input buffer
+  holoinfer_datatype input_type_ = holoinfer_datatype::hFloat;
+
+  /// @brief Data type of output buffer
+  holoinfer_datatype output_type_ = holoinfer_datatype::hFloat;
+
   /// @brief Data bindings for inference
   std::shared_ptr<std::vector<void*>> inference_bindings;
 
@@ -80,6 +80,27 @@ InferStatus ManagerInfer::set_inference_params(std::shared_ptr<MultiAISpecs>& mu
 
       inference_map_[model_map.first] = tensor_name;
 
+      // Models with several inputs read them by tensor name, the others by model name
+      auto& input_names = model_inputs_[model_map.first];
+      input_names = {model_map.first};
+      if (multiai_specs->input_tensor_map_.find(model_map.first) !=
+              multiai_specs->input_tensor_map_.end() &&
+          multiai_specs->input_tensor_map_.at(model_map.first).size() > 1) {
+        input_names = multiai_specs->input_tensor_map_.at(model_map.first);
+      }
+
+      auto& output_names = model_outputs_[model_map.first];
+      output_names = {tensor_name};
+      if (multiai_specs->output_tensor_map_.find(model_map.first) !=
+          multiai_specs->output_tensor_map_.end()) {
+        output_names = multiai_specs->output_tensor_map_.at(model_map.first);
+        if (output_names.empty() || output_names[0] != tensor_name) {
+          status.set_message("Inference manager, First output tensor of " + model_map.first +
+                             " must be " + tensor_name);
+          return status;
+        }
+      }
+
       if (backend_type.compare("trt") == 0) {
         if (multiai_specs->use_fp16_ && multiai_specs->is_engine_path_) {
           status.set_message(
@@ -90,6 +111,15 @@ InferStatus ManagerInfer::set_inference_params(std::shared_ptr<MultiAISpecs>& mu
           status.set_message("WARNING: TRT backend supports infernce on GPU, CPU flag is ignored");
           status.display_message();
         }
+        if (input_names.size() > 1 || output_names.size() > 1) {
+          status.set_message("Inference manager, TRT backend supports one input and one output per "
+                             "model, found several for " + model_map.first);
+          return status;
+        }
+        if (multiai_specs->batch_size_ > 1) {
+          status.set_message("WARNING: TRT backend does not support batching, batch size ignored");
+          status.display_message();
+        }
         holo_infer_context_.insert({model_map.first,
                                     std::make_unique<TrtInfer>(model_map.second,
                                                                model_map.first,
@@ -97,9 +127,6 @@ InferStatus ManagerInfer::set_inference_params(std::shared_ptr<MultiAISpecs>& mu
                                                                multiai_specs->is_engine_path_,
                                                                cuda_buffer_in_,
                                                                cuda_buffer_out_)});
-
-        std::vector<int64_t> dims = holo_infer_context_.at(model_map.first)->get_output_dims();
-        allocate_host_device_buffers(multiai_specs->output_per_model_, dims, tensor_name);
       } else if (backend_type.compare("onnxrt") == 0) {
         if (cuda_buffer_in_ || cuda_buffer_out_) {
           status.set_message(
@@ -118,16 +145,54 @@ InferStatus ManagerInfer::set_inference_params(std::shared_ptr<MultiAISpecs>& mu
           return status;
         }
 
+        OnnxSettings onnx_settings;
+        onnx_settings.intra_op_threads = multiai_specs->intra_op_threads_;
+        onnx_settings.inter_op_threads = multiai_specs->inter_op_threads_;
+        onnx_settings.parallel_execution = multiai_specs->parallel_execution_;
+        onnx_settings.optimized_model_cache_path = multiai_specs->optimized_model_cache_path_;
+        onnx_settings.batch_size = multiai_specs->batch_size_;
+        onnx_settings.batch_timeout_us = multiai_specs->batch_timeout_us_;
+        auto level_status = get_graph_optimization_level(multiai_specs->graph_optimization_level_,
+                                                         onnx_settings.optimization_level);
+        if (level_status.get_code() != holoinfer_code::H_SUCCESS) { return level_status; }
+
         holo_infer_context_.insert(
             {model_map.first,
-             std::make_unique<OnnxInfer>(model_map.second, multiai_specs->oncuda_)});
-
-        std::vector<int64_t> dims = holo_infer_context_.at(model_map.first)->get_output_dims();
-        allocate_host_buffers(multiai_specs->output_per_model_, dims, tensor_name);
+             std::make_unique<OnnxInfer>(model_map.second, multiai_specs->oncuda_, onnx_settings)});
       } else {
         status.set_message("Inference manager, following backend not supported: " + backend_type);
         return status;
       }
+
+      auto input_node_dims = holo_infer_context_.at(model_map.first)->get_input_node_dims();
+      auto output_node_dims = holo_infer_context_.at(model_map.first)->get_output_node_dims();
+      if (input_node_dims.size() != input_names.size() ||
+          output_node_dims.size() != output_names.size()) {
+        status.set_message("Inference manager, Model " + model_map.first + " has " +
+                           std::to_string(input_node_dims.size()) + " inputs and " +
+                           std::to_string(output_node_dims.size()) + " outputs, mapped to " +
+                           std::to_string(input_names.size()) + " input and " +
+                           std::to_string(output_names.size()) + " output tensors");
+        return status;
+      }
+      // Output buffers hold the data type of the model outputs
+      auto output_types = holo_infer_context_.at(model_map.first)->get_output_datatypes();
+      for (size_t i = 0; i < output_names.size(); i++) {
+        if (backend_type.compare("trt") == 0) {
+          allocate_host_device_buffers(multiai_specs->output_per_model_,
+                                       output_node_dims[i],
+                                       output_names[i],
+                                       output_types[i]);
+        } else {
+          allocate_host_buffers(multiai_specs->output_per_model_,
+                                output_node_dims[i],
+                                output_names[i],
+                                output_types[i]);
+        }
+        output_tensor_dims_[output_names[i]] = output_node_dims[i];
+      }
+      model_input_buffers_[model_map.first].resize(input_names.size());
+      model_output_buffers_[model_map.first].resize(output_names.size());
       models_input_dims_.insert(
           {model_map.first, holo_infer_context_[model_map.first]->get_input_dims()});
       models_output_dims_.insert(
@@ -141,10 +206,37 @@ InferStatus ManagerInfer::set_inference_params(std::shared_ptr<MultiAISpecs>& mu
     return status;
   }
   parallel_processing_ = multiai_specs->parallel_processing_;
+
+  // Create the threads once, each model always running on the same one
+  model_names_.clear();
+  model_latencies_.clear();
+  for (const auto& model_param : infer_param_) {
+    model_names_.push_back(model_param.first);
+    model_latencies_.push_back(&latencies_[model_param.first]);
+  }
+  model_status_.assign(model_names_.size(), InferStatus());
+
+  size_t worker_count = 0;
+  if (parallel_processing_ && model_names_.size() > 1) {
+    worker_count = multiai_specs->inference_threads_ > 0
+                       ? std::min(multiai_specs->inference_threads_, model_names_.size())
+                       : model_names_.size();
+    // A single worker would only add a hand-off to the sequential inference
+    if (worker_count == 1) { worker_count = 0; }
+  }
+  try {
+    worker_pool_ = std::make_unique<WorkerPool>(
+        worker_count, model_names_.size(), [this](size_t model_index) { run_model(model_index); });
+  } catch (const std::system_error& se) {
+    status.set_message("Inference manager, Thread creation failed: " + std::string(se.what()));
+    return status;
+  }
   return InferStatus();
 }
 
 void ManagerInfer::cleanup() {
+  worker_pool_.reset();
+
   for (auto& infer_map : holo_infer_context_) {
     infer_map.second->cleanup();
     infer_map.second.reset();
@@ -158,67 +250,96 @@ InferStatus ManagerInfer::run_core_inference(const std::string& model_name,
                                              DataMap& permodel_output_data) {
   InferStatus status = InferStatus(holoinfer_code::H_ERROR);
 
-  if (permodel_preprocess_data.find(model_name) != permodel_preprocess_data.end()) {
-    auto indat = permodel_preprocess_data.at(model_name);
-    if (permodel_output_data.find(inference_map_.at(model_name)) == permodel_output_data.end()) {
-      status.set_message("Infer Manager core, no output data mapping for " + model_name);
+  if (holo_infer_context_.find(model_name) == holo_infer_context_.end()) {
+    status.set_message("Inference manager, Inference context for model " + model_name +
+                       " is invalid.");
+    return status;
+  }
+
+  // The buffer vectors are sized at setup, and each is only used by the thread of its model
+  const auto& input_names = model_inputs_.at(model_name);
+  auto& input_buffers = model_input_buffers_.at(model_name);
+  for (size_t i = 0; i < input_names.size(); i++) {
+    auto indat = permodel_preprocess_data.find(input_names[i]);
+    if (indat == permodel_preprocess_data.end()) {
+      status.set_message("Inference manager, Preprocessed data for model " + model_name +
+                         " does not exist.");
       return status;
     }
-    auto outdat = permodel_output_data.at(inference_map_.at(model_name));
-
-    if (holo_infer_context_.find(model_name) != holo_infer_context_.end()) {
-      auto i_status = holo_infer_context_.at(model_name)->do_inference(indat, outdat);
-      if (i_status.get_code() == holoinfer_code::H_ERROR) {
-        i_status.display_message();
-        status.set_message("Inference manager, Inference failed in core for " + model_name);
-        return status;
-      }
+    input_buffers[i] = indat->second;
+  }
 
-      return InferStatus();
+  const auto& output_names = model_outputs_.at(model_name);
+  auto& output_buffers = model_output_buffers_.at(model_name);
+  for (size_t i = 0; i < output_names.size(); i++) {
+    auto outdat = permodel_output_data.find(output_names[i]);
+    if (outdat == permodel_output_data.end()) {
+      status.set_message("Infer Manager core, no output data mapping for " + model_name);
+      return status;
     }
-    status.set_message("Inference manager, Inference context for model " + model_name +
-                       " is invalid.");
+    output_buffers[i] = outdat->second;
+  }
+
+  auto& context = holo_infer_context_.at(model_name);
+  auto i_status = context->do_inference(input_buffers, output_buffers);
+  if (i_status.get_code() == holoinfer_code::H_ERROR) {
+    i_status.display_message();
+    status.set_message("Inference manager, Inference failed in core for " + model_name);
     return status;
   }
-  status.set_message("Inference manager, Preprocessed data for model " + model_name +
-                     " does not exist.");
-  return status;
+
+  // Output dimensions follow the batch of the inference when it is dynamic
+  auto output_node_dims = context->get_output_node_dims();
+  models_output_dims_.at(model_name) = output_node_dims[0];
+  for (size_t i = 0; i < output_names.size(); i++) {
+    output_tensor_dims_.at(output_names[i]) = output_node_dims[i];
+  }
+  return InferStatus();
+}
+
+void ManagerInfer::run_model(size_t model_index) {
+  auto start = std::chrono::steady_clock::now();
+  const std::string& model_name = model_names_[model_index];
+  try {
+    model_status_[model_index] =
+        run_core_inference(model_name, *current_preprocess_data_, *current_output_data_);
+  } catch (const std::exception& e) {
+    model_status_[model_index] = InferStatus(
+        holoinfer_code::H_ERROR, "Inference manager, Exception in " + model_name + ": " + e.what());
+  } catch (...) {
+    model_status_[model_index] =
+        InferStatus(holoinfer_code::H_ERROR, "Inference manager, Exception in " + model_name);
+  }
+  model_latencies_[model_index]->record(std::chrono::steady_clock::now() - start);
 }
 
 InferStatus ManagerInfer::execute_inference(DataMap& permodel_preprocess_data,
                                             DataMap& permodel_output_data) {
   InferStatus status = InferStatus();
+  if (!worker_pool_) {
+    status.set_code(holoinfer_code::H_ERROR);
+    status.set_message("Inference manager, Inference parameters are not set");
+    return status;
+  }
 
   std::chrono::steady_clock::time_point s_time;
   std::chrono::steady_clock::time_point e_time;
 
-  std::map<std::string, std::future<InferStatus>> inference_futures;
+  // The models read the data maps by reference, the pool waits for all of them to complete
+  current_preprocess_data_ = &permodel_preprocess_data;
+  current_output_data_ = &permodel_output_data;
   s_time = std::chrono::steady_clock::now();
-  for (auto& model_param : infer_param_) {
-    std::string model_instance{model_param.first};
-
-    if (!parallel_processing_) {
-      run_core_inference(model_param.first, permodel_preprocess_data, permodel_output_data);
-    } else {
-      inference_futures.insert({model_instance,
-                                std::async(std::launch::async,
-                                           std::bind(&ManagerInfer::run_core_inference,
-                                                     this,
-                                                     model_param.first,
-                                                     permodel_preprocess_data,
-                                                     permodel_output_data))});
-    }
-  }
+  worker_pool_->run();
+  current_preprocess_data_ = nullptr;
+  current_output_data_ = nullptr;
 
-  if (parallel_processing_) {
-    for (auto& inf_fut : inference_futures) {
-      InferStatus infer_status = inf_fut.second.get();
-      if (infer_status.get_code() != holoinfer_code::H_SUCCESS) {
-        status.set_code(holoinfer_code::H_ERROR);
-        infer_status.display_message();
-        status.set_message("Inference manager, Inference failed in execution for " + inf_fut.first);
-        return status;
-      }
+  for (size_t i = 0; i < model_names_.size(); i++) {
+    if (model_status_[i].get_code() != holoinfer_code::H_SUCCESS) {
+      status.set_code(holoinfer_code::H_ERROR);
+      model_status_[i].display_message();
+      status.set_message("Inference manager, Inference failed in execution for " +
+                         model_names_[i]);
+      return status;
     }
   }
 
@@ -240,6 +361,14 @@ DimType ManagerInfer::get_output_dimensions() const {
   return models_output_dims_;
 }
 
+DimType ManagerInfer::get_output_tensor_dimensions() const {
+  return output_tensor_dims_;
+}
+
+const LatencyMap& ManagerInfer::get_latencies() const {
+  return latencies_;
+}
+
 InferContext::InferContext() {
   try {
     manager = std::make_unique<ManagerInfer>();
@@ -276,5 +405,13 @@ DimType InferContext::get_output_dimensions() const {
   return manager->get_output_dimensions();
 }
 
+DimType InferContext::get_output_tensor_dimensions() const {
+  return manager->get_output_tensor_dimensions();
+}
+
+const LatencyMap& InferContext::get_latencies() const {
+  return manager->get_latencies();
+}
+
 }  // namespace inference
 }  // namespace holoscan
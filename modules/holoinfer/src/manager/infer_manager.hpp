@@ -17,12 +17,14 @@
 #ifndef _HOLOSCAN_INFER_MANAGER_H
 #define _HOLOSCAN_INFER_MANAGER_H
 
+#include <chrono>
 #include <functional>
-#include <future>
 #include <iostream>
 #include <map>
 #include <memory>
 #include <string>
+#include <system_error>
+#include <vector>
 
 #include <holoinfer.hpp>
 #include <holoinfer_buffer.hpp>
@@ -30,6 +32,7 @@
 #include <infer/infer.hpp>
 #include <infer/onnx/core.hpp>
 #include <infer/trt/core.hpp>
+#include <manager/worker_pool.hpp>
 #include <params/infer_param.hpp>
 
 namespace holoscan {
@@ -100,10 +103,51 @@ class ManagerInfer {
    */
   DimType get_output_dimensions() const;
 
+  /**
+   * @brief Get output dimension per output tensor
+   *
+   * @returns Map with output tensor name as key and dimension as value
+   */
+  DimType get_output_tensor_dimensions() const;
+
+  /**
+   * @brief Get inference latencies per model, accumulated over all inferences
+   *
+   * @returns Map with model name as key and latency histogram as value
+   */
+  const LatencyMap& get_latencies() const;
+
  private:
+  /**
+   * @brief Runs the inference of a model on the current input and output data, and records its
+   * status and latency. Called by the worker pool.
+   *
+   * @param model_index Index of the model in model_names_
+   */
+  void run_model(size_t model_index);
+
   /// Flag to infer models in parallel. Defaults to False
   bool parallel_processing_ = false;
 
+  /// Threads running the models, created once at setup and reused for every inference
+  std::unique_ptr<WorkerPool> worker_pool_;
+
+  /// Model names, in the order of the tasks of the worker pool
+  std::vector<std::string> model_names_;
+
+  /// Status of the last inference per model
+  std::vector<InferStatus> model_status_;
+
+  /// Latency histogram per model name
+  LatencyMap latencies_;
+
+  /// Latency histogram per model, in the order of model_names_
+  std::vector<LatencyHistogram*> model_latencies_;
+
+  /// Data of the inference in progress, read by the worker pool
+  DataMap* current_preprocess_data_ = nullptr;
+  DataMap* current_output_data_ = nullptr;
+
   /// Flag to demonstrate if input data buffer is on cuda
   bool cuda_buffer_in_ = false;
 
@@ -119,12 +163,25 @@ class ManagerInfer {
   /// Map storing model to tensor map. Currently supports one-one mapping
   std::map<std::string, std::string> inference_map_;
 
+  /// Map storing the keys of the input data per model, in the order of the model inputs
+  MultiMappings model_inputs_;
+
+  /// Map storing the output tensor names per model, in the order of the model outputs
+  MultiMappings model_outputs_;
+
+  /// Input and output buffers of the inference in progress per model
+  std::map<std::string, std::vector<std::shared_ptr<DataBuffer>>> model_input_buffers_;
+  std::map<std::string, std::vector<std::shared_ptr<DataBuffer>>> model_output_buffers_;
+
   /// Map storing input dimension per model
   DimType models_input_dims_;
 
   /// Map storing inferred output dimension per tensor
   DimType models_output_dims_;
 
+  /// Map storing inferred output dimension per output tensor name
+  DimType output_tensor_dims_;
+
   /// Map storing Backends supported. Onnxruntime and TRT is supported
   std::map<std::string, bool> supported_backend_{
       {"onnxrt", true}, {"trt", true}, {"pytorch", false}};
@@ -32,8 +32,9 @@ InferStatus ManagerProcessor::initialize(const MultiMappings& process_operations
 InferStatus ManagerProcessor::process(
     const MultiMappings& tensor_oper_map, const Mappings& in_out_tensor_map,
     DataMap& inferred_result_map, const std::map<std::string, std::vector<int>>& dimension_map) {
+  size_t index = 0;
   for (const auto& tensor_to_ops : tensor_oper_map) {
-    auto tensor_name = tensor_to_ops.first;
+    const auto& tensor_name = tensor_to_ops.first;
     if (inferred_result_map.find(tensor_name) == inferred_result_map.end()) {
       return InferStatus(
           holoinfer_code::H_ERROR,
@@ -46,78 +47,39 @@ InferStatus ManagerProcessor::process(
           "Process manager, Dimension map does not contain results from " + tensor_name);
     }
 
-    std::vector<float> out_result = inferred_result_map.at(tensor_name)->host_buffer;
-    const std::vector<int> dimensions = dimension_map.at(tensor_name);
-
-    auto operations = tensor_to_ops.second;
-
-    // If the input tensor has a mapped output tensor, then allocate memory
-    if (in_out_tensor_map.find(tensor_name) != in_out_tensor_map.end()) {
-      auto out_tensor_name = in_out_tensor_map.at(tensor_name);
-      if (processed_data_map_.find(out_tensor_name) == processed_data_map_.end()) {
-        processed_data_map_.insert({out_tensor_name, std::make_shared<DataBuffer>()});
-      }
+    const auto& inferred_result = inferred_result_map.at(tensor_name)->host_buffer;
+    if (inferred_result.get_datatype() != holoinfer_datatype::hFloat) {
+      return InferStatus(holoinfer_code::H_ERROR,
+                         "Process manager, Only float32 results are supported, " + tensor_name +
+                             " is of type " + get_datatype_name(inferred_result.get_datatype()));
+    }
+    const auto& dimensions = dimension_map.at(tensor_name);
+
+    // If the input tensor has a mapped output tensor, the operations write to its buffer
+    auto out_tensor = in_out_tensor_map.find(tensor_name);
+    HostBuffer* processed_buffer = &unmapped_output_;
+    if (out_tensor != in_out_tensor_map.end()) {
+      auto& processed_data = processed_data_map_[out_tensor->second];
+      if (!processed_data) { processed_data = std::make_shared<DataBuffer>(); }
+      processed_buffer = &processed_data->host_buffer;
     }
 
-    processed_dims_map_.clear();
-
-    for (auto& operation : operations) {
-      std::vector<int64_t> processed_dims;
-      std::vector<float> process_vector;
-      std::vector<std::string> custom_strings;
-
-      // if operation is print, then no need to allocate output memory
-      if (operation.find("print") != std::string::npos) {
-        if (operation.compare("print") == 0) {
-          std::cout << "Printing results from " << tensor_name << " -> ";
-        } else {
-          if (operation.find("custom") != std::string::npos) {
-            std::istringstream cstrings(operation);
-
-            std::string custom_string;
-            while (std::getline(cstrings, custom_string, ',')) {
-              custom_strings.push_back(custom_string);
-            }
-            if (custom_strings.size() != 3) {
-              return InferStatus(
-                  holoinfer_code::H_ERROR,
-                  "Process manager, Custom binary print operation must generate 3 strings");
-            }
-            operation = custom_strings.at(0);
-            custom_strings.erase(custom_strings.begin());
-          }
-        }
-      } else {
-        if (in_out_tensor_map.find(tensor_name) == in_out_tensor_map.end()) {
-          return InferStatus(
-              holoinfer_code::H_ERROR,
-              "Process manager, In tensor " + tensor_name + " has no out tensor mapping");
-        }
-        // allocate memory for the first time
-        // TODO: every consecutive operation update the allocated buffer :: SD
-        if (process_vector.size() == 0) {
-          const size_t out_channels = dimensions[dimensions.size() - 1];
-          process_vector.resize(2 * out_channels);
-        }
-      }
-
-      InferStatus status = infer_data_->process_operation(
-          operation, dimensions, out_result, processed_dims, process_vector, custom_strings);
-
-      if (status.get_code() != holoinfer_code::H_SUCCESS) {
-        return InferStatus(holoinfer_code::H_ERROR,
-                           "Process manager, Error running operation " + operation);
-      }
-      // TODO: Update the input to process_operation with updated results if many operations in
-      // sequence: SD
-      // TODO: Generalize dims map to have mapping based on out_tensors
-
-      if (in_out_tensor_map.find(tensor_name) != in_out_tensor_map.end()) {
-        auto out_tensor_name = in_out_tensor_map.at(tensor_name);
+    auto status = infer_data_->process_operations(
+        index++, tensor_name, dimensions, inferred_result, processed_dims_, *processed_buffer);
+    if (status.get_code() != holoinfer_code::H_SUCCESS) {
+      return InferStatus(holoinfer_code::H_ERROR,
+                         "Process manager, Error running operations on " + tensor_name + ", " +
+                             status.get_message());
+    }
 
-        processed_data_map_.at(out_tensor_name)->host_buffer = std::move(process_vector);
-        processed_dims_map_.insert({tensor_name, std::move(processed_dims)});
+    // Operations without output, like print, need no out tensor
+    if (!processed_dims_.empty()) {
+      if (out_tensor == in_out_tensor_map.end()) {
+        return InferStatus(
+            holoinfer_code::H_ERROR,
+            "Process manager, In tensor " + tensor_name + " has no out tensor mapping");
       }
+      processed_dims_map_[tensor_name] = processed_dims_;
     }
   }
   return InferStatus();
@@ -93,6 +93,12 @@ class ManagerProcessor {
 
   /// Map with tensor name as key and related Dimension as value
   DimType processed_dims_map_;
+
+  /// Dimension of the output of the operations on a tensor
+  std::vector<int64_t> processed_dims_;
+
+  /// Output of the operations on a tensor without out tensor mapping
+  HostBuffer unmapped_output_;
 };
 
 /// Pointer to manager class for multi data processing
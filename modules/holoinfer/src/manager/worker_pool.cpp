@@ -0,0 +1,69 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "worker_pool.hpp"
+
+#include <utility>
+
+namespace holoscan {
+namespace inference {
+
+WorkerPool::WorkerPool(size_t worker_count, size_t task_count, std::function<void(size_t)> task)
+    : worker_count_(worker_count), task_count_(task_count), task_(std::move(task)) {
+  workers_.reserve(worker_count);
+  for (size_t i = 0; i < worker_count; i++) { workers_.emplace_back(&WorkerPool::work, this, i); }
+}
+
+WorkerPool::~WorkerPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+  }
+  start_cv_.notify_all();
+  for (auto& worker : workers_) { worker.join(); }
+}
+
+void WorkerPool::run() {
+  if (worker_count_ == 0) {
+    for (size_t i = 0; i < task_count_; i++) { task_(i); }
+    return;
+  }
+  std::unique_lock<std::mutex> lock(mutex_);
+  pending_ = worker_count_;
+  generation_++;
+  start_cv_.notify_all();
+  done_cv_.wait(lock, [this]() { return pending_ == 0; });
+}
+
+void WorkerPool::work(size_t worker_index) {
+  uint64_t generation = 0;
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      start_cv_.wait(lock, [&]() { return stopping_ || generation_ != generation; });
+      if (stopping_) { return; }
+      generation = generation_;
+    }
+
+    for (size_t i = worker_index; i < task_count_; i += worker_count_) { task_(i); }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (--pending_ == 0) { done_cv_.notify_one(); }
+  }
+}
+
+}  // namespace inference
+}  // namespace holoscan
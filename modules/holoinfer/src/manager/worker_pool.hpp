@@ -0,0 +1,87 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef _HOLOSCAN_INFER_WORKER_POOL_H
+#define _HOLOSCAN_INFER_WORKER_POOL_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace holoscan {
+namespace inference {
+
+/**
+ * @brief Long-lived pool of threads running a fixed set of tasks.
+ *
+ * Task i always runs on worker i % worker count, so that the state a task keeps per thread (CUDA
+ * context, inference engine bindings) stays on the same thread from one run to the next. A run
+ * does not allocate memory.
+ */
+class WorkerPool {
+ public:
+  /**
+   * @brief Constructor
+   *
+   * @param worker_count Number of threads to create
+   * @param task_count Number of tasks run by each call to run()
+   * @param task Function called with the index of the task to run
+   */
+  WorkerPool(size_t worker_count, size_t task_count, std::function<void(size_t)> task);
+
+  /**
+   * @brief Destructor, waits for the threads to exit
+   */
+  ~WorkerPool();
+
+  WorkerPool(const WorkerPool&) = delete;
+  WorkerPool& operator=(const WorkerPool&) = delete;
+
+  /**
+   * @brief Runs every task on its worker and waits for all of them to complete
+   */
+  void run();
+
+  /**
+   * @brief Get the number of worker threads
+   *
+   * @returns Worker count
+   */
+  size_t worker_count() const { return worker_count_; }
+
+ private:
+  void work(size_t worker_index);
+
+  size_t worker_count_;
+  size_t task_count_;
+  std::function<void(size_t)> task_;
+  std::vector<std::thread> workers_;
+
+  std::mutex mutex_;
+  std::condition_variable start_cv_;
+  std::condition_variable done_cv_;
+  uint64_t generation_ = 0;
+  size_t pending_ = 0;
+  bool stopping_ = false;
+};
+
+}  // namespace inference
+}  // namespace holoscan
+
+#endif
@@ -16,51 +16,563 @@
  */
 #include "data_processor.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <mutex>
+#include <numeric>
+#include <thread>
+#include <utility>
+
 namespace holoscan {
 namespace inference {
 
+namespace {
+
+/// Lanes of the max per channel kernel, each tracking one channel of one pixel of a block
+constexpr size_t kMaxPerChannelLanes = 256;
+
+/// Inputs with fewer elements are processed on the calling thread
+constexpr size_t kParallelMinElements = 1 << 18;
+
+/// Upper bound of the worker threads of the max per channel
+constexpr size_t kMaxWorkers = 8;
+
+/// Guards the registered operations
+std::mutex registry_mutex;
+
+/// Operations registered with register_process_operation, by name
+std::map<std::string, ProcessOperationFactory>& registered_operations() {
+  static std::map<std::string, ProcessOperationFactory> operations;
+  return operations;
+}
+
+/// Splits an operation "name,arg1,arg2" into its name followed by its arguments
+std::vector<std::string> split_operation(const std::string& operation) {
+  std::vector<std::string> tokens;
+  std::istringstream stream(operation);
+  std::string token;
+  while (std::getline(stream, token, ',')) { tokens.push_back(token); }
+  if (tokens.empty()) { tokens.emplace_back(); }
+  return tokens;
+}
+
+InferStatus argument_error(const std::string& operation, const std::string& expected) {
+  return InferStatus(holoinfer_code::H_ERROR,
+                     "Data processor, Operation " + operation + " expects " + expected);
+}
+
+/// Parses a float argument, failing if the argument is not entirely a number
+bool parse_argument(const std::string& argument, float& value) {
+  try {
+    size_t end = 0;
+    value = std::stof(argument, &end);
+    return end == argument.size();
+  } catch (const std::exception&) { return false; }
+}
+
+/// Parses a positive integer argument
+bool parse_argument(const std::string& argument, size_t& value) {
+  try {
+    size_t end = 0;
+    const long long parsed = std::stoll(argument, &end);
+    value = static_cast<size_t>(parsed);
+    return end == argument.size() && parsed > 0;
+  } catch (const std::exception&) { return false; }
+}
+
+size_t element_count(const std::vector<int64_t>& dims) {
+  return std::accumulate(dims.begin(), dims.end(), size_t{1}, std::multiplies<size_t>());
+}
+
+/// Checks that the input has a last dimension, the one reduced by the operation
+InferStatus check_last_dimension(const std::string& operation, const std::vector<int64_t>& dims) {
+  if (dims.empty() || dims.back() <= 0) {
+    return InferStatus(holoinfer_code::H_ERROR,
+                       "Data processor, " + operation + " needs a non empty last dimension");
+  }
+  return InferStatus();
+}
+
+/// Softmax over the last dimension
+InferStatus softmax(const std::vector<int64_t>& in_dims, const HostBuffer& in_data,
+                    std::vector<int64_t>& out_dims, HostBuffer& out_data) {
+  auto status = check_last_dimension("softmax", in_dims);
+  if (status.get_code() != holoinfer_code::H_SUCCESS) { return status; }
+  const size_t count = element_count(in_dims);
+  const size_t n = in_dims.back();
+
+  out_data.resize(count);
+  const float* in = in_data.data_as<float>();
+  float* out = out_data.data_as<float>();
+  for (size_t row = 0; row < count; row += n) {
+    const float max_value = *std::max_element(in + row, in + row + n);
+    float sum = 0.f;
+    for (size_t i = row; i < row + n; i++) {
+      out[i] = std::exp(in[i] - max_value);
+      sum += out[i];
+    }
+    const float scale = 1.f / sum;
+    for (size_t i = row; i < row + n; i++) { out[i] *= scale; }
+  }
+  out_dims = in_dims;
+  return InferStatus();
+}
+
+/// Element-wise logistic function
+InferStatus sigmoid(const std::vector<int64_t>& in_dims, const HostBuffer& in_data,
+                    std::vector<int64_t>& out_dims, HostBuffer& out_data) {
+  const size_t count = element_count(in_dims);
+  out_data.resize(count);
+  const float* in = in_data.data_as<float>();
+  float* out = out_data.data_as<float>();
+  for (size_t i = 0; i < count; i++) { out[i] = 1.f / (1.f + std::exp(-in[i])); }
+  out_dims = in_dims;
+  return InferStatus();
+}
+
+/// Index of the first max of the last dimension, which is removed
+InferStatus argmax(const std::vector<int64_t>& in_dims, const HostBuffer& in_data,
+                   std::vector<int64_t>& out_dims, HostBuffer& out_data) {
+  auto status = check_last_dimension("argmax", in_dims);
+  if (status.get_code() != holoinfer_code::H_SUCCESS) { return status; }
+  const size_t n = in_dims.back();
+  const size_t rows = element_count(in_dims) / n;
+
+  out_data.resize(rows);
+  const float* in = in_data.data_as<float>();
+  float* out = out_data.data_as<float>();
+  for (size_t row = 0; row < rows; row++) {
+    const float* values = in + row * n;
+    out[row] = static_cast<float>(std::max_element(values, values + n) - values);
+  }
+  out_dims.assign(in_dims.begin(), in_dims.end() - 1);
+  if (out_dims.empty()) { out_dims.push_back(1); }
+  return InferStatus();
+}
+
+/// 1 where the value is at least the threshold, 0 elsewhere
+InferStatus threshold(float threshold_value, const std::vector<int64_t>& in_dims,
+                      const HostBuffer& in_data, std::vector<int64_t>& out_dims,
+                      HostBuffer& out_data) {
+  const size_t count = element_count(in_dims);
+  out_data.resize(count);
+  const float* in = in_data.data_as<float>();
+  float* out = out_data.data_as<float>();
+  for (size_t i = 0; i < count; i++) { out[i] = in[i] >= threshold_value ? 1.f : 0.f; }
+  out_dims = in_dims;
+  return InferStatus();
+}
+
+/**
+ * The k largest values of the last dimension, replaced by k (index, value) pairs in decreasing
+ * order of value. Equal values are ordered by index.
+ */
+InferStatus top_k(size_t k, std::vector<size_t>& indices, const std::vector<int64_t>& in_dims,
+                  const HostBuffer& in_data, std::vector<int64_t>& out_dims,
+                  HostBuffer& out_data) {
+  auto status = check_last_dimension("top_k", in_dims);
+  if (status.get_code() != holoinfer_code::H_SUCCESS) { return status; }
+  const size_t n = in_dims.back();
+  if (k > n) {
+    return InferStatus(holoinfer_code::H_ERROR,
+                       "Data processor, top_k, k is larger than the last dimension " +
+                           std::to_string(n));
+  }
+  const size_t rows = element_count(in_dims) / n;
+
+  out_data.resize(rows * k * 2);
+  indices.resize(n);
+  const float* in = in_data.data_as<float>();
+  float* out = out_data.data_as<float>();
+  for (size_t row = 0; row < rows; row++) {
+    const float* values = in + row * n;
+    std::iota(indices.begin(), indices.end(), 0);
+    std::partial_sort(
+        indices.begin(), indices.begin() + k, indices.end(), [values](size_t a, size_t b) {
+          return values[a] > values[b] || (values[a] == values[b] && a < b);
+        });
+    for (size_t i = 0; i < k; i++) {
+      out[(row * k + i) * 2] = static_cast<float>(indices[i]);
+      out[(row * k + i) * 2 + 1] = values[indices[i]];
+    }
+  }
+  out_dims.assign(in_dims.begin(), in_dims.end() - 1);
+  out_dims.push_back(static_cast<int64_t>(k));
+  out_dims.push_back(2);
+  return InferStatus();
+}
+
+/// Scratch memory of the non maximum suppression, kept across frames
+struct NmsScratch {
+  std::vector<size_t> candidates;
+  std::vector<size_t> kept;
+};
+
+float intersection_over_union(const float* a, const float* b) {
+  const float area_a = std::max(0.f, a[2] - a[0]) * std::max(0.f, a[3] - a[1]);
+  const float area_b = std::max(0.f, b[2] - b[0]) * std::max(0.f, b[3] - b[1]);
+  const float width = std::max(0.f, std::min(a[2], b[2]) - std::max(a[0], b[0]));
+  const float height = std::max(0.f, std::min(a[3], b[3]) - std::max(a[1], b[1]));
+  const float intersection = width * height;
+  const float union_area = area_a + area_b - intersection;
+  return union_area > 0.f ? intersection / union_area : 0.f;
+}
+
+/**
+ * Greedy non maximum suppression of detections [..., N, C], each row being x1, y1, x2, y2, score
+ * followed by any other values. Detections with a score of at least score_threshold are kept in
+ * decreasing order of score, unless their IoU with a kept detection exceeds iou_threshold.
+ */
+InferStatus nms(float iou_threshold, float score_threshold, NmsScratch& scratch,
+                const std::vector<int64_t>& in_dims, const HostBuffer& in_data,
+                std::vector<int64_t>& out_dims, HostBuffer& out_data) {
+  if (in_dims.size() < 2 || in_dims.back() < 5) {
+    return InferStatus(holoinfer_code::H_ERROR,
+                       "Data processor, nms needs detections [..., N, C] with C >= 5");
+  }
+  const size_t columns = in_dims.back();
+  const size_t rows = in_dims[in_dims.size() - 2];
+  if (element_count(in_dims) != rows * columns) {
+    return InferStatus(holoinfer_code::H_ERROR, "Data processor, nms supports a single batch");
+  }
+  const float* in = in_data.data_as<float>();
+
+  auto& candidates = scratch.candidates;
+  candidates.clear();
+  for (size_t row = 0; row < rows; row++) {
+    if (in[row * columns + 4] >= score_threshold) { candidates.push_back(row); }
+  }
+  std::stable_sort(candidates.begin(), candidates.end(), [in, columns](size_t a, size_t b) {
+    return in[a * columns + 4] > in[b * columns + 4];
+  });
+
+  auto& kept = scratch.kept;
+  kept.clear();
+  for (size_t candidate : candidates) {
+    const float* box = in + candidate * columns;
+    bool suppressed = false;
+    for (size_t k : kept) {
+      if (intersection_over_union(box, in + k * columns) > iou_threshold) {
+        suppressed = true;
+        break;
+      }
+    }
+    if (!suppressed) { kept.push_back(candidate); }
+  }
+
+  out_data.resize(kept.size() * columns);
+  float* out = out_data.data_as<float>();
+  for (size_t i = 0; i < kept.size(); i++) {
+    std::copy_n(in + kept[i] * columns, columns, out + i * columns);
+  }
+  out_dims = in_dims;
+  out_dims[out_dims.size() - 2] = static_cast<int64_t>(kept.size());
+  return InferStatus();
+}
+
+/**
+ * Nearest neighbor resize of masks [..., H, W, C] to height x width, or of a single channel mask
+ * [H, W].
+ */
+InferStatus resize_mask(size_t height, size_t width, std::vector<size_t>& source_columns,
+                        const std::vector<int64_t>& in_dims, const HostBuffer& in_data,
+                        std::vector<int64_t>& out_dims, HostBuffer& out_data) {
+  if (in_dims.size() < 2) {
+    return InferStatus(holoinfer_code::H_ERROR,
+                       "Data processor, resize_mask needs masks [H, W] or [..., H, W, C]");
+  }
+  const size_t rank = in_dims.size();
+  const size_t height_dim = rank == 2 ? 0 : rank - 3;
+  const size_t in_height = in_dims[height_dim];
+  const size_t in_width = in_dims[height_dim + 1];
+  const size_t channels = rank == 2 ? 1 : in_dims[rank - 1];
+  const size_t count = element_count(in_dims);
+  if (in_height == 0 || in_width == 0 || channels == 0) {
+    return InferStatus(holoinfer_code::H_ERROR, "Data processor, resize_mask of an empty mask");
+  }
+  const size_t masks = count / (in_height * in_width * channels);
+
+  // Each output pixel samples the input pixel its center falls in
+  source_columns.resize(width);
+  for (size_t x = 0; x < width; x++) {
+    source_columns[x] = std::min(in_width - 1, (2 * x + 1) * in_width / (2 * width)) * channels;
+  }
+  out_data.resize(masks * height * width * channels);
+  const float* in = in_data.data_as<float>();
+  float* out = out_data.data_as<float>();
+  for (size_t mask = 0; mask < masks; mask++) {
+    for (size_t y = 0; y < height; y++) {
+      const size_t source_y = std::min(in_height - 1, (2 * y + 1) * in_height / (2 * height));
+      const float* source_row = in + (mask * in_height + source_y) * in_width * channels;
+      for (size_t x = 0; x < width; x++) {
+        std::copy_n(source_row + source_columns[x], channels, out);
+        out += channels;
+      }
+    }
+  }
+  out_dims = in_dims;
+  out_dims[height_dim] = static_cast<int64_t>(height);
+  out_dims[height_dim + 1] = static_cast<int64_t>(width);
+  return InferStatus();
+}
+
+/// Factory of an operation without arguments
+template <typename Function>
+auto operation_without_arguments(const std::string& name, Function function) {
+  return [name, function](const std::string&, const std::vector<std::string>& args,
+                          ProcessOperation& operation) {
+    if (!args.empty()) { return argument_error(name, "no arguments"); }
+    operation = function;
+    return InferStatus();
+  };
+}
+
+}  // namespace
+
+InferStatus register_process_operation(const std::string& name, ProcessOperationFactory factory) {
+  if (name.empty() || name.find(',') != std::string::npos || !factory) {
+    return InferStatus(holoinfer_code::H_ERROR,
+                       "Data processor, Invalid registration of operation " + name);
+  }
+  std::lock_guard<std::mutex> lock(registry_mutex);
+  registered_operations()[name] = std::move(factory);
+  return InferStatus();
+}
+
+DataProcessor::DataProcessor() {
+  builtin_operations_ = {
+      {"max_per_channel_scaled",
+       operation_without_arguments(
+           "max_per_channel_scaled",
+           [this](auto& in_dims, auto& in_data, auto& out_dims, auto& out_data) {
+             return compute_max_per_channel_cpu(in_dims, in_data, out_dims, out_data);
+           })},
+      {"print",
+       [this](const std::string& tensor_name,
+              const std::vector<std::string>& args,
+              ProcessOperation& operation) {
+         if (!args.empty()) { return argument_error("print", "no arguments"); }
+         operation = [this, tensor_name](auto& in_dims, auto& in_data, auto&, auto&) {
+           std::cout << "Printing results from " << tensor_name << " -> ";
+           print_results(in_dims, in_data);
+           return InferStatus();
+         };
+         return InferStatus();
+       }},
+      {"print_custom_binary_classification",
+       [this](const std::string&, const std::vector<std::string>& args,
+              ProcessOperation& operation) {
+         if (args.size() != 2) {
+           return argument_error("print_custom_binary_classification", "2 strings");
+         }
+         operation = [this, args](auto& in_dims, auto& in_data, auto&, auto&) {
+           print_custom_binary_classification(in_dims, in_data, args);
+           return InferStatus();
+         };
+         return InferStatus();
+       }},
+      {"softmax", operation_without_arguments("softmax", softmax)},
+      {"sigmoid", operation_without_arguments("sigmoid", sigmoid)},
+      {"argmax", operation_without_arguments("argmax", argmax)},
+      {"threshold",
+       [](const std::string&, const std::vector<std::string>& args, ProcessOperation& operation) {
+         float threshold_value = 0.f;
+         if (args.size() != 1 || !parse_argument(args[0], threshold_value)) {
+           return argument_error("threshold", "a threshold value");
+         }
+         operation = [threshold_value](auto& in_dims, auto& in_data, auto& out_dims,
+                                       auto& out_data) {
+           return threshold(threshold_value, in_dims, in_data, out_dims, out_data);
+         };
+         return InferStatus();
+       }},
+      {"top_k",
+       [](const std::string&, const std::vector<std::string>& args, ProcessOperation& operation) {
+         size_t k = 0;
+         if (args.size() != 1 || !parse_argument(args[0], k)) {
+           return argument_error("top_k", "a positive k");
+         }
+         auto indices = std::make_shared<std::vector<size_t>>();
+         operation = [k, indices](auto& in_dims, auto& in_data, auto& out_dims, auto& out_data) {
+           return top_k(k, *indices, in_dims, in_data, out_dims, out_data);
+         };
+         return InferStatus();
+       }},
+      {"nms",
+       [](const std::string&, const std::vector<std::string>& args, ProcessOperation& operation) {
+         float iou_threshold = 0.f;
+         float score_threshold = 0.f;
+         if (args.empty() || args.size() > 2 || !parse_argument(args[0], iou_threshold) ||
+             (args.size() == 2 && !parse_argument(args[1], score_threshold))) {
+           return argument_error("nms", "an IoU threshold and an optional score threshold");
+         }
+         auto scratch = std::make_shared<NmsScratch>();
+         operation = [iou_threshold, score_threshold, scratch](
+                         auto& in_dims, auto& in_data, auto& out_dims, auto& out_data) {
+           return nms(
+               iou_threshold, score_threshold, *scratch, in_dims, in_data, out_dims, out_data);
+         };
+         return InferStatus();
+       }},
+      {"resize_mask",
+       [](const std::string&, const std::vector<std::string>& args, ProcessOperation& operation) {
+         size_t height = 0;
+         size_t width = 0;
+         if (args.size() != 2 || !parse_argument(args[0], height) ||
+             !parse_argument(args[1], width)) {
+           return argument_error("resize_mask", "a height and a width");
+         }
+         auto source_columns = std::make_shared<std::vector<size_t>>();
+         operation = [height, width, source_columns](
+                         auto& in_dims, auto& in_data, auto& out_dims, auto& out_data) {
+           return resize_mask(
+               height, width, *source_columns, in_dims, in_data, out_dims, out_data);
+         };
+         return InferStatus();
+       }}};
+}
+
 InferStatus DataProcessor::initialize(const MultiMappings& process_operations) {
+  chains_.clear();
   for (const auto& p_op : process_operations) {
-    auto _operations = p_op.second;
-    if (_operations.size() == 0) {
+    if (p_op.second.size() == 0) {
       return InferStatus(holoinfer_code::H_ERROR,
                          "Data processor, Empty operation list for tensor " + p_op.first);
     }
 
-    for (const auto& _op : _operations) {
-      if (_op.find("print") == std::string::npos) {
-        if (supported_operations_.find(_op) == supported_operations_.end()) {
-          return InferStatus(holoinfer_code::H_ERROR,
-                             "Data processor, Operation " + _op + " not supported.");
+    OperationChain chain;
+    chain.tensor_name = p_op.first;
+    for (const auto& _op : p_op.second) {
+      auto tokens = split_operation(_op);
+      const std::string name = tokens[0];
+      tokens.erase(tokens.begin());
+
+      ProcessOperationFactory registered_factory;
+      {
+        std::lock_guard<std::mutex> lock(registry_mutex);
+        auto registered = registered_operations().find(name);
+        if (registered != registered_operations().end()) {
+          registered_factory = registered->second;
         }
-      } else {
-        if ((_op.compare("print") != 0) &&
-            (_op.find("print_custom_binary_classification") == std::string::npos)) {
+      }
+
+      ProcessOperation operation;
+      InferStatus status;
+      try {
+        if (registered_factory) {
+          status = registered_factory(tokens, operation);
+        } else if (builtin_operations_.find(name) != builtin_operations_.end()) {
+          status = builtin_operations_.at(name)(chain.tensor_name, tokens, operation);
+        } else {
           return InferStatus(holoinfer_code::H_ERROR,
-                             "Data processor, Print operation: " + _op + " not supported.");
+                             "Data processor, Operation " + name + " not supported.");
         }
+      } catch (const std::exception& e) {
+        return InferStatus(holoinfer_code::H_ERROR,
+                           "Data processor, Exception in compiling " + name + ", " + e.what());
+      } catch (...) {
+        return InferStatus(holoinfer_code::H_ERROR,
+                           "Data processor, Exception in compiling " + name);
+      }
+      if (status.get_code() != holoinfer_code::H_SUCCESS) { return status; }
+      if (!operation) {
+        return InferStatus(holoinfer_code::H_ERROR,
+                           "Data processor, Operation " + name + " has no function");
       }
+      chain.names.push_back(name);
+      chain.operations.push_back(std::move(operation));
+    }
+    chains_.push_back(std::move(chain));
+  }
+  return InferStatus();
+}
+
+InferStatus DataProcessor::process_operations(size_t index, const std::string& tensor_name,
+                                              const std::vector<int>& in_dims,
+                                              const HostBuffer& in_data,
+                                              std::vector<int64_t>& out_dims,
+                                              HostBuffer& out_data) {
+  if (index >= chains_.size() || chains_[index].tensor_name != tensor_name) {
+    return InferStatus(holoinfer_code::H_ERROR,
+                       "Data processor, Operations of tensor " + tensor_name +
+                           " differ from the initialized ones");
+  }
+  auto& chain = chains_[index];
+  chain.in_dims.assign(in_dims.begin(), in_dims.end());
+  if (in_data.get_datatype() != holoinfer_datatype::hFloat ||
+      in_data.size() < element_count(chain.in_dims)) {
+    return InferStatus(holoinfer_code::H_ERROR,
+                       "Data processor, Input of " + tensor_name +
+                           " is not float32 data of its dimensions");
+  }
+
+  // Operations write their output alternately to the two buffers of the chain, and the last one
+  // directly to the output. Operations without output leave the input of the next operation
+  // unchanged.
+  const HostBuffer* input = &in_data;
+  const std::vector<int64_t>* input_dims = &chain.in_dims;
+  size_t next = 0;
+  bool has_output = false;
+  out_dims.clear();
+  for (size_t i = 0; i < chain.operations.size(); i++) {
+    const bool is_last = i + 1 == chain.operations.size();
+    auto& dims = is_last ? out_dims : chain.dims[next];
+    auto& buffer = is_last ? out_data : chain.buffers[next];
+    dims.clear();
+    InferStatus status;
+    try {
+      status = chain.operations[i](*input_dims, *input, dims, buffer);
+    } catch (const std::exception& e) {
+      return InferStatus(holoinfer_code::H_ERROR,
+                         "Data processor, Exception in running " + chain.names[i] + ", " +
+                             e.what());
     }
+    if (status.get_code() != holoinfer_code::H_SUCCESS) { return status; }
+    if (dims.empty()) { continue; }
+
+    if (buffer.get_datatype() != holoinfer_datatype::hFloat ||
+        buffer.size() < element_count(dims)) {
+      return InferStatus(holoinfer_code::H_ERROR,
+                         "Data processor, Output of " + chain.names[i] +
+                             " is not float32 data of its dimensions");
+    }
+    if (is_last) { return InferStatus(); }
+    input = &buffer;
+    input_dims = &dims;
+    next = 1 - next;
+    has_output = true;
+  }
+
+  // The last operation has no output, the output is the one of the last operation with output
+  if (has_output) {
+    out_dims = *input_dims;
+    const size_t count = element_count(out_dims);
+    out_data.resize(count);
+    std::copy_n(input->data_as<float>(), count, out_data.data_as<float>());
   }
   return InferStatus();
 }
 
-void DataProcessor::print_results(const std::vector<int>& dimensions,
-                                  const std::vector<float>& indata) {
-  size_t dsize = indata.size();
+void DataProcessor::print_results(const std::vector<int64_t>& dimensions,
+                                  const HostBuffer& in_data) {
+  const float* indata = in_data.data_as<float>();
+  size_t dsize = element_count(dimensions);
+  if (dsize == 0) { return; }
 
-  for (unsigned int i = 0; i < dsize - 1; i++) { std::cout << indata.at(i) << ", "; }
+  for (unsigned int i = 0; i < dsize - 1; i++) { std::cout << indata[i] << ", "; }
   std::cout << indata[dsize - 1] << "\n";
 }
 
 void DataProcessor::print_custom_binary_classification(
-    const std::vector<int>& dimensions, const std::vector<float>& indata,
+    const std::vector<int64_t>& dimensions, const HostBuffer& in_data,
     const std::vector<std::string>& custom_strings) {
-  size_t dsize = indata.size();
+  const float* indata = in_data.data_as<float>();
+  size_t dsize = element_count(dimensions);
 
   if (dsize == 2) {
-    auto first_value = 1.0 / (1 + exp(-indata.at(0)));
-    auto second_value = 1.0 / (1 + exp(-indata.at(1)));
+    auto first_value = 1.0 / (1 + exp(-indata[0]));
+    auto second_value = 1.0 / (1 + exp(-indata[1]));
 
     if (first_value > second_value) {
       std::cout << custom_strings[0] << ". Confidence: " << first_value << "\n";
@@ -73,65 +585,114 @@ void DataProcessor::print_custom_binary_classification(
   }
 }
 
-void DataProcessor::compute_max_per_channel_cpu(const std::vector<int>& dimensions,
-                                                const std::vector<float>& outvector,
-                                                std::vector<int64_t>& processed_dims,
-                                                std::vector<float>& processed_data) {
+void DataProcessor::max_per_channel(const float* data, size_t channels, size_t first_pixel,
+                                    size_t last_pixel, ChannelMax* result) {
+  auto update = [result](size_t c, float value, size_t pixel) {
+    if (value > result[c].value || (value == result[c].value && pixel < result[c].pixel)) {
+      result[c] = {value, pixel};
+    }
+  };
+
+  // Pixels are processed in blocks, lane l of a block tracking channel l % channels of pixel
+  // l / channels. The branchless loop over the lanes of a block is vectorized by the compiler.
+  size_t pixel = first_pixel;
+  if (channels <= kMaxPerChannelLanes) {
+    const size_t block_pixels = kMaxPerChannelLanes / channels;
+    const size_t lanes = block_pixels * channels;
+    const size_t blocks = (last_pixel - first_pixel) / block_pixels;
+
+    float lane_max[kMaxPerChannelLanes];
+    int32_t lane_block[kMaxPerChannelLanes];
+    std::fill_n(lane_max, lanes, -std::numeric_limits<float>::infinity());
+    std::fill_n(lane_block, lanes, 0);
+
+    const float* block_data = data + first_pixel * channels;
+    for (int32_t block = 0; block < static_cast<int32_t>(blocks); block++, block_data += lanes) {
+      for (size_t l = 0; l < lanes; l++) {
+        // selection with a mask, a conditional move is not vectorized
+        const float value = block_data[l];
+        const int32_t greater = -static_cast<int32_t>(value > lane_max[l]);
+        lane_max[l] = greater ? value : lane_max[l];
+        lane_block[l] = (block & greater) | (lane_block[l] & ~greater);
+      }
+    }
+    for (size_t l = 0; l < lanes && blocks > 0; l++) {
+      update(l % channels, lane_max[l], first_pixel + lane_block[l] * block_pixels + l / channels);
+    }
+    pixel += blocks * block_pixels;
+  }
+
+  for (; pixel < last_pixel; pixel++) {
+    const float* pixel_data = data + pixel * channels;
+    for (size_t c = 0; c < channels; c++) { update(c, pixel_data[c], pixel); }
+  }
+}
+
+void DataProcessor::max_per_channel_task(size_t task) {
+  const auto& job = max_per_channel_job_;
+  const size_t first_row = job.rows * task / job.task_count;
+  const size_t last_row = job.rows * (task + 1) / job.task_count;
+
+  auto& result = max_per_task_[task];
+  result.assign(job.channels, {-std::numeric_limits<float>::infinity(), 0});
+  max_per_channel(
+      job.data, job.channels, first_row * job.cols, last_row * job.cols, result.data());
+}
+
+
+InferStatus DataProcessor::compute_max_per_channel_cpu(const std::vector<int64_t>& dimensions,
+                                                       const HostBuffer& in_data,
+                                                       std::vector<int64_t>& processed_dims,
+                                                       HostBuffer& processed_data) {
   // Assuming NHWC format, TODO:: Generalize:: SD
+  if (dimensions.size() != 4) {
+    return InferStatus(holoinfer_code::H_ERROR,
+                       "Data processor, max_per_channel_scaled needs NHWC data");
+  }
   const size_t rows = dimensions[1];
   const size_t cols = dimensions[2];
   const size_t out_channels = dimensions[3];
 
-  const float* out_result = outvector.data();
-  std::vector<unsigned int> max_x_per_channel, max_y_per_channel;
-
-  max_x_per_channel.resize(out_channels, 0);
-  max_y_per_channel.resize(out_channels, 0);
-  std::vector<float> maxV(out_channels, -1999);
-
-  for (unsigned int i = 0; i < rows; i++) {
-    for (unsigned int j = 0; j < cols; j++) {
-      for (unsigned int c = 1; c < out_channels; c++) {
-        unsigned int index = i * cols * out_channels + j * out_channels + c;
-        float v1 = out_result[index];
-        if (maxV[c] < v1) {
-          maxV[c] = v1;
-          max_x_per_channel[c] = i;
-          max_y_per_channel[c] = j;
+  const bool parallel = rows * cols * out_channels >= kParallelMinElements;
+  if (parallel && !worker_pool_) {
+    const size_t worker_count =
+        std::min<size_t>(std::thread::hardware_concurrency(), kMaxWorkers);
+    if (worker_count > 1) {
+      max_per_task_.resize(worker_count);
+      worker_pool_ = std::make_unique<WorkerPool>(
+          worker_count, worker_count, [this](size_t task) { max_per_channel_task(task); });
+    }
+  }
+
+  auto& max_per_channel_result = max_per_task_[0];
+  if (parallel && worker_pool_) {
+    max_per_channel_job_ = {
+        in_data.data_as<float>(), rows, cols, out_channels, worker_pool_->worker_count()};
+    worker_pool_->run();
+    // Tasks cover increasing rows, the first task with the max has its first location
+    for (size_t task = 1; task < max_per_channel_job_.task_count; task++) {
+      for (size_t c = 0; c < out_channels; c++) {
+        if (max_per_task_[task][c].value > max_per_channel_result[c].value) {
+          max_per_channel_result[c] = max_per_task_[task][c];
         }
       }
     }
+  } else {
+    max_per_channel_job_ = {in_data.data_as<float>(), rows, cols, out_channels, 1};
+    max_per_channel_task(0);
   }
 
+  processed_data.resize(2 * out_channels);
+  float* out = processed_data.data_as<float>();
   for (unsigned int i = 0; i < out_channels; i++) {
-    processed_data[2 * i] = static_cast<float>(max_x_per_channel[i]) / static_cast<float>(rows);
-    processed_data[2 * i + 1] = static_cast<float>(max_y_per_channel[i]) / static_cast<float>(cols);
+    // the first channel is not searched, its location is the origin
+    const size_t pixel = i == 0 ? 0 : max_per_channel_result[i].pixel;
+    out[2 * i] = static_cast<float>(pixel / cols) / static_cast<float>(rows);
+    out[2 * i + 1] = static_cast<float>(pixel % cols) / static_cast<float>(cols);
   }
 
   processed_dims.push_back(1);  // CHECK: if disabled, get_data_from_tensor fails.
   processed_dims.push_back(static_cast<int64_t>(2 * out_channels));
-  max_x_per_channel.clear();
-  max_y_per_channel.clear();
-}
-
-InferStatus DataProcessor::process_operation(const std::string& operation,
-                                             const std::vector<int>& indims,
-                                             const std::vector<float>& indata,
-                                             std::vector<int64_t>& processed_dims,
-                                             std::vector<float>& processed_data,
-                                             const std::vector<std::string>& custom_strings) {
-  if (oper_to_fp_.find(operation) == oper_to_fp_.end())
-    return InferStatus(holoinfer_code::H_ERROR,
-                       "Data processor, Operation " + operation + " not found in map");
-  try {
-    oper_to_fp_.at(operation)(indims, indata, processed_dims, processed_data, custom_strings);
-  } catch (...) {
-    return InferStatus(holoinfer_code::H_ERROR,
-                       "Data processor, Exception in running " + operation);
-  }
-  if (operation.find("print") == std::string::npos && processed_data.size() == 0) {
-    return InferStatus(holoinfer_code::H_ERROR, "Data processor, Processed data map empty");
-  }
   return InferStatus();
 }
 
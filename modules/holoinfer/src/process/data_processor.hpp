@@ -22,32 +22,31 @@
 #include <functional>
 #include <iostream>
 #include <map>
+#include <memory>
 #include <sstream>
 #include <string>
 #include <vector>
 
 #include <holoinfer.hpp>
+#include <holoinfer_buffer.hpp>
+#include <manager/worker_pool.hpp>
 
 namespace holoscan {
 namespace inference {
-/// Declaration of function callback used by DataProcessor
-using processor_FP =
-    std::function<void(const std::vector<int>&, const std::vector<float>&, std::vector<int64_t>&,
-                       std::vector<float>&, const std::vector<std::string>&)>;
-
 /**
- * @brief Data Processor class that processes one operations per tensor. Currently supports CPU
- * based single operation.
+ * @brief Data Processor class that runs a chain of operations per tensor. Operations are compiled
+ * once at initialization, from the registered and the built-in (CPU based) operations.
  */
 class DataProcessor {
  public:
   /**
    * @brief Default Constructor
    */
-  DataProcessor() {}
+  DataProcessor();
 
   /**
-   * @brief Checks the validity of supported operations
+   * @brief Compiles the operations of each tensor into a chain. An operation is "name" or
+   * "name,arg1,arg2", its arguments being parsed here once.
    *
    * @param process_operations Map where tensor name is the key, and operations to perform on
    * the tensor as vector of strings. Each value in the vector of strings is the supported
@@ -58,33 +57,35 @@ class DataProcessor {
   InferStatus initialize(const MultiMappings& process_operations);
 
   /**
-   * @brief Executes an operation via function callback. (Currently CPU based)
+   * @brief Runs the chain of operations of a tensor, each operation reading the output of the
+   * previous one.
    *
-   * @param operation Operation to perform. Refer to user docs for a list of supported operations
+   * @param index Index of the tensor in the process operations given at initialization
+   * @param tensor_name Name of the tensor, must be the one at index
    * @param in_dims Dimension of the input tensor
-   * @param in_data Input data buffer
-   * @param out_dims Dimension of the output tensor
-   * @param out_data Output data buffer
-   * @param custom_strings Strings to display for custom print operations
+   * @param in_data Input data buffer of float32, read in place
+   * @param out_dims Dimension of the output tensor, empty if no operation generates output
+   * @param out_data Output data buffer, updated with the output of the last operation
    * @returns InferStatus with appropriate code and message
    */
-  InferStatus process_operation(const std::string& operation, const std::vector<int>& in_dims,
-                                const std::vector<float>& in_data, std::vector<int64_t>& out_dims,
-                                std::vector<float>& out_data,
-                                const std::vector<std::string>& custom_strings);
+  InferStatus process_operations(size_t index, const std::string& tensor_name,
+                                 const std::vector<int>& in_dims, const HostBuffer& in_data,
+                                 std::vector<int64_t>& out_dims, HostBuffer& out_data);
 
   /**
-   * @brief Computes max per channel in input data and scales it to [0, 1]. (CPU based)
+   * @brief Computes the location of the max per channel in NHWC input data, scaled to [0, 1].
+   * (CPU based) The first location of the max is reported, the first channel is not searched.
+   * Large inputs are split by rows across worker threads.
    *
-   * @param operation Operation to perform. Refer to user docs for a list of supported operations
    * @param in_dims Dimension of the input tensor
    * @param in_data Input data buffer
    * @param out_dims Dimension of the output tensor
-   * @param out_data Output data buffer
+   * @param out_data Output data buffer, holding 2 values per channel
+   * @returns InferStatus with appropriate code and message
    */
-  void compute_max_per_channel_cpu(const std::vector<int>& in_dims,
-                                   const std::vector<float>& in_data,
-                                   std::vector<int64_t>& out_dims, std::vector<float>& out_data);
+  InferStatus compute_max_per_channel_cpu(const std::vector<int64_t>& in_dims,
+                                          const HostBuffer& in_data,
+                                          std::vector<int64_t>& out_dims, HostBuffer& out_data);
 
   /**
    * @brief Print data in the input buffer. Ideally to be used by classification models.
@@ -92,7 +93,7 @@ class DataProcessor {
    * @param in_dims Dimension of the input tensor
    * @param in_data Input data buffer
    */
-  void print_results(const std::vector<int>& in_dims, const std::vector<float>& in_data);
+  void print_results(const std::vector<int64_t>& in_dims, const HostBuffer& in_data);
 
   /**
    * @brief Print custom text for binary classification results in the input buffer.
@@ -101,42 +102,63 @@ class DataProcessor {
    * @param in_data Input data buffer
    * @param custom_strings Strings to display for custom print operations
    */
-  void print_custom_binary_classification(const std::vector<int>& in_dims,
-                                          const std::vector<float>& in_data,
+  void print_custom_binary_classification(const std::vector<int64_t>& in_dims,
+                                          const HostBuffer& in_data,
                                           const std::vector<std::string>& custom_strings);
 
  private:
-  /// Map defining supported operations by DataProcessor Class.
-  /// Keyword in this map must be used exactly by the user in configuration.
-  /// Operation is the key and its related implementation platform as the value.
-  const std::map<std::string, holoinfer_data_processor> supported_operations_{
-      {"max_per_channel_scaled", holoinfer_data_processor::HOST},
-      {"print", holoinfer_data_processor::HOST},
-      {"print_custom_binary_classification", holoinfer_data_processor::HOST}};
-
-  /// Mapped function call for the function pointer of max_per_channel_scaled
-  processor_FP max_per_channel_scaled_fp_ = [this](auto& in_dims, auto& in_data, auto& out_dims,
-                                                   auto& out_data, auto& custom_strings) {
-    compute_max_per_channel_cpu(in_dims, in_data, out_dims, out_data);
+  /// Compiled operations of a tensor, with the buffers holding their intermediate results
+  struct OperationChain {
+    std::string tensor_name;
+    std::vector<std::string> names;
+    std::vector<ProcessOperation> operations;
+    std::vector<int64_t> in_dims;
+    std::vector<int64_t> dims[2];
+    HostBuffer buffers[2];
   };
 
-  /// Mapped function call for the function pointer of print
-  processor_FP print_results_fp_ = [this](auto& in_dims, auto& in_data, auto& out_dims,
-                                          auto& out_data, auto& custom_strings) {
-    print_results(in_dims, in_data);
+  /// Operation chains, in the order of the tensors given at initialization
+  std::vector<OperationChain> chains_;
+
+  /// Max value of a channel and the first pixel it was found at
+  struct ChannelMax {
+    float value;
+    size_t pixel;
   };
 
-  /// Mapped function call for the function pointer of printing custom binary classification results
-  processor_FP print_custom_binary_classification_fp_ =
-      [this](auto& in_dims, auto& in_data, auto& out_dims, auto& out_data, auto& custom_strings) {
-        print_custom_binary_classification(in_dims, in_data, custom_strings);
-      };
-
-  /// Map with supported operation as the key and related function pointer as value
-  const std::map<std::string, processor_FP> oper_to_fp_{
-      {"max_per_channel_scaled", max_per_channel_scaled_fp_},
-      {"print", print_results_fp_},
-      {"print_custom_binary_classification", print_custom_binary_classification_fp_}};
+  /**
+   * Updates the max per channel with pixels [first_pixel, last_pixel) of interleaved data,
+   * preferring the lower pixel for equal values.
+   */
+  static void max_per_channel(const float* data, size_t channels, size_t first_pixel,
+                              size_t last_pixel, ChannelMax* result);
+
+  /// Computes the max per channel of the rows of a task of the current max per channel job
+  void max_per_channel_task(size_t task);
+
+  /// Input of the max per channel job run by the worker pool
+  struct MaxPerChannelJob {
+    const float* data = nullptr;
+    size_t rows = 0;
+    size_t cols = 0;
+    size_t channels = 0;
+    size_t task_count = 1;
+  } max_per_channel_job_;
+
+  /// Max per channel of each task, merged into the first one after a run of the worker pool
+  std::vector<std::vector<ChannelMax>> max_per_task_{1};
+
+  /// Worker threads of the max per channel, created for the first large input
+  std::unique_ptr<WorkerPool> worker_pool_;
+
+  /// Factory of a built-in operation, given the name of the tensor it processes
+  using BuiltinOperationFactory =
+      std::function<InferStatus(const std::string& tensor_name,
+                                const std::vector<std::string>& args, ProcessOperation& operation)>;
+
+  /// Built-in operations, with the operation name as the key and its factory as the value.
+  /// Keyword in this map must be used exactly by the user in configuration.
+  std::map<std::string, BuiltinOperationFactory> builtin_operations_;
 };
 
 }  // namespace inference
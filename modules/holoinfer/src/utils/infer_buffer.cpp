@@ -17,24 +17,101 @@
 
 #include <holoinfer_buffer.hpp>
 
+#include <cstring>
+
 namespace holoscan {
 namespace inference {
 
 /*
  * @brief Get the element size
  *
- * @param element_type Input data type. Float32 is the only supported element type.
+ * @param element_type Input data type
  *
- * @returns Bytes used in storing element type
+ * @returns Bytes used in storing element type, 0 for an unsupported type
  */
 uint32_t get_element_size(holoinfer_datatype element_type) noexcept {
   switch (element_type) {
     case holoinfer_datatype::hFloat:
+    case holoinfer_datatype::hInt32:
       return 4;
+    case holoinfer_datatype::hFloat16:
+      return 2;
+    case holoinfer_datatype::hUInt8:
+    case holoinfer_datatype::hInt8:
+      return 1;
+    case holoinfer_datatype::hInt64:
+      return 8;
+    case holoinfer_datatype::hUnsupported:
+      return 0;
   }
   return 0;
 }
 
+std::string get_datatype_name(holoinfer_datatype element_type) {
+  switch (element_type) {
+    case holoinfer_datatype::hFloat:
+      return "float32";
+    case holoinfer_datatype::hFloat16:
+      return "float16";
+    case holoinfer_datatype::hUInt8:
+      return "uint8";
+    case holoinfer_datatype::hInt8:
+      return "int8";
+    case holoinfer_datatype::hInt32:
+      return "int32";
+    case holoinfer_datatype::hInt64:
+      return "int64";
+    case holoinfer_datatype::hUnsupported:
+      break;
+  }
+  return "unsupported";
+}
+
+InferStatus normalize_uint8_to_float(const uint8_t* in, float* out, size_t count,
+                                     const std::vector<float>& mean,
+                                     const std::vector<float>& std_dev) {
+  // The per channel scale and offset are repeated over a period that is a multiple of the
+  // channels, so that the inner loop reads them contiguously and is vectorized by the compiler.
+  constexpr size_t kMaxChannels = 16;
+  constexpr size_t kRepeat = 16;
+  const size_t channels = mean.size();
+  if (channels == 0 || channels > kMaxChannels || std_dev.size() != channels) {
+    return InferStatus(holoinfer_code::H_ERROR,
+                       "Normalization, mean and std_dev must have the same size, between 1 and " +
+                           std::to_string(kMaxChannels));
+  }
+  if (count % channels != 0) {
+    return InferStatus(holoinfer_code::H_ERROR,
+                       "Normalization, element count is not a multiple of the channels");
+  }
+
+  const size_t period = channels * kRepeat;
+  float scale[kMaxChannels * kRepeat];
+  float offset[kMaxChannels * kRepeat];
+  for (size_t c = 0; c < channels; c++) {
+    if (std_dev[c] == 0.f) {
+      return InferStatus(holoinfer_code::H_ERROR, "Normalization, std_dev must not be zero");
+    }
+    for (size_t r = 0; r < kRepeat; r++) {
+      scale[r * channels + c] = 1.f / std_dev[c];
+      offset[r * channels + c] = -mean[c] / std_dev[c];
+    }
+  }
+
+  size_t i = 0;
+  for (; i + period <= count; i += period) {
+    const uint8_t* block_in = in + i;
+    float* block_out = out + i;
+    for (size_t j = 0; j < period; j++) {
+      block_out[j] = static_cast<float>(block_in[j]) * scale[j] + offset[j];
+    }
+  }
+  for (size_t j = 0; i < count; i++, j++) {
+    out[i] = static_cast<float>(in[i]) * scale[j] + offset[j];
+  }
+  return InferStatus();
+}
+
 /*
  * @brief Allocate buffer on host and device
  *
@@ -42,13 +119,14 @@ uint32_t get_element_size(holoinfer_datatype element_type) noexcept {
  * is populated in this function.
  * @param dims Dimension of the allocation
  * @param keyname Storage name in the map against the created DataBuffer
+ * @param type Data type of the buffers
  * @returns InferStatus with appropriate code and message
  */
 InferStatus allocate_host_device_buffers(DataMap& buffers, std::vector<int64_t>& dims,
-                                         const std::string& keyname) {
+                                         const std::string& keyname, holoinfer_datatype type) {
   size_t buffer_size = accumulate(dims.begin(), dims.end(), 1, std::multiplies<size_t>());
 
-  auto data_buffer = std::make_shared<DataBuffer>();
+  auto data_buffer = std::make_shared<DataBuffer>(type);
   data_buffer->host_buffer.resize(buffer_size);
   data_buffer->device_buffer->resize(buffer_size);
 
@@ -64,19 +142,41 @@ InferStatus allocate_host_device_buffers(DataMap& buffers, std::vector<int64_t>&
  * is populated in this function.
  * @param dims Dimension of the allocation
  * @param keyname Storage name in the map against the created DataBuffer
+ * @param type Data type of the buffers
  * @returns InferStatus with appropriate code and message
  */
 InferStatus allocate_host_buffers(DataMap& buffers, std::vector<int64_t>& dims,
-                                  const std::string& keyname) {
+                                  const std::string& keyname, holoinfer_datatype type) {
   size_t buffer_size = accumulate(dims.begin(), dims.end(), 1, std::multiplies<size_t>());
 
-  auto data_buffer = std::make_shared<DataBuffer>();
+  auto data_buffer = std::make_shared<DataBuffer>(type);
   data_buffer->host_buffer.resize(buffer_size);
 
   buffers.insert({keyname, std::move(data_buffer)});
   return InferStatus();
 }
 
+InferStatus update_host_buffer(DataBuffer& buffer, void* data, holoinfer_datatype type,
+                               size_t count, bool alias, const std::vector<float>& mean,
+                               const std::vector<float>& std_dev) {
+  const bool normalize = type == holoinfer_datatype::hUInt8 && !mean.empty();
+  const auto buffer_type = normalize ? holoinfer_datatype::hFloat : type;
+  if (buffer.get_datatype() != buffer_type) { buffer.set_datatype(buffer_type); }
+
+  if (normalize) {
+    buffer.host_buffer.resize(count);
+    return normalize_uint8_to_float(static_cast<const uint8_t*>(data),
+                                    buffer.host_buffer.data_as<float>(), count, mean, std_dev);
+  }
+  if (alias) {
+    buffer.host_buffer.set_external(data, count);
+    return InferStatus();
+  }
+  buffer.host_buffer.resize(count);
+  if (count > 0) { std::memcpy(buffer.host_buffer.data(), data, buffer.host_buffer.get_bytes()); }
+  return InferStatus();
+}
+
 bool DeviceAllocator::operator()(void** ptr, size_t size) const {
   return cudaMalloc(ptr, size) == cudaSuccess;
 }
@@ -85,16 +185,76 @@ void DeviceFree::operator()(void* ptr) const {
   cudaFree(ptr);
 }
 
-DataBuffer::DataBuffer() {
-  device_buffer = std::make_shared<DeviceBuffer>();
+DataBuffer::DataBuffer(holoinfer_datatype type) : host_buffer(type) {
+  device_buffer = std::make_shared<DeviceBuffer>(type);
+}
+
+void DataBuffer::set_datatype(holoinfer_datatype type) {
+  host_buffer.set_datatype(type);
+  device_buffer->set_datatype(type);
+}
+
+HostBuffer::HostBuffer(holoinfer_datatype type) : type_(type) {}
+
+void* HostBuffer::data() {
+  return external_ != nullptr ? external_ : buffer_.get();
+}
+
+const void* HostBuffer::data() const {
+  return external_ != nullptr ? external_ : buffer_.get();
+}
+
+size_t HostBuffer::size() const {
+  return size_;
+}
+
+size_t HostBuffer::get_bytes() const {
+  return size_ * get_element_size(type_);
+}
+
+void HostBuffer::resize(size_t number_of_elements) {
+  const size_t kept_bytes = get_bytes();
+  size_ = number_of_elements;
+  reserve(get_bytes(), kept_bytes);
+}
+
+void HostBuffer::set_external(void* data, size_t number_of_elements) {
+  external_ = data;
+  size_ = number_of_elements;
+}
+
+holoinfer_datatype HostBuffer::get_datatype() const {
+  return type_;
+}
+
+void HostBuffer::set_datatype(holoinfer_datatype type) {
+  const size_t kept_bytes = get_bytes();
+  type_ = type;
+  reserve(get_bytes(), kept_bytes);
+}
+
+void HostBuffer::reserve(size_t bytes, size_t kept_bytes) {
+  // External memory may not be valid anymore, its elements are dropped
+  if (external_ != nullptr) {
+    external_ = nullptr;
+    kept_bytes = 0;
+  }
+  if (bytes <= capacity_) { return; }
+
+  // Not value initialized, the steady state of a reused buffer neither allocates nor zero fills
+  std::unique_ptr<uint8_t[]> buffer(new uint8_t[bytes]);
+  kept_bytes = std::min(kept_bytes, capacity_);
+  if (kept_bytes > 0) { std::memcpy(buffer.get(), buffer_.get(), kept_bytes); }
+  buffer_ = std::move(buffer);
+  capacity_ = bytes;
 }
 
 DeviceBuffer::DeviceBuffer(holoinfer_datatype type)
     : size_(0), capacity_(0), type_(type), buffer_(nullptr) {}
 
 DeviceBuffer::DeviceBuffer(size_t size, holoinfer_datatype type)
-    : size_(size), capacity_(size), type_(type) {
-  if (!allocator_(&buffer_, this->get_bytes())) { throw std::bad_alloc(); }
+    : size_(size), capacity_(size * get_element_size(type)), type_(type) {
+  if (!allocator_(&buffer_, capacity_)) { throw std::bad_alloc(); }
 }
 
 void* DeviceBuffer::data() {
@@ -111,13 +271,24 @@ size_t DeviceBuffer::get_bytes() const {
 
 void DeviceBuffer::resize(size_t element_size) {
   size_ = element_size;
-  if (capacity_ < element_size) {
+  if (capacity_ < this->get_bytes()) {
     free_(buffer_);
+    buffer_ = nullptr;
+    capacity_ = 0;
     if (!allocator_(&buffer_, this->get_bytes())) { throw std::bad_alloc{}; }
-    capacity_ = element_size;
+    capacity_ = this->get_bytes();
   }
 }
 
+holoinfer_datatype DeviceBuffer::get_datatype() const {
+  return type_;
+}
+
+void DeviceBuffer::set_datatype(holoinfer_datatype type) {
+  type_ = type;
+  resize(size_);
+}
+
 DeviceBuffer::~DeviceBuffer() {
   free_(buffer_);
 }
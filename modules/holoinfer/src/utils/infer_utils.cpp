@@ -65,19 +65,25 @@ InferStatus map_data_to_model_from_tensor(const MultiMappings& model_data_mappin
     return status;
   }
   for (auto& md_mapping : model_data_mapping) {
-    if (md_mapping.second.size() != 1) {
-      status.set_message("Entry in model data mapping must be of size 1.");
+    if (md_mapping.second.empty()) {
+      status.set_message("Entry in model data mapping cannot be empty.");
       return status;
     }
-    auto tensor_name = md_mapping.second[0];
 
-    if (data_per_input_tensor.find(tensor_name) == data_per_input_tensor.end()) {
-      status.set_message("Tensor " + tensor_name + " missing in data_per_input_tensor.");
-      return status;
+    for (const auto& tensor_name : md_mapping.second) {
+      if (data_per_input_tensor.find(tensor_name) == data_per_input_tensor.end()) {
+        status.set_message("Tensor " + tensor_name + " missing in data_per_input_tensor.");
+        return status;
+      }
     }
 
-    if (data_per_model.find(md_mapping.first) == data_per_model.end()) {
-      data_per_model.insert({md_mapping.first, data_per_input_tensor.at(tensor_name)});
+    // Models with several inputs read them by tensor name
+    if (md_mapping.second.size() > 1) {
+      for (const auto& tensor_name : md_mapping.second) {
+        data_per_model[tensor_name] = data_per_input_tensor.at(tensor_name);
+      }
+    } else if (data_per_model.find(md_mapping.first) == data_per_model.end()) {
+      data_per_model.insert({md_mapping.first, data_per_input_tensor.at(md_mapping.second[0])});
     }
   }
   return InferStatus();
@@ -159,10 +165,11 @@ gxf_result_t multiai_get_data_per_model(const GXFReceivers& receivers,
       dims_per_tensor[in_tensors[i]] = std::move(dims);
 
       if (to == nvidia::gxf::MemoryStorageType::kHost) {
-        std::vector<float> in_tensor_ptr(buffer_size, 0);
+        auto& host_buffer = data_per_input_tensor.at(in_tensors[i])->host_buffer;
+        host_buffer.resize(buffer_size);
 
         if (storage_type == nvidia::gxf::MemoryStorageType::kDevice) {
-          cudaError_t cuda_result = cudaMemcpy(static_cast<void*>(in_tensor_ptr.data()),
+          cudaError_t cuda_result = cudaMemcpy(host_buffer.data(),
                                                static_cast<const void*>(in_tensor_data),
                                                buffer_size * sizeof(float),
                                                cudaMemcpyDeviceToHost);
@@ -173,11 +180,10 @@ gxf_result_t multiai_get_data_per_model(const GXFReceivers& receivers,
           }
 
         } else if (storage_type == nvidia::gxf::MemoryStorageType::kHost) {
-          memcpy(in_tensor_ptr.data(),
+          memcpy(host_buffer.data(),
                  static_cast<float*>(in_tensor_data),
                  buffer_size * sizeof(float));
         }
-        data_per_input_tensor.at(in_tensors[i])->host_buffer = std::move(in_tensor_ptr);
 
       } else {
         if (to == nvidia::gxf::MemoryStorageType::kDevice) {
@@ -392,16 +398,16 @@ InferStatus check_multi_mappings_size_value(const MultiMappings& input_map,
     return status;
   } else {
     for (const auto& map_data : input_map) {
-      // Only 1 Tensor supported per model as MultiMappings input
-      if (map_data.second.size() != 1) {
-        status.set_message(type_of_map + ": 1 tensor per model supported. Found: " +
-                           std::to_string(map_data.second.size()));
+      if (map_data.second.empty()) {
+        status.set_message(type_of_map + ": At least 1 tensor per model required.");
+        return status;
+      }
+      if (map_data.first.empty() ||
+          std::any_of(map_data.second.begin(), map_data.second.end(), [](const std::string& v) {
+            return v.empty();
+          })) {
+        status.set_message("Empty entry for key or value in " + type_of_map);
         return status;
-      } else {
-        if (map_data.first.empty() || map_data.second[0].empty()) {
-          status.set_message("Empty entry for key or value in " + type_of_map);
-          return status;
-        }
       }
     }
   }
@@ -431,6 +437,19 @@ InferStatus multiai_inference_validity_check(const Mappings& model_path_map,
                                              const Mappings& inference_map,
                                              const std::vector<std::string>& in_tensor_names,
                                              const std::vector<std::string>& out_tensor_names) {
+  MultiMappings inference_multi_map;
+  for (const auto& inference : inference_map) {
+    inference_multi_map[inference.first] = {inference.second};
+  }
+  return multiai_inference_validity_check(
+      model_path_map, pre_processor_map, inference_multi_map, in_tensor_names, out_tensor_names);
+}
+
+InferStatus multiai_inference_validity_check(const Mappings& model_path_map,
+                                             const MultiMappings& pre_processor_map,
+                                             const MultiMappings& inference_map,
+                                             const std::vector<std::string>& in_tensor_names,
+                                             const std::vector<std::string>& out_tensor_names) {
   InferStatus status = InferStatus(holoinfer_code::H_ERROR);
 
   // check for model path map size
@@ -457,7 +476,7 @@ InferStatus multiai_inference_validity_check(const Mappings& model_path_map,
     return l_status;
   }
 
-  l_status = check_mappings_size_value(inference_map, "inference_map");
+  l_status = check_multi_mappings_size_value(inference_map, "inference_map");
   if (l_status.get_code() == holoinfer_code::H_ERROR) { return l_status; }
 
   if (in_tensor_names.empty()) {
@@ -470,10 +489,12 @@ InferStatus multiai_inference_validity_check(const Mappings& model_path_map,
     return status;
   }
 
-  if (!check_equality(model_path_map.size(),
-                      pre_processor_map.size(),
-                      inference_map.size(),
-                      out_tensor_names.size())) {
+  // Models with several outputs map each of them to an output tensor
+  size_t inferred_tensor_count = 0;
+  for (const auto& inference : inference_map) { inferred_tensor_count += inference.second.size(); }
+
+  if (!check_equality(model_path_map.size(), pre_processor_map.size(), inference_map.size()) ||
+      inferred_tensor_count != out_tensor_names.size()) {
     status.set_message(
         "Size mismatch. model_path_map, pre_processor_map, "
         "inference_map, in_tensor_name, out_tensor_names must be of same size.");
@@ -486,26 +507,24 @@ InferStatus multiai_inference_validity_check(const Mappings& model_path_map,
       status.set_message("Model keyword: " + model_path.first + " not in pre_processor_map");
       return status;
     } else {  // check that values in pre_processor_map exist in in_tensor_names
-      if (std::find(in_tensor_names.begin(),
-                    in_tensor_names.end(),
-                    pre_processor_map.at(model_path.first)[0]) == in_tensor_names.end()) {
-        status.set_message("Input Tensor name does not contain: " +
-                           pre_processor_map.at(model_path.first)[0]);
-
-        return status;
+      for (const auto& tensor_name : pre_processor_map.at(model_path.first)) {
+        if (std::find(in_tensor_names.begin(), in_tensor_names.end(), tensor_name) ==
+            in_tensor_names.end()) {
+          status.set_message("Input Tensor name does not contain: " + tensor_name);
+          return status;
+        }
       }
     }
     if (inference_map.find(model_path.first) == inference_map.end()) {
       status.set_message("Model keyword: " + model_path.first + " not in inference_map");
       return status;
     } else {  // check that values in inference_map exist in out_tensor_names
-      if (std::find(out_tensor_names.begin(),
-                    out_tensor_names.end(),
-                    inference_map.at(model_path.first)) == out_tensor_names.end()) {
-        status.set_message("Output Tensor name does not contain: " +
-                           inference_map.at(model_path.first));
-
-        return status;
+      for (const auto& tensor_name : inference_map.at(model_path.first)) {
+        if (std::find(out_tensor_names.begin(), out_tensor_names.end(), tensor_name) ==
+            out_tensor_names.end()) {
+          status.set_message("Output Tensor name does not contain: " + tensor_name);
+          return status;
+        }
       }
     }
   }
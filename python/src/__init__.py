@@ -27,6 +27,7 @@ _EXTRA_MODULES = [
     "logger",
     "operators",
     "resources",
+    "schedulers",
 ]
 __all__.extend(_EXTRA_MODULES)
 
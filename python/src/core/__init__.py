@@ -40,9 +40,12 @@ create a custom application.
     holoscan.core.IOSpec
     holoscan.core.Message
     holoscan.core.Operator
+    holoscan.core.OperatorProfile
     holoscan.core.OperatorSpec
     holoscan.core.OutputContext
+    holoscan.core.Profiler
     holoscan.core.Resource
+    holoscan.core.Scheduler
     holoscan.core.Tensor
     holoscan.core.arg_to_py_object
     holoscan.core.arglist_to_kwargs
@@ -71,10 +74,11 @@ from ._core import (
 from ._core import Fragment as _Fragment
 from ._core import InputContext, IOSpec, Message
 from ._core import Operator as _Operator
-from ._core import OperatorSpec, OutputContext, PyOperatorSpec
+from ._core import OperatorProfile, OperatorSpec, OutputContext, Profiler, PyOperatorSpec
 from ._core import PyTensor as Tensor
 from ._core import (
     Resource,
+    Scheduler,
     arg_to_py_object,
     arglist_to_kwargs,
     kwargs_to_arglist,
@@ -103,9 +107,12 @@ __all__ = [
     "IOSpec",
     "Message",
     "Operator",
+    "OperatorProfile",
     "OperatorSpec",
     "OutputContext",
+    "Profiler",
     "Resource",
+    "Scheduler",
     "Tensor",
     "arg_to_py_object",
     "arglist_to_kwargs",
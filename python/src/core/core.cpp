@@ -48,6 +48,7 @@
 #include "holoscan/core/operator.hpp"
 #include "holoscan/core/operator_spec.hpp"
 #include "holoscan/core/parameter.hpp"
+#include "holoscan/core/profiler.hpp"
 #include "holoscan/core/resource.hpp"
 #include "trampolines.hpp"
 
@@ -307,6 +308,33 @@ PYBIND11_MODULE(_core, m) {
           py::call_guard<py::gil_scoped_release>(),
           R"doc(Return repr(self).)doc");
 
+  py::class_<Scheduler, Component, PyScheduler, std::shared_ptr<Scheduler>>(
+      m, "Scheduler", doc::Scheduler::doc_Scheduler)
+      .def(py::init<const py::args&, const py::kwargs&>(),
+           doc::Scheduler::doc_Scheduler_args_kwargs)
+      .def_property("name",
+                    py::overload_cast<>(&Scheduler::name, py::const_),
+                    (Scheduler & (Scheduler::*)(const std::string&)&)&Scheduler::name,
+                    doc::Scheduler::doc_name)
+      .def_property("fragment",
+                    py::overload_cast<>(&Scheduler::fragment),
+                    py::overload_cast<Fragment*>(&Scheduler::fragment),
+                    doc::Scheduler::doc_fragment)
+      .def_property("spec",
+                    &Scheduler::spec_shared,
+                    py::overload_cast<const std::shared_ptr<ComponentSpec>&>(&Scheduler::spec))
+      .def("setup", &Scheduler::setup, doc::Scheduler::doc_setup)  // note: virtual
+      .def("initialize",
+           &Scheduler::initialize,
+           doc::Scheduler::doc_initialize)  // note: virtual function
+      .def_property_readonly(
+          "description", &Scheduler::description, doc::Scheduler::doc_description)
+      .def(
+          "__repr__",
+          [](const Scheduler& s) { return s.description(); },
+          py::call_guard<py::gil_scoped_release>(),
+          R"doc(Return repr(self).)doc");
+
   py::class_<InputContext, std::shared_ptr<InputContext>> input_context(
       m, "InputContext", doc::InputContext::doc_InputContext);
 
@@ -366,6 +394,14 @@ PYBIND11_MODULE(_core, m) {
             return io_spec.condition(kind, kwargs_to_arglist(kwargs));
           },
           doc::IOSpec::doc_condition)
+      .def_property_readonly(
+          "connector_type", &IOSpec::connector_type, doc::IOSpec::doc_connector_type)
+      .def(
+          "connector",
+          [](IOSpec& io_spec, const IOSpec::ConnectorType& kind, const py::kwargs& kwargs) {
+            return io_spec.connector(kind, kwargs_to_arglist(kwargs));
+          },
+          doc::IOSpec::doc_connector)
       .def(
           "__repr__",
           [](const IOSpec& iospec) {
@@ -380,6 +416,11 @@ PYBIND11_MODULE(_core, m) {
       .value("INPUT", IOSpec::IOType::kInput)
       .value("OUTPUT", IOSpec::IOType::kOutput);
 
+  py::enum_<IOSpec::ConnectorType>(iospec, "ConnectorType", doc::ConnectorType::doc_ConnectorType)
+      .value("DEFAULT", IOSpec::ConnectorType::kDefault)
+      .value("DOUBLE_BUFFER", IOSpec::ConnectorType::kDoubleBuffer)
+      .value("LOCK_FREE", IOSpec::ConnectorType::kLockFree);
+
   py::class_<OperatorSpec, ComponentSpec, std::shared_ptr<OperatorSpec>>(
       m, "OperatorSpec", R"doc(Operator specification class.)doc")
       .def(py::init<Fragment*>(), "fragment"_a, doc::OperatorSpec::doc_OperatorSpec)
@@ -498,6 +539,50 @@ PYBIND11_MODULE(_core, m) {
       .def_property_readonly("config_file", &Config::config_file, doc::Config::doc_config_file)
       .def_property_readonly("prefix", &Config::prefix, doc::Config::doc_prefix);
 
+  py::class_<OperatorProfile>(m, "OperatorProfile", doc::OperatorProfile::doc_OperatorProfile)
+      .def_readonly("name", &OperatorProfile::name)
+      .def_readonly("count", &OperatorProfile::count)
+      .def_readonly("total_ms", &OperatorProfile::total_ms)
+      .def_readonly("min_ms", &OperatorProfile::min_ms)
+      .def_readonly("mean_ms", &OperatorProfile::mean_ms)
+      .def_readonly("p50_ms", &OperatorProfile::p50_ms)
+      .def_readonly("p99_ms", &OperatorProfile::p99_ms)
+      .def_readonly("max_ms", &OperatorProfile::max_ms)
+      .def_readonly("interval_mean_ms", &OperatorProfile::interval_mean_ms)
+      .def_readonly("interval_p50_ms", &OperatorProfile::interval_p50_ms)
+      .def_readonly("interval_p99_ms", &OperatorProfile::interval_p99_ms)
+      .def_readonly("interval_max_ms", &OperatorProfile::interval_max_ms)
+      .def_readonly("throughput_hz", &OperatorProfile::throughput_hz)
+      .def(
+          "__repr__",
+          [](const OperatorProfile& p) {
+            return fmt::format(
+                "OperatorProfile(name={}, count={}, mean_ms={:.6f}, p99_ms={:.6f}, "
+                "throughput_hz={:.3f})",
+                p.name,
+                p.count,
+                p.mean_ms,
+                p.p99_ms,
+                p.throughput_hz);
+          },
+          R"doc(Return repr(self).)doc");
+
+  py::class_<Profiler>(m, "Profiler", doc::Profiler::doc_Profiler)
+      .def("enable", &Profiler::enable, "enabled"_a = true, doc::Profiler::doc_enable)
+      .def_property_readonly("enabled", &Profiler::enabled, doc::Profiler::doc_enabled)
+      .def_property("output_file",
+                    py::overload_cast<>(&Profiler::output_file, py::const_),
+                    py::overload_cast<const std::string&>(&Profiler::output_file),
+                    doc::Profiler::doc_output_file)
+      .def("operator_profiles",
+           &Profiler::operator_profiles,
+           py::call_guard<py::gil_scoped_release>(),
+           doc::Profiler::doc_operator_profiles)
+      .def("reset", &Profiler::reset, doc::Profiler::doc_reset)
+      .def("to_json", &Profiler::to_json, doc::Profiler::doc_to_json)
+      .def("to_csv", &Profiler::to_csv, doc::Profiler::doc_to_csv)
+      .def("dump", &Profiler::dump, "path"_a, doc::Profiler::doc_dump);
+
   py::class_<Executor, PyExecutor, std::shared_ptr<Executor>>(
       m, "Executor", R"doc(Executor class.)doc")
       .def(py::init<Fragment*>(), "fragment"_a, doc::Executor::doc_Executor)
@@ -530,6 +615,12 @@ PYBIND11_MODULE(_core, m) {
       .def("config", py::overload_cast<>(&Fragment::config), doc::Fragment::doc_config)
       .def_property_readonly("graph", &Fragment::graph, doc::Fragment::doc_graph)
       .def_property_readonly("executor", &Fragment::executor, doc::Fragment::doc_executor)
+      .def_property_readonly("profiler", &Fragment::profiler, doc::Fragment::doc_profiler)
+      .def("scheduler",
+           py::overload_cast<const std::shared_ptr<Scheduler>&>(&Fragment::scheduler),
+           "scheduler"_a,
+           doc::Fragment::doc_scheduler_kwargs)
+      .def("scheduler", py::overload_cast<>(&Fragment::scheduler), doc::Fragment::doc_scheduler)
       .def(
           "from_config",
           [](Fragment& fragment, const std::string& key) {
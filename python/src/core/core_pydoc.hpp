@@ -377,6 +377,79 @@ YAML formatted string describing the resource.
 
 }  // namespace Resource
 
+namespace Scheduler {
+
+PYDOC(Scheduler, R"doc(
+Class representing a scheduler.
+)doc")
+
+//  Constructor
+PYDOC(Scheduler_args_kwargs, R"doc(
+Class representing a scheduler.
+
+Can be initialized with any number of Python positional and keyword arguments.
+
+If a `name` keyword argument is provided, it must be a `str` and will be
+used to set the name of the scheduler.
+
+If a `fragment` keyword argument is provided, it must be of type
+`holoscan.core.Fragment` (or
+`holoscan.core.Application`). A single `Fragment` object can also be
+provided positionally instead.
+
+Any other arguments will be cast from a Python argument type to a C++ `Arg`
+and stored in ``self.args``. (For details on how the casting is done, see the
+`py_object_to_arg` utility).
+
+Parameters
+----------
+\*args
+    Positional arguments.
+\*\*kwargs
+    Keyword arguments.
+
+Raises
+------
+RuntimeError
+    If `name` kwarg is provided, but is not of `str` type.
+    If multiple arguments of type `Fragment` are provided.
+    If any other arguments cannot be converted to `Arg` type via `py_object_to_arg`.
+)doc")
+
+PYDOC(name, R"doc(
+The name of the scheduler.
+
+Returns
+-------
+name : str
+)doc")
+
+PYDOC(fragment, R"doc(
+Fragment that the scheduler belongs to.
+
+Returns
+-------
+name : holoscan.core.Fragment
+)doc")
+
+PYDOC(spec, R"doc(
+The scheduler's ComponentSpec.
+)doc")
+
+PYDOC(setup, R"doc(
+setup method for the scheduler.
+)doc")
+
+PYDOC(initialize, R"doc(
+initialization method for the scheduler.
+)doc")
+
+PYDOC(description, R"doc(
+YAML formatted string describing the scheduler.
+)doc")
+
+}  // namespace Scheduler
+
 namespace InputContext {
 
 PYDOC(InputContext, R"doc(
@@ -520,6 +593,37 @@ obj : holoscan.core.IOSpec
     The self object.
 )doc")
 
+PYDOC(connector_type, R"doc(
+The type of the connector (receiver/transmitter) of this input/output.
+
+Returns
+-------
+connector_type : holoscan.core.IOSpec.ConnectorType
+)doc")
+
+PYDOC(connector, R"doc(
+Set the connector (receiver for an input, transmitter for an output) of this input/output.
+
+The following ConnectorTypes are supported:
+
+- `IOSpec.ConnectorType.DEFAULT`
+- `IOSpec.ConnectorType.DOUBLE_BUFFER`
+- `IOSpec.ConnectorType.LOCK_FREE`
+
+Parameters
+----------
+kind : holoscan.core.IOSpec.ConnectorType
+    The type of the connector.
+**kwargs
+    Python keyword arguments that will be cast to an `ArgList` associated
+    with the connector (e.g. `capacity`, `policy`).
+
+Returns
+-------
+obj : holoscan.core.IOSpec
+    The self object.
+)doc")
+
 }  // namespace IOSpec
 
 namespace IOType {
@@ -529,6 +633,13 @@ Enum representing the I/O specification type (input or output).
 )doc")
 }  // namespace IOType
 
+namespace ConnectorType {
+
+PYDOC(ConnectorType, R"doc(
+Enum representing the connector (receiver/transmitter) type of an input/output.
+)doc")
+}  // namespace ConnectorType
+
 namespace OperatorSpec {
 
 //  Constructor
@@ -699,6 +810,95 @@ TODO
 
 }  // namespace Config
 
+namespace OperatorProfile {
+
+PYDOC(OperatorProfile, R"doc(
+Tick statistics of an operator recorded by the fragment's ``Profiler``.
+
+All durations are in milliseconds. Percentiles are estimated from a histogram
+(relative error of at most 6.25%); ``count``, ``min_ms``, ``mean_ms`` and
+``max_ms`` are exact.
+)doc")
+
+}  // namespace OperatorProfile
+
+namespace Profiler {
+
+PYDOC(Profiler, R"doc(
+Per-operator tick latency profiler.
+
+When enabled, the ``compute`` call of each native operator is timed and the
+interval between consecutive ticks is recorded. The profiler must be enabled
+before the application is run.
+)doc")
+
+PYDOC(enable, R"doc(
+Enable or disable profiling.
+
+Parameters
+----------
+enabled : bool, optional
+    Whether profiling is enabled.
+)doc")
+
+PYDOC(enabled, R"doc(
+Whether profiling is enabled.
+)doc")
+
+PYDOC(output_file, R"doc(
+Path of the file the statistics are written to when the application completes.
+
+The file is written in CSV format if the path ends with ``.csv``, and in JSON
+format otherwise. No file is written if the path is empty.
+)doc")
+
+PYDOC(operator_profiles, R"doc(
+Get the statistics of all profiled operators.
+
+This method can be called while the application is running.
+
+Returns
+-------
+profiles : list of holoscan.core.OperatorProfile
+)doc")
+
+PYDOC(reset, R"doc(
+Clear all recorded statistics.
+)doc")
+
+PYDOC(to_json, R"doc(
+Get the statistics in JSON format.
+
+Returns
+-------
+str
+)doc")
+
+PYDOC(to_csv, R"doc(
+Get the statistics in CSV format.
+
+Returns
+-------
+str
+)doc")
+
+PYDOC(dump, R"doc(
+Write the statistics to a file.
+
+Parameters
+----------
+path : str
+    The path of the output file. The file is written in CSV format if the path
+    ends with ``.csv``, and in JSON format otherwise.
+
+Returns
+-------
+bool
+    Whether the file was written.
+)doc")
+
+}  // namespace Profiler
+
 namespace Executor {
 
 //  Constructor
@@ -783,6 +983,31 @@ PYDOC(executor, R"doc(
 Get the executor associated with the fragment.
 )doc")
 
+PYDOC(profiler, R"doc(
+Get the operator profiler associated with the fragment.
+)doc")
+
+PYDOC(scheduler_kwargs, R"doc(
+Set the scheduler used by the fragment.
+
+Parameters
+----------
+scheduler : holoscan.core.Scheduler
+    The scheduler to use (e.g. ``holoscan.schedulers.MultiThreadScheduler``).
+)doc")
+
+PYDOC(scheduler, R"doc(
+Get the scheduler used by the fragment.
+
+If no scheduler was set, one is created from the ``scheduler`` section of the
+configuration (``type`` is one of ``greedy``, ``multi_thread`` or
+``event_based``). A ``GreedyScheduler`` is used by default.
+
+Returns
+-------
+scheduler : holoscan.core.Scheduler
+)doc")
+
 PYDOC(from_config, R"doc(
 Retrieve parameters from the associated configuration.
 
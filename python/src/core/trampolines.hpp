@@ -45,6 +45,7 @@
 #include "holoscan/core/io_context.hpp"
 #include "holoscan/core/operator.hpp"
 #include "holoscan/core/resource.hpp"
+#include "holoscan/core/scheduler.hpp"
 
 /**********************************************************
  * Define trampolines for classes with virtual functions. *
@@ -185,6 +186,63 @@ class PyResource : public Resource {
   }
 };
 
+class PyScheduler : public Scheduler {
+ public:
+  /* Inherit the constructors */
+  using Scheduler::Scheduler;
+
+  // Define a kwargs-based constructor that can create an ArgList
+  // for passing on to the variadic-template based constructor.
+  PyScheduler(const py::args& args, const py::kwargs& kwargs) : Scheduler() {
+    using std::string_literals::operator""s;
+
+    int n_fragments = 0;
+    for (auto& item : args) {
+      py::object arg_value = item.cast<py::object>();
+      if (py::isinstance<Fragment>(arg_value)) {
+        if (n_fragments > 0) { throw std::runtime_error("multiple Fragment objects provided"); }
+        fragment_ = arg_value.cast<Fragment*>();
+        n_fragments += 1;
+      } else {
+        this->add_arg(py_object_to_arg(arg_value, ""s));
+      }
+    }
+    for (auto& item : kwargs) {
+      std::string kwarg_name = item.first.cast<std::string>();
+      py::object kwarg_value = item.second.cast<py::object>();
+      if (kwarg_name == "name"s) {
+        if (py::isinstance<py::str>(kwarg_value)) {
+          name_ = kwarg_value.cast<std::string>();
+        } else {
+          throw std::runtime_error("name kwarg must be a string");
+        }
+      } else if (kwarg_name == "fragment"s) {
+        if (py::isinstance<Fragment>(kwarg_value)) {
+          if (n_fragments > 0) {
+            throw std::runtime_error(
+                "Cannot add kwarg fragment, when a Fragment was also provided positionally");
+          }
+          fragment_ = kwarg_value.cast<Fragment*>();
+        } else {
+          throw std::runtime_error("fragment kwarg must be a Fragment");
+        }
+      } else {
+        this->add_arg(py_object_to_arg(kwarg_value, kwarg_name));
+      }
+    }
+  }
+
+  /* Trampolines (need one for each virtual function) */
+  void initialize() override {
+    /* <Return type>, <Parent Class>, <Name of C++ function>, <Argument(s)> */
+    PYBIND11_OVERRIDE(void, Scheduler, initialize);
+  }
+  void setup(ComponentSpec& spec) override {
+    /* <Return type>, <Parent Class>, <Name of C++ function>, <Argument(s)> */
+    PYBIND11_OVERRIDE(void, Scheduler, setup, spec);
+  }
+};
+
 class PyOperatorSpec : public OperatorSpec {
  public:
   /* Inherit the constructors */
@@ -418,26 +476,38 @@ class PyOperator : public Operator {
   }
 
   void stop() override {
+    // Release the contexts (and the message entities pooled by them) while the GXF context is
+    // still alive.
+    {
+      py::gil_scoped_acquire scope_guard;
+      py_context_.reset();
+      py_op_input_.reset();
+      py_op_output_.reset();
+    }
     /* <Return type>, <Parent Class>, <Name of C++ function>, <Argument(s)> */
     PYBIND11_OVERRIDE(void, Operator, stop);
   }
 
   void compute(InputContext& op_input, OutputContext& op_output,
                ExecutionContext& context) override {
-    auto gxf_context = dynamic_cast<gxf::GXFInputContext&>(op_input).gxf_context();
-
-    auto py_op_input = std::make_shared<PyInputContext>(
-        gxf_context, op_input.op(), op_input.inputs(), this->py_op_);
-    auto py_op_output = std::make_shared<PyOutputContext>(
-        gxf_context, op_output.op(), op_output.outputs(), this->py_op_);
-    auto py_context =
-        std::make_shared<PyExecutionContext>(gxf_context, py_op_input, py_op_output, this->py_op_);
+    // The Python-facing contexts are created on the first tick and reused afterwards.
+    if (!py_context_) {
+      auto gxf_context = dynamic_cast<gxf::GXFInputContext&>(op_input).gxf_context();
+
+      py_op_input_ = std::make_shared<PyInputContext>(
+          gxf_context, op_input.op(), op_input.inputs(), this->py_op_);
+      py_op_output_ = std::make_shared<PyOutputContext>(
+          gxf_context, op_output.op(), op_output.outputs(), this->py_op_);
+      py_context_ = std::make_shared<PyExecutionContext>(
+          gxf_context, py_op_input_, py_op_output_, this->py_op_);
+    }
     {
       // Get the compute method of the Python Operator class and call it
       py::gil_scoped_acquire scope_guard;
       py::object py_compute = py::getattr(py_op_, "compute");
       try {
-        py_compute.operator()(py::cast(py_op_input), py::cast(py_op_output), py::cast(py_context));
+        py_compute.operator()(
+            py::cast(py_op_input_), py::cast(py_op_output_), py::cast(py_context_));
       } catch (const py::error_already_set& e) {
         // Print the Python error to stderr
         auto stderr = py::module::import("sys").attr("stderr");
@@ -456,6 +526,9 @@ class PyOperator : public Operator {
 
  private:
   py::object py_op_ = py::none();
+  std::shared_ptr<PyInputContext> py_op_input_;
+  std::shared_ptr<PyOutputContext> py_op_output_;
+  std::shared_ptr<PyExecutionContext> py_context_;
 };
 
 class PyExecutor : public Executor {
@@ -24,6 +24,7 @@
     holoscan.gxf.GXFOperator
     holoscan.gxf.GXFOutputContext
     holoscan.gxf.GXFResource
+    holoscan.gxf.GXFScheduler
     holoscan.gxf.load_extensions
 """
 
@@ -36,6 +37,7 @@ from ._gxf import (
     GXFOperator,
     GXFOutputContext,
     GXFResource,
+    GXFScheduler,
 )
 from ._gxf import PyEntity as Entity
 from ._gxf import load_extensions
@@ -49,5 +51,6 @@ __all__ = [
     "GXFOperator",
     "GXFOutputContext",
     "GXFResource",
+    "GXFScheduler",
     "load_extensions",
 ]
@@ -36,6 +36,7 @@
 #include "holoscan/core/gxf/gxf_io_context.hpp"
 #include "holoscan/core/gxf/gxf_operator.hpp"
 #include "holoscan/core/gxf/gxf_resource.hpp"
+#include "holoscan/core/gxf/gxf_scheduler.hpp"
 #include "holoscan/core/gxf/gxf_tensor.hpp"
 #include "holoscan/core/gxf/gxf_wrapper.hpp"
 
@@ -155,6 +156,11 @@ PYBIND11_MODULE(_gxf, m) {
       .def(py::init<>(), doc::GXFResource::doc_GXFResource)
       .def("initialize", &gxf::GXFResource::initialize, doc::GXFResource::doc_initialize);
 
+  py::class_<gxf::GXFScheduler, Scheduler, gxf::GXFComponent, std::shared_ptr<gxf::GXFScheduler>>(
+      m, "GXFScheduler", doc::GXFScheduler::doc_GXFScheduler)
+      .def(py::init<>(), doc::GXFScheduler::doc_GXFScheduler)
+      .def("initialize", &gxf::GXFScheduler::initialize, doc::GXFScheduler::doc_initialize);
+
   py::class_<gxf::GXFCondition, Condition, gxf::GXFComponent, std::shared_ptr<gxf::GXFCondition>>(
       m, "GXFCondition", doc::GXFCondition::doc_GXFCondition)
       .def(py::init<>(), doc::GXFCondition::doc_GXFCondition)
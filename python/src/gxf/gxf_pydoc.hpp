@@ -138,6 +138,19 @@ Initialize the component.
 
 }  // namespace GXFResource
 
+namespace GXFScheduler {
+
+// Constructor
+PYDOC(GXFScheduler, R"doc(
+Base GXF-based scheduler class.
+)doc")
+
+PYDOC(initialize, R"doc(
+Initialize the scheduler.
+)doc")
+
+}  // namespace GXFScheduler
+
 namespace GXFOperator {
 
 // Constructor
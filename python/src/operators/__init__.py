@@ -25,6 +25,7 @@
     holoscan.operators.NTV2Channel
     holoscan.operators.PingRxOp
     holoscan.operators.PingTxOp
+    holoscan.operators.PreprocessorOp
     holoscan.operators.SegmentationPostprocessorOp
     holoscan.operators.TensorRTInferenceOp
     holoscan.operators.VideoStreamRecorderOp
@@ -42,6 +43,7 @@ from ._operators import (
     MultiAIInferenceOp,
     MultiAIPostprocessorOp,
     NTV2Channel,
+    PreprocessorOp,
     SegmentationPostprocessorOp,
     TensorRTInferenceOp,
     VideoStreamRecorderOp,
@@ -58,6 +60,7 @@ __all__ = [
     "NTV2Channel",
     "PingRxOp",
     "PingTxOp",
+    "PreprocessorOp",
     "SegmentationPostprocessorOp",
     "TensorRTInferenceOp",
     "VideoStreamRecorderOp",
@@ -45,6 +45,7 @@
 #include "holoscan/operators/multiai_postprocessor/multiai_postprocessor.hpp"
 #include "holoscan/operators/ping_rx/ping_rx.hpp"
 #include "holoscan/operators/ping_tx/ping_tx.hpp"
+#include "holoscan/operators/preprocessor/preprocessor.hpp"
 #include "holoscan/operators/segmentation_postprocessor/segmentation_postprocessor.hpp"
 #include "holoscan/operators/tensor_rt/tensor_rt_inference.hpp"
 #include "holoscan/operators/video_stream_recorder/video_stream_recorder.hpp"
@@ -98,7 +99,7 @@ class PyFormatConverterOp : public FormatConverterOp {
                       const std::vector<int> out_channel_order = std::vector<int>{},
                       std::shared_ptr<holoscan::CudaStreamPool> cuda_stream_pool =
                           std::shared_ptr<holoscan::CudaStreamPool>(),
-                      const std::string& name = "format_converter")
+                      uint32_t num_threads = 1, const std::string& name = "format_converter")
       : FormatConverterOp(ArgList{Arg{"in_tensor_name", in_tensor_name},
                                   Arg{"in_dtype", in_dtype},
                                   Arg{"out_tensor_name", out_tensor_name},
@@ -111,7 +112,44 @@ class PyFormatConverterOp : public FormatConverterOp {
                                   Arg{"resize_mode", resize_mode},
                                   Arg{"out_channel_order", out_channel_order},
                                   Arg{"pool", pool},
-                                  Arg{"cuda_stream_pool", cuda_stream_pool}}) {
+                                  Arg{"cuda_stream_pool", cuda_stream_pool},
+                                  Arg{"num_threads", num_threads}}) {
+    name_ = name;
+    fragment_ = fragment;
+    spec_ = std::make_shared<OperatorSpec>(fragment);
+    setup(*spec_.get());
+    initialize();
+  }
+};
+
+class PyPreprocessorOp : public PreprocessorOp {
+ public:
+  /* Inherit the constructors */
+  using PreprocessorOp::PreprocessorOp;
+
+  // Define a constructor that fully initializes the object.
+  PyPreprocessorOp(Fragment* fragment, std::shared_ptr<holoscan::Allocator> pool,
+                   const std::string& in_tensor_name = "", const std::string& out_tensor_name = "",
+                   int32_t resize_height = 0, int32_t resize_width = 0, int32_t resize_mode = 0,
+                   const std::vector<int> out_channel_order = std::vector<int>{},
+                   float scale_min = 0.f, float scale_max = 1.f,
+                   const std::vector<float> mean = std::vector<float>{},
+                   const std::vector<float> std = std::vector<float>{},
+                   const std::string& out_layout = "hwc"s, uint32_t num_threads = 1,
+                   const std::string& name = "preprocessor")
+      : PreprocessorOp(ArgList{Arg{"in_tensor_name", in_tensor_name},
+                               Arg{"out_tensor_name", out_tensor_name},
+                               Arg{"resize_width", resize_width},
+                               Arg{"resize_height", resize_height},
+                               Arg{"resize_mode", resize_mode},
+                               Arg{"out_channel_order", out_channel_order},
+                               Arg{"scale_min", scale_min},
+                               Arg{"scale_max", scale_max},
+                               Arg{"mean", mean},
+                               Arg{"std", std},
+                               Arg{"out_layout", out_layout},
+                               Arg{"pool", pool},
+                               Arg{"num_threads", num_threads}}) {
     name_ = name;
     fragment_ = fragment;
     spec_ = std::make_shared<OperatorSpec>(fragment);
@@ -130,6 +168,10 @@ class PyVideoStreamReplayerOp : public VideoStreamReplayerOp {
                           const std::string& basename, size_t batch_size = 1UL,
                           bool ignore_corrupted_entities = true, float frame_rate = 0.f,
                           bool realtime = true, bool repeat = false, uint64_t count = 0UL,
+                          size_t prefetch_size = 0UL, bool memory_mapped = false,
+                          uint64_t start_frame = 0UL, uint64_t end_frame = 0UL,
+                          const std::string& playback_mode = "forward"s,
+                          bool verify_checksum = false,
                           const std::string& name = "video_stream_replayer")
       : VideoStreamReplayerOp(ArgList{Arg{"directory", directory},
                                       Arg{"basename", basename},
@@ -138,7 +180,13 @@ class PyVideoStreamReplayerOp : public VideoStreamReplayerOp {
                                       Arg{"frame_rate", frame_rate},
                                       Arg{"realtime", realtime},
                                       Arg{"repeat", repeat},
-                                      Arg{"count", count}}) {
+                                      Arg{"count", count},
+                                      Arg{"prefetch_size", prefetch_size},
+                                      Arg{"memory_mapped", memory_mapped},
+                                      Arg{"start_frame", start_frame},
+                                      Arg{"end_frame", end_frame},
+                                      Arg{"playback_mode", playback_mode},
+                                      Arg{"verify_checksum", verify_checksum}}) {
     name_ = name;
     fragment_ = fragment;
     spec_ = std::make_shared<OperatorSpec>(fragment);
@@ -184,10 +232,26 @@ class PyVideoStreamRecorderOp : public VideoStreamRecorderOp {
   // Define a constructor that fully initializes the object.
   PyVideoStreamRecorderOp(Fragment* fragment, const std::string& directory,
                           const std::string& basename, bool flush_on_tick_ = false,
+                          size_t queue_size = 0UL, bool drop_on_overflow = false,
+                          size_t write_block_size = 4UL * 1024 * 1024, bool direct_io = false,
+                          uint64_t fsync_interval_ms = 0UL, uint64_t fsync_bytes = 0UL,
+                          const std::string& compression = "none"s,
+                          int32_t compression_level = 3, bool delta_encoding = false,
+                          uint64_t keyframe_interval = 30UL,
                           const std::string& name = "video_stream_recorder")
       : VideoStreamRecorderOp(ArgList{Arg{"directory", directory},
                                       Arg{"basename", basename},
-                                      Arg{"flush_on_tick", flush_on_tick_}}) {
+                                      Arg{"flush_on_tick", flush_on_tick_},
+                                      Arg{"queue_size", queue_size},
+                                      Arg{"drop_on_overflow", drop_on_overflow},
+                                      Arg{"write_block_size", write_block_size},
+                                      Arg{"direct_io", direct_io},
+                                      Arg{"fsync_interval_ms", fsync_interval_ms},
+                                      Arg{"fsync_bytes", fsync_bytes},
+                                      Arg{"compression", compression},
+                                      Arg{"compression_level", compression_level},
+                                      Arg{"delta_encoding", delta_encoding},
+                                      Arg{"keyframe_interval", keyframe_interval}}) {
     name_ = name;
     fragment_ = fragment;
     spec_ = std::make_shared<OperatorSpec>(fragment);
@@ -300,12 +364,14 @@ class PySegmentationPostprocessorOp : public SegmentationPostprocessorOp {
                                 const std::string& data_format = "hwc"s,
                                 std::shared_ptr<holoscan::CudaStreamPool> cuda_stream_pool =
                                     std::shared_ptr<holoscan::CudaStreamPool>(),
+                                uint32_t num_threads = 1,
                                 const std::string& name = "segmentation_postprocessor"s)
       : SegmentationPostprocessorOp(ArgList{Arg{"in_tensor_name", in_tensor_name},
                                             Arg{"network_output_type", network_output_type},
                                             Arg{"data_format", data_format},
                                             Arg{"allocator", allocator},
-                                            Arg{"cuda_stream_pool", cuda_stream_pool}}) {
+                                            Arg{"cuda_stream_pool", cuda_stream_pool},
+                                            Arg{"num_threads", num_threads}}) {
     name_ = name;
     fragment_ = fragment;
     spec_ = std::make_shared<OperatorSpec>(fragment);
@@ -325,8 +391,13 @@ MultiAIInferenceOp::DataMap _dict_to_multiai_inference_datamap(py::dict dict) {
 MultiAIInferenceOp::DataVecMap _dict_to_multiai_inference_datavecmap(py::dict dict) {
   MultiAIInferenceOp::DataVecMap data_vec_map;
   for (auto item : dict) {
-    data_vec_map.insert(item.first.cast<std::string>(),
-                        item.second.cast<std::vector<std::string>>());
+    // a single tensor name may be given as a str
+    if (py::isinstance<py::str>(item.second)) {
+      data_vec_map.insert(item.first.cast<std::string>(), {item.second.cast<std::string>()});
+    } else {
+      data_vec_map.insert(item.first.cast<std::string>(),
+                          item.second.cast<std::vector<std::string>>());
+    }
   }
   return data_vec_map;
 }
@@ -339,7 +410,7 @@ class PyMultiAIInferenceOp : public MultiAIInferenceOp {
   // Define a constructor that fully initializes the object.
   PyMultiAIInferenceOp(Fragment* fragment, const std::string& backend,
                        std::shared_ptr<::holoscan::Allocator> allocator,
-                       py::dict inference_map,      // MultiAIPostprocessorOp::DataMap
+                       py::dict inference_map,      // MultiAIPostprocessorOp::DataVecMap
                        py::dict model_path_map,     // MultiAIPostprocessorOp::DataMap
                        py::dict pre_processor_map,  // MultiAIPostprocessorOp::DataVecMap
                        const std::vector<std::string>& in_tensor_names,
@@ -347,6 +418,13 @@ class PyMultiAIInferenceOp : public MultiAIInferenceOp {
                        bool parallel_inference = true, bool input_on_cuda = true,
                        bool output_on_cuda = true, bool transmit_on_cuda = true,
                        bool enable_fp16 = false, bool is_engine_path = false,
+                       size_t inference_threads = 0UL, size_t batch_size = 1UL,
+                       int64_t batch_timeout_us = 0L, int32_t intra_op_threads = 1,
+                       int32_t inter_op_threads = 0, bool parallel_execution = false,
+                       const std::string& graph_optimization_level = "extended",
+                       const std::string& optimized_model_cache_path = "",
+                       const std::vector<float>& input_mean = std::vector<float>{},
+                       const std::vector<float>& input_std = std::vector<float>{},
                        // TODO(grelee): handle receivers similarly to HolovizOp?  (default: {})
                        // TODO(grelee): handle transmitter similarly to HolovizOp?
                        const std::string& name = "multi_ai_inference")
@@ -360,12 +438,23 @@ class PyMultiAIInferenceOp : public MultiAIInferenceOp {
                                    Arg{"output_on_cuda", output_on_cuda},
                                    Arg{"transmit_on_cuda", transmit_on_cuda},
                                    Arg{"enable_fp16", enable_fp16},
-                                   Arg{"is_engine_path", is_engine_path}}) {
+                                   Arg{"is_engine_path", is_engine_path},
+                                   Arg{"inference_threads", inference_threads},
+                                   Arg{"batch_size", batch_size},
+                                   Arg{"batch_timeout_us", batch_timeout_us},
+                                   Arg{"intra_op_threads", intra_op_threads},
+                                   Arg{"inter_op_threads", inter_op_threads},
+                                   Arg{"parallel_execution", parallel_execution},
+                                   Arg{"graph_optimization_level", graph_optimization_level},
+                                   Arg{"optimized_model_cache_path", optimized_model_cache_path},
+                                   Arg{"input_mean", input_mean},
+                                   Arg{"input_std", input_std}}) {
     name_ = name;
     fragment_ = fragment;
 
-    // convert from Python dict to MultiAIPostprocessorOp::DataMap
-    auto inference_map_datamap = _dict_to_multiai_inference_datamap(inference_map.cast<py::dict>());
+    // convert from Python dict to MultiAIPostprocessorOp::DataVecMap
+    auto inference_map_datamap =
+        _dict_to_multiai_inference_datavecmap(inference_map.cast<py::dict>());
     this->add_arg(Arg("inference_map", inference_map_datamap));
 
     auto model_path_datamap = _dict_to_multiai_inference_datamap(model_path_map.cast<py::dict>());
@@ -446,10 +535,12 @@ class PyBayerDemosaicOp : public BayerDemosaicOp {
 
   // Define a constructor that fully initializes the object.
   PyBayerDemosaicOp(Fragment* fragment, std::shared_ptr<holoscan::Allocator> pool,
-                    std::shared_ptr<holoscan::CudaStreamPool> cuda_stream_pool,
+                    std::shared_ptr<holoscan::CudaStreamPool> cuda_stream_pool =
+                        std::shared_ptr<holoscan::CudaStreamPool>(),
                     const std::string& in_tensor_name = "", const std::string& out_tensor_name = "",
                     int interpolation_mode = 0, int bayer_grid_pos = 2, bool generate_alpha = false,
-                    int alpha_value = 255, const std::string& name = "bayer_demosaic")
+                    int alpha_value = 255, uint32_t num_threads = 1,
+                    const std::string& name = "bayer_demosaic")
       : BayerDemosaicOp(ArgList{Arg{"pool", pool},
                                 Arg{"cuda_stream_pool", cuda_stream_pool},
                                 Arg{"in_tensor_name", in_tensor_name},
@@ -457,7 +548,8 @@ class PyBayerDemosaicOp : public BayerDemosaicOp {
                                 Arg{"interpolation_mode", interpolation_mode},
                                 Arg{"bayer_grid_pos", bayer_grid_pos},
                                 Arg{"generate_alpha", generate_alpha},
-                                Arg{"alpha_value", alpha_value}}) {
+                                Arg{"alpha_value", alpha_value},
+                                Arg{"num_threads", num_threads}}) {
     name_ = name;
     fragment_ = fragment;
     spec_ = std::make_shared<OperatorSpec>(fragment);
@@ -503,6 +595,7 @@ PYBIND11_MODULE(_operators, m) {
                     int32_t,
                     const std::vector<int>,
                     std::shared_ptr<holoscan::CudaStreamPool>,
+                    uint32_t,
                     const std::string&>(),
            "fragment"_a,
            "pool"_a,
@@ -518,11 +611,47 @@ PYBIND11_MODULE(_operators, m) {
            "resize_mode"_a = 0,
            "out_channel_order"_a = std::vector<int>{},
            "cuda_stream_pool"_a = std::shared_ptr<holoscan::CudaStreamPool>(),
+           "num_threads"_a = 1,
            "name"_a = "format_converter"s,
            doc::FormatConverterOp::doc_FormatConverterOp_python)
       .def("initialize", &FormatConverterOp::initialize, doc::FormatConverterOp::doc_initialize)
       .def("setup", &FormatConverterOp::setup, "spec"_a, doc::FormatConverterOp::doc_setup);
 
+  py::class_<PreprocessorOp, PyPreprocessorOp, Operator, std::shared_ptr<PreprocessorOp>>(
+      m, "PreprocessorOp", doc::PreprocessorOp::doc_PreprocessorOp)
+      .def(py::init<Fragment*,
+                    std::shared_ptr<holoscan::Allocator>,
+                    const std::string&,
+                    const std::string&,
+                    int32_t,
+                    int32_t,
+                    int32_t,
+                    const std::vector<int>,
+                    float,
+                    float,
+                    const std::vector<float>,
+                    const std::vector<float>,
+                    const std::string&,
+                    uint32_t,
+                    const std::string&>(),
+           "fragment"_a,
+           "pool"_a,
+           "in_tensor_name"_a = ""s,
+           "out_tensor_name"_a = ""s,
+           "resize_height"_a = 0,
+           "resize_width"_a = 0,
+           "resize_mode"_a = 0,
+           "out_channel_order"_a = std::vector<int>{},
+           "scale_min"_a = 0.f,
+           "scale_max"_a = 1.f,
+           "mean"_a = std::vector<float>{},
+           "std"_a = std::vector<float>{},
+           "out_layout"_a = "hwc"s,
+           "num_threads"_a = 1,
+           "name"_a = "preprocessor"s,
+           doc::PreprocessorOp::doc_PreprocessorOp_python)
+      .def("setup", &PreprocessorOp::setup, "spec"_a, doc::PreprocessorOp::doc_setup);
+
   py::enum_<NTV2Channel>(m, "NTV2Channel")
       .value("NTV2_CHANNEL1", NTV2Channel::NTV2_CHANNEL1)
       .value("NTV2_CHANNEL2", NTV2Channel::NTV2_CHANNEL2)
@@ -618,17 +747,57 @@ PYBIND11_MODULE(_operators, m) {
              Operator,
              std::shared_ptr<VideoStreamRecorderOp>>(
       m, "VideoStreamRecorderOp", doc::VideoStreamRecorderOp::doc_VideoStreamRecorderOp)
-      .def(py::init<Fragment*, const std::string&, const std::string&, bool, const std::string&>(),
+      .def(py::init<Fragment*,
+                    const std::string&,
+                    const std::string&,
+                    bool,
+                    size_t,
+                    bool,
+                    size_t,
+                    bool,
+                    uint64_t,
+                    uint64_t,
+                    const std::string&,
+                    int32_t,
+                    bool,
+                    uint64_t,
+                    const std::string&>(),
            "fragment"_a,
            "directory"_a,
            "basename"_a,
            "flush_on_tick"_a = false,
+           "queue_size"_a = 0UL,
+           "drop_on_overflow"_a = false,
+           "write_block_size"_a = 4UL * 1024 * 1024,
+           "direct_io"_a = false,
+           "fsync_interval_ms"_a = 0UL,
+           "fsync_bytes"_a = 0UL,
+           "compression"_a = "none"s,
+           "compression_level"_a = 3,
+           "delta_encoding"_a = false,
+           "keyframe_interval"_a = 30UL,
            "name"_a = "recorder"s,
            doc::VideoStreamRecorderOp::doc_VideoStreamRecorderOp_python)
       .def("initialize",
            &VideoStreamRecorderOp::initialize,
            doc::VideoStreamRecorderOp::doc_initialize)
-      .def("setup", &VideoStreamRecorderOp::setup, "spec"_a, doc::VideoStreamRecorderOp::doc_setup);
+      .def("setup", &VideoStreamRecorderOp::setup, "spec"_a, doc::VideoStreamRecorderOp::doc_setup)
+      .def(
+          "statistics",
+          [](const VideoStreamRecorderOp& op) {
+            auto stats = op.statistics();
+            py::dict result;
+            result["frames_received"] = stats.frames_received;
+            result["frames_written"] = stats.frames_written;
+            result["frames_dropped"] = stats.frames_dropped;
+            result["backpressure_waits"] = stats.backpressure_waits;
+            result["backpressure_time_ns"] = stats.backpressure_time_ns;
+            result["max_queue_depth"] = stats.max_queue_depth;
+            result["bytes_written"] = stats.bytes_written;
+            result["syncs"] = stats.syncs;
+            return result;
+          },
+          doc::VideoStreamRecorderOp::doc_statistics);
 
   py::class_<VideoStreamReplayerOp,
              PyVideoStreamReplayerOp,
@@ -644,6 +813,12 @@ PYBIND11_MODULE(_operators, m) {
                     bool,
                     bool,
                     uint64_t,
+                    size_t,
+                    bool,
+                    uint64_t,
+                    uint64_t,
+                    const std::string&,
+                    bool,
                     const std::string&>(),
            "fragment"_a,
            "directory"_a,
@@ -654,12 +829,26 @@ PYBIND11_MODULE(_operators, m) {
            "realtime"_a = true,
            "repeat"_a = false,
            "count"_a = 0UL,
+           "prefetch_size"_a = 0UL,
+           "memory_mapped"_a = false,
+           "start_frame"_a = 0UL,
+           "end_frame"_a = 0UL,
+           "playback_mode"_a = "forward"s,
+           "verify_checksum"_a = false,
            "name"_a = "format_converter"s,
            doc::VideoStreamReplayerOp::doc_VideoStreamReplayerOp_python)
       .def("initialize",
            &VideoStreamReplayerOp::initialize,
            doc::VideoStreamReplayerOp::doc_initialize)
-      .def("setup", &VideoStreamReplayerOp::setup, "spec"_a, doc::VideoStreamReplayerOp::doc_setup);
+      .def("setup", &VideoStreamReplayerOp::setup, "spec"_a, doc::VideoStreamReplayerOp::doc_setup)
+      .def("seek", &VideoStreamReplayerOp::seek, "frame"_a, doc::VideoStreamReplayerOp::doc_seek)
+      .def("frame_at_time",
+           &VideoStreamReplayerOp::frame_at_time,
+           "log_time"_a,
+           doc::VideoStreamReplayerOp::doc_frame_at_time)
+      .def_property_readonly("frame_count",
+                             &VideoStreamReplayerOp::frame_count,
+                             doc::VideoStreamReplayerOp::doc_frame_count);
 
   py::class_<HolovizOp, PyHolovizOp, Operator, std::shared_ptr<HolovizOp>> holoviz_op(
       m, "HolovizOp", doc::HolovizOp::doc_HolovizOp);
@@ -748,6 +937,7 @@ PYBIND11_MODULE(_operators, m) {
                     const std::string&,
                     const std::string&,
                     std::shared_ptr<holoscan::CudaStreamPool>,
+                    uint32_t,
                     const std::string&>(),
            "fragment"_a,
            "allocator"_a,
@@ -755,6 +945,7 @@ PYBIND11_MODULE(_operators, m) {
            "network_output_type"_a = "softmax"s,
            "data_format"_a = "hwc"s,
            "cuda_stream_pool"_a = std::shared_ptr<holoscan::CudaStreamPool>(),
+           "num_threads"_a = 1,
            "name"_a = "segmentation_postprocessor"s,
            doc::SegmentationPostprocessorOp::doc_SegmentationPostprocessorOp_python)
       .def("setup",
@@ -785,6 +976,16 @@ PYBIND11_MODULE(_operators, m) {
                     bool,
                     bool,
                     bool,
+                    size_t,
+                    size_t,
+                    int64_t,
+                    int32_t,
+                    int32_t,
+                    bool,
+                    const std::string&,
+                    const std::string&,
+                    const std::vector<float>&,
+                    const std::vector<float>&,
                     const std::string&>(),
            "fragment"_a,
            "backend"_a,
@@ -801,6 +1002,16 @@ PYBIND11_MODULE(_operators, m) {
            "transmit_on_cuda"_a = true,
            "enable_fp16"_a = false,
            "is_engine_path"_a = false,
+           "inference_threads"_a = 0UL,
+           "batch_size"_a = 1UL,
+           "batch_timeout_us"_a = 0L,
+           "intra_op_threads"_a = 1,
+           "inter_op_threads"_a = 0,
+           "parallel_execution"_a = false,
+           "graph_optimization_level"_a = "extended"s,
+           "optimized_model_cache_path"_a = ""s,
+           "input_mean"_a = std::vector<float>{},
+           "input_std"_a = std::vector<float>{},
            "name"_a = "multi_ai_inference"s,
            doc::MultiAIInferenceOp::doc_MultiAIInferenceOp_python)
       .def("initialize", &MultiAIInferenceOp::initialize, doc::MultiAIInferenceOp::doc_initialize)
@@ -877,17 +1088,19 @@ PYBIND11_MODULE(_operators, m) {
                     int,
                     bool,
                     int,
+                    uint32_t,
                     const std::string&>(),
            "fragment"_a,
            "pool"_a,
-           "cuda_stream_pool"_a,
+           "cuda_stream_pool"_a = std::shared_ptr<holoscan::CudaStreamPool>(),
            "in_tensor_name"_a = ""s,
            "out_tensor_name"_a = ""s,
            "interpolation_mode"_a = 0,
            "bayer_grid_pos"_a = 2,
            "generate_alpha"_a = false,
            "alpha_value"_a = 255,
-           "name"_a = "format_converter"s,
+           "num_threads"_a = 1,
+           "name"_a = "bayer_demosaic"s,
            doc::BayerDemosaicOp::doc_BayerDemosaicOp_python)
       .def_property_readonly(
           "gxf_typename", &BayerDemosaicOp::gxf_typename, doc::BayerDemosaicOp::doc_gxf_typename)
@@ -34,6 +34,10 @@ Format conversion operator.
 PYDOC(FormatConverterOp_python, R"doc(
 Format conversion operator.
 
+Inputs are converted with NPP, inputs in host memory are first copied to the device. Without a
+GPU, inputs in host memory are converted on the CPU and the output is allocated in host memory,
+the `pool` must then support host allocations.
+
 Parameters
 ----------
 fragment : holoscan.core.Fragment
@@ -61,10 +65,14 @@ resize_width : int, optional
     Desired width for the (resized) output. Width will be unchanged if `resize_width` is 0.
 resize_mode : int, optional
     Resize mode enum value corresponding to NPP's nppiInterpolationMode (default=NPPI_INTER_CUBIC).
+    Without a GPU, inputs in host memory support the nearest (1), linear (2) and cubic (4 to 7)
+    modes.
 channel_order : sequence of int
     Sequence of integers describing how channel values are permuted.
 cuda_stream_pool : holoscan.resources.CudaStreamPool, optional
     CudaStreamPool instance to allocate CUDA streams.
+num_threads : int, optional
+    Number of threads converting the rows of images in host memory.
 name : str, optional
     The name of the operator.
 )doc")
@@ -87,6 +95,69 @@ spec : holoscan.core.OperatorSpec
 
 }  // namespace FormatConverterOp
 
+namespace PreprocessorOp {
+
+PYDOC(PreprocessorOp, R"doc(
+Image preprocessing operator for inference on the CPU.
+)doc")
+
+// PyPreprocessorOp Constructor
+PYDOC(PreprocessorOp_python, R"doc(
+Image preprocessing operator for inference on the CPU.
+
+Resizes an 8-bit RGB or RGBA image, reorders its channels, converts it to 32-bit floating point
+with a per-channel normalization and writes it with the HWC or CHW layout, in a single pass. The
+input must be in host memory and the output is allocated in the same kind of memory, the `pool`
+must then support host allocations. Use FormatConverterOp for inputs in device memory.
+
+Output channel `c` is `(value * (scale_max - scale_min) / 255 + scale_min - mean[c]) / std[c]`.
+
+Parameters
+----------
+fragment : holoscan.core.Fragment
+    The fragment that the operator belongs to.
+pool : holoscan.resources.Allocator
+    Memory pool allocator used by the operator.
+in_tensor_name : str, optional
+    The name of the input tensor.
+out_tensor_name : str, optional
+    The name of the output tensor.
+resize_height : int, optional
+    Desired height for the (resized) output. Height will be unchanged if `resize_height` is 0.
+resize_width : int, optional
+    Desired width for the (resized) output. Width will be unchanged if `resize_width` is 0.
+resize_mode : int, optional
+    Resize mode enum value corresponding to NPP's nppiInterpolationMode (default=NPPI_INTER_CUBIC).
+    The nearest (1), linear (2) and cubic (4 to 7) modes are supported.
+out_channel_order : sequence of int, optional
+    Input channel of each output channel (default: the first three channels).
+scale_min : float, optional
+    Value the input value 0 maps to.
+scale_max : float, optional
+    Value the input value 255 maps to.
+mean : sequence of float, optional
+    Mean subtracted from each output channel after scaling (default: 0).
+std : sequence of float, optional
+    Standard deviation dividing each output channel after the mean subtraction (default: 1).
+out_layout : str, optional
+    Layout of the output tensor, "hwc" or "chw".
+num_threads : int, optional
+    Number of threads processing the rows of the output.
+name : str, optional
+    The name of the operator.
+)doc")
+
+PYDOC(setup, R"doc(
+Define the operator specification.
+
+Parameters
+----------
+spec : holoscan.core.OperatorSpec
+    The operator specification.
+)doc")
+
+}  // namespace PreprocessorOp
+
 namespace AJASourceOp {
 
 PYDOC(AJASourceOp, R"doc(
@@ -261,6 +332,9 @@ Operator carrying out post-processing operations used in the ultrasound demo app
 PYDOC(SegmentationPostprocessorOp_python, R"doc(
 Operator carrying out post-processing operations used in the ultrasound demo app.
 
+An input tensor in host memory is processed on the CPU and the output is allocated in host
+memory, otherwise the processing runs on the GPU.
+
 Parameters
 ----------
 fragment : holoscan.core.Fragment
@@ -275,6 +349,8 @@ data_format : str, optional
     Data format of network output.
 cuda_stream_pool : holoscan.resources.CudaStreamPool, optional
     CudaStreamPool instance to allocate CUDA streams.
+num_threads : int, optional
+    Number of threads processing the rows of outputs in host memory.
 
 name : str, optional
     The name of the operator.
@@ -318,6 +394,31 @@ basename : str
     User specified file name without extension.
 flush_on_tick : bool, optional
     Flushes output buffer on every tick when ``True``.
+queue_size : int, optional
+    Number of entities which may wait for a writer thread. If zero value is
+    specified, entities are written when the operator is executed.
+drop_on_overflow : bool, optional
+    Drop entities when the queue is full instead of waiting for room.
+write_block_size : int, optional
+    Size in bytes of the blocks in which writes to the entity file are
+    coalesced.
+direct_io : bool, optional
+    Write the entity file with ``O_DIRECT``, bypassing the page cache.
+fsync_interval_ms : int, optional
+    Sync the files to the device when this many milliseconds have passed since
+    the last sync. If zero value is specified, it is ignored.
+fsync_bytes : int, optional
+    Sync the files to the device when this many bytes have been written since
+    the last sync. If zero value is specified, it is ignored.
+compression : str, optional
+    Compression of the recorded entities: ``"none"``, ``"lz4"`` or ``"zstd"``.
+compression_level : int, optional
+    Compression level used by zstd, from 1 to 22.
+delta_encoding : bool, optional
+    Encode entities as a lossless delta to the previous entity.
+keyframe_interval : int, optional
+    Number of entities between two entities recorded without delta encoding.
+    If zero value is specified, only the first entity is.
 name : str, optional
     The name of the operator.
 )doc")
@@ -338,6 +439,17 @@ spec : holoscan.core.OperatorSpec
     The operator specification.
 )doc")
 
+PYDOC(statistics, R"doc(
+Get a snapshot of the recording statistics.
+
+Returns
+-------
+dict
+    Number of frames received, written and dropped, number of backpressure
+    waits and their total time in nanoseconds, maximum queue depth, number of
+    bytes written and number of syncs.
+)doc")
+
 }  // namespace VideoStreamRecorderOp
 
 namespace VideoStreamReplayerOp {
@@ -374,6 +486,23 @@ count : int, optional
     Number of frame counts to playback. If zero value is specified, it is
     ignored. If the count is less than the number of frames in the video, it
     would finish early.
+prefetch_size : int, optional
+    Number of entities to read ahead on a background thread. If zero value is
+    specified, entities are read when the operator is executed.
+memory_mapped : bool, optional
+    Load the whole index up front and deserialize entities from a memory
+    mapping of the recording, which allows seeking. It is enabled automatically
+    when a playback range or a playback mode other than ``"forward"`` is given.
+start_frame : int, optional
+    First frame of the playback range.
+end_frame : int, optional
+    Frame after the last one of the playback range. If zero value is
+    specified, the range ends with the recording.
+playback_mode : {"forward", "reverse", "ping_pong"}, optional
+    Order in which the playback range is played.
+verify_checksum : bool, optional
+    Verify the checksum of each entity while deserializing it. Corrupted
+    entities are then handled according to `ignore_corrupted_entities`.
 name : str, optional
     The name of the operator.
 )doc")
@@ -394,6 +523,39 @@ spec : holoscan.core.OperatorSpec
     The operator specification.
 )doc")
 
+PYDOC(seek, R"doc(
+Continue playback from the given frame.
+
+The frame is clamped to the playback range and the seek is applied on the next
+tick. Requires the memory-mapped mode.
+
+Parameters
+----------
+frame : int
+    The frame number.
+)doc")
+
+PYDOC(frame_at_time, R"doc(
+Find the first frame logged at or after a timestamp.
+
+Requires the memory-mapped mode.
+
+Parameters
+----------
+log_time : int
+    The timestamp, in the clock domain of the recording.
+
+Returns
+-------
+int
+    The frame number, or `frame_count` if every frame was logged before
+    `log_time`.
+)doc")
+
+PYDOC(frame_count, R"doc(
+Number of frames in the recording (memory-mapped mode only, zero otherwise).
+)doc")
+
 }  // namespace VideoStreamReplayerOp
 
 namespace TensorRTInferenceOp {
@@ -495,11 +657,13 @@ backend : {"trt", "onnxrt"}
 allocator : holoscan.resources.Allocator
     Memory allocator to use for the output.
 inference_map : holoscan.operators.MultiAIInferenceOp.DataVecMap
-    Tensor to model map.
+    Tensor to model map. Models with several outputs map to a list of tensors,
+    one per model output.
 model_path_map : holoscan.operators.MultiAIInferenceOp.DataMap
     Path to the ONNX model to be loaded.
 pre_processor_map : holoscan.operators.MultiAIInferenceOp::DataVecMap
-    Pre processed data to model map.
+    Pre processed data to model map. Models with several inputs map to a list of
+    tensors, one per model input.
 in_tensor_names : sequence of str, optional
     Input tensors.
 out_tensor_names : sequence of str, optional
@@ -518,6 +682,35 @@ enable_fp16 : bool, optional
     Use 16-bit floating point computations.
 is_engine_path : bool, optional
     Whether the input model path mapping is for trt engine files
+inference_threads : int, optional
+    Number of threads running models in parallel. Each model always runs on
+    the same thread. If zero value is specified, one thread per model is used.
+batch_size : int, optional
+    Maximum number of samples run in one inference call. Only supported by the
+    ONNX runtime for models with a dynamic batch dimension. Operators running the
+    same model batch their concurrent inferences.
+batch_timeout_us : int, optional
+    Maximum time in microseconds an inference waits for others to fill its batch.
+intra_op_threads : int, optional
+    ONNX runtime threads running an operator of a model, 0 for the ONNX runtime
+    default.
+inter_op_threads : int, optional
+    ONNX runtime threads running independent operators of a model in parallel
+    execution mode, 0 for the ONNX runtime default.
+parallel_execution : bool, optional
+    Whether to run independent operators of a model in parallel.
+graph_optimization_level : {"disable", "basic", "extended", "all"}, optional
+    ONNX runtime graph optimization level.
+optimized_model_cache_path : str, optional
+    Directory where the ONNX runtime saves the optimized models and loads them
+    from on the next runs. Empty for no cache.
+input_mean : sequence of float, optional
+    Per channel mean normalizing uint8 input tensors to float32 on extraction,
+    as (value - mean) / std with channels interleaved in the last dimension.
+    Empty to pass uint8 tensors as is.
+input_std : sequence of float, optional
+    Per channel standard deviation normalizing uint8 input tensors, of the size
+    of ``input_mean``.
 name : str, optional
     The name of the operator.
 )doc")
@@ -559,7 +752,11 @@ allocator : holoscan.resources.Allocator
 post_processor_map : holoscan.operators.MultiAIPostprocessorOp.DataVecMap
     All post processor settings for each model.
 process_operations : holoscan.operators.MultiAIPostprocessorOp.DataVecMap
-    Operations in sequence on tensors.
+    Operations in sequence on tensors, each one ``"name"`` or ``"name,arg1,arg2"``. Built-in
+    operations are ``max_per_channel_scaled``, ``print``,
+    ``print_custom_binary_classification,<first>,<second>``, ``softmax``, ``sigmoid``,
+    ``argmax``, ``top_k,<k>``, ``threshold,<value>``, ``nms,<iou_threshold>[,<score_threshold>]``
+    and ``resize_mask,<height>,<width>``.
 processed_map : holoscan.operators.MultiAIPostprocessorOp::DataVecMap
     Input-output tensor mapping.
 in_tensor_names : sequence of str, optional
@@ -607,14 +804,18 @@ Format conversion operator.
 PYDOC(BayerDemosaicOp_python, R"doc(
 Format conversion operator.
 
+Images are demosaiced with NPP, images in host memory are first copied to the device. Without
+NPP, or with the gradient-corrected interpolation, images in host memory are demosaiced on the CPU
+and the output stays in host memory.
+
 Parameters
 ----------
 fragment : holoscan.core.Fragment
     The fragment that the operator belongs to.
 pool : holoscan.resources.Allocator
     Memory pool allocator used by the operator.
-cuda_stream_pool : holoscan.resources.CudaStreamPool
-    CUDA Stream pool to create CUDA streams
+cuda_stream_pool : holoscan.resources.CudaStreamPool, optional
+    CUDA Stream pool to create CUDA streams. Only needed for images in device memory.
 in_tensor_name : str, optional
     The name of the input tensor.
 out_tensor_name : str, optional
@@ -622,6 +823,7 @@ out_tensor_name : str, optional
 interpolation_mode : int, optional
     The interpolation model to be used for demosaicing. Values available at:
     https://docs.nvidia.com/cuda/npp/group__typedefs__npp.html#ga2b58ebd329141d560aa4367f1708f191
+    Images in host memory also accept 4 (NPPI_INTER_CUBIC) for a gradient-corrected interpolation.
 bayer_grid_pos : int, optional
     The Bayer grid position (default of 2 = GBRG). Values available at:
     https://docs.nvidia.com/cuda/npp/group__typedefs__npp.html#ga5597309d6766fb2dffe155990d915ecb
@@ -629,6 +831,8 @@ generate_alpha : bool, optional
     Generate alpha channel.
 alpha_value : int, optional
     Alpha value to be generated if `generate_alpha` is set to ``True``.
+num_threads : int, optional
+    Number of threads demosaicing the rows of images in host memory.
 name : str, optional
     The name of the operator.
 )doc")
@@ -21,6 +21,8 @@
     holoscan.resources.CudaStreamPool
     holoscan.resources.DoubleBufferReceiver
     holoscan.resources.DoubleBufferTransmitter
+    holoscan.resources.LockFreeReceiver
+    holoscan.resources.LockFreeTransmitter
     holoscan.resources.MemoryStorageType
     holoscan.resources.Receiver
     holoscan.resources.StdComponentSerializer
@@ -35,6 +37,8 @@ from ._resources import (
     CudaStreamPool,
     DoubleBufferReceiver,
     DoubleBufferTransmitter,
+    LockFreeReceiver,
+    LockFreeTransmitter,
     MemoryStorageType,
     Receiver,
     StdComponentSerializer,
@@ -49,6 +53,8 @@ __all__ = [
     "CudaStreamPool",
     "DoubleBufferReceiver",
     "DoubleBufferTransmitter",
+    "LockFreeReceiver",
+    "LockFreeTransmitter",
     "MemoryStorageType",
     "Receiver",
     "StdComponentSerializer",
@@ -30,6 +30,8 @@
 #include "holoscan/core/resources/gxf/cuda_stream_pool.hpp"
 #include "holoscan/core/resources/gxf/double_buffer_receiver.hpp"
 #include "holoscan/core/resources/gxf/double_buffer_transmitter.hpp"
+#include "holoscan/core/resources/gxf/lock_free_receiver.hpp"
+#include "holoscan/core/resources/gxf/lock_free_transmitter.hpp"
 #include "holoscan/core/resources/gxf/receiver.hpp"
 #include "holoscan/core/resources/gxf/std_component_serializer.hpp"
 #include "holoscan/core/resources/gxf/transmitter.hpp"
@@ -163,6 +165,47 @@ class PyDoubleBufferTransmitter : public DoubleBufferTransmitter {
   }
 };
 
+class PyLockFreeReceiver : public LockFreeReceiver {
+ public:
+  /* Inherit the constructors */
+  using LockFreeReceiver::LockFreeReceiver;
+
+  // Define a constructor that fully initializes the object.
+  PyLockFreeReceiver(Fragment* fragment, uint64_t capacity = 1UL, uint64_t policy = 2UL,
+                     bool multi_producer = false, uint64_t block_timeout_ms = 1000UL,
+                     const std::string& name = "lock_free_receiver")
+      : LockFreeReceiver(ArgList{Arg{"capacity", capacity},
+                                 Arg{"policy", policy},
+                                 Arg{"multi_producer", multi_producer},
+                                 Arg{"block_timeout_ms", block_timeout_ms}}) {
+    name_ = name;
+    fragment_ = fragment;
+    spec_ = std::make_shared<ComponentSpec>(fragment);
+    setup(*spec_.get());
+    initialize();
+  }
+};
+
+class PyLockFreeTransmitter : public LockFreeTransmitter {
+ public:
+  /* Inherit the constructors */
+  using LockFreeTransmitter::LockFreeTransmitter;
+
+  // Define a constructor that fully initializes the object.
+  PyLockFreeTransmitter(Fragment* fragment, uint64_t capacity = 1UL, uint64_t policy = 2UL,
+                        uint64_t block_timeout_ms = 1000UL,
+                        const std::string& name = "lock_free_transmitter")
+      : LockFreeTransmitter(ArgList{Arg{"capacity", capacity},
+                                    Arg{"policy", policy},
+                                    Arg{"block_timeout_ms", block_timeout_ms}}) {
+    name_ = name;
+    fragment_ = fragment;
+    spec_ = std::make_shared<ComponentSpec>(fragment);
+    setup(*spec_.get());
+    initialize();
+  }
+};
+
 class PyStdComponentSerializer : public StdComponentSerializer {
  public:
   /* Inherit the constructors */
@@ -318,6 +361,37 @@ PYBIND11_MODULE(_resources, m) {
            "spec"_a,
            doc::DoubleBufferTransmitter::doc_setup);
 
+  py::class_<LockFreeReceiver, PyLockFreeReceiver, Receiver, std::shared_ptr<LockFreeReceiver>>(
+      m, "LockFreeReceiver", doc::LockFreeReceiver::doc_LockFreeReceiver)
+      .def(py::init<Fragment*, uint64_t, uint64_t, bool, uint64_t, const std::string&>(),
+           "fragment"_a,
+           "capacity"_a = 1UL,
+           "policy"_a = 2UL,
+           "multi_producer"_a = false,
+           "block_timeout_ms"_a = 1000UL,
+           "name"_a = "lock_free_receiver"s,
+           doc::LockFreeReceiver::doc_LockFreeReceiver_python)
+      .def_property_readonly(
+          "gxf_typename", &LockFreeReceiver::gxf_typename, doc::LockFreeReceiver::doc_gxf_typename)
+      .def("setup", &LockFreeReceiver::setup, "spec"_a, doc::LockFreeReceiver::doc_setup);
+
+  py::class_<LockFreeTransmitter,
+             PyLockFreeTransmitter,
+             Transmitter,
+             std::shared_ptr<LockFreeTransmitter>>(
+      m, "LockFreeTransmitter", doc::LockFreeTransmitter::doc_LockFreeTransmitter)
+      .def(py::init<Fragment*, uint64_t, uint64_t, uint64_t, const std::string&>(),
+           "fragment"_a,
+           "capacity"_a = 1UL,
+           "policy"_a = 2UL,
+           "block_timeout_ms"_a = 1000UL,
+           "name"_a = "lock_free_transmitter"s,
+           doc::LockFreeTransmitter::doc_LockFreeTransmitter_python)
+      .def_property_readonly("gxf_typename",
+                             &LockFreeTransmitter::gxf_typename,
+                             doc::LockFreeTransmitter::doc_gxf_typename)
+      .def("setup", &LockFreeTransmitter::setup, "spec"_a, doc::LockFreeTransmitter::doc_setup);
+
   py::class_<StdComponentSerializer,
              PyStdComponentSerializer,
              gxf::GXFResource,
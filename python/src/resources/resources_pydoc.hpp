@@ -263,6 +263,104 @@ spec : holoscan.core.ComponentSpec
 
 }  // namespace DoubleBufferTransmitter
 
+namespace LockFreeReceiver {
+
+PYDOC(LockFreeReceiver, R"doc(
+Receiver using a lock-free ring buffer.
+
+New messages are available to the operator as soon as they are pushed.
+)doc")
+
+// Constructor
+PYDOC(LockFreeReceiver_python, R"doc(
+Receiver using a lock-free ring buffer.
+
+New messages are available to the operator as soon as they are pushed.
+
+Parameters
+----------
+fragment : holoscan.core.Fragment
+    The fragment to assign the resource to.
+capacity : int, optional
+    The capacity of the receiver.
+policy : int, optional
+    The policy to use (0=pop, 1=reject, 2=fault, 3=block).
+multi_producer : bool, optional
+    Whether messages may be pushed from several threads at once.
+block_timeout_ms : int, optional
+    How long a push waits for room when the policy is 3 (block).
+name : str, optional
+    The name of the receiver.
+)doc")
+
+PYDOC(gxf_typename, R"doc(
+The GXF type name of the resource.
+
+Returns
+-------
+str
+    The GXF type name of the resource
+)doc")
+
+PYDOC(setup, R"doc(
+Define the component specification.
+
+Parameters
+----------
+spec : holoscan.core.ComponentSpec
+    Component specification associated with the resource.
+)doc")
+
+}  // namespace LockFreeReceiver
+
+namespace LockFreeTransmitter {
+
+PYDOC(LockFreeTransmitter, R"doc(
+Transmitter using a lock-free ring buffer.
+
+Published messages are handed to the downstream receivers without a back stage.
+)doc")
+
+// Constructor
+PYDOC(LockFreeTransmitter_python, R"doc(
+Transmitter using a lock-free ring buffer.
+
+Published messages are handed to the downstream receivers without a back stage.
+
+Parameters
+----------
+fragment : holoscan.core.Fragment
+    The fragment to assign the resource to.
+capacity : int, optional
+    The capacity of the transmitter.
+policy : int, optional
+    The policy to use (0=pop, 1=reject, 2=fault, 3=block).
+block_timeout_ms : int, optional
+    How long a publish waits for room when the policy is 3 (block).
+name : str, optional
+    The name of the transmitter.
+)doc")
+
+PYDOC(gxf_typename, R"doc(
+The GXF type name of the resource.
+
+Returns
+-------
+str
+    The GXF type name of the resource
+)doc")
+
+PYDOC(setup, R"doc(
+Define the component specification.
+
+Parameters
+----------
+spec : holoscan.core.ComponentSpec
+    Component specification associated with the resource.
+)doc")
+
+}  // namespace LockFreeTransmitter
+
 namespace Receiver {
 
 PYDOC(Receiver, R"doc(
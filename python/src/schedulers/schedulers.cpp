@@ -0,0 +1,175 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <pybind11/pybind11.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "./schedulers_pydoc.hpp"
+#include "holoscan/core/component_spec.hpp"
+#include "holoscan/core/fragment.hpp"
+#include "holoscan/core/gxf/gxf_scheduler.hpp"
+#include "holoscan/core/schedulers/gxf/event_based_scheduler.hpp"
+#include "holoscan/core/schedulers/gxf/greedy_scheduler.hpp"
+#include "holoscan/core/schedulers/gxf/multithread_scheduler.hpp"
+
+using std::string_literals::operator""s;
+using pybind11::literals::operator""_a;
+
+#define STRINGIFY(x) #x
+#define MACRO_STRINGIFY(x) STRINGIFY(x)
+
+namespace py = pybind11;
+
+namespace holoscan {
+
+/* Trampoline classes for handling Python kwargs
+ *
+ * These add a constructor that takes a Fragment for which to initialize the scheduler.
+ * The explicit parameter list and default arguments take care of providing a Pythonic
+ * kwarg-based interface with appropriate default values matching the scheduler's
+ * default parameters in the C++ API `setup` method.
+ *
+ * The sequence of events in this constructor is based on Fragment::make_scheduler<SchedulerT>
+ */
+
+class PyGreedyScheduler : public GreedyScheduler {
+ public:
+  /* Inherit the constructors */
+  using GreedyScheduler::GreedyScheduler;
+
+  // Define a constructor that fully initializes the object.
+  PyGreedyScheduler(Fragment* fragment, bool stop_on_deadlock = true,
+                    double check_recession_period_ms = 0.0,
+                    const std::string& name = "greedy_scheduler")
+      : GreedyScheduler(ArgList{Arg{"stop_on_deadlock", stop_on_deadlock},
+                                Arg{"check_recession_period_ms", check_recession_period_ms}}) {
+    name_ = name;
+    fragment_ = fragment;
+    spec_ = std::make_shared<ComponentSpec>(fragment);
+    setup(*spec_.get());
+  }
+};
+
+class PyMultiThreadScheduler : public MultiThreadScheduler {
+ public:
+  /* Inherit the constructors */
+  using MultiThreadScheduler::MultiThreadScheduler;
+
+  // Define a constructor that fully initializes the object.
+  PyMultiThreadScheduler(Fragment* fragment, int64_t worker_thread_number = 1L,
+                         bool stop_on_deadlock = true, double check_recession_period_ms = 5.0,
+                         const std::string& name = "multithread_scheduler")
+      : MultiThreadScheduler(
+            ArgList{Arg{"worker_thread_number", worker_thread_number},
+                    Arg{"stop_on_deadlock", stop_on_deadlock},
+                    Arg{"check_recession_period_ms", check_recession_period_ms}}) {
+    name_ = name;
+    fragment_ = fragment;
+    spec_ = std::make_shared<ComponentSpec>(fragment);
+    setup(*spec_.get());
+  }
+};
+
+class PyEventBasedScheduler : public EventBasedScheduler {
+ public:
+  /* Inherit the constructors */
+  using EventBasedScheduler::EventBasedScheduler;
+
+  // Define a constructor that fully initializes the object.
+  PyEventBasedScheduler(Fragment* fragment, int64_t worker_thread_number = 1L,
+                        bool stop_on_deadlock = true,
+                        const std::string& name = "event_based_scheduler")
+      : EventBasedScheduler(ArgList{Arg{"worker_thread_number", worker_thread_number},
+                                    Arg{"stop_on_deadlock", stop_on_deadlock}}) {
+    name_ = name;
+    fragment_ = fragment;
+    spec_ = std::make_shared<ComponentSpec>(fragment);
+    setup(*spec_.get());
+  }
+};
+
+// End of trampoline classes for handling Python kwargs
+
+PYBIND11_MODULE(_schedulers, m) {
+  m.doc() = R"pbdoc(
+        Holoscan SDK Python Bindings
+        ---------------------------------------
+        .. currentmodule:: _schedulers
+        .. autosummary::
+           :toctree: _generate
+           add
+           subtract
+    )pbdoc";
+
+#ifdef VERSION_INFO
+  m.attr("__version__") = MACRO_STRINGIFY(VERSION_INFO);
+#else
+  m.attr("__version__") = "dev";
+#endif
+
+  py::class_<GreedyScheduler,
+             PyGreedyScheduler,
+             gxf::GXFScheduler,
+             std::shared_ptr<GreedyScheduler>>(
+      m, "GreedyScheduler", doc::GreedyScheduler::doc_GreedyScheduler)
+      .def(py::init<Fragment*, bool, double, const std::string&>(),
+           "fragment"_a,
+           "stop_on_deadlock"_a = true,
+           "check_recession_period_ms"_a = 0.0,
+           "name"_a = "greedy_scheduler"s,
+           doc::GreedyScheduler::doc_GreedyScheduler_python)
+      .def_property_readonly(
+          "gxf_typename", &GreedyScheduler::gxf_typename, doc::GreedyScheduler::doc_gxf_typename)
+      .def("setup", &GreedyScheduler::setup, "spec"_a, doc::GreedyScheduler::doc_setup);
+
+  py::class_<MultiThreadScheduler,
+             PyMultiThreadScheduler,
+             gxf::GXFScheduler,
+             std::shared_ptr<MultiThreadScheduler>>(
+      m, "MultiThreadScheduler", doc::MultiThreadScheduler::doc_MultiThreadScheduler)
+      .def(py::init<Fragment*, int64_t, bool, double, const std::string&>(),
+           "fragment"_a,
+           "worker_thread_number"_a = 1L,
+           "stop_on_deadlock"_a = true,
+           "check_recession_period_ms"_a = 5.0,
+           "name"_a = "multithread_scheduler"s,
+           doc::MultiThreadScheduler::doc_MultiThreadScheduler_python)
+      .def_property_readonly("gxf_typename",
+                             &MultiThreadScheduler::gxf_typename,
+                             doc::MultiThreadScheduler::doc_gxf_typename)
+      .def("setup", &MultiThreadScheduler::setup, "spec"_a, doc::MultiThreadScheduler::doc_setup);
+
+  py::class_<EventBasedScheduler,
+             PyEventBasedScheduler,
+             gxf::GXFScheduler,
+             std::shared_ptr<EventBasedScheduler>>(
+      m, "EventBasedScheduler", doc::EventBasedScheduler::doc_EventBasedScheduler)
+      .def(py::init<Fragment*, int64_t, bool, const std::string&>(),
+           "fragment"_a,
+           "worker_thread_number"_a = 1L,
+           "stop_on_deadlock"_a = true,
+           "name"_a = "event_based_scheduler"s,
+           doc::EventBasedScheduler::doc_EventBasedScheduler_python)
+      .def_property_readonly("gxf_typename",
+                             &EventBasedScheduler::gxf_typename,
+                             doc::EventBasedScheduler::doc_gxf_typename)
+      .def("setup", &EventBasedScheduler::setup, "spec"_a, doc::EventBasedScheduler::doc_setup);
+}  // PYBIND11_MODULE
+}  // namespace holoscan
@@ -0,0 +1,168 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef PYHOLOSCAN_SCHEDULERS_PYDOC_HPP
+#define PYHOLOSCAN_SCHEDULERS_PYDOC_HPP
+
+#include <string>
+
+#include "../macros.hpp"
+
+namespace holoscan::doc {
+
+namespace GreedyScheduler {
+
+PYDOC(GreedyScheduler, R"doc(
+Greedy scheduler class.
+
+Executes all operators of the fragment on a single thread. This is the default scheduler.
+)doc")
+
+// PyGreedyScheduler Constructor
+PYDOC(GreedyScheduler_python, R"doc(
+Greedy scheduler.
+
+Parameters
+----------
+fragment : holoscan.core.Fragment
+    The fragment the scheduler will be associated with
+stop_on_deadlock : bool, optional
+    If enabled the scheduler will stop when all operators are in a waiting state, but no
+    periodic operator exists to break the dead end.
+check_recession_period_ms : float, optional
+    The maximum duration (in ms) for which the scheduler waits when an operator is not yet
+    ready to run.
+name : str, optional
+    The name of the scheduler.
+)doc")
+
+PYDOC(gxf_typename, R"doc(
+The GXF type name of the scheduler.
+
+Returns
+-------
+str
+    The GXF type name of the scheduler
+)doc")
+
+PYDOC(setup, R"doc(
+Define the component specification.
+
+Parameters
+----------
+spec : holoscan.core.ComponentSpec
+    Component specification associated with the scheduler.
+)doc")
+
+}  // namespace GreedyScheduler
+
+namespace MultiThreadScheduler {
+
+PYDOC(MultiThreadScheduler, R"doc(
+Multi-thread scheduler class.
+
+Dispatches ready operators to a pool of worker threads.
+)doc")
+
+// PyMultiThreadScheduler Constructor
+PYDOC(MultiThreadScheduler_python, R"doc(
+Multi-thread scheduler.
+
+Parameters
+----------
+fragment : holoscan.core.Fragment
+    The fragment the scheduler will be associated with
+worker_thread_number : int, optional
+    The number of worker threads.
+stop_on_deadlock : bool, optional
+    If enabled the scheduler will stop when all operators are in a waiting state, but no
+    periodic operator exists to break the dead end.
+check_recession_period_ms : float, optional
+    The duration (in ms) that worker threads sleep when no operator is ready to run.
+name : str, optional
+    The name of the scheduler.
+)doc")
+
+PYDOC(gxf_typename, R"doc(
+The GXF type name of the scheduler.
+
+Returns
+-------
+str
+    The GXF type name of the scheduler
+)doc")
+
+PYDOC(setup, R"doc(
+Define the component specification.
+
+Parameters
+----------
+spec : holoscan.core.ComponentSpec
+    Component specification associated with the scheduler.
+)doc")
+
+}  // namespace MultiThreadScheduler
+
+namespace EventBasedScheduler {
+
+PYDOC(EventBasedScheduler, R"doc(
+Event-based scheduler class.
+
+Worker threads are woken up by scheduling events instead of polling. Requires a GXF release
+that provides ``nvidia::gxf::EventBasedScheduler``.
+)doc")
+
+// PyEventBasedScheduler Constructor
+PYDOC(EventBasedScheduler_python, R"doc(
+Event-based scheduler.
+
+Parameters
+----------
+fragment : holoscan.core.Fragment
+    The fragment the scheduler will be associated with
+worker_thread_number : int, optional
+    The number of worker threads.
+stop_on_deadlock : bool, optional
+    If enabled the scheduler will stop when all operators are in a waiting state, but no
+    periodic operator exists to break the dead end.
+name : str, optional
+    The name of the scheduler.
+)doc")
+
+PYDOC(gxf_typename, R"doc(
+The GXF type name of the scheduler.
+
+Returns
+-------
+str
+    The GXF type name of the scheduler
+)doc")
+
+PYDOC(setup, R"doc(
+Define the component specification.
+
+Parameters
+----------
+spec : holoscan.core.ComponentSpec
+    Component specification associated with the scheduler.
+)doc")
+
+}  // namespace EventBasedScheduler
+
+}  // namespace holoscan::doc
+
+#endif  // PYHOLOSCAN_SCHEDULERS_PYDOC_HPP
@@ -13,6 +13,8 @@
 # See the License for the specific language governing permissions and
 # limitations under the License.
 
+import json
+
 from holoscan.conditions import CountCondition
 from holoscan.core import Application, Operator, OperatorSpec
 from holoscan.logger import load_env_log_level
@@ -114,3 +116,23 @@ def test_my_ping_app(ping_config_file):
     app = MyPingApp()
     app.config(ping_config_file)
     app.run()
+
+
+def test_my_ping_app_profiler(ping_config_file, tmp_path):
+    load_env_log_level()
+    app = MyPingApp()
+    app.config(ping_config_file)
+    output_file = str(tmp_path / "profile.json")
+    app.profiler.enable()
+    app.profiler.output_file = output_file
+    app.run()
+
+    profiles = app.profiler.operator_profiles()
+    assert sorted(p.name for p in profiles) == ["mx", "rx", "tx"]
+    for profile in profiles:
+        assert profile.count > 0
+        assert profile.max_ms >= profile.min_ms
+
+    with open(output_file) as f:
+        data = json.load(f)
+    assert len(data["operators"]) == 3
@@ -41,6 +41,7 @@ from holoscan.core import (
 )
 from holoscan.executors import GXFExecutor
 from holoscan.graphs import FlowGraph
+from holoscan.resources import DoubleBufferTransmitter, LockFreeReceiver, LockFreeTransmitter
 
 
 class OpTx(Operator):
@@ -384,6 +385,27 @@ class TestOperatorSpec:
         assert "error" in captured.err
         assert "already exists" in captured.err
 
+    def test_connector(self, fragment):
+        c = OperatorSpec(fragment)
+        iospec = c.input("input_default")
+        assert iospec.connector_type == IOSpec.ConnectorType.DEFAULT
+        assert iospec.resource is None
+
+        iospec = c.input("input_lock_free").connector(
+            IOSpec.ConnectorType.LOCK_FREE, capacity=4, policy=0
+        )
+        assert iospec.connector_type == IOSpec.ConnectorType.LOCK_FREE
+        assert isinstance(iospec.resource, LockFreeReceiver)
+
+        iospec = c.output("output_lock_free").connector(IOSpec.ConnectorType.LOCK_FREE)
+        assert isinstance(iospec.resource, LockFreeTransmitter)
+
+        iospec = c.output("output_double_buffer").connector(
+            IOSpec.ConnectorType.DOUBLE_BUFFER, capacity=2
+        )
+        assert iospec.connector_type == IOSpec.ConnectorType.DOUBLE_BUFFER
+        assert isinstance(iospec.resource, DoubleBufferTransmitter)
+
     def test_dynamic_attribute_not_allowed(self, fragment):
         obj = OperatorSpec(fragment)
         with pytest.raises(AttributeError):
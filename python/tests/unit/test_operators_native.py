@@ -395,6 +395,43 @@ class TestMultiAIInferenceOp:
         assert captured.err.count("[error]") <= 1
         assert "warning" not in captured.err
 
+    def test_batching_initialization(self, app, config_file, capfd):
+        app.config(config_file)
+        model_path = os.path.join(sample_data_path, "multiai_ultrasound", "models")
+
+        model_path_map = {
+            "plax_chamber": os.path.join(model_path, "plax_chamber.onnx"),
+            "aortic_stenosis": os.path.join(model_path, "aortic_stenosis.onnx"),
+            "bmode_perspective": os.path.join(model_path, "bmode_perspective.onnx"),
+        }
+        kwargs = app.kwargs("multiai_inference")
+        # tensor names may also be given as lists, one per model output
+        kwargs["inference_map"] = {
+            model: [tensor] for model, tensor in kwargs["inference_map"].items()
+        }
+
+        op = MultiAIInferenceOp(
+            app,
+            name="multiai_inference",
+            allocator=UnboundedAllocator(app, name="pool"),
+            model_path_map=model_path_map,
+            batch_size=4,
+            batch_timeout_us=500,
+            intra_op_threads=2,
+            inter_op_threads=2,
+            parallel_execution=True,
+            graph_optimization_level="all",
+            input_mean=[123.675, 116.28, 103.53],
+            input_std=[58.395, 57.12, 57.375],
+            **kwargs,
+        )
+        assert isinstance(op, _Operator)
+        assert op.id != -1
+
+        captured = capfd.readouterr()
+        assert captured.err.count("[error]") <= 1
+        assert "warning" not in captured.err
+
 
 class TestMultiAIPostprocessorOp:
     def test_kwarg_based_initialization(self, app, config_file, capfd):
@@ -459,6 +496,43 @@ class TestVideoStreamRecorderOp:
         assert captured.err.count("[error]") <= 1
         assert "warning" not in captured.err
 
+    def test_async_initialization(self, app, config_file, capfd):
+        app.config(config_file)
+        op = VideoStreamRecorderOp(
+            name="recorder",
+            fragment=app,
+            queue_size=8,
+            write_block_size=1 << 20,
+            fsync_interval_ms=1000,
+            **app.kwargs("recorder"),
+        )
+        assert isinstance(op, _Operator)
+        stats = op.statistics()
+        assert stats["frames_received"] == 0
+        assert stats["frames_dropped"] == 0
+
+        captured = capfd.readouterr()
+        assert captured.err.count("[error]") <= 1
+        assert "warning" not in captured.err
+
+    @pytest.mark.parametrize("compression", ["none", "lz4", "zstd"])
+    def test_compression_initialization(self, app, config_file, capfd, compression):
+        app.config(config_file)
+        op = VideoStreamRecorderOp(
+            name="recorder",
+            fragment=app,
+            compression=compression,
+            compression_level=9,
+            delta_encoding=True,
+            keyframe_interval=10,
+            **app.kwargs("recorder"),
+        )
+        assert isinstance(op, _Operator)
+
+        captured = capfd.readouterr()
+        assert captured.err.count("[error]") <= 1
+        assert "warning" not in captured.err
+
 
 class TestVideoStreamReplayerOp:
     def test_kwarg_based_initialization(self, app, config_file, capfd):
@@ -483,6 +557,63 @@ class TestVideoStreamReplayerOp:
         assert captured.err.count("[error]") <= 1
         assert "warning" not in captured.err
 
+    def test_prefetch_initialization(self, app, config_file, capfd):
+        app.config(config_file)
+        data_path = os.environ.get("HOLOSCAN_SAMPLE_DATA_PATH", "../data")
+        op = VideoStreamReplayerOp(
+            name="replayer",
+            fragment=app,
+            directory=os.path.join(data_path, "endoscopy", "video"),
+            prefetch_size=4,
+            **app.kwargs("replayer"),
+        )
+        assert isinstance(op, _Operator)
+        assert op.id != -1
+
+        # assert no warnings logged
+        captured = capfd.readouterr()
+        assert captured.err.count("[error]") <= 1
+        assert "warning" not in captured.err
+
+    def test_memory_mapped_initialization(self, app, config_file, capfd):
+        app.config(config_file)
+        data_path = os.environ.get("HOLOSCAN_SAMPLE_DATA_PATH", "../data")
+        op = VideoStreamReplayerOp(
+            name="replayer",
+            fragment=app,
+            directory=os.path.join(data_path, "endoscopy", "video"),
+            start_frame=10,
+            end_frame=20,
+            playback_mode="ping_pong",
+            **app.kwargs("replayer"),
+        )
+        assert isinstance(op, _Operator)
+        assert op.frame_count > 20
+        assert op.frame_at_time(0) == 0
+        op.seek(15)
+
+        # assert no warnings logged
+        captured = capfd.readouterr()
+        assert captured.err.count("[error]") <= 1
+        assert "warning" not in captured.err
+
+    def test_verify_checksum_initialization(self, app, config_file, capfd):
+        app.config(config_file)
+        data_path = os.environ.get("HOLOSCAN_SAMPLE_DATA_PATH", "../data")
+        op = VideoStreamReplayerOp(
+            name="replayer",
+            fragment=app,
+            directory=os.path.join(data_path, "endoscopy", "video"),
+            verify_checksum=True,
+            **app.kwargs("replayer"),
+        )
+        assert isinstance(op, _Operator)
+
+        # assert no warnings logged
+        captured = capfd.readouterr()
+        assert captured.err.count("[error]") <= 1
+        assert "warning" not in captured.err
+
 
 @pytest.mark.parametrize(
     "type_str",
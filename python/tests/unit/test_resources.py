@@ -21,6 +21,8 @@ from holoscan.resources import (
     CudaStreamPool,
     DoubleBufferReceiver,
     DoubleBufferTransmitter,
+    LockFreeReceiver,
+    LockFreeTransmitter,
     MemoryStorageType,
     Receiver,
     StdComponentSerializer,
@@ -147,6 +149,54 @@ class TestStdDoubleBufferTransmitter:
         DoubleBufferTransmitter(app)
 
 
+class TestLockFreeReceiver:
+    def test_kwarg_based_initialization(self, app, capfd):
+        r = LockFreeReceiver(
+            fragment=app,
+            capacity=4,
+            policy=0,
+            multi_producer=True,
+            name="lock_free_receiver",
+        )
+        assert isinstance(r, Receiver)
+        assert isinstance(r, GXFResource)
+        assert isinstance(r, Resource)
+        assert r.id != -1
+        assert r.gxf_typename == "holoscan::gxf::LockFreeReceiver"
+
+        # assert no warnings or errors logged
+        captured = capfd.readouterr()
+        assert "error" not in captured.err
+        assert "warning" not in captured.err
+
+    def test_default_initialization(self, app):
+        LockFreeReceiver(app)
+
+
+class TestLockFreeTransmitter:
+    def test_kwarg_based_initialization(self, app, capfd):
+        r = LockFreeTransmitter(
+            fragment=app,
+            capacity=4,
+            policy=3,
+            block_timeout_ms=10,
+            name="lock_free_transmitter",
+        )
+        assert isinstance(r, Transmitter)
+        assert isinstance(r, GXFResource)
+        assert isinstance(r, Resource)
+        assert r.id != -1
+        assert r.gxf_typename == "holoscan::gxf::LockFreeTransmitter"
+
+        # assert no warnings or errors logged
+        captured = capfd.readouterr()
+        assert "error" not in captured.err
+        assert "warning" not in captured.err
+
+    def test_default_initialization(self, app):
+        LockFreeTransmitter(app)
+
+
 class TestStdComponentSerializer:
     def test_kwarg_based_initialization(self, app, capfd):
         r = StdComponentSerializer(
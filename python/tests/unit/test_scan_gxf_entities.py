@@ -0,0 +1,161 @@
+# SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import os
+import sys
+from io import BytesIO
+
+import numpy as np
+import pytest
+
+sys.path.insert(0, os.path.join(os.path.dirname(__file__), "..", "..", "..", "scripts"))
+
+import scan_gxf_entities  # noqa: E402
+from convert_video_to_gxf_entities import (  # noqa: E402
+    Component,
+    ComponentHeader,
+    EntityHeader,
+    EntityIndex,
+    MemoryStorageType,
+    PrimitiveType,
+    Tensor,
+    TensorHeader,
+    TensorType,
+)
+
+BASENAME = "tensor"
+FRAME_INTERVAL = 33_000_000
+# Entity header flag of LZ4 compressed components (CompressionMethod::kLz4)
+LZ4_FLAG = 1
+
+
+def serialize_entity(sequence_number, compressed):
+    """Serialize an entity with a single component, followed by its trailer."""
+    payload = BytesIO()
+    if compressed:
+        # The scanner only reads the component header of compressed components
+        name = b"frame"
+        data = bytes([sequence_number]) * 100
+        ComponentHeader(data=(len(data), *TensorType, len(name))).serialize(writer=payload)
+        payload.write(name)
+        payload.write(data)
+        flags = scan_gxf_entities.CHECKSUM_FLAG | LZ4_FLAG
+    else:
+        tensor_header = TensorHeader(
+            data=(MemoryStorageType.kHost, PrimitiveType.kUnsigned8, 1, 3, (4, 8, 3), (24, 3, 1))
+        )
+        array = np.full((4, 8, 3), sequence_number, dtype=np.uint8)
+        component_header = ComponentHeader(data=(0, *TensorType, 0))
+        Component(data=(component_header, "", Tensor(data=(tensor_header, array)))).write(
+            writer=payload
+        )
+        flags = scan_gxf_entities.CHECKSUM_FLAG
+
+    header = EntityHeader.HEADER_STRUCT.pack(0, 0, sequence_number, flags, 1, 0)
+    payload = payload.getvalue()
+    trailer = scan_gxf_entities.TRAILER_STRUCT.pack(
+        len(payload), scan_gxf_entities.crc32c(payload)
+    )
+    return header + payload + trailer
+
+
+@pytest.fixture
+def recording(tmp_path):
+    """Write a recording alternating uncompressed and compressed entities, and its index."""
+    offset = 0
+    index = []
+    with open(tmp_path / f"{BASENAME}.gxf_entities", "wb") as f:
+        for sequence_number in range(6):
+            entity = serialize_entity(sequence_number, compressed=sequence_number % 2 == 1)
+            f.write(entity)
+            index.append((sequence_number * FRAME_INTERVAL, len(entity), offset))
+            offset += len(entity)
+    with open(tmp_path / f"{BASENAME}.gxf_index", "wb") as f:
+        for entry in index:
+            EntityIndex(data=entry).write(writer=f, whence=os.SEEK_CUR)
+    return tmp_path, index
+
+
+def run_scanner(monkeypatch, directory, *args):
+    monkeypatch.setattr(
+        sys,
+        "argv",
+        ["scan_gxf_entities.py", "--basename", BASENAME, "--directory", str(directory), *args],
+    )
+    return scan_gxf_entities.main()
+
+
+def read_index(directory):
+    return [
+        (entry.log_time, entry.data_size, entry.data_offset)
+        for entry in scan_gxf_entities.read_index(str(directory / f"{BASENAME}.gxf_index"))
+    ]
+
+
+def test_crc32c():
+    assert scan_gxf_entities.crc32c(b"123456789") == 0xE3069283
+
+
+def test_verify_valid_recording(monkeypatch, recording):
+    directory, index = recording
+    assert run_scanner(monkeypatch, directory, "--verify") == 0
+
+    # The entities are walked without the index too
+    os.remove(directory / f"{BASENAME}.gxf_index")
+    entities, stop_reason = scan_gxf_entities.scan(
+        str(directory / f"{BASENAME}.gxf_entities"), [], verify=True
+    )
+    assert stop_reason == ""
+    assert [(entity.offset, entity.size) for entity in entities] == [
+        (offset, size) for _, size, offset in index
+    ]
+    assert not any(entity.corrupted for entity in entities)
+
+
+def test_verify_detects_corruption(monkeypatch, recording):
+    directory, index = recording
+    _, size, offset = index[2]
+    with open(directory / f"{BASENAME}.gxf_entities", "r+b") as f:
+        f.seek(offset + size // 2)
+        byte = f.read(1)
+        f.seek(offset + size // 2)
+        f.write(bytes([byte[0] ^ 0xFF]))
+
+    assert run_scanner(monkeypatch, directory, "--verify") == 1
+    entities, _ = scan_gxf_entities.scan(
+        str(directory / f"{BASENAME}.gxf_entities"), [], verify=True
+    )
+    assert [entity.header.sequence_number for entity in entities if entity.corrupted] == [2]
+
+
+@pytest.mark.parametrize("indexed_entities", [4, 6])
+def test_repair_truncated_recording(monkeypatch, recording, indexed_entities):
+    directory, index = recording
+    entities_path = directory / f"{BASENAME}.gxf_entities"
+    index_path = directory / f"{BASENAME}.gxf_index"
+
+    # Cut the last entity short and drop the index entries written after the cut
+    _, last_size, last_offset = index[-1]
+    os.truncate(entities_path, last_offset + last_size // 2)
+    with open(index_path, "r+b") as f:
+        f.truncate(indexed_entities * EntityIndex.HEADER_SIZE)
+
+    assert run_scanner(monkeypatch, directory, "--repair") == 0
+    assert os.path.getsize(entities_path) == last_offset
+    assert read_index(directory) == index[:-1]
+    assert os.path.getsize(str(index_path) + ".bak") == indexed_entities * EntityIndex.HEADER_SIZE
+
+    # The repaired recording is consistent
+    assert run_scanner(monkeypatch, directory, "--verify") == 0
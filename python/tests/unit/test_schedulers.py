@@ -0,0 +1,157 @@
+# SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import pytest
+
+from holoscan.conditions import CountCondition
+from holoscan.core import Application, Operator, Scheduler
+from holoscan.gxf import GXFScheduler
+from holoscan.schedulers import EventBasedScheduler, GreedyScheduler, MultiThreadScheduler
+
+
+class TestGreedyScheduler:
+    def test_kwarg_based_initialization(self, app, capfd):
+        scheduler = GreedyScheduler(
+            fragment=app,
+            name="greedy",
+            stop_on_deadlock=True,
+            check_recession_period_ms=1.0,
+        )
+        assert isinstance(scheduler, GXFScheduler)
+        assert isinstance(scheduler, Scheduler)
+        assert scheduler.gxf_typename == "nvidia::gxf::GreedyScheduler"
+
+        # assert no warnings or errors logged
+        captured = capfd.readouterr()
+        assert "error" not in captured.err
+        assert "warning" not in captured.err
+
+    def test_default_initialization(self, app):
+        GreedyScheduler(app)
+
+    def test_positional_initialization(self, app):
+        GreedyScheduler(app, False, 2.0, "greedy")
+
+
+class TestMultiThreadScheduler:
+    def test_kwarg_based_initialization(self, app, capfd):
+        scheduler = MultiThreadScheduler(
+            fragment=app,
+            name="multithread",
+            worker_thread_number=4,
+            stop_on_deadlock=True,
+            check_recession_period_ms=5.0,
+        )
+        assert isinstance(scheduler, GXFScheduler)
+        assert isinstance(scheduler, Scheduler)
+        assert scheduler.gxf_typename == "nvidia::gxf::MultiThreadScheduler"
+
+        # assert no warnings or errors logged
+        captured = capfd.readouterr()
+        assert "error" not in captured.err
+        assert "warning" not in captured.err
+
+    def test_default_initialization(self, app):
+        MultiThreadScheduler(app)
+
+    def test_positional_initialization(self, app):
+        MultiThreadScheduler(app, 2, True, 10.0, "multithread")
+
+
+class TestEventBasedScheduler:
+    def test_kwarg_based_initialization(self, app, capfd):
+        scheduler = EventBasedScheduler(
+            fragment=app,
+            name="event_based",
+            worker_thread_number=2,
+            stop_on_deadlock=True,
+        )
+        assert isinstance(scheduler, GXFScheduler)
+        assert isinstance(scheduler, Scheduler)
+        assert scheduler.gxf_typename == "nvidia::gxf::EventBasedScheduler"
+
+        # assert no warnings or errors logged
+        captured = capfd.readouterr()
+        assert "error" not in captured.err
+        assert "warning" not in captured.err
+
+    def test_default_initialization(self, app):
+        EventBasedScheduler(app)
+
+
+def test_fragment_default_scheduler(app):
+    scheduler = app.scheduler()
+    assert isinstance(scheduler, GreedyScheduler)
+
+
+def test_fragment_set_scheduler(app):
+    scheduler = MultiThreadScheduler(app, worker_thread_number=2, name="multithread")
+    app.scheduler(scheduler)
+    assert app.scheduler() is scheduler
+
+
+####################################################################################################
+# Test Ping app with the selected scheduler
+####################################################################################################
+
+
+class PingTxOp(Operator):
+    def __init__(self, *args, **kwargs):
+        self.index = 0
+        # Need to call the base class constructor last
+        super().__init__(*args, **kwargs)
+
+    def setup(self, spec):
+        spec.output("out")
+
+    def compute(self, op_input, op_output, context):
+        self.index += 1
+        op_output.emit(self.index, "out")
+
+
+class PingRxOp(Operator):
+    def __init__(self, *args, **kwargs):
+        # Need to call the base class constructor last
+        super().__init__(*args, **kwargs)
+
+    def setup(self, spec):
+        spec.input("in")
+
+    def compute(self, op_input, op_output, context):
+        value = op_input.receive("in")
+        print(f"#{self.name}:{value}")
+
+
+class PingSchedulerApp(Application):
+    def compose(self):
+        tx = PingTxOp(self, CountCondition(self, 5), name="tx")
+        rx1 = PingRxOp(self, name="rx1")
+        rx2 = PingRxOp(self, name="rx2")
+        self.add_flow(tx, rx1)
+        self.add_flow(tx, rx2)
+
+
+@pytest.mark.parametrize("scheduler_class", [GreedyScheduler, MultiThreadScheduler])
+def test_ping_app_with_scheduler(scheduler_class, capfd):
+    app = PingSchedulerApp()
+    if scheduler_class is MultiThreadScheduler:
+        app.scheduler(scheduler_class(app, worker_thread_number=2, name="scheduler"))
+    else:
+        app.scheduler(scheduler_class(app, name="scheduler"))
+    app.run()
+
+    captured = capfd.readouterr()
+    lines = [line[1:] for line in captured.out.splitlines() if line.startswith("#")]
+    assert sorted(lines) == sorted([f"rx{i}:{v}" for i in (1, 2) for v in range(1, 6)])
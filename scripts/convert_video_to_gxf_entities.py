@@ -979,6 +979,8 @@ class EntityRecorder:
         tensor = Tensor(data=(tensor_header, array))
         component = Component(data=(component_header, name, tensor))
         entity = Entity(data=(entity_header, [component]))
+        # Store the size of the components so that readers can skip the entity
+        entity_header._serialized_size = entity.size_in_bytes - EntityHeader.HEADER_SIZE
 
         timestamp = self._start_timestemp + int(self._index * 10**9 / self._framerate)
         offset = self._entities_file.tell()
@@ -0,0 +1,253 @@
+# SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Scan a GXF entity recording, verify its checksums and rebuild its index.
+
+Recordings made by ``VideoStreamRecorderOp`` follow the components of each entity with a trailer
+holding their size and CRC-32C. Entities are walked using the index, or by parsing their
+components where the index is missing or truncated.
+"""
+
+import os
+import shutil
+import statistics
+import struct
+import sys
+from typing import Dict, List, NamedTuple, Optional, Tuple
+
+from convert_video_to_gxf_entities import ComponentHeader, Entity, EntityHeader, EntityIndex
+
+# Entity header flag set when the components are followed by an entity trailer
+# (VideoStreamSerializer::kChecksumFlag)
+CHECKSUM_FLAG = 0x200
+# Entity header flags of compressed or delta-encoded components, which store their size
+# (kCompressionMethodMask | kDeltaEncodingFlag)
+COMPRESSED_FLAGS = 0x1FF
+# VideoStreamSerializer::EntityTrailer: serialized_size (uint64_t), checksum (uint32_t)
+TRAILER_STRUCT = struct.Struct("=QI")
+# Largest number of components in an entity (kMaxComponents in GXF)
+MAX_COMPONENTS = 1024
+
+try:
+    import crc32c as _crc32c
+
+    def crc32c(data: bytes) -> int:
+        return _crc32c.crc32c(data)
+
+except ImportError:
+    _CRC32C_TABLE = []
+    for _i in range(256):
+        _crc = _i
+        for _ in range(8):
+            _crc = (_crc >> 1) ^ (0x82F63B78 if _crc & 1 else 0)
+        _CRC32C_TABLE.append(_crc)
+
+    def crc32c(data: bytes) -> int:
+        # Slow fallback, install the 'crc32c' package to verify large recordings
+        crc = 0xFFFFFFFF
+        table = _CRC32C_TABLE
+        for byte in data:
+            crc = (crc >> 8) ^ table[(crc ^ byte) & 0xFF]
+        return crc ^ 0xFFFFFFFF
+
+
+class ScannedEntity(NamedTuple):
+    offset: int
+    size: int
+    header: EntityHeader
+    corrupted: bool
+
+
+def read_index(path: str) -> List[EntityIndex]:
+    """Read the complete entries of an index file, ignoring a truncated last entry."""
+    if not os.path.exists(path):
+        return []
+    entries = []
+    with open(path, "rb") as f:
+        count = os.path.getsize(path) // EntityIndex.HEADER_SIZE
+        for i in range(count):
+            entries.append(EntityIndex(reader=f, offset=i * EntityIndex.HEADER_SIZE))
+    return entries
+
+
+def trailer_size(header: EntityHeader) -> int:
+    return TRAILER_STRUCT.size if header.flags & CHECKSUM_FLAG else 0
+
+
+def parse_entity_size(f, offset: int, header: EntityHeader) -> int:
+    """Return the size of the entity at the given offset by walking its components."""
+    if not header.flags & COMPRESSED_FLAGS:
+        size = Entity(reader=f, offset=offset).size_in_bytes
+    else:
+        # Compressed components store their size in the component header
+        size = EntityHeader.HEADER_SIZE
+        for _ in range(header.component_count):
+            component_header = ComponentHeader(reader=f, offset=offset + size)
+            size += (
+                ComponentHeader.HEADER_SIZE
+                + component_header.name_size
+                + component_header.serialized_size
+            )
+    return size + trailer_size(header)
+
+
+def entity_size(f, offset: int, header: EntityHeader, index_sizes: Dict[int, int]) -> Optional[int]:
+    """Return the size of the entity at the given offset, or None if it cannot be determined."""
+    if offset in index_sizes:
+        return index_sizes[offset]
+    # Entities missing from the index, such as the last ones of an interrupted recording, are
+    # parsed
+    try:
+        return parse_entity_size(f, offset, header)
+    except Exception:
+        return None
+
+
+def verify_entity(f, offset: int, size: int) -> bool:
+    """Return whether the entity matches the size and checksum of its trailer."""
+    payload_size = size - EntityHeader.HEADER_SIZE - TRAILER_STRUCT.size
+    if payload_size < 0:
+        return False
+    f.seek(offset + EntityHeader.HEADER_SIZE)
+    payload = f.read(payload_size)
+    serialized_size, checksum = TRAILER_STRUCT.unpack(f.read(TRAILER_STRUCT.size))
+    return serialized_size == payload_size and crc32c(payload) == checksum
+
+
+def scan(
+    entities_path: str, index: List[EntityIndex], verify: bool
+) -> Tuple[List[ScannedEntity], str]:
+    """Walk the entity stream, returning the complete entities and why the walk stopped."""
+    index_sizes = {entry.data_offset: entry.data_size for entry in index}
+    file_size = os.path.getsize(entities_path)
+    entities = []
+    offset = 0
+    with open(entities_path, "rb") as f:
+        while offset < file_size:
+            if offset + EntityHeader.HEADER_SIZE > file_size:
+                return entities, f"truncated entity header at offset {offset}"
+            header = EntityHeader(reader=f, offset=offset)
+            if header.component_count > MAX_COMPONENTS:
+                return entities, f"invalid entity header at offset {offset}"
+            size = entity_size(f, offset, header, index_sizes)
+            if size is None or offset + size > file_size:
+                return entities, f"truncated entity {header.sequence_number} at offset {offset}"
+
+            corrupted = False
+            if verify and header.flags & CHECKSUM_FLAG:
+                corrupted = not verify_entity(f, offset, size)
+            entities.append(ScannedEntity(offset, size, header, corrupted))
+            offset += size
+    return entities, ""
+
+
+def rebuild_index(
+    entities: List[ScannedEntity], index: List[EntityIndex], framerate: float
+) -> List[EntityIndex]:
+    """Index the scanned entities, keeping the log times of the existing index entries.
+
+    Entities missing from the index are given log times following the last known one, at the
+    frame interval of the existing index or at the given frame rate.
+    """
+    log_times = {entry.data_offset: entry.log_time for entry in index}
+    intervals = [b.log_time - a.log_time for a, b in zip(index, index[1:])]
+    interval = int(statistics.median(intervals)) if intervals else int(1e9 / framerate)
+
+    rebuilt = []
+    log_time = None
+    for entity in entities:
+        if entity.offset in log_times:
+            log_time = log_times[entity.offset]
+        elif log_time is None:
+            log_time = 0
+        else:
+            log_time += interval
+        rebuilt.append(EntityIndex(data=(log_time, entity.size, entity.offset)))
+    return rebuilt
+
+
+def main():
+    import argparse
+
+    parser = argparse.ArgumentParser(
+        description=(
+            "Command line utility for scanning GXF entity recordings, verifying their checksums "
+            "and repairing truncated recordings by rebuilding their index."
+        )
+    )
+    parser.add_argument("--basename", default="tensor", help="Basename for gxf entities")
+    parser.add_argument("--directory", default="./", help="Directory for gxf entities")
+    parser.add_argument("--verify", action="store_true", help="Verify the checksum of each entity")
+    parser.add_argument(
+        "--repair",
+        action="store_true",
+        help=(
+            "Rebuild the index from the entity stream and cut a truncated last entity. The "
+            "previous index is kept with a '.bak' suffix."
+        ),
+    )
+    parser.add_argument(
+        "--framerate",
+        default=30,
+        type=float,
+        help="Frame rate of the log times given to entities missing from the index",
+    )
+    args = parser.parse_args()
+
+    index_path = os.path.join(args.directory, f"{args.basename}.gxf_index")
+    entities_path = os.path.join(args.directory, f"{args.basename}.gxf_entities")
+    if not os.path.exists(entities_path):
+        print(f"Entity file not found: {entities_path}", file=sys.stderr)
+        return 2
+
+    index = read_index(index_path)
+    entities, stop_reason = scan(entities_path, index, args.verify)
+    end_offset = entities[-1].offset + entities[-1].size if entities else 0
+    corrupted = [entity for entity in entities if entity.corrupted]
+    rebuilt = rebuild_index(entities, index, args.framerate)
+    index_matches = len(index) == len(rebuilt) and all(
+        (a.data_offset, a.data_size) == (b.data_offset, b.data_size) for a, b in zip(index, rebuilt)
+    )
+
+    print(f"{len(entities)} entities, {end_offset} bytes, {len(index)} index entries")
+    for entity in corrupted:
+        print(
+            f"Checksum mismatch for entity {entity.header.sequence_number} "
+            f"at offset {entity.offset}"
+        )
+    if stop_reason:
+        print(
+            f"Stopped at {stop_reason}: "
+            f"{os.path.getsize(entities_path) - end_offset} bytes not readable"
+        )
+    if not index_matches:
+        print("Index does not match the entity stream")
+
+    if args.repair and (stop_reason or not index_matches):
+        if os.path.exists(index_path):
+            shutil.copyfile(index_path, index_path + ".bak")
+        with open(index_path, "wb") as f:
+            for entry in rebuilt:
+                entry.write(writer=f, whence=os.SEEK_CUR)
+        if stop_reason:
+            os.truncate(entities_path, end_offset)
+        print(f"Rebuilt index with {len(rebuilt)} entries")
+        return 1 if corrupted else 0
+
+    return 1 if corrupted or stop_reason or not index_matches else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,58 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/conditions/gxf/target_time.hpp"
+
+namespace holoscan {
+
+TargetTimeCondition::TargetTimeCondition(const std::string& name,
+                                         gxf::TargetTimeSchedulingTerm* term)
+    : GXFCondition(name, term) {
+  target_ns_ = term->target_time();
+}
+
+void TargetTimeCondition::initialize() {
+  GXFCondition::initialize();
+  // Apply a target that was set before the GXF component existed
+  if (gxf_cptr_ && target_ns_ != 0) { target_time(target_ns_); }
+}
+
+void TargetTimeCondition::target_time(int64_t steady_clock_ns) {
+  if (gxf_cptr_) {
+    auto term = static_cast<gxf::TargetTimeSchedulingTerm*>(gxf_cptr_);
+    term->set_target_time(steady_clock_ns);
+  }
+  target_ns_ = steady_clock_ns;
+}
+
+int64_t TargetTimeCondition::target_time() const {
+  if (gxf_cptr_) {
+    auto term = static_cast<gxf::TargetTimeSchedulingTerm*>(gxf_cptr_);
+    return term->target_time();
+  }
+  return target_ns_;
+}
+
+void TargetTimeCondition::clear_target_time() {
+  if (gxf_cptr_) {
+    auto term = static_cast<gxf::TargetTimeSchedulingTerm*>(gxf_cptr_);
+    term->clear_target_time();
+  }
+  target_ns_ = 0;
+}
+
+}  // namespace holoscan
@@ -37,12 +37,18 @@
 #include "holoscan/core/gxf/gxf_extension_registrar.hpp"
 #include "holoscan/core/gxf/gxf_operator.hpp"
 #include "holoscan/core/gxf/gxf_resource.hpp"
+#include "holoscan/core/gxf/gxf_scheduler.hpp"
 #include "holoscan/core/gxf/gxf_tensor.hpp"
 #include "holoscan/core/gxf/gxf_utils.hpp"
 #include "holoscan/core/gxf/gxf_wrapper.hpp"
+#include "holoscan/core/gxf/lock_free_channel.hpp"
+#include "holoscan/core/gxf/target_time_scheduling_term.hpp"
 #include "holoscan/core/message.hpp"
 #include "holoscan/core/resources/gxf/double_buffer_receiver.hpp"
 #include "holoscan/core/resources/gxf/double_buffer_transmitter.hpp"
+#include "holoscan/core/resources/gxf/lock_free_receiver.hpp"
+#include "holoscan/core/resources/gxf/lock_free_transmitter.hpp"
+#include "holoscan/core/schedulers/gxf/greedy_scheduler.hpp"
 
 #include "gxf/std/default_extension.hpp"
 
@@ -94,6 +100,131 @@ GXFExecutor::~GXFExecutor() {
   }
 }
 
+/**
+ * @brief Add a transmitter for an additional target of a (native) output port.
+ *
+ * The transmitter is added to the operator's entity with the same type and queue parameters as
+ * the port's transmitter. Each DownstreamReceptiveSchedulingTerm of the port (the default one
+ * when the port has no condition) is duplicated for the new transmitter with the same `min_size`,
+ * so that the operator waits for every target (per-consumer backpressure). Overflow is handled by
+ * the policy of each target's receiver.
+ *
+ * @return The component ID of the new transmitter.
+ */
+static gxf_uid_t add_fanout_transmitter(gxf_context_t context, IOSpec* io_spec, size_t index) {
+  auto check = [&](gxf_result_t code, const char* what) {
+    if (code != GXF_SUCCESS) {
+      auto message = fmt::format("Unable to add fan-out transmitter {} of '{}' ({}): {}",
+                                 index,
+                                 io_spec->name(),
+                                 what,
+                                 GxfResultStr(code));
+      HOLOSCAN_LOG_ERROR("{}", message);
+      throw std::runtime_error(message);
+    }
+  };
+
+  auto source_resource = std::dynamic_pointer_cast<GXFResource>(io_spec->resource());
+  gxf_uid_t eid = source_resource->gxf_eid();
+  gxf_uid_t source_cid = source_resource->gxf_cid();
+
+  gxf_tid_t tx_tid;
+  check(GxfComponentType(context, source_cid, &tx_tid), "transmitter type");
+  auto tx_name = fmt::format("__fanout_{}_{}", io_spec->name(), index);
+  gxf_uid_t tx_cid;
+  check(GxfComponentAdd(context, eid, tx_tid, tx_name.c_str(), &tx_cid), "transmitter");
+  for (const char* key : {"capacity", "policy", "block_timeout_ms"}) {
+    uint64_t value = 0;
+    if (GxfParameterGetUInt64(context, source_cid, key, &value) == GXF_SUCCESS) {
+      check(GxfParameterSetUInt64(context, tx_cid, key, value), key);
+    }
+  }
+
+  // `min_size` of each scheduling term to duplicate
+  std::vector<uint64_t> term_min_sizes;
+  if (io_spec->conditions().empty()) { term_min_sizes.push_back(1); }
+  for (const auto& [condition_type, condition] : io_spec->conditions()) {
+    if (condition_type != ConditionType::kDownstreamMessageAffordable) { continue; }
+    uint64_t min_size = 1;
+    auto gxf_condition = std::dynamic_pointer_cast<GXFCondition>(condition);
+    if (gxf_condition) {
+      GxfParameterGetUInt64(context, gxf_condition->gxf_cid(), "min_size", &min_size);
+    }
+    term_min_sizes.push_back(min_size);
+  }
+  if (!term_min_sizes.empty()) {
+    gxf_tid_t term_tid;
+    check(GxfComponentTypeId(context, "nvidia::gxf::DownstreamReceptiveSchedulingTerm", &term_tid),
+          "scheduling term type");
+    for (size_t term_index = 0; term_index < term_min_sizes.size(); ++term_index) {
+      gxf_uid_t term_cid;
+      auto term_name =
+          fmt::format("__condition_fanout_{}_{}_{}", io_spec->name(), index, term_index);
+      check(GxfComponentAdd(context, eid, term_tid, term_name.c_str(), &term_cid),
+            "scheduling term");
+      check(GxfParameterSetHandle(context, term_cid, "transmitter", tx_cid), "transmitter handle");
+      check(GxfParameterSetUInt64(context, term_cid, "min_size", term_min_sizes[term_index]),
+            "min_size");
+    }
+  }
+
+  void* tx_ptr = nullptr;
+  check(GxfComponentPointer(context, tx_cid, tx_tid, &tx_ptr), "transmitter pointer");
+  io_spec->add_fanout_connector_ptr(tx_ptr);
+  return tx_cid;
+}
+
+/**
+ * @brief Whether the scheduler ticks a single operator at a time.
+ *
+ * This is the case of the greedy scheduler and of the multi-thread and event-based schedulers with
+ * a single worker thread.
+ */
+static bool is_single_threaded(gxf_context_t context, GXFScheduler* scheduler) {
+  if (dynamic_cast<GreedyScheduler*>(scheduler) != nullptr) { return true; }
+  int64_t worker_thread_number = 0;
+  if (GxfParameterGetInt64(
+          context, scheduler->gxf_cid(), "worker_thread_number", &worker_thread_number) !=
+      GXF_SUCCESS) {
+    return false;
+  }
+  return worker_thread_number <= 1;
+}
+
+/**
+ * @brief Throw if a port of the operator uses a lock-free connector with the 'block' overflow
+ * policy.
+ *
+ * A blocked push waits for the consumer on the scheduler thread, so with a single-threaded
+ * scheduler the consumer never runs and the push always times out.
+ */
+static void check_no_blocking_connector(gxf_context_t context, Operator* op) {
+  auto check = [&](const std::unordered_map<std::string, std::unique_ptr<IOSpec>>& io_specs) {
+    for (const auto& [port_name, io_spec] : io_specs) {
+      const auto& resource = io_spec->resource();
+      if (!std::dynamic_pointer_cast<::holoscan::LockFreeReceiver>(resource) &&
+          !std::dynamic_pointer_cast<::holoscan::LockFreeTransmitter>(resource)) {
+        continue;
+      }
+      const auto gxf_resource = std::dynamic_pointer_cast<GXFResource>(resource);
+      uint64_t policy = 0;
+      if (GxfParameterGetUInt64(context, gxf_resource->gxf_cid(), "policy", &policy) ==
+              GXF_SUCCESS &&
+          policy == static_cast<uint64_t>(OverflowPolicy::kBlock)) {
+        auto message = fmt::format(
+            "Port '{}' of operator '{}' uses the 'block' overflow policy, which needs a scheduler "
+            "with several worker threads",
+            port_name,
+            op->name());
+        HOLOSCAN_LOG_ERROR("{}", message);
+        throw std::runtime_error(message);
+      }
+    }
+  };
+  check(op->spec()->inputs());
+  check(op->spec()->outputs());
+}
+
 void GXFExecutor::run(Graph& graph) {
   auto context = context_;
 
@@ -118,11 +249,22 @@ void GXFExecutor::run(Graph& graph) {
   gxf_uid_t clock_cid;
   code = GxfComponentAdd(context, eid, clock_tid, "clock", &clock_cid);
 
-  gxf_tid_t sched_tid;
-  code = GxfComponentTypeId(context, "nvidia::gxf::GreedyScheduler", &sched_tid);
-  gxf_uid_t sched_cid;
-  code = GxfComponentAdd(context, eid, sched_tid, nullptr, &sched_cid);
-  code = GxfParameterSetHandle(context, sched_cid, "clock", clock_cid);
+  // Add the scheduler selected by the fragment (GreedyScheduler by default)
+  auto scheduler = std::dynamic_pointer_cast<gxf::GXFScheduler>(fragment_->scheduler());
+  if (!scheduler) {
+    HOLOSCAN_LOG_ERROR("The scheduler of the fragment is not a GXF scheduler");
+    throw std::runtime_error("The scheduler of the fragment is not a GXF scheduler");
+  }
+  scheduler->gxf_eid(eid);
+  scheduler->initialize();
+  code = GxfParameterSetHandle(context, scheduler->gxf_cid(), "clock", clock_cid);
+
+  // The fan-out transmitters of a previous run belong to the entities built for it
+  for (const auto& op : graph.get_operators()) {
+    for (auto& [port_name, io_spec] : op->spec()->outputs()) {
+      io_spec->clear_fanout_connector_ptrs();
+    }
+  }
 
   // Add connections
   std::deque<holoscan::Graph::NodeType> worklist;
@@ -132,6 +274,13 @@ void GXFExecutor::run(Graph& graph) {
   std::unordered_set<holoscan::Graph::NodeType> visited_nodes;
   visited_nodes.reserve(operators.size());
 
+  if (is_single_threaded(context, scheduler.get())) {
+    for (const auto& op : operators) { check_no_blocking_connector(context, op.get()); }
+  }
+
+  // Number of transmitters connected to each receiver, to detect fan-in
+  std::unordered_map<gxf_uid_t, size_t> upstream_counts;
+
   while (true) {
     if (worklist.empty()) {
       // If the worklist is empty, we check if we have visited all nodes.
@@ -163,6 +312,7 @@ void GXFExecutor::run(Graph& graph) {
 
     // Collect connections
     std::unordered_map<gxf_uid_t, std::set<gxf_uid_t>> connections;
+    std::unordered_map<gxf_uid_t, IOSpec*> source_specs;
     for (auto& next_op : next_operators) {
       auto next_op_spec = next_op->spec();
       auto& next_op_name = next_op->name();
@@ -186,7 +336,8 @@ void GXFExecutor::run(Graph& graph) {
           if (connections.find(source_cid) == connections.end()) {
             connections[source_cid] = std::set<gxf_uid_t>();
           }
-          connections[source_cid].insert(target_cid);
+          if (connections[source_cid].insert(target_cid).second) { ++upstream_counts[target_cid]; }
+          source_specs[source_cid] = op_spec->outputs()[source_port].get();
         }
       }
 
@@ -207,8 +358,20 @@ void GXFExecutor::run(Graph& graph) {
         continue;
       }
 
-      // Insert GXF's Broadcast component if source port is connected to multiple targets
-      if (target_cids.size() > 1) {
+      if (target_cids.size() > 1 && op->operator_type() == Operator::OperatorType::kNative) {
+        // Native operators publish each message to one transmitter per target (see
+        // GXFOutputContext), so all the targets share the message entity without an extra
+        // Broadcast entity and scheduler hop in between.
+        IOSpec* source_spec = source_specs[source_cid];
+        auto target_it = target_cids.begin();
+        ::holoscan::gxf::add_connection(context, source_cid, *target_it);
+        for (size_t index = 1; ++target_it != target_cids.end(); ++index) {
+          gxf_uid_t tx_cid = add_fanout_transmitter(context, source_spec, index);
+          ::holoscan::gxf::add_connection(context, tx_cid, *target_it);
+        }
+      } else if (target_cids.size() > 1) {
+        // Insert GXF's Broadcast component if the source port of a GXF operator (whose codelet
+        // publishes to a single transmitter) is connected to multiple targets
         const char* source_cname = "";
         code = GxfComponentName(context, source_cid, &source_cname);
         gxf_uid_t broadcast_eid;
@@ -274,6 +437,24 @@ void GXFExecutor::run(Graph& graph) {
   }
   (void)code;
 
+  // Several transmitters may push to a receiver with fan-in, from different worker threads, so
+  // lock-free receivers use their multi-producer ring for it.
+  gxf_tid_t lock_free_receiver_tid = GxfTidNull();
+  GxfComponentTypeId(context, "holoscan::gxf::LockFreeReceiver", &lock_free_receiver_tid);
+  for (const auto& [target_cid, upstream_count] : upstream_counts) {
+    if (upstream_count < 2) { continue; }
+    gxf_tid_t target_tid = GxfTidNull();
+    if (GxfComponentType(context, target_cid, &target_tid) != GXF_SUCCESS ||
+        target_tid != lock_free_receiver_tid) {
+      continue;
+    }
+    HOLOSCAN_LOG_DEBUG("Lock-free receiver {} has {} upstream transmitters, using a "
+                       "multi-producer ring",
+                       target_cid,
+                       upstream_count);
+    GXF_ASSERT_SUCCESS(GxfParameterSetBool(context, target_cid, "multi_producer", true));
+  }
+
   // Install signal handler
   s_signal_context = context;
   signal(SIGINT, [](int signum) {
@@ -294,6 +475,22 @@ void GXFExecutor::run(Graph& graph) {
   GXF_ASSERT_SUCCESS(GxfGraphRunAsync(context));
   HOLOSCAN_LOG_INFO("Waiting for completion...");
   GXF_ASSERT_SUCCESS(GxfGraphWait(context));
+
+  // Write the operator profile if profiling is enabled
+  auto& profiler = fragment_->profiler();
+  if (profiler.enabled()) {
+    for (const auto& profile : profiler.operator_profiles()) {
+      HOLOSCAN_LOG_INFO(
+          "Operator '{}': {} ticks, compute mean {:.3f} ms / p99 {:.3f} ms, {:.2f} Hz",
+          profile.name,
+          profile.count,
+          profile.mean_ms,
+          profile.p99_ms,
+          profile.throughput_hz);
+    }
+    if (!profiler.output_file().empty()) { profiler.dump(profiler.output_file()); }
+  }
+
   HOLOSCAN_LOG_INFO("Deactivating Graph...");
   GXF_ASSERT_SUCCESS(GxfGraphDeactivate(context));
 }
@@ -329,6 +526,8 @@ void GXFExecutor::create_input_port(Fragment* fragment, gxf_context_t gxf_contex
     gxf_tid_t double_buffer_receiver_tid{};
     GxfComponentTypeId(
         gxf_context, "nvidia::gxf::DoubleBufferReceiver", &double_buffer_receiver_tid);
+    gxf_tid_t lock_free_receiver_tid{};
+    GxfComponentTypeId(gxf_context, "holoscan::gxf::LockFreeReceiver", &lock_free_receiver_tid);
 
     if (receiver_tid == double_buffer_receiver_tid) {
       nvidia::gxf::DoubleBufferReceiver* double_buffer_receiver_ptr = nullptr;
@@ -348,6 +547,22 @@ void GXFExecutor::create_input_port(Fragment* fragment, gxf_context_t gxf_contex
             rx_name,
             entity_name);
       }
+    } else if (receiver_tid == lock_free_receiver_tid) {
+      holoscan::gxf::LockFreeReceiver* lock_free_receiver_ptr = nullptr;
+      GxfComponentPointer(gxf_context,
+                          receiver_cid,
+                          receiver_tid,
+                          reinterpret_cast<void**>(&lock_free_receiver_ptr));
+
+      if (lock_free_receiver_ptr) {
+        io_spec->resource(
+            std::make_shared<holoscan::LockFreeReceiver>(rx_name, lock_free_receiver_ptr));
+      } else {
+        HOLOSCAN_LOG_ERROR(
+            "Unable to get LockFreeReceiver pointer for the handle: '{}' in '{}' entity",
+            rx_name,
+            entity_name);
+      }
     } else {
       HOLOSCAN_LOG_ERROR("Unsupported GXF receiver type for the handle: '{}' in '{}' entity",
                          rx_name,
@@ -357,8 +572,10 @@ void GXFExecutor::create_input_port(Fragment* fragment, gxf_context_t gxf_contex
   }
 
   gxf_result_t code;
-  // Create Receiver component for this input
-  auto rx_resource = std::make_shared<DoubleBufferReceiver>();
+  // Create Receiver component for this input. A DoubleBufferReceiver is used unless another
+  // connector was selected with `IOSpec::connector()`.
+  auto rx_resource = std::dynamic_pointer_cast<Receiver>(io_spec->resource());
+  if (!rx_resource) { rx_resource = std::make_shared<DoubleBufferReceiver>(); }
   rx_resource->name(rx_name);
   rx_resource->fragment(fragment);
   auto rx_spec = std::make_shared<ComponentSpec>(fragment);
@@ -437,6 +654,9 @@ void GXFExecutor::create_output_port(Fragment* fragment, gxf_context_t gxf_conte
     gxf_tid_t double_buffer_transmitter_tid{};
     GxfComponentTypeId(
         gxf_context, "nvidia::gxf::DoubleBufferTransmitter", &double_buffer_transmitter_tid);
+    gxf_tid_t lock_free_transmitter_tid{};
+    GxfComponentTypeId(
+        gxf_context, "holoscan::gxf::LockFreeTransmitter", &lock_free_transmitter_tid);
 
     if (transmitter_tid == double_buffer_transmitter_tid) {
       nvidia::gxf::DoubleBufferTransmitter* double_buffer_transmitter_ptr = nullptr;
@@ -456,6 +676,22 @@ void GXFExecutor::create_output_port(Fragment* fragment, gxf_context_t gxf_conte
             tx_name,
             entity_name);
       }
+    } else if (transmitter_tid == lock_free_transmitter_tid) {
+      holoscan::gxf::LockFreeTransmitter* lock_free_transmitter_ptr = nullptr;
+      GxfComponentPointer(gxf_context,
+                          transmitter_cid,
+                          transmitter_tid,
+                          reinterpret_cast<void**>(&lock_free_transmitter_ptr));
+
+      if (lock_free_transmitter_ptr) {
+        io_spec->resource(std::make_shared<holoscan::LockFreeTransmitter>(
+            tx_name, lock_free_transmitter_ptr));
+      } else {
+        HOLOSCAN_LOG_ERROR(
+            "Unable to get LockFreeTransmitter pointer for the handle: '{}' in '{}' entity",
+            tx_name,
+            entity_name);
+      }
     } else {
       HOLOSCAN_LOG_ERROR("Unsupported GXF transmitter type for the handle: '{}' in '{}' entity",
                          tx_name,
@@ -465,8 +701,10 @@ void GXFExecutor::create_output_port(Fragment* fragment, gxf_context_t gxf_conte
   }
 
   gxf_result_t code;
-  // Create Transmitter component for this output
-  auto tx_resource = std::make_shared<DoubleBufferTransmitter>();
+  // Create Transmitter component for this output. A DoubleBufferTransmitter is used unless another
+  // connector was selected with `IOSpec::connector()`.
+  auto tx_resource = std::dynamic_pointer_cast<Transmitter>(io_spec->resource());
+  if (!tx_resource) { tx_resource = std::make_shared<DoubleBufferTransmitter>(); }
   tx_resource->name(tx_name);
   tx_resource->fragment(fragment);
   auto tx_spec = std::make_shared<ComponentSpec>(fragment);
@@ -569,6 +807,10 @@ bool GXFExecutor::initialize_operator(Operator* op) {
           context_, codelet_cid, codelet_tid, reinterpret_cast<void**>(&gxf_wrapper));
       if (gxf_wrapper) {
         gxf_wrapper->set_operator(op);
+        auto& profiler = fragment_->profiler();
+        if (profiler.enabled()) {
+          gxf_wrapper->set_profiler(&profiler, profiler.register_operator(op->name()));
+        }
       } else {
         HOLOSCAN_LOG_ERROR("Unable to get GXFWrapper for Operator '{}'", op->name());
       }
@@ -754,6 +996,15 @@ void GXFExecutor::register_extensions() {
     extension_factory.add_type<holoscan::Tensor>("Holoscan's Tensor type",
                                                  {0xa5eb0ed57d7f4aa2, 0xb5865ccca0ef955c});
 
+    extension_factory.add_component<holoscan::gxf::LockFreeReceiver, nvidia::gxf::Receiver>(
+        "Receiver backed by a lock-free ring buffer", {0x3c9a7a1e5d2b4f60, 0x9e1d84c2b7f03a55});
+    extension_factory.add_component<holoscan::gxf::LockFreeTransmitter, nvidia::gxf::Transmitter>(
+        "Transmitter backed by a lock-free ring buffer", {0x7f2e61b0c84d4a9e, 0xb3a5c9d1e6f20b47});
+    extension_factory
+        .add_component<holoscan::gxf::TargetTimeSchedulingTerm, nvidia::gxf::SchedulingTerm>(
+            "Scheduling term waiting for a steady-clock target time",
+            {0x5b8e0f3a2c7d4e19, 0xa64c1d9b03e7f582});
+
     if (!extension_factory.register_extension()) {
       HOLOSCAN_LOG_ERROR("Failed to register Holoscan SDK internal extension");
     }
@@ -20,6 +20,7 @@
 
 #include <iterator>  // for std::back_inserter
 #include <set>
+#include <stdexcept>
 #include <string>
 #include <typeinfo>
 #include <utility>
@@ -30,6 +31,9 @@
 #include "holoscan/core/executors/gxf/gxf_executor.hpp"
 #include "holoscan/core/graphs/flow_graph.hpp"
 #include "holoscan/core/operator.hpp"
+#include "holoscan/core/schedulers/gxf/event_based_scheduler.hpp"
+#include "holoscan/core/schedulers/gxf/greedy_scheduler.hpp"
+#include "holoscan/core/schedulers/gxf/multithread_scheduler.hpp"
 
 namespace holoscan {
 
@@ -72,6 +76,51 @@ Executor& Fragment::executor() {
   if (!executor_) { executor_ = make_executor<gxf::GXFExecutor>(); }
   return *executor_;
 }
+
+Profiler& Fragment::profiler() {
+  if (!profiler_) { profiler_ = std::make_unique<Profiler>(); }
+  return *profiler_;
+}
+
+void Fragment::scheduler(const std::shared_ptr<Scheduler>& scheduler) {
+  scheduler_ = scheduler;
+}
+
+std::shared_ptr<Scheduler> Fragment::scheduler() {
+  if (!scheduler_) {
+    // Look for a top-level 'scheduler' map in the configuration. The 'type' key selects the
+    // scheduler and the remaining keys are passed to it as arguments.
+    std::string scheduler_type = "greedy";
+    ArgList args;
+    for (const auto& yaml_node : config().yaml_nodes()) {
+      if (!yaml_node.IsMap()) { continue; }
+      const auto scheduler_node = yaml_node["scheduler"];
+      if (!scheduler_node || !scheduler_node.IsMap()) { continue; }
+      for (const auto& p : scheduler_node) {
+        const std::string param_key = p.first.as<std::string>();
+        if (param_key == "type") {
+          scheduler_type = p.second.as<std::string>();
+          continue;
+        }
+        args.add(Arg(param_key) = p.second);
+      }
+    }
+
+    if (scheduler_type == "multi_thread") {
+      scheduler_ = make_scheduler<MultiThreadScheduler>("scheduler", args);
+    } else if (scheduler_type == "event_based") {
+      scheduler_ = make_scheduler<EventBasedScheduler>("scheduler", args);
+    } else if (scheduler_type == "greedy") {
+      scheduler_ = make_scheduler<GreedyScheduler>("scheduler", args);
+    } else {
+      // A misspelled type would otherwise silently change how the operators are threaded
+      throw std::runtime_error("Unknown scheduler type '" + scheduler_type +
+                               "' (expected one of: greedy, multi_thread, event_based)");
+    }
+  }
+  return scheduler_;
+}
+
 ArgList Fragment::from_config(const std::string& key) {
   (void)key;
   auto& yaml_nodes = config().yaml_nodes();
@@ -36,7 +36,9 @@ GXFExecutionContext::GXFExecutionContext(gxf_context_t context,
                                          std::shared_ptr<GXFInputContext> gxf_input_context,
                                          std::shared_ptr<GXFOutputContext> gxf_output_context)
     : gxf_input_context_(gxf_input_context), gxf_output_context_(gxf_output_context) {
-      context_ = context;
+  context_ = context;
+  input_context_ = gxf_input_context_.get();
+  output_context_ = gxf_output_context_.get();
 }
 
 }  // namespace holoscan::gxf
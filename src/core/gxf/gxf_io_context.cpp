@@ -18,6 +18,7 @@
 #include "holoscan/core/gxf/gxf_io_context.hpp"
 
 #include <memory>
+#include <utility>
 
 #include "holoscan/core/gxf/gxf_operator.hpp"
 #include "holoscan/core/message.hpp"
@@ -27,72 +28,85 @@
 
 namespace holoscan::gxf {
 
-GXFInputContext::GXFInputContext(gxf_context_t context, Operator* op)
-    : InputContext(op), gxf_context_(context) {}
+void* resolve_connector(IOSpec* io_spec) {
+  void* connector = io_spec->connector_ptr();
+  if (connector) { return connector; }
 
-std::any GXFInputContext::receive_impl(const char* name, bool no_error_message) {
-  std::string input_name;
+  auto gxf_resource = std::dynamic_pointer_cast<GXFResource>(io_spec->resource());
+  if (gxf_resource == nullptr) {
+    HOLOSCAN_LOG_ERROR("Invalid resource type");
+    return nullptr;
+  }
 
-  if (name == nullptr || name[0] == '\0') {
-    if (inputs_.size() == 1) {
-      input_name = inputs_.begin()->first;
-    } else {
-      input_name = "";
+  connector = gxf_resource->gxf_cptr();
+  if (connector == nullptr) {
+    gxf_tid_t tid;
+    gxf_context_t context = gxf_resource->gxf_context();
+    gxf_result_t code = GxfComponentTypeId(context, gxf_resource->gxf_typename(), &tid);
+    if (code == GXF_SUCCESS) {
+      code = GxfComponentPointer(context, gxf_resource->gxf_cid(), tid, &connector);
+    }
+    if (code != GXF_SUCCESS) {
+      HOLOSCAN_LOG_ERROR("Unable to get the component pointer of '{}': {}",
+                         io_spec->name(),
+                         GxfResultStr(code));
+      return nullptr;
     }
-  } else {
-    input_name = name;
   }
 
-  auto it = inputs_.find(input_name);
-  if (it == inputs_.end()) {
-    if (no_error_message) { return nullptr; }
-    // Show error message because the input name is not found.
-    if (inputs_.size() == 1) {
-      HOLOSCAN_LOG_ERROR(
-          "The operator({}) has only one port with label '{}' but the non-existent port label "
-          "'{}' was specified in the receive() method",
-          op_->name(),
-          inputs_.begin()->first,
-          name);
-      return -1;  // to cause a bad_any_cast
-    } else {
-      auto msg_buf = fmt::memory_buffer();
-      auto& op_inputs = op_->spec()->inputs();
-      for (const auto& [label, _] : op_inputs) {
-        if (&label == &(op_inputs.begin()->first)) {
-          fmt::format_to(std::back_inserter(msg_buf), "{}", label);
-        } else {
-          fmt::format_to(std::back_inserter(msg_buf), ", {}", label);
-        }
-      }
-      HOLOSCAN_LOG_ERROR(
-          "The operator({}) does not have an input port with label '{}'. It should be "
-          "one of ({:.{}}) in receive() method",
-          op_->name(),
-          input_name,
-          msg_buf.data(),
-          msg_buf.size());
-      return -1;  // to cause a bad_any_cast
-    }
+  io_spec->connector_ptr(connector);
+  return connector;
+}
+
+namespace {
+
+// Publish the entity to the transmitter of the output and to its additional (fan-out)
+// transmitters. All the downstream receivers get a reference to the same entity.
+void publish(IOSpec* io_spec, nvidia::gxf::Transmitter* transmitter,
+             const nvidia::gxf::Entity& entity) {
+  // TODO(gbae): Check error message
+  transmitter->publish(entity);
+  for (void* fanout_transmitter : io_spec->fanout_connector_ptrs()) {
+    static_cast<nvidia::gxf::Transmitter*>(fanout_transmitter)->publish(entity);
   }
+}
 
-  const std::unique_ptr<IOSpec>& input_spec = it->second;
-  auto resource = input_spec->resource();
-  auto gxf_resource = std::dynamic_pointer_cast<GXFResource>(resource);
-  if (gxf_resource == nullptr) {
-    HOLOSCAN_LOG_ERROR("Invalid resource type");
+}  // namespace
+
+GXFInputContext::GXFInputContext(gxf_context_t context, Operator* op)
+    : InputContext(op), gxf_context_(context) {}
+
+std::any GXFInputContext::receive_impl(const char* name, bool no_error_message) {
+  IOSpec* io_spec = find_input(name, no_error_message);
+  if (io_spec == nullptr) {
+    if (no_error_message) { return nullptr; }
     return -1;  // to cause a bad_any_cast
   }
+  return receive_impl(io_spec);
+}
+
+std::any GXFInputContext::receive_impl(IOSpec* io_spec) {
+  std::shared_ptr<void> shared_value;
+  return receive_message(io_spec, nullptr, shared_value);
+}
 
-  gxf_result_t code;
-  gxf_tid_t rx_tid;
-  gxf_context_t context = gxf_resource->gxf_context();
-  code = GxfComponentTypeId(context, gxf_resource->gxf_typename(), &rx_tid);
-  void* rx_ptr;
-  code = GxfComponentPointer(context, gxf_resource->gxf_cid(), rx_tid, &rx_ptr);
+std::any GXFInputContext::receive_impl(IOSpec* io_spec, const std::type_info& typeinfo,
+                                       std::shared_ptr<void>& shared_value) {
+  return receive_message(io_spec, &typeinfo, shared_value);
+}
+
+std::any GXFInputContext::receive_message(IOSpec* io_spec, const std::type_info* typeinfo,
+                                          std::shared_ptr<void>& shared_value) {
+  if (io_spec == nullptr) {
+    HOLOSCAN_LOG_ERROR("The operator({}) received from an unassigned input port handle",
+                       op_->name());
+    return -1;  // to cause a bad_any_cast
+  }
 
-  (void)code;
-  auto receiver = static_cast<nvidia::gxf::Receiver*>(rx_ptr);
+  auto receiver = static_cast<nvidia::gxf::Receiver*>(resolve_connector(io_spec));
+  if (receiver == nullptr) {
+    return -1;  // to cause a bad_any_cast
+  }
 
   auto entity = receiver->receive();
   if (!entity || entity.value().is_null()) {
@@ -107,6 +121,11 @@ std::any GXFInputContext::receive_impl(const char* name, bool no_error_message)
   }
 
   auto message_ptr = message.value().get();
+  if (typeinfo && message_ptr->holds_shared_value(*typeinfo)) {
+    shared_value = message_ptr->shared_value(*typeinfo);
+    if (!shared_value) { return nullptr; }  // a null shared pointer was sent
+    return {};
+  }
   auto value = message_ptr->value();
 
   return value;
@@ -116,86 +135,43 @@ GXFOutputContext::GXFOutputContext(gxf_context_t context, Operator* op)
     : OutputContext(op), gxf_context_(context) {}
 
 void GXFOutputContext::emit_impl(std::any data, const char* name, OutputType out_type) {
-  std::string output_name;
-
-  if (name == nullptr || name[0] == '\0') {
-    if (outputs_.size() == 1) {
-      output_name = outputs_.begin()->first;
-    } else {
-      output_name = "";
-    }
-  } else {
-    output_name = name;
-  }
-
-  auto it = outputs_.find(output_name);
-  if (it == outputs_.end()) {
-    // Show error message because the output name is not found.
-    if (outputs_.size() == 1) {
-      HOLOSCAN_LOG_ERROR(
-          "The operator({}) has only one port with label '{}' but the non-existent port label "
-          "'{}' was specified in the emit() method",
-          op_->name(),
-          outputs_.begin()->first,
-          name);
-      return;
-    } else {
-      auto msg_buf = fmt::memory_buffer();
-      auto& op_outputs = op_->spec()->outputs();
-      for (const auto& [label, _] : op_outputs) {
-        if (&label == &(op_outputs.begin()->first)) {
-          fmt::format_to(std::back_inserter(msg_buf), "{}", label);
-        } else {
-          fmt::format_to(std::back_inserter(msg_buf), ", {}", label);
-        }
-      }
-      HOLOSCAN_LOG_ERROR(
-          "The operator({}) does not have an output port with label '{}'. It should be "
-          "one of ({:.{}}) in emit() method",
-          op_->name(),
-          output_name,
-          msg_buf.data(),
-          msg_buf.size());
-      return;
-    }
-  }
-
-  const std::unique_ptr<IOSpec>& output_spec = it->second;
-  auto resource = output_spec->resource();
+  IOSpec* io_spec = find_output(name);
+  if (io_spec == nullptr) { return; }
+  emit_impl(std::move(data), io_spec, out_type);
+}
 
-  auto gxf_resource = std::dynamic_pointer_cast<GXFResource>(resource);
-  if (gxf_resource == nullptr) {
-    HOLOSCAN_LOG_ERROR("Invalid resource type");
+void GXFOutputContext::emit_impl(std::any data, IOSpec* io_spec, OutputType out_type) {
+  if (io_spec == nullptr) {
+    HOLOSCAN_LOG_ERROR("The operator({}) emitted to an unassigned output port handle",
+                       op_->name());
     return;
   }
 
-  gxf_result_t code;
-  gxf_tid_t tx_tid;
-  gxf_context_t context = gxf_resource->gxf_context();
-  code = GxfComponentTypeId(context, gxf_resource->gxf_typename(), &tx_tid);
-
-  void* tx_ptr;
-  code = GxfComponentPointer(context, gxf_resource->gxf_cid(), tx_tid, &tx_ptr);
-  (void)code;
+  auto transmitter = static_cast<nvidia::gxf::Transmitter*>(resolve_connector(io_spec));
+  if (transmitter == nullptr) { return; }
 
   switch (out_type) {
     case OutputType::kSharedPointer: {
-      // Create an Entity object and add a Message object to it.
-      auto gxf_entity = nvidia::gxf::Entity::New(gxf_context_);
-      auto buffer = gxf_entity.value().add<Message>();
+      // Get an Entity object with a Message object from the pool of the port.
+      Message* message = nullptr;
+      auto gxf_entity = message_pool(io_spec).acquire(message);
+      if (!gxf_entity) {
+        HOLOSCAN_LOG_ERROR("Unable to create a message entity for '{}': {}",
+                           io_spec->name(),
+                           GxfResultStr(gxf_entity.error()));
+        return;
+      }
       // Set the data to the value of the Message object.
-      buffer.value()->set_value(data);
+      message->set_value(std::move(data));
       // Publish the Entity object.
-      // TODO(gbae): Check error message
-      static_cast<nvidia::gxf::Transmitter*>(tx_ptr)->publish(std::move(gxf_entity.value()));
+      publish(io_spec, transmitter, gxf_entity.value());
       break;
     }
     case OutputType::kGXFEntity: {
       // Cast to an Entity object and publish it.
       try {
         auto gxf_entity = std::any_cast<holoscan::gxf::Entity>(data);
-        // TODO(gbae): Check error message
-        static_cast<nvidia::gxf::Transmitter*>(tx_ptr)->publish(std::move(gxf_entity));
+        publish(io_spec, transmitter, gxf_entity);
       } catch (const std::bad_any_cast& e) {
         HOLOSCAN_LOG_ERROR("Unable to cast to gxf::Entity: {}", e.what());
       }
@@ -204,4 +180,34 @@ void GXFOutputContext::emit_impl(std::any data, const char* name, OutputType out
   }
 }
 
+void GXFOutputContext::emit_impl(Message&& message, IOSpec* io_spec) {
+  if (io_spec == nullptr) {
+    HOLOSCAN_LOG_ERROR("The operator({}) emitted to an unassigned output port handle",
+                       op_->name());
+    return;
+  }
+
+  auto transmitter = static_cast<nvidia::gxf::Transmitter*>(resolve_connector(io_spec));
+  if (transmitter == nullptr) { return; }
+
+  Message* pooled_message = nullptr;
+  auto gxf_entity = message_pool(io_spec).acquire(pooled_message);
+  if (!gxf_entity) {
+    HOLOSCAN_LOG_ERROR("Unable to create a message entity for '{}': {}",
+                       io_spec->name(),
+                       GxfResultStr(gxf_entity.error()));
+    return;
+  }
+  *pooled_message = std::move(message);
+  publish(io_spec, transmitter, gxf_entity.value());
+}
+
+MessagePool& GXFOutputContext::message_pool(IOSpec* io_spec) {
+  auto it = message_pools_.find(io_spec);
+  if (it == message_pools_.end()) {
+    it = message_pools_.emplace(io_spec, std::make_unique<MessagePool>(gxf_context_)).first;
+  }
+  return *it->second;
+}
+
 }  // namespace holoscan::gxf
@@ -19,6 +19,7 @@
 
 #include "holoscan/core/common.hpp"
 #include "holoscan/core/gxf/gxf_execution_context.hpp"
+#include "holoscan/core/gxf/gxf_io_context.hpp"
 #include "holoscan/core/io_context.hpp"
 
 #include "gxf/std/transmitter.hpp"
@@ -46,6 +47,15 @@ gxf_result_t GXFWrapper::start() {
     HOLOSCAN_LOG_ERROR("GXFWrapper::start() - Operator is not set");
     return GXF_FAILURE;
   }
+
+  // Resolve the receivers/transmitters once so that receive()/emit() don't look them up per tick.
+  for (auto& [_, io_spec] : op_->spec()->inputs()) { resolve_connector(io_spec.get()); }
+  for (auto& [_, io_spec] : op_->spec()->outputs()) { resolve_connector(io_spec.get()); }
+
+  // The input/output/execution contexts don't hold per-tick state, so they are created once here
+  // instead of on every tick.
+  exec_context_ = std::make_unique<GXFExecutionContext>(context(), op_);
+
   op_->start();
   return GXF_SUCCESS;
 }
@@ -59,15 +69,20 @@ gxf_result_t GXFWrapper::tick() {
 
   HOLOSCAN_LOG_TRACE("Calling operator: {}", op_->name());
 
-  GXFExecutionContext exec_context(context(), op_);
-  InputContext* op_input = exec_context.input();
-  OutputContext* op_output = exec_context.output();
+  if (!exec_context_) {
+    HOLOSCAN_LOG_ERROR("GXFWrapper::tick() - Operator '{}' is not started", op_->name());
+    return GXF_FAILURE;
+  }
+  InputContext* op_input = exec_context_->input();
+  OutputContext* op_output = exec_context_->output();
+  const int64_t start_ns = profiler_ ? Profiler::now_ns() : 0;
   try {
-    op_->compute(*op_input, *op_output, exec_context);
+    op_->compute(*op_input, *op_output, *exec_context_);
   } catch (const std::exception& e) {
     HOLOSCAN_LOG_ERROR("Exception occurred for operator: '{}' - {}", op_->name(), e.what());
     return GXF_FAILURE;
   }
+  if (profiler_) { profiler_->record(profiler_op_index_, start_ns, Profiler::now_ns()); }
 
   return GXF_SUCCESS;
 }
@@ -79,6 +94,7 @@ gxf_result_t GXFWrapper::stop() {
     return GXF_FAILURE;
   }
   op_->stop();
+  exec_context_.reset();
   return GXF_SUCCESS;
 }
 
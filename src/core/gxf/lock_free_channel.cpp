@@ -0,0 +1,281 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/gxf/lock_free_channel.hpp"
+
+#include <chrono>
+#include <thread>
+
+#include <gxf/core/registrar.hpp>
+
+#include "holoscan/logger/logger.hpp"
+
+namespace holoscan::gxf {
+
+LockFreeEntityQueue::~LockFreeEntityQueue() {
+  clear();
+}
+
+void LockFreeEntityQueue::init(gxf_context_t context, size_t capacity, OverflowPolicy policy,
+                               bool multi_producer, uint64_t block_timeout_ms) {
+  clear();
+  context_ = context;
+  policy_ = policy;
+  block_timeout_ms_ = block_timeout_ms;
+  spsc_.reset();
+  mpmc_.reset();
+  // Dropping the oldest entity means that the producer pops too, so the queue must support
+  // concurrent consumers.
+  if (multi_producer || policy == OverflowPolicy::kPop) {
+    mpmc_ = std::make_unique<MPMCQueue<gxf_uid_t>>(capacity);
+  } else {
+    spsc_ = std::make_unique<SPSCQueue<gxf_uid_t>>(capacity);
+  }
+}
+
+void LockFreeEntityQueue::clear() {
+  gxf_uid_t uid = kNullUid;
+  while (try_pop(uid)) { GxfEntityRefCountDec(context_, uid); }
+}
+
+bool LockFreeEntityQueue::try_push(gxf_uid_t uid) {
+  if (spsc_) { return spsc_->try_push(uid); }
+  if (mpmc_) { return mpmc_->try_push(uid); }
+  return false;
+}
+
+bool LockFreeEntityQueue::try_pop(gxf_uid_t& uid) {
+  if (spsc_) { return spsc_->try_pop(uid); }
+  if (mpmc_) { return mpmc_->try_pop(uid); }
+  return false;
+}
+
+gxf_result_t LockFreeEntityQueue::push(gxf_uid_t uid) {
+  if (uid == kNullUid) { return GXF_ARGUMENT_NULL; }
+  if (!spsc_ && !mpmc_) { return GXF_FAILURE; }
+
+  // The queue keeps its own reference until the entity is popped.
+  const gxf_result_t code = GxfEntityRefCountInc(context_, uid);
+  if (code != GXF_SUCCESS) { return code; }
+  if (try_push(uid)) { return GXF_SUCCESS; }
+
+  switch (policy_) {
+    case OverflowPolicy::kPop: {
+      gxf_uid_t oldest = kNullUid;
+      do {
+        if (try_pop(oldest)) {
+          HOLOSCAN_LOG_DEBUG("Lock-free queue is full, dropping the oldest entity {}", oldest);
+          GxfEntityRefCountDec(context_, oldest);
+        }
+      } while (!try_push(uid));
+      return GXF_SUCCESS;
+    }
+    case OverflowPolicy::kReject:
+      HOLOSCAN_LOG_DEBUG("Lock-free queue is full, dropping the new entity {}", uid);
+      GxfEntityRefCountDec(context_, uid);
+      return GXF_SUCCESS;
+    case OverflowPolicy::kBlock: {
+      const auto deadline =
+          std::chrono::steady_clock::now() + std::chrono::milliseconds(block_timeout_ms_);
+      while (!try_push(uid)) {
+        if (std::chrono::steady_clock::now() >= deadline) {
+          HOLOSCAN_LOG_ERROR("Lock-free queue stayed full for {} ms", block_timeout_ms_);
+          GxfEntityRefCountDec(context_, uid);
+          return GXF_EXCEEDING_PREALLOCATED_SIZE;
+        }
+        std::this_thread::yield();
+      }
+      return GXF_SUCCESS;
+    }
+    case OverflowPolicy::kFault:
+    default:
+      GxfEntityRefCountDec(context_, uid);
+      return GXF_EXCEEDING_PREALLOCATED_SIZE;
+  }
+}
+
+gxf_result_t LockFreeEntityQueue::pop(gxf_uid_t* uid) {
+  if (uid == nullptr) { return GXF_ARGUMENT_NULL; }
+  if (!try_pop(*uid)) { return GXF_FAILURE; }
+  return GXF_SUCCESS;
+}
+
+gxf_result_t LockFreeEntityQueue::peek(gxf_uid_t* uid, int32_t index) const {
+  if (uid == nullptr) { return GXF_ARGUMENT_NULL; }
+  if (index < 0) { return GXF_ARGUMENT_OUT_OF_RANGE; }
+  const bool found = spsc_   ? spsc_->peek(static_cast<size_t>(index), *uid)
+                     : mpmc_ ? mpmc_->peek(static_cast<size_t>(index), *uid)
+                             : false;
+  return found ? GXF_SUCCESS : GXF_FAILURE;
+}
+
+size_t LockFreeEntityQueue::size() const {
+  if (spsc_) { return spsc_->size(); }
+  if (mpmc_) { return mpmc_->size(); }
+  return 0;
+}
+
+size_t LockFreeEntityQueue::capacity() const {
+  if (spsc_) { return spsc_->capacity(); }
+  if (mpmc_) { return mpmc_->capacity(); }
+  return 0;
+}
+
+// -------------------------------------------------------------------------------------------------
+// LockFreeReceiver
+// -------------------------------------------------------------------------------------------------
+
+gxf_result_t LockFreeReceiver::registerInterface(nvidia::gxf::Registrar* registrar) {
+  nvidia::gxf::Expected<void> result;
+  result &= registrar->parameter(capacity_, "capacity", "Capacity", "", 1UL);
+  result &= registrar->parameter(
+      policy_, "policy", "Policy", "0: pop, 1: reject, 2: fault, 3: block", 2UL);
+  result &= registrar->parameter(multi_producer_,
+                                 "multi_producer",
+                                 "Multiple producers",
+                                 "Whether entities may be pushed from several threads at once",
+                                 false);
+  result &= registrar->parameter(block_timeout_ms_,
+                                 "block_timeout_ms",
+                                 "Block timeout (ms)",
+                                 "How long a push waits for room with the 'block' policy",
+                                 1000UL);
+  return nvidia::gxf::ToResultCode(result);
+}
+
+gxf_result_t LockFreeReceiver::initialize() {
+  queue_.init(context(),
+              capacity_.get(),
+              static_cast<OverflowPolicy>(policy_.get()),
+              multi_producer_.get(),
+              block_timeout_ms_.get());
+  return GXF_SUCCESS;
+}
+
+gxf_result_t LockFreeReceiver::deinitialize() {
+  queue_.clear();
+  return GXF_SUCCESS;
+}
+
+gxf_result_t LockFreeReceiver::pop_abi(gxf_uid_t* uid) {
+  return queue_.pop(uid);
+}
+
+gxf_result_t LockFreeReceiver::push_abi(gxf_uid_t other) {
+  const gxf_result_t code = queue_.push(other);
+#if HOLOSCAN_GXF_ENTITY_EVENTS
+  // Wake up the receiving entity instead of waiting for the scheduler to poll it.
+  if (code == GXF_SUCCESS) { GxfEntityNotifyEventType(context(), eid(), GXF_EVENT_MESSAGE_SYNC); }
+#endif
+  return code;
+}
+
+gxf_result_t LockFreeReceiver::peek_abi(gxf_uid_t* uid, int32_t index) {
+  return queue_.peek(uid, index);
+}
+
+gxf_result_t LockFreeReceiver::peek_back_abi(gxf_uid_t* uid, int32_t index) {
+  // There is no back stage: pushed entities are available right away.
+  (void)uid;
+  (void)index;
+  return GXF_FAILURE;
+}
+
+size_t LockFreeReceiver::capacity_abi() {
+  return queue_.capacity();
+}
+
+size_t LockFreeReceiver::size_abi() {
+  return queue_.size();
+}
+
+gxf_result_t LockFreeReceiver::receive_abi(gxf_uid_t* uid) {
+  return queue_.pop(uid);
+}
+
+size_t LockFreeReceiver::back_size_abi() {
+  return 0;
+}
+
+gxf_result_t LockFreeReceiver::sync_abi() {
+  return GXF_SUCCESS;
+}
+
+// -------------------------------------------------------------------------------------------------
+// LockFreeTransmitter
+// -------------------------------------------------------------------------------------------------
+
+gxf_result_t LockFreeTransmitter::registerInterface(nvidia::gxf::Registrar* registrar) {
+  nvidia::gxf::Expected<void> result;
+  result &= registrar->parameter(capacity_, "capacity", "Capacity", "", 1UL);
+  result &= registrar->parameter(
+      policy_, "policy", "Policy", "0: pop, 1: reject, 2: fault, 3: block", 2UL);
+  result &= registrar->parameter(block_timeout_ms_,
+                                 "block_timeout_ms",
+                                 "Block timeout (ms)",
+                                 "How long a publish waits for room with the 'block' policy",
+                                 1000UL);
+  return nvidia::gxf::ToResultCode(result);
+}
+
+gxf_result_t LockFreeTransmitter::initialize() {
+  queue_.init(context(),
+              capacity_.get(),
+              static_cast<OverflowPolicy>(policy_.get()),
+              false,
+              block_timeout_ms_.get());
+  return GXF_SUCCESS;
+}
+
+gxf_result_t LockFreeTransmitter::deinitialize() {
+  queue_.clear();
+  return GXF_SUCCESS;
+}
+
+gxf_result_t LockFreeTransmitter::pop_abi(gxf_uid_t* uid) {
+  return queue_.pop(uid);
+}
+
+gxf_result_t LockFreeTransmitter::push_abi(gxf_uid_t other) {
+  return queue_.push(other);
+}
+
+gxf_result_t LockFreeTransmitter::peek_abi(gxf_uid_t* uid, int32_t index) {
+  return queue_.peek(uid, index);
+}
+
+size_t LockFreeTransmitter::capacity_abi() {
+  return queue_.capacity();
+}
+
+size_t LockFreeTransmitter::size_abi() {
+  return queue_.size();
+}
+
+gxf_result_t LockFreeTransmitter::publish_abi(gxf_uid_t uid) {
+  return queue_.push(uid);
+}
+
+size_t LockFreeTransmitter::back_size_abi() {
+  return 0;
+}
+
+gxf_result_t LockFreeTransmitter::sync_abi() {
+  return GXF_SUCCESS;
+}
+
+}  // namespace holoscan::gxf
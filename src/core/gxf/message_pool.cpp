@@ -0,0 +1,64 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/gxf/message_pool.hpp"
+
+namespace holoscan::gxf {
+
+MessagePool::MessagePool(gxf_context_t context, size_t capacity)
+    : context_(context), capacity_(capacity) {
+  entries_.reserve(capacity_);
+}
+
+nvidia::gxf::Expected<nvidia::gxf::Entity> MessagePool::acquire(Message*& message) {
+  // Look for entities that are referenced only by the pool, starting from the least recently
+  // handed out one. The payloads of all of them are released, so that they do not outlive the
+  // downstream receivers until the entity is handed out again.
+  const size_t num_entries = entries_.size();
+  Entry* found = nullptr;
+  for (size_t i = 0; i < num_entries; ++i) {
+    size_t index = next_ + i;
+    if (index >= num_entries) { index -= num_entries; }
+    auto& entry = entries_[index];
+
+    int64_t ref_count = 0;
+    if (GxfEntityGetRefCount(context_, entry.entity.eid(), &ref_count) != GXF_SUCCESS ||
+        ref_count != 1) {
+      continue;
+    }
+    entry.message->reset();
+    if (found == nullptr) {
+      found = &entry;
+      next_ = index + 1 == num_entries ? 0 : index + 1;
+    }
+  }
+  if (found != nullptr) {
+    message = found->message;
+    return found->entity;
+  }
+
+  auto entity = nvidia::gxf::Entity::New(context_);
+  if (!entity) { return nvidia::gxf::ForwardError(entity); }
+  auto message_handle = entity.value().add<Message>();
+  if (!message_handle) { return nvidia::gxf::ForwardError(message_handle); }
+  message = message_handle.value().get();
+
+  if (entries_.size() < capacity_) { entries_.push_back(Entry{entity.value(), message}); }
+  return entity;
+}
+
+}  // namespace holoscan::gxf
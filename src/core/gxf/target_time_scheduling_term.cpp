@@ -0,0 +1,78 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/gxf/target_time_scheduling_term.hpp"
+
+#include <chrono>
+
+namespace holoscan::gxf {
+
+namespace {
+
+int64_t steady_clock_now_ns() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+}  // namespace
+
+gxf_result_t TargetTimeSchedulingTerm::initialize() {
+  target_ns_.store(0, std::memory_order_relaxed);
+  return GXF_SUCCESS;
+}
+
+gxf_result_t TargetTimeSchedulingTerm::check_abi(int64_t timestamp,
+                                                 nvidia::gxf::SchedulingConditionType* type,
+                                                 int64_t* target_timestamp) const {
+  const int64_t target_ns = target_ns_.load(std::memory_order_acquire);
+  if (target_ns == 0) {
+    *type = nvidia::gxf::SchedulingConditionType::READY;
+    return GXF_SUCCESS;
+  }
+
+  const int64_t remaining_ns = target_ns - steady_clock_now_ns();
+  if (remaining_ns <= 0) {
+    *type = nvidia::gxf::SchedulingConditionType::READY;
+    return GXF_SUCCESS;
+  }
+
+  // Express the target in the scheduler's clock domain
+  *type = nvidia::gxf::SchedulingConditionType::WAIT_TIME;
+  *target_timestamp = timestamp + remaining_ns;
+  return GXF_SUCCESS;
+}
+
+gxf_result_t TargetTimeSchedulingTerm::onExecute_abi(int64_t dt) {
+  (void)dt;
+  // The codelet sets the next target during its tick, so the target is not reset here.
+  return GXF_SUCCESS;
+}
+
+void TargetTimeSchedulingTerm::set_target_time(int64_t steady_clock_ns) {
+  target_ns_.store(steady_clock_ns, std::memory_order_release);
+}
+
+void TargetTimeSchedulingTerm::clear_target_time() {
+  target_ns_.store(0, std::memory_order_release);
+}
+
+int64_t TargetTimeSchedulingTerm::target_time() const {
+  return target_ns_.load(std::memory_order_acquire);
+}
+
+}  // namespace holoscan::gxf
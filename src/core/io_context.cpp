@@ -0,0 +1,106 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/io_context.hpp"
+
+#include <iterator>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+namespace holoscan {
+
+namespace {
+
+// Format the labels of the given ports as a comma-separated list.
+fmt::memory_buffer port_labels(
+    const std::unordered_map<std::string, std::unique_ptr<IOSpec>>& ports) {
+  auto msg_buf = fmt::memory_buffer();
+  for (const auto& [label, _] : ports) {
+    if (&label == &(ports.begin()->first)) {
+      fmt::format_to(std::back_inserter(msg_buf), "{}", label);
+    } else {
+      fmt::format_to(std::back_inserter(msg_buf), ", {}", label);
+    }
+  }
+  return msg_buf;
+}
+
+}  // namespace
+
+IOSpec* InputContext::find_input(const char* name, bool no_error_message) const {
+  if (name == nullptr || name[0] == '\0') {
+    if (inputs_.size() == 1) { return inputs_.begin()->second.get(); }
+    name = "";
+  }
+
+  auto it = inputs_.find(name);
+  if (it != inputs_.end()) { return it->second.get(); }
+  if (no_error_message) { return nullptr; }
+
+  // Show error message because the input name is not found.
+  if (inputs_.size() == 1) {
+    HOLOSCAN_LOG_ERROR(
+        "The operator({}) has only one port with label '{}' but the non-existent port label "
+        "'{}' was specified in the receive() method",
+        op_->name(),
+        inputs_.begin()->first,
+        name);
+  } else {
+    auto msg_buf = port_labels(op_->spec()->inputs());
+    HOLOSCAN_LOG_ERROR(
+        "The operator({}) does not have an input port with label '{}'. It should be "
+        "one of ({:.{}}) in receive() method",
+        op_->name(),
+        name,
+        msg_buf.data(),
+        msg_buf.size());
+  }
+  return nullptr;
+}
+
+IOSpec* OutputContext::find_output(const char* name) const {
+  if (name == nullptr || name[0] == '\0') {
+    if (outputs_.size() == 1) { return outputs_.begin()->second.get(); }
+    name = "";
+  }
+
+  auto it = outputs_.find(name);
+  if (it != outputs_.end()) { return it->second.get(); }
+
+  // Show error message because the output name is not found.
+  if (outputs_.size() == 1) {
+    HOLOSCAN_LOG_ERROR(
+        "The operator({}) has only one port with label '{}' but the non-existent port label "
+        "'{}' was specified in the emit() method",
+        op_->name(),
+        outputs_.begin()->first,
+        name);
+  } else {
+    auto msg_buf = port_labels(op_->spec()->outputs());
+    HOLOSCAN_LOG_ERROR(
+        "The operator({}) does not have an output port with label '{}'. It should be "
+        "one of ({:.{}}) in emit() method",
+        op_->name(),
+        name,
+        msg_buf.data(),
+        msg_buf.size());
+  }
+  return nullptr;
+}
+
+}  // namespace holoscan
@@ -0,0 +1,358 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/profiler.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iterator>  // for std::back_inserter
+
+#include "holoscan/logger/logger.hpp"
+
+namespace holoscan {
+
+namespace {
+
+std::atomic<uint64_t> s_next_profiler_id{1};
+
+// Cache of the buffer used by the current thread. Only the most recently used profiler is cached;
+// other profilers fall back to a lookup under the profiler's lock.
+struct ThreadBufferCache {
+  uint64_t profiler_id = 0;
+  uint64_t generation = 0;
+  void* buffer = nullptr;
+};
+thread_local ThreadBufferCache t_buffer_cache;
+
+// Increment a counter that is only written by the owning thread.
+inline void add_relaxed(std::atomic<uint64_t>& counter, uint64_t value) {
+  counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+constexpr double kNsToMs = 1e-6;
+
+std::string escape_json(const std::string& str) {
+  std::string escaped;
+  escaped.reserve(str.size());
+  for (char c : str) {
+    switch (c) {
+      case '"':
+        escaped += "\\\"";
+        break;
+      case '\\':
+        escaped += "\\\\";
+        break;
+      case '\n':
+        escaped += "\\n";
+        break;
+      default:
+        escaped += c;
+    }
+  }
+  return escaped;
+}
+
+std::string escape_csv(const std::string& str) {
+  if (str.find_first_of(",\"\n") == std::string::npos) { return str; }
+  std::string escaped = "\"";
+  for (char c : str) {
+    if (c == '"') { escaped += '"'; }
+    escaped += c;
+  }
+  escaped += '"';
+  return escaped;
+}
+
+}  // namespace
+
+void Profiler::Histogram::add(uint64_t value) {
+  add_relaxed(count, 1);
+  add_relaxed(sum, value);
+  if (value < min.load(std::memory_order_relaxed)) {
+    min.store(value, std::memory_order_relaxed);
+  }
+  if (value > max.load(std::memory_order_relaxed)) {
+    max.store(value, std::memory_order_relaxed);
+  }
+  add_relaxed(buckets[bucket_index(value)], 1);
+}
+
+void Profiler::Histogram::clear() {
+  count.store(0, std::memory_order_relaxed);
+  sum.store(0, std::memory_order_relaxed);
+  min.store(UINT64_MAX, std::memory_order_relaxed);
+  max.store(0, std::memory_order_relaxed);
+  for (auto& bucket : buckets) { bucket.store(0, std::memory_order_relaxed); }
+}
+
+Profiler::Profiler() : id_(s_next_profiler_id.fetch_add(1)) {}
+
+Profiler::~Profiler() = default;
+
+int64_t Profiler::now_ns() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+int Profiler::bucket_index(uint64_t value) {
+  if (value < kLinearBuckets) { return static_cast<int>(value); }
+  const int exponent = 63 - __builtin_clzll(value);
+  if (exponent > kMaxExponent) { return kBucketCount - 1; }
+  const int sub_bucket =
+      static_cast<int>((value >> (exponent - kSubBucketBits)) & ((1 << kSubBucketBits) - 1));
+  return kLinearBuckets + ((exponent - 4) << kSubBucketBits) + sub_bucket;
+}
+
+uint64_t Profiler::bucket_value(int index) {
+  if (index < kLinearBuckets) { return static_cast<uint64_t>(index); }
+  const int exponent = 4 + ((index - kLinearBuckets) >> kSubBucketBits);
+  const uint64_t sub_bucket = (index - kLinearBuckets) & ((1 << kSubBucketBits) - 1);
+  const uint64_t width = uint64_t{1} << (exponent - kSubBucketBits);
+  // Use the middle of the bucket
+  return (uint64_t{1} << exponent) + sub_bucket * width + width / 2;
+}
+
+size_t Profiler::register_operator(const std::string& name) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (size_t index = 0; index < operators_.size(); ++index) {
+    if (operators_[index]->name == name) { return index; }
+  }
+  auto entry = std::make_unique<OperatorEntry>();
+  entry->name = name;
+  operators_.push_back(std::move(entry));
+  generation_.fetch_add(1, std::memory_order_release);
+  return operators_.size() - 1;
+}
+
+Profiler::ThreadBuffer* Profiler::thread_buffer() {
+  const uint64_t generation = generation_.load(std::memory_order_acquire);
+  auto& cache = t_buffer_cache;
+  if (cache.profiler_id == id_ && cache.generation == generation) {
+    return static_cast<ThreadBuffer*>(cache.buffer);
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  const auto thread_id = std::this_thread::get_id();
+  ThreadBuffer* buffer = nullptr;
+  auto it = buffer_by_thread_.find(thread_id);
+  if (it != buffer_by_thread_.end() && it->second->slots.size() == operators_.size()) {
+    buffer = it->second;
+  } else {
+    // Operators were registered since the buffer was created. Keep the old buffer (its
+    // statistics are still aggregated) and record into a new one from now on.
+    auto new_buffer = std::make_unique<ThreadBuffer>(operators_.size());
+    for (size_t index = 0; index < operators_.size(); ++index) {
+      new_buffer->slots[index].entry = operators_[index].get();
+    }
+    buffer = new_buffer.get();
+    thread_buffers_.push_back(std::move(new_buffer));
+    buffer_by_thread_[thread_id] = buffer;
+  }
+
+  cache.profiler_id = id_;
+  cache.generation = generation;
+  cache.buffer = buffer;
+  return buffer;
+}
+
+void Profiler::record(size_t op_index, int64_t start_ns, int64_t end_ns) {
+  ThreadBuffer* buffer = thread_buffer();
+  if (op_index >= buffer->slots.size()) { return; }
+  auto& slot = buffer->slots[op_index];
+
+  slot.compute.add(end_ns > start_ns ? static_cast<uint64_t>(end_ns - start_ns) : 0);
+
+  auto& entry = *slot.entry;
+  const int64_t previous_start_ns =
+      entry.last_start_ns.exchange(start_ns, std::memory_order_relaxed);
+  if (previous_start_ns == 0) {
+    entry.first_start_ns.store(start_ns, std::memory_order_relaxed);
+  } else if (start_ns > previous_start_ns) {
+    slot.interval.add(static_cast<uint64_t>(start_ns - previous_start_ns));
+  }
+}
+
+std::vector<OperatorProfile> Profiler::operator_profiles() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  std::vector<OperatorProfile> profiles;
+  profiles.reserve(operators_.size());
+
+  std::array<uint64_t, kBucketCount> compute_buckets;
+  std::array<uint64_t, kBucketCount> interval_buckets;
+
+  for (size_t index = 0; index < operators_.size(); ++index) {
+    OperatorProfile profile;
+    profile.name = operators_[index]->name;
+
+    uint64_t compute_sum = 0;
+    uint64_t compute_min = UINT64_MAX;
+    uint64_t compute_max = 0;
+    uint64_t interval_count = 0;
+    uint64_t interval_sum = 0;
+    uint64_t interval_min = UINT64_MAX;
+    uint64_t interval_max = 0;
+    compute_buckets.fill(0);
+    interval_buckets.fill(0);
+
+    for (const auto& buffer : thread_buffers_) {
+      if (index >= buffer->slots.size()) { continue; }
+      const auto& slot = buffer->slots[index];
+      profile.count += slot.compute.count.load(std::memory_order_relaxed);
+      compute_sum += slot.compute.sum.load(std::memory_order_relaxed);
+      compute_min = std::min(compute_min, slot.compute.min.load(std::memory_order_relaxed));
+      compute_max = std::max(compute_max, slot.compute.max.load(std::memory_order_relaxed));
+      interval_count += slot.interval.count.load(std::memory_order_relaxed);
+      interval_sum += slot.interval.sum.load(std::memory_order_relaxed);
+      interval_min = std::min(interval_min, slot.interval.min.load(std::memory_order_relaxed));
+      interval_max = std::max(interval_max, slot.interval.max.load(std::memory_order_relaxed));
+      for (int bucket = 0; bucket < kBucketCount; ++bucket) {
+        compute_buckets[bucket] += slot.compute.buckets[bucket].load(std::memory_order_relaxed);
+        interval_buckets[bucket] += slot.interval.buckets[bucket].load(std::memory_order_relaxed);
+      }
+    }
+
+    // Estimate the value at the given quantile, clamped to the observed range.
+    auto percentile = [](const std::array<uint64_t, kBucketCount>& buckets,
+                         uint64_t total,
+                         double quantile,
+                         uint64_t min_value,
+                         uint64_t max_value) -> uint64_t {
+      if (total == 0) { return 0; }
+      const auto rank = std::max<uint64_t>(1, static_cast<uint64_t>(quantile * total + 0.5));
+      uint64_t cumulative = 0;
+      for (int bucket = 0; bucket < kBucketCount; ++bucket) {
+        cumulative += buckets[bucket];
+        if (cumulative >= rank) {
+          return std::clamp(bucket_value(bucket), min_value, max_value);
+        }
+      }
+      return max_value;
+    };
+
+    if (profile.count > 0) {
+      profile.total_ms = compute_sum * kNsToMs;
+      profile.min_ms = compute_min * kNsToMs;
+      profile.mean_ms = profile.total_ms / profile.count;
+      profile.p50_ms =
+          percentile(compute_buckets, profile.count, 0.50, compute_min, compute_max) * kNsToMs;
+      profile.p99_ms =
+          percentile(compute_buckets, profile.count, 0.99, compute_min, compute_max) * kNsToMs;
+      profile.max_ms = compute_max * kNsToMs;
+    }
+    if (interval_count > 0) {
+      profile.interval_mean_ms = interval_sum * kNsToMs / interval_count;
+      profile.interval_p50_ms =
+          percentile(interval_buckets, interval_count, 0.50, interval_min, interval_max) * kNsToMs;
+      profile.interval_p99_ms =
+          percentile(interval_buckets, interval_count, 0.99, interval_min, interval_max) * kNsToMs;
+      profile.interval_max_ms = interval_max * kNsToMs;
+      profile.throughput_hz = 1000.0 / profile.interval_mean_ms;
+    }
+    profiles.push_back(std::move(profile));
+  }
+  return profiles;
+}
+
+void Profiler::reset() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto& buffer : thread_buffers_) {
+    for (auto& slot : buffer->slots) {
+      slot.compute.clear();
+      slot.interval.clear();
+    }
+  }
+  for (auto& entry : operators_) {
+    entry->first_start_ns.store(0, std::memory_order_relaxed);
+    entry->last_start_ns.store(0, std::memory_order_relaxed);
+  }
+}
+
+std::string Profiler::to_json() const {
+  auto buf = fmt::memory_buffer();
+  fmt::format_to(std::back_inserter(buf), "{{\n  \"operators\": [");
+  const auto profiles = operator_profiles();
+  for (size_t index = 0; index < profiles.size(); ++index) {
+    const auto& p = profiles[index];
+    fmt::format_to(std::back_inserter(buf),
+                   "{}\n    {{\"name\": \"{}\", \"count\": {}, \"total_ms\": {:.6f}, "
+                   "\"min_ms\": {:.6f}, \"mean_ms\": {:.6f}, \"p50_ms\": {:.6f}, "
+                   "\"p99_ms\": {:.6f}, \"max_ms\": {:.6f}, \"interval_mean_ms\": {:.6f}, "
+                   "\"interval_p50_ms\": {:.6f}, \"interval_p99_ms\": {:.6f}, "
+                   "\"interval_max_ms\": {:.6f}, \"throughput_hz\": {:.3f}}}",
+                   index == 0 ? "" : ",",
+                   escape_json(p.name),
+                   p.count,
+                   p.total_ms,
+                   p.min_ms,
+                   p.mean_ms,
+                   p.p50_ms,
+                   p.p99_ms,
+                   p.max_ms,
+                   p.interval_mean_ms,
+                   p.interval_p50_ms,
+                   p.interval_p99_ms,
+                   p.interval_max_ms,
+                   p.throughput_hz);
+  }
+  fmt::format_to(std::back_inserter(buf), "{}]\n}}\n", profiles.empty() ? "" : "\n  ");
+  return fmt::to_string(buf);
+}
+
+std::string Profiler::to_csv() const {
+  auto buf = fmt::memory_buffer();
+  fmt::format_to(std::back_inserter(buf),
+                 "name,count,total_ms,min_ms,mean_ms,p50_ms,p99_ms,max_ms,interval_mean_ms,"
+                 "interval_p50_ms,interval_p99_ms,interval_max_ms,throughput_hz\n");
+  for (const auto& p : operator_profiles()) {
+    fmt::format_to(std::back_inserter(buf),
+                   "{},{},{:.6f},{:.6f},{:.6f},{:.6f},{:.6f},{:.6f},{:.6f},{:.6f},{:.6f},{:.6f},"
+                   "{:.3f}\n",
+                   escape_csv(p.name),
+                   p.count,
+                   p.total_ms,
+                   p.min_ms,
+                   p.mean_ms,
+                   p.p50_ms,
+                   p.p99_ms,
+                   p.max_ms,
+                   p.interval_mean_ms,
+                   p.interval_p50_ms,
+                   p.interval_p99_ms,
+                   p.interval_max_ms,
+                   p.throughput_hz);
+  }
+  return fmt::to_string(buf);
+}
+
+bool Profiler::dump(const std::string& path) const {
+  const bool is_csv = path.size() >= 4 && path.compare(path.size() - 4, 4, ".csv") == 0;
+  std::ofstream file(path);
+  if (!file) {
+    HOLOSCAN_LOG_ERROR("Unable to open the profiler output file '{}'", path);
+    return false;
+  }
+  file << (is_csv ? to_csv() : to_json());
+  HOLOSCAN_LOG_INFO("Operator profile written to '{}'", path);
+  return static_cast<bool>(file);
+}
+
+}  // namespace holoscan
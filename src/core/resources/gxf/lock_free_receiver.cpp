@@ -0,0 +1,56 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/resources/gxf/lock_free_receiver.hpp"
+
+#include "holoscan/core/component_spec.hpp"
+
+namespace holoscan {
+
+LockFreeReceiver::LockFreeReceiver(const std::string& name,
+                                   holoscan::gxf::LockFreeReceiver* component)
+    : Receiver(name, component) {
+  uint64_t capacity = 0;
+  GxfParameterGetUInt64(gxf_context_, gxf_cid_, "capacity", &capacity);
+  capacity_ = capacity;
+  uint64_t policy = 0;
+  GxfParameterGetUInt64(gxf_context_, gxf_cid_, "policy", &policy);
+  policy_ = policy;
+  bool multi_producer = false;
+  GxfParameterGetBool(gxf_context_, gxf_cid_, "multi_producer", &multi_producer);
+  multi_producer_ = multi_producer;
+  uint64_t block_timeout_ms = 0;
+  GxfParameterGetUInt64(gxf_context_, gxf_cid_, "block_timeout_ms", &block_timeout_ms);
+  block_timeout_ms_ = block_timeout_ms;
+}
+
+void LockFreeReceiver::setup(ComponentSpec& spec) {
+  spec.param(capacity_, "capacity", "Capacity", "", 1UL);
+  spec.param(policy_, "policy", "Policy", "0: pop, 1: reject, 2: fault, 3: block", 2UL);
+  spec.param(multi_producer_,
+             "multi_producer",
+             "Multiple producers",
+             "Whether entities may be pushed from several threads at once",
+             false);
+  spec.param(block_timeout_ms_,
+             "block_timeout_ms",
+             "Block timeout (ms)",
+             "How long a push waits for room with the 'block' policy",
+             1000UL);
+}
+
+}  // namespace holoscan
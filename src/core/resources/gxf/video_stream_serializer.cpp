@@ -28,6 +28,41 @@ void VideoStreamSerializer::setup(ComponentSpec& spec) {
              "component_serializers",
              "Component serializers",
              "List of serializers for serializing and deserializing components");
+  spec.param(compression_,
+             "compression",
+             "Compression",
+             "Compression of serialized components: 'none', 'lz4' or 'zstd'",
+             std::string("none"));
+  spec.param(compression_level_,
+             "compression_level",
+             "Compression level",
+             "Compression level used by zstd (1 to 22)",
+             3);
+  spec.param(delta_encoding_,
+             "delta_encoding",
+             "Delta encoding",
+             "Encode components as a lossless delta to the same component of the previous entity",
+             false);
+  spec.param(keyframe_interval_,
+             "keyframe_interval",
+             "Keyframe interval",
+             "Number of entities between two entities stored without delta encoding (0 for none)",
+             static_cast<uint64_t>(30));
+  spec.param(compression_chunk_size_,
+             "compression_chunk_size",
+             "Compression chunk size",
+             "Size of the chunks compressed in parallel, in bytes",
+             static_cast<uint64_t>(1 << 20));
+  spec.param(compression_threads_,
+             "compression_threads",
+             "Compression threads",
+             "Number of threads compressing chunks (0 to use the number of hardware threads)",
+             static_cast<uint64_t>(0));
+  spec.param(verify_checksum_,
+             "verify_checksum",
+             "Verify checksum",
+             "Verify the checksum of entities while deserializing them, failing on mismatch",
+             false);
 }
 
 void VideoStreamSerializer::initialize() {
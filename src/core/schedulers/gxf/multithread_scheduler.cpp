@@ -0,0 +1,44 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/schedulers/gxf/multithread_scheduler.hpp"
+
+#include "holoscan/core/component_spec.hpp"
+
+namespace holoscan {
+
+void MultiThreadScheduler::setup(ComponentSpec& spec) {
+  spec.param(worker_thread_number_,
+             "worker_thread_number",
+             "Worker thread number",
+             "The number of worker threads.",
+             1L);
+  spec.param(stop_on_deadlock_,
+             "stop_on_deadlock",
+             "Stop on deadlock",
+             "If enabled the scheduler will stop when all entities are in a waiting state, but no "
+             "periodic entity exists to break the dead end.",
+             true);
+  spec.param(check_recession_period_ms_,
+             "check_recession_period_ms",
+             "Check recession period (ms)",
+             "The period (in ms) at which the dispatcher thread re-checks operators that are "
+             "waiting.",
+             5.0);
+}
+
+}  // namespace holoscan
@@ -95,13 +95,19 @@ void Logger::flush_on(LogLevel level) {
 
 void Logger::log_message(const char* file, int line, const char* function_name, LogLevel level,
                          fmt::string_view format, fmt::format_args args) {
-  get_logger()->log(spdlog::source_loc{file, line, function_name},
-                    static_cast<spdlog::level::level_enum>(level),
-                    fmt::vformat(format, args));
+  auto& logger = get_logger();
+  auto spdlog_level = static_cast<spdlog::level::level_enum>(level);
+  // Skip formatting (and its allocation) for messages that would be discarded anyway.
+  if (!logger->should_log(spdlog_level) && !logger->should_backtrace()) { return; }
+  logger->log(spdlog::source_loc{file, line, function_name}, spdlog_level,
+              fmt::vformat(format, args));
 }
 
 void Logger::log_message(LogLevel level, fmt::string_view format, fmt::format_args args) {
-  get_logger()->log(static_cast<spdlog::level::level_enum>(level), fmt::vformat(format, args));
+  auto& logger = get_logger();
+  auto spdlog_level = static_cast<spdlog::level::level_enum>(level);
+  if (!logger->should_log(spdlog_level) && !logger->should_backtrace()) { return; }
+  logger->log(spdlog_level, fmt::vformat(format, args));
 }
 
 }  // namespace holoscan
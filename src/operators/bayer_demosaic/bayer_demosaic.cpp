@@ -46,14 +46,15 @@ void BayerDemosaicOp::setup(OperatorSpec& spec) {
   spec.param(cuda_stream_pool_,
              "cuda_stream_pool",
              "CUDA Stream Pool",
-             "CUDA Stream pool to create CUDA streams.");
+             "CUDA Stream pool to create CUDA streams. Only needed for images in device memory.");
   spec.param(bayer_interp_mode_,
              "interpolation_mode",
              "Interpolation used for demosaicing",
              "The interpolation model to be used for demosaicing (default UNDEFINED). Values "
              "available at: "
              "https://docs.nvidia.com/cuda/npp/"
-             "group__typedefs__npp.html#ga2b58ebd329141d560aa4367f1708f191",
+             "group__typedefs__npp.html#ga2b58ebd329141d560aa4367f1708f191. Images in host "
+             "memory also accept 4 (NPPI_INTER_CUBIC) for a gradient-corrected interpolation.",
              0);
   spec.param(bayer_grid_pos_,
              "bayer_grid_pos",
@@ -72,6 +73,11 @@ void BayerDemosaicOp::setup(OperatorSpec& spec) {
              "Alpha value to be generated",
              "Alpha value to be generated if `generate_alpha` is set to `true` (default `255`).",
              255);
+  spec.param(num_threads_,
+             "num_threads",
+             "Number of threads",
+             "Number of threads demosaicing the rows of images in host memory (default `1`).",
+             1u);
 }
 
 void BayerDemosaicOp::initialize() {
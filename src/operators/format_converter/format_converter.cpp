@@ -17,6 +17,7 @@
 
 #include "holoscan/operators/format_converter/format_converter.hpp"
 
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
@@ -31,6 +32,7 @@
 #include "holoscan/core/operator_spec.hpp"
 #include "holoscan/core/resources/gxf/allocator.hpp"
 #include "holoscan/core/resources/gxf/cuda_stream_pool.hpp"
+#include "holoscan/operators/format_converter/format_converter_cpu.hpp"
 
 #define CUDA_TRY(stmt)                                                                     \
   ({                                                                                       \
@@ -155,9 +157,12 @@ static gxf_result_t verifyFormatDTypeChannels(FormatDType dtype, int channel_cou
 }
 
 void FormatConverterOp::initialize() {
+  // Without a GPU, inputs in host memory are converted on the CPU
   auto nppStatus = nppGetStreamContext(&npp_stream_ctx_);
-  if (NPP_SUCCESS != nppStatus) {
-    throw std::runtime_error("Failed to get NPP CUDA stream context");
+  has_npp_ = NPP_SUCCESS == nppStatus;
+  if (!has_npp_) {
+    HOLOSCAN_LOG_WARN(
+        "Failed to get NPP CUDA stream context, only inputs in host memory can be converted");
   }
   Operator::initialize();
 }
@@ -210,6 +215,8 @@ void FormatConverterOp::stop() {
   resize_buffer_.freeBuffer();
   channel_buffer_.freeBuffer();
   device_scratch_buffer_.freeBuffer();
+  host_resize_buffer_.clear();
+  host_resize_buffer_.shrink_to_fit();
 }
 
 void FormatConverterOp::compute(InputContext& op_input, OutputContext& op_output,
@@ -217,16 +224,6 @@ void FormatConverterOp::compute(InputContext& op_input, OutputContext& op_output
   // Process input message
   auto in_message = op_input.receive<gxf::Entity>("source_video");
 
-  // get the CUDA stream from the input message
-  gxf_result_t stream_handler_result =
-      cuda_stream_handler_.fromMessage(context.context(), in_message);
-  if (stream_handler_result != GXF_SUCCESS) {
-    throw std::runtime_error("Failed to get the CUDA stream from incoming messages");
-  }
-
-  // assign the CUDA stream to the NPP stream context
-  npp_stream_ctx_.hStream = cuda_stream_handler_.getCudaStream(context.context());
-
   nvidia::gxf::Shape out_shape{0, 0, 0};
   void* in_tensor_data = nullptr;
   nvidia::gxf::PrimitiveType in_primitive_type = nvidia::gxf::PrimitiveType::kCustom;
@@ -235,6 +232,7 @@ void FormatConverterOp::compute(InputContext& op_input, OutputContext& op_output
   int32_t columns = 0;
   int16_t in_channels = 0;
   int16_t out_channels = 0;
+  size_t in_tensor_size = 0;
 
   // get Handle to underlying nvidia::gxf::Allocator from std::shared_ptr<holoscan::Allocator>
   auto pool = nvidia::gxf::Handle<nvidia::gxf::Allocator>::Create(context.context(),
@@ -293,29 +291,12 @@ void FormatConverterOp::compute(InputContext& op_input, OutputContext& op_output
 
     // Get needed information from the tensor
     in_memory_storage_type = frame->storage_type();
+    in_tensor_size = frame->size();
     out_shape = nvidia::gxf::Shape{
         static_cast<int32_t>(buffer_info.height), static_cast<int32_t>(buffer_info.width), 4};
     in_tensor_data = frame->pointer();
     rows = buffer_info.height;
     columns = buffer_info.width;
-
-    // If the buffer is in host memory, copy it to a device (GPU) buffer
-    // as needed for the NPP resize/convert operations.
-    if (in_memory_storage_type == nvidia::gxf::MemoryStorageType::kHost) {
-      size_t buffer_size = rows * columns * in_channels;
-      if (buffer_size > device_scratch_buffer_.size()) {
-        device_scratch_buffer_.resize(
-            pool.value(), buffer_size, nvidia::gxf::MemoryStorageType::kDevice);
-        if (!device_scratch_buffer_.pointer()) {
-          throw std::runtime_error(
-              fmt::format("Failed to allocate device scratch buffer ({} bytes)", buffer_size));
-        }
-      }
-      CUDA_TRY(cudaMemcpy(
-          device_scratch_buffer_.pointer(), frame->pointer(), buffer_size, cudaMemcpyHostToDevice));
-      in_tensor_data = device_scratch_buffer_.pointer();
-      in_memory_storage_type = nvidia::gxf::MemoryStorageType::kDevice;
-    }
   } else {
     const auto maybe_tensor = in_message.get<Tensor>(in_tensor_name_.get().c_str());
     if (!maybe_tensor) {
@@ -332,15 +313,41 @@ void FormatConverterOp::compute(InputContext& op_input, OutputContext& op_output
     in_tensor_data = in_tensor_gxf.pointer();
     in_primitive_type = in_tensor_gxf.element_type();
     in_memory_storage_type = in_tensor_gxf.storage_type();
+    in_tensor_size = in_tensor_gxf.size();
     rows = in_tensor_gxf.shape().dimension(0);
     columns = in_tensor_gxf.shape().dimension(1);
     in_channels = in_tensor_gxf.shape().dimension(2);
     out_channels = in_channels;
   }
 
-  if (in_memory_storage_type != nvidia::gxf::MemoryStorageType::kDevice) {
-    throw std::runtime_error(fmt::format(
-        "Tensor('{}') or VideoBuffer is not allocated on device.\n", in_tensor_name_.get()));
+  // Inputs in host (pinned or system) memory are copied to a device (GPU) buffer for the NPP
+  // resize/convert operations. Without a GPU they are processed on the CPU, without copies, and
+  // the output is allocated in the same memory as the input.
+  if (in_memory_storage_type != nvidia::gxf::MemoryStorageType::kDevice && has_npp_) {
+    if (in_tensor_size > device_scratch_buffer_.size()) {
+      device_scratch_buffer_.resize(
+          pool.value(), in_tensor_size, nvidia::gxf::MemoryStorageType::kDevice);
+      if (!device_scratch_buffer_.pointer()) {
+        throw std::runtime_error(
+            fmt::format("Failed to allocate device scratch buffer ({} bytes)", in_tensor_size));
+      }
+    }
+    CUDA_TRY(cudaMemcpy(
+        device_scratch_buffer_.pointer(), in_tensor_data, in_tensor_size, cudaMemcpyHostToDevice));
+    in_tensor_data = device_scratch_buffer_.pointer();
+    in_memory_storage_type = nvidia::gxf::MemoryStorageType::kDevice;
+  }
+  const bool is_host_input = in_memory_storage_type != nvidia::gxf::MemoryStorageType::kDevice;
+  if (!is_host_input) {
+    // get the CUDA stream from the input message
+    gxf_result_t stream_handler_result =
+        cuda_stream_handler_.fromMessage(context.context(), in_message);
+    if (stream_handler_result != GXF_SUCCESS) {
+      throw std::runtime_error("Failed to get the CUDA stream from incoming messages");
+    }
+
+    // assign the CUDA stream to the NPP stream context
+    npp_stream_ctx_.hStream = cuda_stream_handler_.getCudaStream(context.context());
   }
 
   if (in_dtype_ == FormatDType::kUnknown) {
@@ -375,13 +382,20 @@ void FormatConverterOp::compute(InputContext& op_input, OutputContext& op_output
 
   // Resize the input image before converting data type
   if (resize_width_ > 0 && resize_height_ > 0) {
-    auto resize_result = resizeImage(in_tensor_data,
-                                     rows,
-                                     columns,
-                                     in_channels,
-                                     in_primitive_type,
-                                     resize_width_,
-                                     resize_height_);
+    auto resize_result = is_host_input ? resizeImageOnHost(in_tensor_data,
+                                                           rows,
+                                                           columns,
+                                                           in_channels,
+                                                           in_primitive_type,
+                                                           resize_width_,
+                                                           resize_height_)
+                                       : resizeImage(in_tensor_data,
+                                                     rows,
+                                                     columns,
+                                                     in_channels,
+                                                     in_primitive_type,
+                                                     resize_width_,
+                                                     resize_height_);
     if (!resize_result) { throw std::runtime_error("Failed to resize image.\n"); }
 
     // Update the tensor pointer and shape
@@ -427,7 +441,8 @@ void FormatConverterOp::compute(InputContext& op_input, OutputContext& op_output
       CreateTensorMap(context.context(),
                       pool.value(),
                       {{out_tensor_name_.get(),
-                        nvidia::gxf::MemoryStorageType::kDevice,
+                        is_host_input ? in_memory_storage_type
+                                      : nvidia::gxf::MemoryStorageType::kDevice,
                         out_shape,
                         out_primitive_type_,
                         0,
@@ -441,17 +456,23 @@ void FormatConverterOp::compute(InputContext& op_input, OutputContext& op_output
   // Set tensor to constant using NPP
   if (in_channels == 2 || in_channels == 3 || in_channels == 4) {
     // gxf_result_t convert_result = convertTensorFormat(
-    convertTensorFormat(
-        in_tensor_data, out_tensor.value()->pointer(), rows, columns, in_channels, out_channels);
-
+    if (is_host_input) {
+      convertTensorFormatOnHost(
+          in_tensor_data, out_tensor.value()->pointer(), rows, columns, in_channels, out_channels);
+    } else {
+      convertTensorFormat(
+          in_tensor_data, out_tensor.value()->pointer(), rows, columns, in_channels, out_channels);
+    }
   } else {
     throw std::runtime_error("Only support 3 or 4 channel input tensor");
   }
 
-  // pass the CUDA stream to the output message
-  stream_handler_result = cuda_stream_handler_.toMessage(out_message);
-  if (stream_handler_result != GXF_SUCCESS) {
-    throw std::runtime_error("Failed to add the CUDA stream to the outgoing messages");
+  if (!is_host_input) {
+    // pass the CUDA stream to the output message
+    gxf_result_t stream_handler_result = cuda_stream_handler_.toMessage(out_message);
+    if (stream_handler_result != GXF_SUCCESS) {
+      throw std::runtime_error("Failed to add the CUDA stream to the outgoing messages");
+    }
   }
 
   // Emit the tensor
@@ -854,6 +875,211 @@ void FormatConverterOp::convertTensorFormat(const void* in_tensor_data, void* ou
   }
 }
 
+RowWorkerPool* FormatConverterOp::hostRowWorkerPool(int32_t rows, int32_t columns) {
+  return lazyRowWorkerPool(
+      row_worker_pool_, num_threads_.get(), static_cast<int64_t>(rows) * columns);
+}
+
+nvidia::gxf::Expected<void*> FormatConverterOp::resizeImageOnHost(
+    const void* in_tensor_data, const int32_t rows, const int32_t columns, const int16_t channels,
+    const nvidia::gxf::PrimitiveType primitive_type, const int32_t resize_width,
+    const int32_t resize_height) {
+  if ((channels != 3 && channels != 4) ||
+      primitive_type != nvidia::gxf::PrimitiveType::kUnsigned8) {
+    GXF_LOG_ERROR("Unsupported input primitive type for resizing image (%d, %d)",
+                  channels,
+                  static_cast<int32_t>(primitive_type));
+    return nvidia::gxf::ExpectedOrCode(GXF_FAILURE, nullptr);
+  }
+  if (!format_converter::cpu_resize_mode_supported(resize_mode_.get())) {
+    GXF_LOG_ERROR("Resize mode %d is not supported for images in host memory",
+                  resize_mode_.get());
+    return nvidia::gxf::ExpectedOrCode(GXF_FAILURE, nullptr);
+  }
+
+  host_resize_buffer_.resize(static_cast<size_t>(resize_width) * resize_height * channels);
+  format_converter::cpu_resize(static_cast<const uint8_t*>(in_tensor_data),
+                               rows,
+                               columns,
+                               channels,
+                               host_resize_buffer_.data(),
+                               resize_height,
+                               resize_width,
+                               resize_mode_.get(),
+                               hostRowWorkerPool(resize_height, resize_width));
+
+  return nvidia::gxf::ExpectedOrCode(GXF_SUCCESS, static_cast<void*>(host_resize_buffer_.data()));
+}
+
+void FormatConverterOp::convertTensorFormatOnHost(const void* in_tensor_data,
+                                                  void* out_tensor_data, const int32_t rows,
+                                                  const int32_t columns, const int16_t in_channels,
+                                                  const int16_t out_channels) {
+  const auto& out_channel_order = out_channel_order_.get();
+  RowWorkerPool* row_worker_pool = hostRowWorkerPool(rows, columns);
+
+  // Returns the output channel order, or nullptr to keep the input order
+  auto get_channel_order = [this, &out_channel_order](size_t channel_count) -> const int32_t* {
+    if (out_channel_order.empty()) { return nullptr; }
+    if (out_channel_order.size() != channel_count) {
+      throw std::runtime_error(fmt::format("Invalid channel order for {}", out_dtype_str_.get()));
+    }
+    return out_channel_order.data();
+  };
+
+  switch (format_conversion_type_) {
+    case FormatConversionType::kNone: {
+      if (in_primitive_type_ == nvidia::gxf::PrimitiveType::kFloat32) {
+        format_converter::cpu_swap_channels(static_cast<const float*>(in_tensor_data),
+                                            in_channels,
+                                            static_cast<float*>(out_tensor_data),
+                                            out_channels,
+                                            rows,
+                                            columns,
+                                            get_channel_order(out_channels),
+                                            0.f,
+                                            row_worker_pool);
+      } else {
+        format_converter::cpu_swap_channels(static_cast<const uint8_t*>(in_tensor_data),
+                                            in_channels,
+                                            static_cast<uint8_t*>(out_tensor_data),
+                                            out_channels,
+                                            rows,
+                                            columns,
+                                            get_channel_order(out_channels),
+                                            0,
+                                            row_worker_pool);
+      }
+      break;
+    }
+    case FormatConversionType::kUnsigned8ToFloat32:
+    case FormatConversionType::kRGBA8888ToFloat32: {
+      // the RGBA8888 channel selection is done in the same pass as the scaling
+      format_converter::cpu_scale(static_cast<const uint8_t*>(in_tensor_data),
+                                  in_channels,
+                                  static_cast<float*>(out_tensor_data),
+                                  out_channels,
+                                  rows,
+                                  columns,
+                                  get_channel_order(out_channels),
+                                  scale_min_,
+                                  scale_max_,
+                                  row_worker_pool);
+      break;
+    }
+    case FormatConversionType::kFloat32ToUnsigned8: {
+      format_converter::cpu_scale(static_cast<const float*>(in_tensor_data),
+                                  in_channels,
+                                  static_cast<uint8_t*>(out_tensor_data),
+                                  out_channels,
+                                  rows,
+                                  columns,
+                                  get_channel_order(out_channels),
+                                  scale_min_,
+                                  scale_max_,
+                                  row_worker_pool);
+      break;
+    }
+    case FormatConversionType::kRGB888ToRGBA8888: {
+      // as with nppiSwapChannels_8u_C3C4R, the channel 3 is filled with the alpha value
+      int32_t dst_order[4]{0, 1, 2, format_converter::kFillChannel};
+      if (const int32_t* order = get_channel_order(4)) {
+        for (int i = 0; i < 4; i++) {
+          dst_order[i] = order[i] < 3 ? order[i] : format_converter::kFillChannel;
+        }
+      }
+      format_converter::cpu_swap_channels(static_cast<const uint8_t*>(in_tensor_data),
+                                          in_channels,
+                                          static_cast<uint8_t*>(out_tensor_data),
+                                          out_channels,
+                                          rows,
+                                          columns,
+                                          dst_order,
+                                          alpha_value_.get(),
+                                          row_worker_pool);
+      break;
+    }
+    case FormatConversionType::kRGBA8888ToRGB888: {
+      format_converter::cpu_swap_channels(static_cast<const uint8_t*>(in_tensor_data),
+                                          in_channels,
+                                          static_cast<uint8_t*>(out_tensor_data),
+                                          out_channels,
+                                          rows,
+                                          columns,
+                                          get_channel_order(3),
+                                          0,
+                                          row_worker_pool);
+      break;
+    }
+    case FormatConversionType::kRGB888ToYUV420: {
+      nvidia::gxf::VideoFormatSize<nvidia::gxf::VideoFormat::GXF_VIDEO_FORMAT_YUV420> color_format;
+      auto color_planes = color_format.getDefaultColorPlanes(columns, rows);
+
+      const auto out_y_ptr = static_cast<uint8_t*>(out_tensor_data);
+      const auto out_u_ptr = out_y_ptr + color_planes[0].size;
+      const auto out_v_ptr = out_u_ptr + color_planes[1].size;
+      uint8_t* out_yuv_ptrs[3] = {out_y_ptr, out_u_ptr, out_v_ptr};
+      int32_t out_yuv_steps[3] = {static_cast<int32_t>(color_planes[0].stride),
+                                  static_cast<int32_t>(color_planes[1].stride),
+                                  static_cast<int32_t>(color_planes[2].stride)};
+
+      format_converter::cpu_rgb_to_yuv420(static_cast<const uint8_t*>(in_tensor_data),
+                                          rows,
+                                          columns,
+                                          out_yuv_ptrs,
+                                          out_yuv_steps,
+                                          row_worker_pool);
+      break;
+    }
+    case FormatConversionType::kYUV420ToRGBA8888:
+    case FormatConversionType::kYUV420ToRGB888: {
+      nvidia::gxf::VideoFormatSize<nvidia::gxf::VideoFormat::GXF_VIDEO_FORMAT_YUV420> color_format;
+      auto color_planes = color_format.getDefaultColorPlanes(columns, rows);
+
+      const auto in_y_ptr = static_cast<const uint8_t*>(in_tensor_data);
+      const auto in_u_ptr = in_y_ptr + color_planes[0].size;
+      const auto in_v_ptr = in_u_ptr + color_planes[1].size;
+      const uint8_t* in_yuv_ptrs[3] = {in_y_ptr, in_u_ptr, in_v_ptr};
+      int32_t in_yuv_steps[3] = {static_cast<int32_t>(color_planes[0].stride),
+                                 static_cast<int32_t>(color_planes[1].stride),
+                                 static_cast<int32_t>(color_planes[2].stride)};
+
+      format_converter::cpu_yuv420_to_rgb(in_yuv_ptrs,
+                                          in_yuv_steps,
+                                          static_cast<uint8_t*>(out_tensor_data),
+                                          format_conversion_type_ ==
+                                                  FormatConversionType::kYUV420ToRGBA8888
+                                              ? 4
+                                              : 3,
+                                          rows,
+                                          columns,
+                                          row_worker_pool);
+      break;
+    }
+    case FormatConversionType::kNV12ToRGB888: {
+      nvidia::gxf::VideoFormatSize<nvidia::gxf::VideoFormat::GXF_VIDEO_FORMAT_NV12> color_format;
+      auto color_planes = color_format.getDefaultColorPlanes(columns, rows);
+
+      const auto in_y_ptr = static_cast<const uint8_t*>(in_tensor_data);
+      const auto in_uv_ptr = in_y_ptr + color_planes[0].size;
+
+      format_converter::cpu_nv12_to_rgb_709hdtv(in_y_ptr,
+                                                in_uv_ptr,
+                                                static_cast<int32_t>(color_planes[0].stride),
+                                                static_cast<uint8_t*>(out_tensor_data),
+                                                rows,
+                                                columns,
+                                                row_worker_pool);
+      break;
+    }
+    default:
+      throw std::runtime_error(fmt::format("Unsupported format conversion: {} ({}) -> {}\n",
+                                           in_dtype_str_.get(),
+                                           static_cast<uint32_t>(in_dtype_),
+                                           out_dtype_str_.get()));
+  }
+}
+
 void FormatConverterOp::setup(OperatorSpec& spec) {
   auto& in_tensor = spec.input<gxf::Entity>("source_video");
   auto& out_tensor = spec.output<gxf::Entity>("tensor");
@@ -903,6 +1129,11 @@ void FormatConverterOp::setup(OperatorSpec& spec) {
              std::vector<int>{});
 
   spec.param(pool_, "pool", "Pool", "Pool to allocate the output message.");
+  spec.param(num_threads_,
+             "num_threads",
+             "Number of threads",
+             "Number of threads processing the rows of images in host memory (default `1`).",
+             1u);
 
   cuda_stream_handler_.defineParams(spec);
 
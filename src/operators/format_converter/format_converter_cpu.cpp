@@ -0,0 +1,825 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/operators/format_converter/format_converter_cpu.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "holoscan/utils/cpu_dispatch.hpp"
+#include "holoscan/utils/row_worker_pool.hpp"
+
+namespace holoscan::ops::format_converter {
+
+namespace {
+
+// NppiInterpolationMode values
+constexpr int32_t kInterNearest = 1;
+constexpr int32_t kInterLinear = 2;
+constexpr int32_t kInterCubic = 4;
+constexpr int32_t kInterCubicBSpline = 5;
+constexpr int32_t kInterCubicCatmullRom = 6;
+constexpr int32_t kInterCubicB05C03 = 7;
+
+// Fixed-point arithmetic of the YUV conversions
+constexpr int32_t kShift = 16;
+
+int32_t to_fixed_point(double value) {
+  return static_cast<int32_t>(std::lround(value * (1 << kShift)));
+}
+
+inline uint8_t saturate_to_u8(int32_t value) {
+  return static_cast<uint8_t>(std::min(std::max(value, 0), 255));
+}
+
+inline uint8_t saturate_to_u8(float value) {
+  return static_cast<uint8_t>(std::min(std::max(value, 0.f), 255.f) + 0.5f);
+}
+
+/// Returns the number of blocks the rows of an output are split in, one per thread of the pool.
+/// Without pool the output is processed on the calling thread.
+uint32_t select_worker_count(int32_t rows, RowWorkerPool* row_worker_pool) {
+  if (!row_worker_pool) { return 1; }
+  return static_cast<uint32_t>(
+      std::clamp<int64_t>(row_worker_pool->threadCount(), 1, std::max(rows, 1)));
+}
+
+/// Calls function(worker, begin_row, end_row) for blocks of the rows [0, rows), one block per
+/// worker. The blocks are processed by the threads of the pool, the calling thread processes the
+/// first one.
+template <typename Function>
+void for_each_row_block(int32_t rows, uint32_t worker_count, RowWorkerPool* row_worker_pool,
+                        Function function) {
+  const int32_t rows_per_worker = (rows + static_cast<int32_t>(worker_count) - 1) /
+                                  static_cast<int32_t>(worker_count);
+  if (worker_count <= 1 || !row_worker_pool) {
+    function(0u, 0, rows);
+    return;
+  }
+  // the pool splits the blocks, each thread processes at most one block
+  row_worker_pool->run(worker_count, [&](size_t begin_block, size_t end_block) {
+    for (size_t block = begin_block; block < end_block; block++) {
+      const int32_t begin_row = static_cast<int32_t>(block) * rows_per_worker;
+      if (begin_row >= rows) { break; }
+      function(
+          static_cast<uint32_t>(block), begin_row, std::min(begin_row + rows_per_worker, rows));
+    }
+  });
+}
+
+//
+// Resize
+//
+
+/// Input samples and weights of each output sample of one axis
+struct ResizeTaps {
+  int32_t count;
+  std::vector<int32_t> index;
+  std::vector<float> weight;
+};
+
+/// Mitchell-Netravali cubic filter with parameters (b, c)
+float cubic_weight(float x, float b, float c) {
+  x = std::abs(x);
+  if (x < 1.f) {
+    return ((12.f - 9.f * b - 6.f * c) * x * x * x + (-18.f + 12.f * b + 6.f * c) * x * x +
+            (6.f - 2.f * b)) /
+           6.f;
+  }
+  if (x < 2.f) {
+    return ((-b - 6.f * c) * x * x * x + (6.f * b + 30.f * c) * x * x +
+            (-12.f * b - 48.f * c) * x + (8.f * b + 24.f * c)) /
+           6.f;
+  }
+  return 0.f;
+}
+
+ResizeTaps compute_taps(int32_t src_size, int32_t dst_size, int32_t resize_mode) {
+  const float scale = static_cast<float>(src_size) / static_cast<float>(dst_size);
+  auto clamp_index = [src_size](int32_t index) { return std::clamp(index, 0, src_size - 1); };
+
+  ResizeTaps taps;
+  switch (resize_mode) {
+    case kInterNearest:
+      taps.count = 1;
+      break;
+    case kInterLinear:
+      taps.count = 2;
+      break;
+    default:
+      taps.count = 4;
+      break;
+  }
+  taps.index.resize(static_cast<size_t>(dst_size) * taps.count);
+  taps.weight.resize(static_cast<size_t>(dst_size) * taps.count);
+
+  for (int32_t i = 0; i < dst_size; i++) {
+    int32_t* index = &taps.index[static_cast<size_t>(i) * taps.count];
+    float* weight = &taps.weight[static_cast<size_t>(i) * taps.count];
+    // position of the output sample center in the input
+    const float center = (static_cast<float>(i) + 0.5f) * scale - 0.5f;
+    switch (resize_mode) {
+      case kInterNearest:
+        index[0] = clamp_index(static_cast<int32_t>((static_cast<float>(i) + 0.5f) * scale));
+        weight[0] = 1.f;
+        break;
+      case kInterLinear: {
+        const float first = std::floor(center);
+        const float fraction = center - first;
+        index[0] = clamp_index(static_cast<int32_t>(first));
+        index[1] = clamp_index(static_cast<int32_t>(first) + 1);
+        weight[0] = 1.f - fraction;
+        weight[1] = fraction;
+      } break;
+      default: {
+        float b = 0.f;
+        float c = 0.5f;
+        if (resize_mode == kInterCubicBSpline) {
+          b = 1.f;
+          c = 0.f;
+        } else if (resize_mode == kInterCubicB05C03) {
+          b = 0.5f;
+          c = 0.3f;
+        }
+        const int32_t first = static_cast<int32_t>(std::floor(center)) - 1;
+        float sum = 0.f;
+        for (int32_t k = 0; k < 4; k++) {
+          index[k] = clamp_index(first + k);
+          weight[k] = cubic_weight(center - static_cast<float>(first + k), b, c);
+          sum += weight[k];
+        }
+        for (int32_t k = 0; k < 4; k++) { weight[k] /= sum; }
+      } break;
+    }
+  }
+  return taps;
+}
+
+/// Weighted sum of `count` input rows of `size` values
+HOLOSCAN_TARGET_CLONES
+void blend_rows(const uint8_t* const* rows, const float* weights, int32_t count, size_t size,
+                float* __restrict out) {
+  const uint8_t* __restrict row = rows[0];
+  const float first_weight = weights[0];
+  for (size_t i = 0; i < size; i++) { out[i] = first_weight * static_cast<float>(row[i]); }
+  for (int32_t k = 1; k < count; k++) {
+    row = rows[k];
+    const float weight = weights[k];
+    for (size_t i = 0; i < size; i++) { out[i] += weight * static_cast<float>(row[i]); }
+  }
+}
+
+/// Resamples a row blended by blend_rows() along the x axis. The channel count is a template
+/// parameter for the common cases, 0 uses `channels`.
+template <int32_t kChannels>
+void resample_row(const float* in, int32_t channels, const ResizeTaps& taps, int32_t dst_columns,
+                  uint8_t* out) {
+  if (kChannels) { channels = kChannels; }
+  for (int32_t x = 0; x < dst_columns; x++) {
+    const int32_t* index = &taps.index[static_cast<size_t>(x) * taps.count];
+    const float* weight = &taps.weight[static_cast<size_t>(x) * taps.count];
+    for (int32_t c = 0; c < channels; c++) {
+      float sum = 0.f;
+      for (int32_t k = 0; k < taps.count; k++) {
+        sum += weight[k] * in[static_cast<size_t>(index[k]) * channels + c];
+      }
+      out[static_cast<size_t>(x) * channels + c] = saturate_to_u8(sum);
+    }
+  }
+}
+
+//
+// Channel swap and scaling
+//
+
+HOLOSCAN_TARGET_CLONES
+void scale_values(const uint8_t* __restrict src, float* __restrict dst, size_t size, float factor,
+                  float offset) {
+  for (size_t i = 0; i < size; i++) { dst[i] = static_cast<float>(src[i]) * factor + offset; }
+}
+
+HOLOSCAN_TARGET_CLONES
+void scale_values(const float* __restrict src, uint8_t* __restrict dst, size_t size, float factor,
+                  float offset) {
+  for (size_t i = 0; i < size; i++) { dst[i] = saturate_to_u8((src[i] - offset) * factor); }
+}
+
+/// Copies, or scales with `transform`, the channels of the rows [begin_row, end_row). Output
+/// channel c is input channel order[c], or `fill_value` for kFillChannel. The channel counts are
+/// template parameters for the common cases so that the loop over the channels is unrolled, 0
+/// uses the runtime counts.
+template <int32_t kInChannels, int32_t kOutChannels, typename SrcT, typename DstT,
+          typename Transform>
+void convert_rows(const SrcT* src, int32_t in_channels, DstT* dst, int32_t out_channels,
+                  int32_t columns, int32_t begin_row, int32_t end_row, const int32_t* order,
+                  DstT fill_value, Transform transform) {
+  const int32_t in_c = kInChannels ? kInChannels : in_channels;
+  if constexpr (kOutChannels != 0) {
+    // Local copies of the order, kept in registers since they cannot alias the output. The fill
+    // channels read channel 0 and select the fill value, so that the loop has no branches.
+    int32_t source[kOutChannels];
+    bool is_fill[kOutChannels];
+    for (int32_t c = 0; c < kOutChannels; c++) {
+      is_fill[c] = order[c] == kFillChannel;
+      source[c] = is_fill[c] ? 0 : order[c];
+    }
+    for (int32_t y = begin_row; y < end_row; y++) {
+      const SrcT* in = src + static_cast<size_t>(y) * columns * in_c;
+      DstT* out = dst + static_cast<size_t>(y) * columns * kOutChannels;
+      for (int32_t x = 0; x < columns; x++) {
+        for (int32_t c = 0; c < kOutChannels; c++) {
+          const DstT value = transform(in[source[c]]);
+          out[c] = is_fill[c] ? fill_value : value;
+        }
+        in += in_c;
+        out += kOutChannels;
+      }
+    }
+  } else {
+    for (int32_t y = begin_row; y < end_row; y++) {
+      const SrcT* in = src + static_cast<size_t>(y) * columns * in_c;
+      DstT* out = dst + static_cast<size_t>(y) * columns * out_channels;
+      for (int32_t x = 0; x < columns; x++) {
+        for (int32_t c = 0; c < out_channels; c++) {
+          out[c] = order[c] == kFillChannel ? fill_value : transform(in[order[c]]);
+        }
+        in += in_c;
+        out += out_channels;
+      }
+    }
+  }
+}
+
+template <typename SrcT, typename DstT, typename Transform>
+void convert_rows(const SrcT* src, int32_t in_channels, DstT* dst, int32_t out_channels,
+                  int32_t columns, int32_t begin_row, int32_t end_row, const int32_t* order,
+                  DstT fill_value, Transform transform) {
+  if (in_channels == 3 && out_channels == 3) {
+    convert_rows<3, 3>(
+        src, 3, dst, 3, columns, begin_row, end_row, order, fill_value, transform);
+  } else if (in_channels == 3 && out_channels == 4) {
+    convert_rows<3, 4>(
+        src, 3, dst, 4, columns, begin_row, end_row, order, fill_value, transform);
+  } else if (in_channels == 4 && out_channels == 3) {
+    convert_rows<4, 3>(
+        src, 4, dst, 3, columns, begin_row, end_row, order, fill_value, transform);
+  } else if (in_channels == 4 && out_channels == 4) {
+    convert_rows<4, 4>(
+        src, 4, dst, 4, columns, begin_row, end_row, order, fill_value, transform);
+  } else {
+    convert_rows<0, 0>(src,
+                       in_channels,
+                       dst,
+                       out_channels,
+                       columns,
+                       begin_row,
+                       end_row,
+                       order,
+                       fill_value,
+                       transform);
+  }
+}
+
+/// Fills `order` from `channel_order`, or with the default order if it is null. Returns true if
+/// the output channels are the input ones.
+bool normalize_channel_order(const int32_t* channel_order, int32_t in_channels,
+                             int32_t out_channels, std::vector<int32_t>* order) {
+  order->resize(out_channels);
+  bool is_identity = in_channels == out_channels;
+  for (int32_t c = 0; c < out_channels; c++) {
+    int32_t value = c < in_channels ? c : kFillChannel;
+    if (channel_order) {
+      value = channel_order[c];
+      if (value != kFillChannel && (value < 0 || value >= in_channels)) {
+        throw std::runtime_error("Invalid channel order: channel " + std::to_string(value) +
+                                 " of a " + std::to_string(in_channels) + " channel input");
+      }
+    }
+    (*order)[c] = value;
+    is_identity = is_identity && value == c;
+  }
+  return is_identity;
+}
+
+/// Converts the channels of an image with `transform`, or with `flat_transform` over all the
+/// values of a row block when the output channels are the input ones.
+template <typename SrcT, typename DstT, typename Transform, typename FlatTransform>
+void convert_image(const SrcT* src, int32_t in_channels, DstT* dst, int32_t out_channels,
+                   int32_t rows, int32_t columns, const int32_t* channel_order, DstT fill_value,
+                   Transform transform, FlatTransform flat_transform,
+                   RowWorkerPool* row_worker_pool) {
+  if (rows <= 0 || columns <= 0) { return; }
+  if (in_channels <= 0 || out_channels <= 0) {
+    throw std::runtime_error("Invalid channel count");
+  }
+
+  std::vector<int32_t> order;
+  const bool is_identity =
+      normalize_channel_order(channel_order, in_channels, out_channels, &order);
+  const uint32_t worker_count = select_worker_count(rows, row_worker_pool);
+
+  if (is_identity) {
+    const size_t row_size = static_cast<size_t>(columns) * in_channels;
+    for_each_row_block(
+        rows, worker_count, row_worker_pool, [&](uint32_t, int32_t begin_row, int32_t end_row) {
+          flat_transform(src + begin_row * row_size,
+                         dst + begin_row * row_size,
+                         (end_row - begin_row) * row_size);
+        });
+    return;
+  }
+
+  for_each_row_block(
+      rows,
+      worker_count,
+      row_worker_pool,
+      [&](uint32_t, int32_t begin_row, int32_t end_row) {
+        convert_rows(src,
+                     in_channels,
+                     dst,
+                     out_channels,
+                     columns,
+                     begin_row,
+                     end_row,
+                     order.data(),
+                     fill_value,
+                     transform);
+      });
+}
+
+//
+// YUV
+//
+
+/// Fixed-point coefficients of a YUV to RGB conversion, scaled by 2^kShift
+struct YUVToRGBCoefficients {
+  int32_t y_offset;
+  int32_t y;
+  int32_t r_v;
+  int32_t g_u;
+  int32_t g_v;
+  int32_t b_u;
+};
+
+/// Converts a row, the chroma samples of pixel x are u[(x / 2) * chroma_step] and
+/// v[(x / 2) * chroma_step]
+template <int32_t kOutChannels>
+void yuv_row_to_rgb(const uint8_t* __restrict y, const uint8_t* __restrict u,
+                    const uint8_t* __restrict v, int32_t chroma_step, uint8_t* __restrict out,
+                    int32_t columns, const YUVToRGBCoefficients& k) {
+  constexpr int32_t kRound = 1 << (kShift - 1);
+  for (int32_t x = 0; x < columns; x++) {
+    const int32_t luma = (static_cast<int32_t>(y[x]) - k.y_offset) * k.y + kRound;
+    const int32_t cb = static_cast<int32_t>(u[(x >> 1) * chroma_step]) - 128;
+    const int32_t cr = static_cast<int32_t>(v[(x >> 1) * chroma_step]) - 128;
+    out[0] = saturate_to_u8((luma + k.r_v * cr) >> kShift);
+    out[1] = saturate_to_u8((luma - k.g_u * cb - k.g_v * cr) >> kShift);
+    out[2] = saturate_to_u8((luma + k.b_u * cb) >> kShift);
+    if (kOutChannels == 4) { out[3] = 255; }
+    out += kOutChannels;
+  }
+}
+
+
+//
+// Fused preprocessing
+//
+
+// Number of output columns of a tile of cpu_preprocess(). The blended input of a tile and its
+// output stay in the L1 cache.
+constexpr int32_t kPreprocessTileWidth = 128;
+
+/// Columns of a tile of cpu_preprocess(), the input columns [first_input, first_input + span)
+/// are the ones read by the taps of its output columns [begin, end)
+struct PreprocessTile {
+  int32_t begin;
+  int32_t end;
+  int32_t first_input;
+  int32_t span;
+};
+
+/// Resamples one channel of a tile blended by blend_rows() along the x axis, and normalizes it.
+/// `offsets` are the offsets of the taps in the blended tile.
+template <int32_t kTaps>
+HOLOSCAN_TARGET_CLONES
+void resample_normalize(const float* __restrict in, const int32_t* __restrict offsets,
+                        const float* __restrict weights, int32_t size, float factor, float offset,
+                        float* __restrict out, size_t out_step) {
+  for (int32_t i = 0; i < size; i++) {
+    float sum = 0.f;
+    for (int32_t k = 0; k < kTaps; k++) {
+      sum += weights[i * kTaps + k] * in[offsets[i * kTaps + k]];
+    }
+    // as the chained conversion, where the resized image is 8-bit
+    sum = std::min(std::max(sum, 0.f), 255.f);
+    out[i * out_step] = sum * factor + offset;
+  }
+}
+}  // namespace
+
+bool cpu_resize_mode_supported(int32_t resize_mode) {
+  switch (resize_mode) {
+    case kInterNearest:
+    case kInterLinear:
+    case kInterCubic:
+    case kInterCubicBSpline:
+    case kInterCubicCatmullRom:
+    case kInterCubicB05C03:
+      return true;
+    default:
+      return false;
+  }
+}
+
+void cpu_resize(const uint8_t* src, int32_t src_rows, int32_t src_columns, int32_t channels,
+                uint8_t* dst, int32_t dst_rows, int32_t dst_columns, int32_t resize_mode,
+                RowWorkerPool* row_worker_pool) {
+  if (!cpu_resize_mode_supported(resize_mode)) {
+    throw std::runtime_error("Unsupported resize mode for host memory images: " +
+                             std::to_string(resize_mode));
+  }
+  if (src_rows <= 0 || src_columns <= 0 || dst_rows <= 0 || dst_columns <= 0 || channels <= 0) {
+    return;
+  }
+
+  const ResizeTaps x_taps = compute_taps(src_columns, dst_columns, resize_mode);
+  const ResizeTaps y_taps = compute_taps(src_rows, dst_rows, resize_mode);
+  const size_t src_step = static_cast<size_t>(src_columns) * channels;
+  const size_t dst_step = static_cast<size_t>(dst_columns) * channels;
+  const uint32_t worker_count = select_worker_count(dst_rows, row_worker_pool);
+
+  if (resize_mode == kInterNearest) {
+    for_each_row_block(
+        dst_rows,
+        worker_count,
+        row_worker_pool,
+        [&](uint32_t, int32_t begin_row, int32_t end_row) {
+          for (int32_t y = begin_row; y < end_row; y++) {
+            const uint8_t* in = src + y_taps.index[y] * src_step;
+            uint8_t* out = dst + y * dst_step;
+            for (int32_t x = 0; x < dst_columns; x++) {
+              const uint8_t* pixel = in + static_cast<size_t>(x_taps.index[x]) * channels;
+              for (int32_t c = 0; c < channels; c++) { out[c] = pixel[c]; }
+              out += channels;
+            }
+          }
+        });
+    return;
+  }
+
+  // Each output row blends the input rows of its taps into a row buffer of the worker, which is
+  // then resampled along the x axis.
+  std::vector<float> row_buffers(worker_count * src_step);
+  for_each_row_block(
+      dst_rows,
+      worker_count,
+      row_worker_pool,
+      [&](uint32_t worker, int32_t begin_row, int32_t end_row) {
+        float* row = row_buffers.data() + worker * src_step;
+        const uint8_t* in_rows[4];
+        for (int32_t y = begin_row; y < end_row; y++) {
+          const size_t first_tap = static_cast<size_t>(y) * y_taps.count;
+          for (int32_t k = 0; k < y_taps.count; k++) {
+            in_rows[k] = src + y_taps.index[first_tap + k] * src_step;
+          }
+          blend_rows(in_rows, &y_taps.weight[first_tap], y_taps.count, src_step, row);
+          uint8_t* out = dst + y * dst_step;
+          switch (channels) {
+            case 3:
+              resample_row<3>(row, channels, x_taps, dst_columns, out);
+              break;
+            case 4:
+              resample_row<4>(row, channels, x_taps, dst_columns, out);
+              break;
+            default:
+              resample_row<0>(row, channels, x_taps, dst_columns, out);
+              break;
+          }
+        }
+      });
+}
+
+void cpu_preprocess(const uint8_t* src, int32_t src_rows, int32_t src_columns,
+                    int32_t in_channels, float* dst, int32_t dst_rows, int32_t dst_columns,
+                    int32_t out_channels, const int32_t* channel_order, const float* factors,
+                    const float* offsets, bool planar, int32_t resize_mode,
+                    RowWorkerPool* row_worker_pool) {
+  if (!cpu_resize_mode_supported(resize_mode)) {
+    throw std::runtime_error("Unsupported resize mode for host memory images: " +
+                             std::to_string(resize_mode));
+  }
+  if (src_rows <= 0 || src_columns <= 0 || dst_rows <= 0 || dst_columns <= 0) { return; }
+  if (in_channels <= 0 || out_channels <= 0) { throw std::runtime_error("Invalid channel count"); }
+
+  std::vector<int32_t> order;
+  normalize_channel_order(channel_order, in_channels, out_channels, &order);
+  if (std::find(order.begin(), order.end(), kFillChannel) != order.end()) {
+    throw std::runtime_error("Invalid channel order: the output channels must be input channels");
+  }
+
+  // Without resize every output pixel is an input pixel
+  if (src_rows == dst_rows && src_columns == dst_columns) { resize_mode = kInterNearest; }
+  const ResizeTaps x_taps = compute_taps(src_columns, dst_columns, resize_mode);
+  const ResizeTaps y_taps = compute_taps(src_rows, dst_rows, resize_mode);
+
+  // Split the output columns in tiles and compute the offsets of the x taps in the blended tiles,
+  // they are the same for all the rows
+  std::vector<PreprocessTile> tiles;
+  std::vector<int32_t> tap_offsets(x_taps.index.size());
+  int32_t max_span = 0;
+  for (int32_t begin = 0; begin < dst_columns; begin += kPreprocessTileWidth) {
+    PreprocessTile tile;
+    tile.begin = begin;
+    tile.end = std::min(begin + kPreprocessTileWidth, dst_columns);
+    const auto first_tap = x_taps.index.begin() + static_cast<size_t>(tile.begin) * x_taps.count;
+    const auto last_tap = x_taps.index.begin() + static_cast<size_t>(tile.end) * x_taps.count;
+    const auto [min_index, max_index] = std::minmax_element(first_tap, last_tap);
+    tile.first_input = *min_index;
+    tile.span = *max_index - *min_index + 1;
+    for (auto tap = first_tap; tap != last_tap; ++tap) {
+      tap_offsets[tap - x_taps.index.begin()] = (*tap - tile.first_input) * in_channels;
+    }
+    max_span = std::max(max_span, tile.span);
+    tiles.push_back(tile);
+  }
+
+  const size_t src_step = static_cast<size_t>(src_columns) * in_channels;
+  const size_t plane_size = static_cast<size_t>(dst_rows) * dst_columns;
+  const size_t tile_buffer_size = static_cast<size_t>(max_span) * in_channels;
+  const uint32_t worker_count = select_worker_count(dst_rows, row_worker_pool);
+  std::vector<float> tile_buffers(worker_count * tile_buffer_size);
+
+  for_each_row_block(
+      dst_rows,
+      worker_count,
+      row_worker_pool,
+      [&](uint32_t worker, int32_t begin_row, int32_t end_row) {
+        float* blended = tile_buffers.data() + worker * tile_buffer_size;
+        const uint8_t* in_rows[4];
+        for (int32_t y = begin_row; y < end_row; y++) {
+          const size_t first_y_tap = static_cast<size_t>(y) * y_taps.count;
+          for (const auto& tile : tiles) {
+            // blend the input rows of the tile, then resample and normalize each output channel
+            for (int32_t k = 0; k < y_taps.count; k++) {
+              in_rows[k] = src + y_taps.index[first_y_tap + k] * src_step +
+                           static_cast<size_t>(tile.first_input) * in_channels;
+            }
+            blend_rows(in_rows,
+                       &y_taps.weight[first_y_tap],
+                       y_taps.count,
+                       static_cast<size_t>(tile.span) * in_channels,
+                       blended);
+
+            const size_t first_x_tap = static_cast<size_t>(tile.begin) * x_taps.count;
+            const size_t pixel = static_cast<size_t>(y) * dst_columns + tile.begin;
+            for (int32_t c = 0; c < out_channels; c++) {
+              float* out = planar ? dst + c * plane_size + pixel : dst + pixel * out_channels + c;
+              const size_t out_step = planar ? 1 : out_channels;
+              const float* in = blended + order[c];
+              const int32_t* tile_offsets = &tap_offsets[first_x_tap];
+              const float* weights = &x_taps.weight[first_x_tap];
+              const int32_t size = tile.end - tile.begin;
+              switch (x_taps.count) {
+                case 1:
+                  resample_normalize<1>(
+                      in, tile_offsets, weights, size, factors[c], offsets[c], out, out_step);
+                  break;
+                case 2:
+                  resample_normalize<2>(
+                      in, tile_offsets, weights, size, factors[c], offsets[c], out, out_step);
+                  break;
+                default:
+                  resample_normalize<4>(
+                      in, tile_offsets, weights, size, factors[c], offsets[c], out, out_step);
+                  break;
+              }
+            }
+          }
+        }
+      });
+}
+
+void cpu_swap_channels(const uint8_t* src, int32_t in_channels, uint8_t* dst,
+                       int32_t out_channels, int32_t rows, int32_t columns,
+                       const int32_t* channel_order, uint8_t fill_value,
+                       RowWorkerPool* row_worker_pool) {
+  convert_image(
+      src,
+      in_channels,
+      dst,
+      out_channels,
+      rows,
+      columns,
+      channel_order,
+      fill_value,
+      [](uint8_t value) { return value; },
+      [](const uint8_t* in, uint8_t* out, size_t size) { std::memcpy(out, in, size); },
+      row_worker_pool);
+}
+
+void cpu_swap_channels(const float* src, int32_t in_channels, float* dst, int32_t out_channels,
+                       int32_t rows, int32_t columns, const int32_t* channel_order,
+                       float fill_value, RowWorkerPool* row_worker_pool) {
+  convert_image(
+      src,
+      in_channels,
+      dst,
+      out_channels,
+      rows,
+      columns,
+      channel_order,
+      fill_value,
+      [](float value) { return value; },
+      [](const float* in, float* out, size_t size) {
+        std::memcpy(out, in, size * sizeof(float));
+      },
+      row_worker_pool);
+}
+
+void cpu_scale(const uint8_t* src, int32_t in_channels, float* dst, int32_t out_channels,
+               int32_t rows, int32_t columns, const int32_t* channel_order, float scale_min,
+               float scale_max, RowWorkerPool* row_worker_pool) {
+  const float factor = (scale_max - scale_min) / 255.f;
+  convert_image(
+      src,
+      in_channels,
+      dst,
+      out_channels,
+      rows,
+      columns,
+      channel_order,
+      0.f,
+      [factor, scale_min](uint8_t value) {
+        return static_cast<float>(value) * factor + scale_min;
+      },
+      [factor, scale_min](const uint8_t* in, float* out, size_t size) {
+        scale_values(in, out, size, factor, scale_min);
+      },
+      row_worker_pool);
+}
+
+void cpu_scale(const float* src, int32_t in_channels, uint8_t* dst, int32_t out_channels,
+               int32_t rows, int32_t columns, const int32_t* channel_order, float scale_min,
+               float scale_max, RowWorkerPool* row_worker_pool) {
+  if (scale_max == scale_min) { throw std::runtime_error("Invalid scale range"); }
+  const float factor = 255.f / (scale_max - scale_min);
+  convert_image(
+      src,
+      in_channels,
+      dst,
+      out_channels,
+      rows,
+      columns,
+      channel_order,
+      uint8_t{0},
+      [factor, scale_min](float value) { return saturate_to_u8((value - scale_min) * factor); },
+      [factor, scale_min](const float* in, uint8_t* out, size_t size) {
+        scale_values(in, out, size, factor, scale_min);
+      },
+      row_worker_pool);
+}
+
+void cpu_rgb_to_yuv420(const uint8_t* src, int32_t rows, int32_t columns, uint8_t* const yuv[3],
+                       const int32_t yuv_steps[3], RowWorkerPool* row_worker_pool) {
+  if (rows <= 0 || columns <= 0) { return; }
+
+  // Y = 0.299 R + 0.587 G + 0.114 B, U = 0.492 (B - Y) + 128 and V = 0.877 (R - Y) + 128
+  const int32_t y_r = to_fixed_point(0.299);
+  const int32_t y_g = to_fixed_point(0.587);
+  const int32_t y_b = to_fixed_point(0.114);
+  const int32_t u_r = to_fixed_point(-0.147);
+  const int32_t u_g = to_fixed_point(-0.289);
+  const int32_t u_b = to_fixed_point(0.436);
+  const int32_t v_r = to_fixed_point(0.615);
+  const int32_t v_g = to_fixed_point(-0.515);
+  const int32_t v_b = to_fixed_point(-0.100);
+  constexpr int32_t kRound = 1 << (kShift - 1);
+  // the chroma is computed from the sum of the 4 pixels of a block
+  constexpr int32_t kBlockShift = kShift + 2;
+  constexpr int32_t kBlockOffset = (128 << kBlockShift) + (1 << (kBlockShift - 1));
+
+  const size_t src_step = static_cast<size_t>(columns) * 3;
+  const int32_t chroma_rows = (rows + 1) / 2;
+  const int32_t chroma_columns = (columns + 1) / 2;
+  const uint32_t worker_count = select_worker_count(chroma_rows, row_worker_pool);
+
+  for_each_row_block(
+      chroma_rows,
+      worker_count,
+      row_worker_pool,
+      [&](uint32_t, int32_t begin_row, int32_t end_row) {
+        for (int32_t cy = begin_row; cy < end_row; cy++) {
+          const int32_t y0 = 2 * cy;
+          const int32_t y1 = std::min(y0 + 1, rows - 1);
+          for (int32_t y = y0; y <= y1; y++) {
+            const uint8_t* __restrict in = src + y * src_step;
+            uint8_t* __restrict out = yuv[0] + static_cast<size_t>(y) * yuv_steps[0];
+            for (int32_t x = 0; x < columns; x++) {
+              out[x] = saturate_to_u8(
+                  (y_r * in[3 * x] + y_g * in[3 * x + 1] + y_b * in[3 * x + 2] + kRound) >> kShift);
+            }
+          }
+
+          const uint8_t* in0 = src + y0 * src_step;
+          const uint8_t* in1 = src + y1 * src_step;
+          uint8_t* out_u = yuv[1] + static_cast<size_t>(cy) * yuv_steps[1];
+          uint8_t* out_v = yuv[2] + static_cast<size_t>(cy) * yuv_steps[2];
+          for (int32_t cx = 0; cx < chroma_columns; cx++) {
+            const size_t x0 = 6 * static_cast<size_t>(cx);
+            const size_t x1 = 3 * static_cast<size_t>(std::min(2 * cx + 1, columns - 1));
+            const int32_t r = in0[x0] + in0[x1] + in1[x0] + in1[x1];
+            const int32_t g = in0[x0 + 1] + in0[x1 + 1] + in1[x0 + 1] + in1[x1 + 1];
+            const int32_t b = in0[x0 + 2] + in0[x1 + 2] + in1[x0 + 2] + in1[x1 + 2];
+            out_u[cx] = saturate_to_u8((u_r * r + u_g * g + u_b * b + kBlockOffset) >> kBlockShift);
+            out_v[cx] = saturate_to_u8((v_r * r + v_g * g + v_b * b + kBlockOffset) >> kBlockShift);
+          }
+        }
+      });
+}
+
+void cpu_yuv420_to_rgb(const uint8_t* const yuv[3], const int32_t yuv_steps[3], uint8_t* dst,
+                       int32_t out_channels, int32_t rows, int32_t columns,
+                       RowWorkerPool* row_worker_pool) {
+  if (out_channels != 3 && out_channels != 4) {
+    throw std::runtime_error("Invalid channel count for the yuv420 conversion: " +
+                             std::to_string(out_channels));
+  }
+  if (rows <= 0 || columns <= 0) { return; }
+
+  // R = Y + 1.140 V, G = Y - 0.394 U - 0.581 V and B = Y + 2.032 U
+  YUVToRGBCoefficients coefficients;
+  coefficients.y_offset = 0;
+  coefficients.y = to_fixed_point(1.0);
+  coefficients.r_v = to_fixed_point(1.140);
+  coefficients.g_u = to_fixed_point(0.394);
+  coefficients.g_v = to_fixed_point(0.581);
+  coefficients.b_u = to_fixed_point(2.032);
+
+  const size_t dst_step = static_cast<size_t>(columns) * out_channels;
+  const uint32_t worker_count = select_worker_count(rows, row_worker_pool);
+  for_each_row_block(
+      rows,
+      worker_count,
+      row_worker_pool,
+      [&](uint32_t, int32_t begin_row, int32_t end_row) {
+        for (int32_t y = begin_row; y < end_row; y++) {
+          const uint8_t* in_y = yuv[0] + static_cast<size_t>(y) * yuv_steps[0];
+          const uint8_t* in_u = yuv[1] + static_cast<size_t>(y / 2) * yuv_steps[1];
+          const uint8_t* in_v = yuv[2] + static_cast<size_t>(y / 2) * yuv_steps[2];
+          if (out_channels == 4) {
+            yuv_row_to_rgb<4>(in_y, in_u, in_v, 1, dst + y * dst_step, columns, coefficients);
+          } else {
+            yuv_row_to_rgb<3>(in_y, in_u, in_v, 1, dst + y * dst_step, columns, coefficients);
+          }
+        }
+      });
+}
+
+void cpu_nv12_to_rgb_709hdtv(const uint8_t* y, const uint8_t* uv, int32_t step, uint8_t* dst,
+                             int32_t rows, int32_t columns, RowWorkerPool* row_worker_pool) {
+  if (rows <= 0 || columns <= 0) { return; }
+
+  // R = 1.164 (Y - 16) + 1.793 V, G = 1.164 (Y - 16) - 0.213 U - 0.533 V and
+  // B = 1.164 (Y - 16) + 2.112 U
+  YUVToRGBCoefficients coefficients;
+  coefficients.y_offset = 16;
+  coefficients.y = to_fixed_point(1.164);
+  coefficients.r_v = to_fixed_point(1.793);
+  coefficients.g_u = to_fixed_point(0.213);
+  coefficients.g_v = to_fixed_point(0.533);
+  coefficients.b_u = to_fixed_point(2.112);
+
+  const size_t dst_step = static_cast<size_t>(columns) * 3;
+  const uint32_t worker_count = select_worker_count(rows, row_worker_pool);
+  for_each_row_block(
+      rows,
+      worker_count,
+      row_worker_pool,
+      [&](uint32_t, int32_t begin_row, int32_t end_row) {
+        for (int32_t row = begin_row; row < end_row; row++) {
+          const uint8_t* in_y = y + static_cast<size_t>(row) * step;
+          const uint8_t* in_uv = uv + static_cast<size_t>(row / 2) * step;
+          yuv_row_to_rgb<3>(in_y, in_uv, in_uv + 1, 2, dst + row * dst_step, columns, coefficients);
+        }
+      });
+}
+
+}  // namespace holoscan::ops::format_converter
@@ -79,7 +79,13 @@ struct YAML::convert<holoscan::ops::MultiAIInferenceOp::DataVecMap> {
     try {
       for (YAML::const_iterator it = node.begin(); it != node.end(); ++it) {
         std::string key = it->first.as<std::string>();
-        std::vector<std::string> value = it->second.as<std::vector<std::string>>();
+        // A single value may be given without a sequence
+        std::vector<std::string> value;
+        if (it->second.IsScalar()) {
+          value.push_back(it->second.as<std::string>());
+        } else {
+          value = it->second.as<std::vector<std::string>>();
+        }
         datavmap.insert(key, value);
       }
     } catch (const std::exception& e) {
@@ -110,8 +116,8 @@ void MultiAIInferenceOp::setup(OperatorSpec& spec) {
   spec.param(inference_map_,
              "inference_map",
              "Inferred tensor per model",
-             "Tensor to model map.",
-             DataMap());
+             "Tensor to model map. Models with several outputs map to a list of tensors.",
+             DataVecMap());
   spec.param(
       in_tensor_names_, "in_tensor_names", "Input Tensors", "Input tensors", {std::string("")});
   spec.param(
@@ -121,11 +127,67 @@ void MultiAIInferenceOp::setup(OperatorSpec& spec) {
   spec.param(is_engine_path_, "is_engine_path", "Input path is engine file", "", false);
 
   spec.param(enable_fp16_, "enable_fp16", "Use fp16", "Use fp16.", false);
+  spec.param(input_mean_,
+             "input_mean",
+             "Input mean",
+             "Per channel mean normalizing uint8 input tensors to float32, with channels "
+             "interleaved in the last dimension. Empty to pass uint8 tensors as is.",
+             std::vector<float>{});
+  spec.param(input_std_,
+             "input_std",
+             "Input standard deviation",
+             "Per channel standard deviation normalizing uint8 input tensors to float32.",
+             std::vector<float>{});
   spec.param(input_on_cuda_, "input_on_cuda", "Input buffer on CUDA", "", true);
   spec.param(output_on_cuda_, "output_on_cuda", "Output buffer on CUDA", "", true);
   spec.param(transmit_on_cuda_, "transmit_on_cuda", "Transmit message on CUDA", "", true);
 
   spec.param(parallel_inference_, "parallel_inference", "Parallel inference", "", true);
+  spec.param(inference_threads_,
+             "inference_threads",
+             "Inference threads",
+             "Number of threads running models in parallel. Each model always runs on the same "
+             "thread. If zero value is specified, one thread per model is used.",
+             0UL);
+  spec.param(batch_size_,
+             "batch_size",
+             "Batch size",
+             "Maximum number of samples run in one inference call. Only supported by onnxrt for "
+             "models with a dynamic batch dimension; operators running the same model batch their "
+             "concurrent inferences.",
+             1UL);
+  spec.param(batch_timeout_us_,
+             "batch_timeout_us",
+             "Batch timeout",
+             "Maximum time in microseconds an inference waits for others to fill its batch.",
+             0L);
+  spec.param(intra_op_threads_,
+             "intra_op_threads",
+             "Intra-op threads",
+             "Onnxruntime threads running an operator of a model, 0 for the onnxruntime default.",
+             1);
+  spec.param(inter_op_threads_,
+             "inter_op_threads",
+             "Inter-op threads",
+             "Onnxruntime threads running independent operators of a model in parallel execution "
+             "mode, 0 for the onnxruntime default.",
+             0);
+  spec.param(parallel_execution_,
+             "parallel_execution",
+             "Parallel execution",
+             "Run independent operators of a model in parallel (onnxruntime execution mode).",
+             false);
+  spec.param(graph_optimization_level_,
+             "graph_optimization_level",
+             "Graph optimization level",
+             "Onnxruntime graph optimization level: disable, basic, extended or all.",
+             std::string("extended"));
+  spec.param(optimized_model_cache_path_,
+             "optimized_model_cache_path",
+             "Optimized model cache path",
+             "Directory where onnxruntime saves the optimized models and loads them from. Empty "
+             "for no cache.",
+             std::string(""));
   spec.param(receivers_, "receivers", "Receivers", "List of receivers", {});
   spec.param(transmitter_, "transmitter", "Transmitter", "Transmitter", {&transmitter});
 }
@@ -139,30 +201,57 @@ void MultiAIInferenceOp::initialize() {
 void MultiAIInferenceOp::start() {
   try {
     // Check for the validity of parameters from configuration
+    auto inference_tensor_map = inference_map_.get().get_map();
     auto status = HoloInfer::multiai_inference_validity_check(model_path_map_.get().get_map(),
                                                               pre_processor_map_.get().get_map(),
-                                                              inference_map_.get().get_map(),
+                                                              inference_tensor_map,
                                                               in_tensor_names_.get(),
                                                               out_tensor_names_.get());
     if (status.get_code() != HoloInfer::holoinfer_code::H_SUCCESS) {
       HoloInfer::raise_error(module_, "Parameter Validation failed: " + status.get_message());
     }
 
+    if (input_mean_.get().size() != input_std_.get().size()) {
+      HoloInfer::raise_error(module_,
+                             "Parameter Validation failed: input_mean and input_std must have the "
+                             "same size");
+    }
+
     bool is_aarch64 = HoloInfer::is_platform_aarch64();
     if (is_aarch64 && backend_.get().compare("onnxrt") == 0 && !infer_on_cpu_.get()) {
       HoloInfer::raise_error(module_, "Onnxruntime with CUDA not supported on aarch64.");
     }
 
+    // The first output of each model is its inferred tensor, the others are mapped separately
+    HoloInfer::Mappings inference_map;
+    output_tensor_map_.clear();
+    for (const auto& inference : inference_tensor_map) {
+      inference_map[inference.first] = inference.second[0];
+      for (const auto& tensor_name : inference.second) {
+        output_tensor_map_[tensor_name] = tensor_name;
+      }
+    }
+
     // Create multiai specification structure
     multiai_specs_ = std::make_shared<HoloInfer::MultiAISpecs>(backend_.get(),
                                                                model_path_map_.get().get_map(),
-                                                               inference_map_.get().get_map(),
+                                                               inference_map,
                                                                is_engine_path_.get(),
                                                                infer_on_cpu_.get(),
                                                                parallel_inference_.get(),
                                                                enable_fp16_.get(),
                                                                input_on_cuda_.get(),
                                                                output_on_cuda_.get());
+    multiai_specs_->inference_threads_ = inference_threads_.get();
+    multiai_specs_->input_tensor_map_ = pre_processor_map_.get().get_map();
+    multiai_specs_->output_tensor_map_ = inference_tensor_map;
+    multiai_specs_->batch_size_ = batch_size_.get();
+    multiai_specs_->batch_timeout_us_ = batch_timeout_us_.get();
+    multiai_specs_->intra_op_threads_ = intra_op_threads_.get();
+    multiai_specs_->inter_op_threads_ = inter_op_threads_.get();
+    multiai_specs_->parallel_execution_ = parallel_execution_.get();
+    multiai_specs_->graph_optimization_level_ = graph_optimization_level_.get();
+    multiai_specs_->optimized_model_cache_path_ = optimized_model_cache_path_.get();
 
     // Create holoscan inference context
     holoscan_infer_context_ = std::make_unique<HoloInfer::InferContext>();
@@ -206,8 +295,11 @@ void MultiAIInferenceOp::compute(InputContext& op_input, OutputContext& op_outpu
                                                     in_tensor_names_.get(),
                                                     multiai_specs_->data_per_tensor_,
                                                     dims_per_tensor_,
+                                                    received_messages_,
                                                     input_on_cuda_.get(),
-                                                    module_);
+                                                    module_,
+                                                    input_mean_.get(),
+                                                    input_std_.get());
 
     if (stat != GXF_SUCCESS) { HoloInfer::raise_error(module_, "Tick, Data extraction"); }
 
@@ -226,21 +318,20 @@ void MultiAIInferenceOp::compute(InputContext& op_input, OutputContext& op_outpu
     }
     HOLOSCAN_LOG_DEBUG(status.get_message());
 
-    // Get output dimensions
-    auto model_out_dims_map = holoscan_infer_context_->get_output_dimensions();
+    // Get output dimensions per tensor, following the batch of the inference
+    auto model_out_dims_map = holoscan_infer_context_->get_output_tensor_dimensions();
 
     auto cont = context.context();
 
     // Transmit output buffers via a single GXF transmitter
     stat = holoscan::utils::multiai_transmit_data_per_model(cont,
-                                                            inference_map_.get().get_map(),
+                                                            output_tensor_map_,
                                                             multiai_specs_->output_per_model_,
                                                             op_output,
                                                             out_tensor_names_.get(),
                                                             model_out_dims_map,
                                                             output_on_cuda_.get(),
                                                             transmit_on_cuda_.get(),
-                                                            data_type_,
                                                             allocator.value(),
                                                             module_);
     if (stat != GXF_SUCCESS) { HoloInfer::raise_error(module_, "Tick, Data Transmission"); }
@@ -192,6 +192,7 @@ void MultiAIPostprocessorOp::compute(InputContext& op_input, OutputContext& op_o
                                                                     in_tensor_names_.get(),
                                                                     data_per_tensor_,
                                                                     dims_per_tensor_,
+                                                                    received_messages_,
                                                                     input_on_cuda_.get(),
                                                                     module_);
 
@@ -222,7 +223,6 @@ void MultiAIPostprocessorOp::compute(InputContext& op_input, OutputContext& op_o
                                                               processed_dims_map,
                                                               output_on_cuda_.get(),
                                                               transmit_on_cuda_.get(),
-                                                              nvidia::gxf::PrimitiveType::kFloat32,
                                                               allocator.value(),
                                                               module_);
 
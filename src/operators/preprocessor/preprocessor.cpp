@@ -0,0 +1,274 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/operators/preprocessor/preprocessor.hpp"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "holoscan/core/execution_context.hpp"
+#include "holoscan/core/fragment.hpp"
+#include "holoscan/core/gxf/entity.hpp"
+#include "holoscan/core/gxf/gxf_tensor.hpp"
+#include "holoscan/core/io_context.hpp"
+#include "holoscan/core/io_spec.hpp"
+#include "holoscan/core/operator_spec.hpp"
+#include "holoscan/core/resources/gxf/allocator.hpp"
+#include "holoscan/operators/format_converter/format_converter_cpu.hpp"
+
+using holoscan::ops::format_converter::cpu_preprocess;
+using holoscan::ops::format_converter::cpu_resize_mode_supported;
+
+namespace holoscan::ops {
+
+void PreprocessorOp::setup(OperatorSpec& spec) {
+  auto& in_tensor = spec.input<gxf::Entity>("source_video");
+  auto& out_tensor = spec.output<gxf::Entity>("tensor");
+
+  spec.param(in_, "in", "Input", "Input channel.", &in_tensor);
+  spec.param(out_, "out", "Output", "Output channel.", &out_tensor);
+
+  spec.param(in_tensor_name_,
+             "in_tensor_name",
+             "InputTensorName",
+             "Name of the input tensor.",
+             std::string(""));
+  spec.param(out_tensor_name_,
+             "out_tensor_name",
+             "OutputTensorName",
+             "Name of the output tensor.",
+             std::string(""));
+  spec.param(resize_width_,
+             "resize_width",
+             "Resize width",
+             "Width for resize. No resize if this value or the height is zero.",
+             0);
+  spec.param(resize_height_,
+             "resize_height",
+             "Resize height",
+             "Height for resize. No resize if this value or the width is zero.",
+             0);
+  spec.param(resize_mode_,
+             "resize_mode",
+             "Resize mode",
+             "Mode for resize, a NppiInterpolationMode value: 1 (nearest neighbor), 2 (linear) or "
+             "4 to 7 (cubic). 4 (NPPI_INTER_CUBIC) if this value is zero.",
+             0);
+  spec.param(out_channel_order_,
+             "out_channel_order",
+             "Output channel order",
+             "Input channel of each output channel. The first three channels if empty.",
+             std::vector<int>{});
+  spec.param(scale_min_, "scale_min", "Scale min", "Value the input value 0 maps to.", 0.f);
+  spec.param(scale_max_, "scale_max", "Scale max", "Value the input value 255 maps to.", 1.f);
+  spec.param(mean_,
+             "mean",
+             "Mean",
+             "Mean subtracted from each output channel after scaling. Zero if empty.",
+             std::vector<float>{});
+  spec.param(std_,
+             "std",
+             "Standard deviation",
+             "Standard deviation dividing each output channel after the mean subtraction. One if "
+             "empty.",
+             std::vector<float>{});
+  spec.param(out_layout_,
+             "out_layout",
+             "Output layout",
+             "Layout of the output tensor: 'hwc' or 'chw'.",
+             std::string("hwc"));
+
+  spec.param(pool_, "pool", "Pool", "Pool to allocate the output message.");
+  spec.param(num_threads_,
+             "num_threads",
+             "Number of threads",
+             "Number of threads processing the rows of outputs in host memory (default `1`).",
+             1u);
+}
+
+void PreprocessorOp::start() {
+  resize_mode_value_ = resize_mode_.get() == 0 ? 4 /* NPPI_INTER_CUBIC */ : resize_mode_.get();
+  if (!cpu_resize_mode_supported(resize_mode_value_)) {
+    throw std::runtime_error(fmt::format("Unsupported resize mode: {}", resize_mode_.get()));
+  }
+
+  if (out_layout_.get() == "hwc") {
+    planar_ = false;
+  } else if (out_layout_.get() == "chw") {
+    planar_ = true;
+  } else {
+    throw std::runtime_error(fmt::format("Unsupported output layout: {}", out_layout_.get()));
+  }
+
+  channel_order_.assign(out_channel_order_.get().begin(), out_channel_order_.get().end());
+  if (channel_order_.empty()) { channel_order_ = {0, 1, 2}; }
+  const size_t out_channels = channel_order_.size();
+
+  const auto& mean = mean_.get();
+  const auto& std_dev = std_.get();
+  if (!mean.empty() && mean.size() != out_channels) {
+    throw std::runtime_error(fmt::format(
+        "The mean has {} values, expected one per output channel ({})", mean.size(), out_channels));
+  }
+  if (!std_dev.empty() && std_dev.size() != out_channels) {
+    throw std::runtime_error(
+        fmt::format("The standard deviation has {} values, expected one per output channel ({})",
+                    std_dev.size(),
+                    out_channels));
+  }
+
+  // fold the scaling and the normalization in one multiply-add per value
+  factors_.resize(out_channels);
+  offsets_.resize(out_channels);
+  const float scale = (scale_max_.get() - scale_min_.get()) / 255.f;
+  for (size_t c = 0; c < out_channels; c++) {
+    const float channel_mean = mean.empty() ? 0.f : mean[c];
+    const float channel_std = std_dev.empty() ? 1.f : std_dev[c];
+    if (channel_std == 0.f) {
+      throw std::runtime_error(
+          fmt::format("The standard deviation of output channel {} is zero", c));
+    }
+    factors_[c] = scale / channel_std;
+    offsets_[c] = (scale_min_.get() - channel_mean) / channel_std;
+  }
+}
+
+void PreprocessorOp::compute(InputContext& op_input, OutputContext& op_output,
+                             ExecutionContext& context) {
+  // Process input message
+  auto in_message = op_input.receive<gxf::Entity>("source_video");
+
+  const void* in_tensor_data = nullptr;
+  nvidia::gxf::PrimitiveType in_primitive_type = nvidia::gxf::PrimitiveType::kCustom;
+  nvidia::gxf::MemoryStorageType in_memory_storage_type = nvidia::gxf::MemoryStorageType::kHost;
+  int32_t rows = 0;
+  int32_t columns = 0;
+  int32_t in_channels = 0;
+
+  // Get either the Tensor or VideoBuffer attached to the message
+  bool is_video_buffer;
+  nvidia::gxf::Handle<nvidia::gxf::VideoBuffer> video_buffer;
+  try {
+    video_buffer = holoscan::gxf::get_videobuffer(in_message);
+    is_video_buffer = true;
+  } catch (const std::runtime_error& r_) {
+    HOLOSCAN_LOG_TRACE("Failed to read VideoBuffer with error: {}", std::string(r_.what()));
+    is_video_buffer = false;
+  }
+
+  if (is_video_buffer) {
+    auto frame = video_buffer.get();
+    const auto& buffer_info = frame->video_frame_info();
+    if (buffer_info.color_format != nvidia::gxf::VideoFormat::GXF_VIDEO_FORMAT_RGBA) {
+      throw std::runtime_error(fmt::format("Unsupported input format: {}",
+                                           static_cast<int>(buffer_info.color_format)));
+    }
+    if (buffer_info.color_planes[0].stride != buffer_info.width * 4) {
+      throw std::runtime_error("Video buffers with padded rows are not supported");
+    }
+    in_primitive_type = nvidia::gxf::PrimitiveType::kUnsigned8;
+    in_memory_storage_type = frame->storage_type();
+    in_tensor_data = frame->pointer();
+    rows = buffer_info.height;
+    columns = buffer_info.width;
+    in_channels = 4;
+  } else {
+    const auto in_tensor = in_message.get<Tensor>(in_tensor_name_.get().c_str());
+    if (!in_tensor) {
+      throw std::runtime_error(
+          fmt::format("Tensor '{}' not found in message.", in_tensor_name_.get()));
+    }
+    holoscan::gxf::GXFTensor in_tensor_gxf{in_tensor->dl_ctx()};
+    if (in_tensor_gxf.rank() != 3) {
+      throw std::runtime_error(
+          fmt::format("Expected an HWC input tensor, got rank {}", in_tensor_gxf.rank()));
+    }
+    in_primitive_type = in_tensor_gxf.element_type();
+    in_memory_storage_type = in_tensor_gxf.storage_type();
+    in_tensor_data = in_tensor_gxf.pointer();
+    rows = in_tensor_gxf.shape().dimension(0);
+    columns = in_tensor_gxf.shape().dimension(1);
+    in_channels = in_tensor_gxf.shape().dimension(2);
+  }
+
+  if (in_memory_storage_type == nvidia::gxf::MemoryStorageType::kDevice) {
+    throw std::runtime_error(
+        "Inputs in device memory are not supported, use FormatConverterOp to preprocess them");
+  }
+  if (in_primitive_type != nvidia::gxf::PrimitiveType::kUnsigned8) {
+    throw std::runtime_error("Only 8-bit input images are supported");
+  }
+  if (in_channels != 3 && in_channels != 4) {
+    throw std::runtime_error(
+        fmt::format("Only 3 or 4 channel input images are supported, got {}", in_channels));
+  }
+
+  int32_t out_rows = rows;
+  int32_t out_columns = columns;
+  if (resize_width_ > 0 && resize_height_ > 0) {
+    out_rows = resize_height_;
+    out_columns = resize_width_;
+  }
+  const int32_t out_channels = static_cast<int32_t>(channel_order_.size());
+  const auto out_shape = planar_ ? nvidia::gxf::Shape{out_channels, out_rows, out_columns}
+                                 : nvidia::gxf::Shape{out_rows, out_columns, out_channels};
+
+  // get Handle to underlying nvidia::gxf::Allocator from std::shared_ptr<holoscan::Allocator>
+  auto pool = nvidia::gxf::Handle<nvidia::gxf::Allocator>::Create(context.context(),
+                                                                  pool_.get()->gxf_cid());
+
+  // The output is allocated in the same kind of memory as the input
+  nvidia::gxf::Expected<nvidia::gxf::Entity> out_message = CreateTensorMap(
+      context.context(),
+      pool.value(),
+      {{out_tensor_name_.get(),
+        in_memory_storage_type,
+        out_shape,
+        nvidia::gxf::PrimitiveType::kFloat32,
+        0,
+        nvidia::gxf::ComputeTrivialStrides(
+            out_shape, nvidia::gxf::PrimitiveTypeSize(nvidia::gxf::PrimitiveType::kFloat32))}},
+      false);
+  if (!out_message) { throw std::runtime_error("Failed to create out_message"); }
+  const auto out_tensor = out_message.value().get<nvidia::gxf::Tensor>();
+  if (!out_tensor) { throw std::runtime_error("Failed to create out_tensor"); }
+
+  RowWorkerPool* row_worker_pool = lazyRowWorkerPool(
+      row_worker_pool_, num_threads_.get(), static_cast<int64_t>(out_rows) * out_columns);
+  cpu_preprocess(static_cast<const uint8_t*>(in_tensor_data),
+                 rows,
+                 columns,
+                 in_channels,
+                 reinterpret_cast<float*>(out_tensor.value()->pointer()),
+                 out_rows,
+                 out_columns,
+                 out_channels,
+                 channel_order_.data(),
+                 factors_.data(),
+                 offsets_.data(),
+                 planar_,
+                 resize_mode_value_,
+                 row_worker_pool);
+
+  // Emit the tensor
+  auto result = gxf::Entity(std::move(out_message.value()));
+  op_output.emit(result);
+}
+
+}  // namespace holoscan::ops
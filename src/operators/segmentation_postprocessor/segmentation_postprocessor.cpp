@@ -18,6 +18,7 @@
 #include "holoscan/operators/segmentation_postprocessor/segmentation_postprocessor.hpp"
 
 #include <limits>
+#include <memory>
 #include <string>
 #include <utility>
 
@@ -31,6 +32,7 @@
 #include "holoscan/core/resources/gxf/allocator.hpp"
 #include "holoscan/core/resources/gxf/cuda_stream_pool.hpp"
 
+using holoscan::ops::segmentation_postprocessor::cpu_postprocess;
 using holoscan::ops::segmentation_postprocessor::cuda_postprocess;
 using holoscan::ops::segmentation_postprocessor::DataFormat;
 using holoscan::ops::segmentation_postprocessor::NetworkOutputType;
@@ -62,6 +64,11 @@ void SegmentationPostprocessorOp::setup(OperatorSpec& spec) {
              "Data format of network output.",
              std::string("hwc"));
   spec.param(allocator_, "allocator", "Allocator", "Output Allocator");
+  spec.param(num_threads_,
+             "num_threads",
+             "Number of threads",
+             "Number of threads processing the rows of outputs in host memory (default `1`).",
+             1u);
 
   cuda_stream_handler_.defineParams(spec);
 
@@ -92,11 +99,18 @@ void SegmentationPostprocessorOp::compute(InputContext& op_input, OutputContext&
   }
   auto in_tensor = maybe_tensor;
 
+  // Tensors in host memory (e.g. the output of an inference on ONNX Runtime CPU) are processed on
+  // the CPU, the output is allocated in the same kind of memory as the input.
+  const auto in_device_type = in_tensor->device().device_type;
+  const bool is_host_input = in_device_type == kDLCPU || in_device_type == kDLCUDAHost;
+
   // get the CUDA stream from the input message
-  gxf_result_t stream_handler_result =
-      cuda_stream_handler_.fromMessage(context.context(), in_message);
-  if (stream_handler_result != GXF_SUCCESS) {
-    throw std::runtime_error("Failed to get the CUDA stream from incoming messages");
+  if (!is_host_input) {
+    gxf_result_t stream_handler_result =
+        cuda_stream_handler_.fromMessage(context.context(), in_message);
+    if (stream_handler_result != GXF_SUCCESS) {
+      throw std::runtime_error("Failed to get the CUDA stream from incoming messages");
+    }
   }
 
   segmentation_postprocessor::Shape shape = {};
@@ -129,14 +143,19 @@ void SegmentationPostprocessorOp::compute(InputContext& op_input, OutputContext&
   auto out_tensor = out_message.value().add<nvidia::gxf::Tensor>("out_tensor");
   if (!out_tensor) { throw std::runtime_error("Failed to allocate output tensor"); }
 
-  // Allocate and convert output buffer on the device.
+  // Allocate and convert output buffer on the device or on the host.
   nvidia::gxf::Shape output_shape{shape.height, shape.width, 1};
+  nvidia::gxf::MemoryStorageType output_storage_type = nvidia::gxf::MemoryStorageType::kDevice;
+  if (in_device_type == kDLCPU) {
+    output_storage_type = nvidia::gxf::MemoryStorageType::kSystem;
+  } else if (in_device_type == kDLCUDAHost) {
+    output_storage_type = nvidia::gxf::MemoryStorageType::kHost;
+  }
 
   // get Handle to underlying nvidia::gxf::Allocator from std::shared_ptr<holoscan::Allocator>
   auto allocator = nvidia::gxf::Handle<nvidia::gxf::Allocator>::Create(context.context(),
                                                                        allocator_.get()->gxf_cid());
-  out_tensor.value()->reshape<uint8_t>(
-      output_shape, nvidia::gxf::MemoryStorageType::kDevice, allocator.value());
+  out_tensor.value()->reshape<uint8_t>(output_shape, output_storage_type, allocator.value());
   if (!out_tensor.value()->pointer()) {
     throw std::runtime_error("Failed to allocate output tensor buffer.");
   }
@@ -146,17 +165,28 @@ void SegmentationPostprocessorOp::compute(InputContext& op_input, OutputContext&
   nvidia::gxf::Expected<uint8_t*> out_tensor_data = out_tensor.value()->data<uint8_t>();
   if (!out_tensor_data) { throw std::runtime_error("Failed to get out tensor data!"); }
 
-  cuda_postprocess(network_output_type_value_,
-                   data_format_value_,
-                   shape,
-                   in_tensor_data,
-                   out_tensor_data.value(),
-                   cuda_stream_handler_.getCudaStream(context.context()));
-
-  // pass the CUDA stream to the output message
-  stream_handler_result = cuda_stream_handler_.toMessage(out_message);
-  if (stream_handler_result != GXF_SUCCESS) {
-    throw std::runtime_error("Failed to add the CUDA stream to the outgoing messages");
+  if (is_host_input) {
+    RowWorkerPool* row_worker_pool = lazyRowWorkerPool(
+        row_worker_pool_, num_threads_.get(), static_cast<int64_t>(shape.height) * shape.width);
+    cpu_postprocess(network_output_type_value_,
+                    data_format_value_,
+                    shape,
+                    in_tensor_data,
+                    out_tensor_data.value(),
+                    row_worker_pool);
+  } else {
+    cuda_postprocess(network_output_type_value_,
+                     data_format_value_,
+                     shape,
+                     in_tensor_data,
+                     out_tensor_data.value(),
+                     cuda_stream_handler_.getCudaStream(context.context()));
+
+    // pass the CUDA stream to the output message
+    gxf_result_t stream_handler_result = cuda_stream_handler_.toMessage(out_message);
+    if (stream_handler_result != GXF_SUCCESS) {
+      throw std::runtime_error("Failed to add the CUDA stream to the outgoing messages");
+    }
   }
 
   auto result = gxf::Entity(std::move(out_message.value()));
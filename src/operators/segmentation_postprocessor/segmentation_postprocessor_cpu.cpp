@@ -0,0 +1,148 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cstdint>
+
+#include "holoscan/operators/segmentation_postprocessor/segmentation_postprocessor.cuh"
+#include "holoscan/utils/row_worker_pool.hpp"
+
+namespace holoscan::ops {
+namespace segmentation_postprocessor {
+
+namespace {
+
+// Number of pixels of a row processed together. The running maximum and index of a block stay in
+// registers and L1, and the loops over the block are vectorized by the compiler.
+constexpr int32_t kBlockWidth = 256;
+
+template <enum DataFormat>
+inline size_t data_format_to_index(Shape shape, int32_t y, int32_t x, int32_t c);
+
+template <>
+inline size_t data_format_to_index<DataFormat::kHWC>(Shape shape, int32_t y, int32_t x,
+                                                     int32_t c) {
+  return (static_cast<size_t>(y) * shape.width + x) * shape.channels + c;
+}
+
+template <>
+inline size_t data_format_to_index<DataFormat::kNHWC>(Shape shape, int32_t y, int32_t x,
+                                                      int32_t c) {
+  return data_format_to_index<DataFormat::kHWC>(shape, y, x, c);
+}
+
+template <>
+inline size_t data_format_to_index<DataFormat::kNCHW>(Shape shape, int32_t y, int32_t x,
+                                                      int32_t c) {
+  return (static_cast<size_t>(c) * shape.height + y) * shape.width + x;
+}
+
+/// Distance between the values of one channel of two neighbouring pixels
+template <enum DataFormat data_format>
+inline size_t pixel_stride(Shape shape) {
+  return data_format == DataFormat::kNCHW ? 1 : shape.channels;
+}
+
+template <enum NetworkOutputType network_output_type, enum DataFormat data_format>
+void postprocess_rows(Shape shape, const float* input, output_type_t* output, int32_t begin_row,
+                      int32_t end_row) {
+  const size_t stride = pixel_stride<data_format>(shape);
+  float max_value[kBlockWidth];
+  int32_t max_index[kBlockWidth];
+
+  for (int32_t y = begin_row; y < end_row; y++) {
+    for (int32_t x = 0; x < shape.width; x += kBlockWidth) {
+      const int32_t count = std::min(kBlockWidth, shape.width - x);
+      output_type_t* out = output + static_cast<size_t>(y) * shape.width + x;
+
+      switch (network_output_type) {
+        case NetworkOutputType::kSigmoid: {
+          const float* in = input + data_format_to_index<data_format>(shape, y, x, 0);
+          for (int32_t i = 0; i < count; i++) { out[i] = in[i * stride] >= 0.5f ? 1 : 0; }
+        } break;
+        case NetworkOutputType::kSoftmax: {
+          // Same selection as the CUDA kernel: the first channel strictly greater than the
+          // maximum so far, starting from 0.0 and channel 0. The index is selected with a mask
+          // rather than a branch so that the loop over the pixels vectorizes.
+          for (int32_t i = 0; i < count; i++) {
+            max_value[i] = 0.0f;
+            max_index[i] = 0;
+          }
+          for (int32_t c = 0; c < shape.channels; c++) {
+            const float* in = input + data_format_to_index<data_format>(shape, y, x, c);
+            for (int32_t i = 0; i < count; i++) {
+              const float value = in[i * stride];
+              const int32_t greater = -static_cast<int32_t>(value > max_value[i]);
+              max_index[i] = (c & greater) | (max_index[i] & ~greater);
+              max_value[i] = std::max(max_value[i], value);
+            }
+          }
+          for (int32_t i = 0; i < count; i++) { out[i] = static_cast<output_type_t>(max_index[i]); }
+        } break;
+      }
+    }
+  }
+}
+
+template <enum NetworkOutputType network_output_type, enum DataFormat data_format>
+void postprocess(Shape shape, const float* input, output_type_t* output,
+                 RowWorkerPool* row_worker_pool) {
+  if (!row_worker_pool) {
+    postprocess_rows<network_output_type, data_format>(shape, input, output, 0, shape.height);
+    return;
+  }
+  row_worker_pool->run(shape.height, [&](size_t begin_row, size_t end_row) {
+    postprocess_rows<network_output_type, data_format>(
+        shape, input, output, static_cast<int32_t>(begin_row), static_cast<int32_t>(end_row));
+  });
+}
+
+template <enum NetworkOutputType network_output_type>
+void postprocess(enum DataFormat data_format, Shape shape, const float* input,
+                 output_type_t* output, RowWorkerPool* row_worker_pool) {
+  switch (data_format) {
+    case DataFormat::kNCHW:
+      postprocess<network_output_type, DataFormat::kNCHW>(shape, input, output, row_worker_pool);
+      break;
+    case DataFormat::kHWC:
+      postprocess<network_output_type, DataFormat::kHWC>(shape, input, output, row_worker_pool);
+      break;
+    case DataFormat::kNHWC:
+      postprocess<network_output_type, DataFormat::kNHWC>(shape, input, output, row_worker_pool);
+      break;
+  }
+}
+
+}  // namespace
+
+void cpu_postprocess(enum NetworkOutputType network_output_type, enum DataFormat data_format,
+                     Shape shape, const float* input, output_type_t* output,
+                     RowWorkerPool* row_worker_pool) {
+  if (shape.height <= 0 || shape.width <= 0) { return; }
+
+  switch (network_output_type) {
+    case NetworkOutputType::kSigmoid:
+      postprocess<NetworkOutputType::kSigmoid>(data_format, shape, input, output, row_worker_pool);
+      break;
+    case NetworkOutputType::kSoftmax:
+      postprocess<NetworkOutputType::kSoftmax>(data_format, shape, input, output, row_worker_pool);
+      break;
+  }
+}
+
+}  // namespace segmentation_postprocessor
+}  // namespace holoscan::ops
@@ -0,0 +1,183 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/operators/video_stream_recorder/block_file_endpoint.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include "holoscan/logger/logger.hpp"
+
+namespace holoscan::ops {
+
+namespace {
+
+// Write all of `size` bytes at `offset`, retrying on short writes and interruptions.
+bool write_all(int fd, const uint8_t* data, size_t size, uint64_t offset) {
+  while (size > 0) {
+    ssize_t count = pwrite(fd, data, size, static_cast<off_t>(offset));
+    if (count < 0) {
+      if (errno == EINTR) { continue; }
+      return false;
+    }
+    data += count;
+    size -= static_cast<size_t>(count);
+    offset += static_cast<uint64_t>(count);
+  }
+  return true;
+}
+
+}  // namespace
+
+BlockFileEndpoint::~BlockFileEndpoint() {
+  close();
+}
+
+nvidia::gxf::Expected<void> BlockFileEndpoint::open(const std::string& filename,
+                                                    size_t block_size, bool direct_io) {
+  close();
+
+  capacity_ = std::max(kAlignment, (block_size + kAlignment - 1) / kAlignment * kAlignment);
+  void* buffer = nullptr;
+  if (posix_memalign(&buffer, kAlignment, capacity_) != 0) {
+    HOLOSCAN_LOG_ERROR("Could not allocate a {} bytes write buffer for '{}'", capacity_, filename);
+    return nvidia::gxf::Unexpected{GXF_OUT_OF_MEMORY};
+  }
+  buffer_ = static_cast<uint8_t*>(buffer);
+
+  constexpr int kFlags = O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC;
+  direct_io_ = false;
+  if (direct_io) {
+    fd_ = ::open(filename.c_str(), kFlags | O_DIRECT, 0644);
+    if (fd_ >= 0) {
+      direct_io_ = true;
+    } else if (errno == EINVAL) {
+      HOLOSCAN_LOG_WARN("Direct I/O is not supported for '{}', using buffered I/O", filename);
+    }
+  }
+  if (fd_ < 0) { fd_ = ::open(filename.c_str(), kFlags, 0644); }
+  if (fd_ < 0) {
+    HOLOSCAN_LOG_ERROR("Could not open '{}' for writing: {}", filename, std::strerror(errno));
+    free(buffer_);
+    buffer_ = nullptr;
+    return nvidia::gxf::Unexpected{GXF_FAILURE};
+  }
+
+  used_ = 0;
+  buffer_offset_ = 0;
+  size_ = 0;
+  return nvidia::gxf::Success;
+}
+
+nvidia::gxf::Expected<void> BlockFileEndpoint::close() {
+  if (fd_ < 0) { return nvidia::gxf::Success; }
+
+  auto result = flush();
+  // Remove the padding of the last direct I/O block
+  if (result && direct_io_ && ftruncate(fd_, static_cast<off_t>(size_)) != 0) {
+    HOLOSCAN_LOG_ERROR("Could not truncate file: {}", std::strerror(errno));
+    result = nvidia::gxf::Unexpected{GXF_FAILURE};
+  }
+  if (::close(fd_) != 0 && result) { result = nvidia::gxf::Unexpected{GXF_FAILURE}; }
+  fd_ = -1;
+  free(buffer_);
+  buffer_ = nullptr;
+  used_ = 0;
+  return result;
+}
+
+nvidia::gxf::Expected<void> BlockFileEndpoint::flush() {
+  if (fd_ < 0) { return nvidia::gxf::Unexpected{GXF_FAILURE}; }
+  return write_buffer();
+}
+
+nvidia::gxf::Expected<void> BlockFileEndpoint::sync() {
+  auto result = flush();
+  if (!result) { return result; }
+  if (fdatasync(fd_) != 0) {
+    HOLOSCAN_LOG_ERROR("Could not sync file: {}", std::strerror(errno));
+    return nvidia::gxf::Unexpected{GXF_FAILURE};
+  }
+  return nvidia::gxf::Success;
+}
+
+nvidia::gxf::Expected<void> BlockFileEndpoint::write_buffer() {
+  if (used_ == 0) { return nvidia::gxf::Success; }
+
+  if (!direct_io_) {
+    if (!write_all(fd_, buffer_, used_, buffer_offset_)) {
+      HOLOSCAN_LOG_ERROR("Could not write file: {}", std::strerror(errno));
+      return nvidia::gxf::Unexpected{GXF_FAILURE};
+    }
+    buffer_offset_ += used_;
+    used_ = 0;
+    return nvidia::gxf::Success;
+  }
+
+  // Direct I/O writes whole blocks: pad the last partial block with zeros
+  const size_t full = used_ / kAlignment * kAlignment;
+  const size_t padded = (used_ + kAlignment - 1) / kAlignment * kAlignment;
+  std::memset(buffer_ + used_, 0, padded - used_);
+  if (!write_all(fd_, buffer_, padded, buffer_offset_)) {
+    HOLOSCAN_LOG_ERROR("Could not write file: {}", std::strerror(errno));
+    return nvidia::gxf::Unexpected{GXF_FAILURE};
+  }
+
+  // Keep the partial block so that it is completed and written again at the same offset
+  const size_t tail = used_ - full;
+  if (tail > 0 && full > 0) { std::memmove(buffer_, buffer_ + full, tail); }
+  buffer_offset_ += full;
+  used_ = tail;
+  return nvidia::gxf::Success;
+}
+
+gxf_result_t BlockFileEndpoint::write_abi(const void* data, size_t size, size_t* bytes_written) {
+  if (data == nullptr || bytes_written == nullptr) { return GXF_ARGUMENT_NULL; }
+  if (fd_ < 0) { return GXF_FAILURE; }
+
+  const auto* bytes = static_cast<const uint8_t*>(data);
+  size_t remaining = size;
+  while (remaining > 0) {
+    if (used_ == capacity_ && !write_buffer()) {
+      *bytes_written = size - remaining;
+      return GXF_FAILURE;
+    }
+    const size_t count = std::min(remaining, capacity_ - used_);
+    std::memcpy(buffer_ + used_, bytes, count);
+    used_ += count;
+    bytes += count;
+    remaining -= count;
+  }
+  size_ += size;
+  *bytes_written = size;
+  return GXF_SUCCESS;
+}
+
+gxf_result_t BlockFileEndpoint::read_abi(void* data, size_t size, size_t* bytes_read) {
+  (void)data;
+  (void)size;
+  (void)bytes_read;
+  return GXF_NOT_IMPLEMENTED;
+}
+
+}  // namespace holoscan::ops
@@ -17,13 +17,17 @@
 
 #include "holoscan/operators/video_stream_recorder/video_stream_recorder.hpp"
 
+#include <algorithm>
 #include <chrono>
+#include <exception>
 #include <string>
+#include <utility>
 
 #include "gxf/core/expected.hpp"
 #include "gxf/serialization/entity_serializer.hpp"
 
 #include "holoscan/core/execution_context.hpp"
+#include "holoscan/core/executor.hpp"
 #include "holoscan/core/fragment.hpp"
 #include "holoscan/core/io_context.hpp"
 #include "holoscan/core/gxf/entity.hpp"
@@ -50,13 +54,78 @@ void VideoStreamRecorderOp::setup(OperatorSpec& spec) {
              "Flush on tick",
              "Flushes output buffer on every tick when true",
              false);
+  spec.param(queue_size_,
+             "queue_size",
+             "Queue size",
+             "Number of entities which may wait for a writer thread. If zero value is specified, "
+             "entities are written in compute() (default: 0).",
+             0UL);
+  spec.param(drop_on_overflow_,
+             "drop_on_overflow",
+             "Drop on overflow",
+             "Drop entities when the queue is full instead of waiting for room (default: false).",
+             false);
+  spec.param(write_block_size_,
+             "write_block_size",
+             "Write block size",
+             "Size in bytes of the blocks in which writes to the entity file are coalesced "
+             "(default: 4 MiB).",
+             static_cast<size_t>(4 * 1024 * 1024));
+  spec.param(direct_io_,
+             "direct_io",
+             "Direct I/O",
+             "Write the entity file with O_DIRECT, bypassing the page cache (default: false).",
+             false);
+  spec.param(fsync_interval_ms_,
+             "fsync_interval_ms",
+             "Sync interval",
+             "Sync the files to the device when this many milliseconds have passed since the last "
+             "sync. If zero value is specified, it is ignored (default: 0).",
+             0UL);
+  spec.param(fsync_bytes_,
+             "fsync_bytes",
+             "Sync size",
+             "Sync the files to the device when this many bytes have been written since the last "
+             "sync. If zero value is specified, it is ignored (default: 0).",
+             0UL);
+  spec.param(compression_,
+             "compression",
+             "Compression",
+             "Compression of the recorded entities: 'none', 'lz4' or 'zstd' (default: 'none').",
+             std::string("none"));
+  spec.param(compression_level_,
+             "compression_level",
+             "Compression level",
+             "Compression level used by zstd, from 1 to 22 (default: 3).",
+             3);
+  spec.param(delta_encoding_,
+             "delta_encoding",
+             "Delta encoding",
+             "Encode entities as a lossless delta to the previous entity (default: false).",
+             false);
+  spec.param(keyframe_interval_,
+             "keyframe_interval",
+             "Keyframe interval",
+             "Number of entities between two entities recorded without delta encoding. If zero "
+             "value is specified, only the first entity is (default: 30).",
+             static_cast<uint64_t>(30));
 }
 
 void VideoStreamRecorderOp::initialize() {
   // Set up prerequisite parameters before calling GXFOperator::initialize()
   auto frag = fragment();
+  // Forward the compression arguments to the serializer, which is created before our own
+  // parameters are set
+  ArgList serializer_args;
+  for (const auto& arg : args()) {
+    const auto& name = arg.name();
+    if (name == "compression" || name == "compression_level" || name == "delta_encoding" ||
+        name == "keyframe_interval") {
+      serializer_args.add(arg);
+    }
+  }
   auto entity_serializer =
-      frag->make_resource<holoscan::VideoStreamSerializer>("entity_serializer");
+      frag->make_resource<holoscan::VideoStreamSerializer>("entity_serializer", serializer_args);
   add_arg(Arg("entity_serializer") = entity_serializer);
 
   // Operator::initialize must occur after all arguments have been added
@@ -73,31 +142,32 @@ void VideoStreamRecorderOp::initialize() {
     path += receiver_.get()->name();
   }
 
-  // Initialize index file stream as write-only
-  index_file_stream_ =
-      nvidia::gxf::FileStream("", path + nvidia::gxf::FileStream::kIndexFileExtension);
-
-  // Initialize binary file stream as write-only
-  binary_file_stream_ =
-      nvidia::gxf::FileStream("", path + nvidia::gxf::FileStream::kBinaryFileExtension);
-
-  // Open index file stream
-  nvidia::gxf::Expected<void> result = index_file_stream_.open();
+  // Open index file stream (index entries are small, so direct I/O is not used)
+  nvidia::gxf::Expected<void> result = index_file_stream_.open(
+      path + nvidia::gxf::FileStream::kIndexFileExtension, BlockFileEndpoint::kAlignment, false);
   if (!result) {
     auto code = nvidia::gxf::ToResultCode(result);
     throw std::runtime_error(fmt::format("Failed to open index_file_stream_ with code: {}", code));
   }
 
   // Open binary file stream
-  result = binary_file_stream_.open();
+  result = binary_file_stream_.open(path + nvidia::gxf::FileStream::kBinaryFileExtension,
+                                    write_block_size_.get(),
+                                    direct_io_.get());
   if (!result) {
     auto code = nvidia::gxf::ToResultCode(result);
     throw std::runtime_error(fmt::format("Failed to open binary_file_stream_ with code: {}", code));
   }
   binary_file_offset_ = 0;
+  bytes_since_sync_ = 0;
+  last_sync_time_ = std::chrono::steady_clock::now();
+  statistics_ = Statistics{};
 }
 
 VideoStreamRecorderOp::~VideoStreamRecorderOp() {
+  // Write the entities which are still queued before closing the files
+  stop_writer();
+
   // for the GXF codelet, this code is in a deinitialize() method
 
   // Close binary file stream
@@ -115,21 +185,67 @@ VideoStreamRecorderOp::~VideoStreamRecorderOp() {
   }
 }
 
-void VideoStreamRecorderOp::compute(InputContext& op_input, OutputContext& op_output,
-                                    ExecutionContext& context) {
-  // avoid warning about unused variable
-  (void)op_output;
-
-  auto entity = op_input.receive<gxf::Entity>("input");
-
+void VideoStreamRecorderOp::start() {
   // dynamic cast from holoscan::Resource to holoscan::VideoStreamSerializer
   auto vs_serializer =
       std::dynamic_pointer_cast<holoscan::VideoStreamSerializer>(entity_serializer_.get());
   // get the Handle to the underlying GXF EntitySerializer
   auto entity_serializer = nvidia::gxf::Handle<nvidia::gxf::EntitySerializer>::Create(
-      context.context(), vs_serializer.get()->gxf_cid());
+      fragment()->executor().context(), vs_serializer.get()->gxf_cid());
+  if (!entity_serializer) {
+    throw std::runtime_error("Could not get the entity serializer of the video stream recorder");
+  }
+  entity_serializer_ptr_ = entity_serializer.value().get();
+
+  if (queue_size_.get() > 0) {
+    writer_stopping_ = false;
+    writer_error_.clear();
+    writer_thread_ = std::thread([this]() { write_entities(); });
+  }
+}
+
+void VideoStreamRecorderOp::stop() {
+  stop_writer();
+
+  if (binary_file_stream_.is_open() && !binary_file_stream_.flush()) {
+    HOLOSCAN_LOG_ERROR("Failed to flush binary_file_stream_");
+  }
+  if (index_file_stream_.is_open() && !index_file_stream_.flush()) {
+    HOLOSCAN_LOG_ERROR("Failed to flush index_file_stream_");
+  }
+
+  auto stats = statistics();
+  HOLOSCAN_LOG_INFO(
+      "Recorder '{}': {} frames received, {} written, {} dropped, {} bytes, {} syncs, "
+      "{} backpressure waits ({} ms), max queue depth {}",
+      name(),
+      stats.frames_received,
+      stats.frames_written,
+      stats.frames_dropped,
+      stats.bytes_written,
+      stats.syncs,
+      stats.backpressure_waits,
+      stats.backpressure_time_ns / 1000000,
+      stats.max_queue_depth);
+}
+
+VideoStreamRecorderOp::Statistics VideoStreamRecorderOp::statistics() const {
+  std::lock_guard<std::mutex> lock(writer_mutex_);
+  return statistics_;
+}
+
+void VideoStreamRecorderOp::stop_writer() {
+  {
+    std::lock_guard<std::mutex> lock(writer_mutex_);
+    writer_stopping_ = true;
+  }
+  writer_ready_cv_.notify_all();
+  if (writer_thread_.joinable()) { writer_thread_.join(); }
+}
+
+void VideoStreamRecorderOp::write_entity(const nvidia::gxf::Entity& entity, uint64_t log_time) {
   nvidia::gxf::Expected<size_t> size =
-      entity_serializer.value()->serializeEntity(entity, &binary_file_stream_);
+      entity_serializer_ptr_->serializeEntity(entity, &binary_file_stream_);
   if (!size) {
     auto code = nvidia::gxf::ToResultCode(size);
     throw std::runtime_error(fmt::format("Failed to serialize entity with code {}", code));
@@ -137,35 +253,131 @@ void VideoStreamRecorderOp::compute(InputContext& op_input, OutputContext& op_ou
 
   // Create entity index
   nvidia::gxf::EntityIndex index;
-  index.log_time = std::chrono::system_clock::now().time_since_epoch().count();
+  index.log_time = log_time;
   index.data_size = size.value();
   index.data_offset = binary_file_offset_;
 
   // Write entity index to index file
   nvidia::gxf::Expected<size_t> result = index_file_stream_.writeTrivialType(&index);
   if (!result) {
-    auto code = nvidia::gxf::ToResultCode(size);
+    auto code = nvidia::gxf::ToResultCode(result);
     throw std::runtime_error(fmt::format("Failed writing to index file stream with code {}", code));
   }
   binary_file_offset_ += size.value();
+  bytes_since_sync_ += size.value();
 
   if (flush_on_tick_) {
     // Flush binary file output stream
     nvidia::gxf::Expected<void> result = binary_file_stream_.flush();
     if (!result) {
-      auto code = nvidia::gxf::ToResultCode(size);
+      auto code = nvidia::gxf::ToResultCode(result);
       throw std::runtime_error(
-          fmt::format("Failed writing to index file stream with code {}", code));
+          fmt::format("Failed writing to binary file stream with code {}", code));
     }
 
     // Flush index file output stream
     result = index_file_stream_.flush();
     if (!result) {
-      auto code = nvidia::gxf::ToResultCode(size);
+      auto code = nvidia::gxf::ToResultCode(result);
       throw std::runtime_error(
           fmt::format("Failed writing to index file stream with code {}", code));
     }
   }
+
+  // Sync the files to the device once the time or byte budget is spent
+  const auto now = std::chrono::steady_clock::now();
+  const bool sync_bytes = fsync_bytes_ > 0 && bytes_since_sync_ >= fsync_bytes_;
+  const bool sync_time =
+      fsync_interval_ms_ > 0 &&
+      now - last_sync_time_ >= std::chrono::milliseconds(fsync_interval_ms_.get());
+  bool synced = false;
+  if (sync_bytes || sync_time) {
+    if (!binary_file_stream_.sync() || !index_file_stream_.sync()) {
+      throw std::runtime_error("Failed syncing recorded files");
+    }
+    bytes_since_sync_ = 0;
+    last_sync_time_ = now;
+    synced = true;
+  }
+
+  std::lock_guard<std::mutex> lock(writer_mutex_);
+  ++statistics_.frames_written;
+  statistics_.bytes_written += size.value();
+  if (synced) { ++statistics_.syncs; }
+}
+
+void VideoStreamRecorderOp::write_entities() {
+  while (true) {
+    RecordRequest request;
+    {
+      std::unique_lock<std::mutex> lock(writer_mutex_);
+      writer_ready_cv_.wait(lock, [this]() { return writer_stopping_ || !write_queue_.empty(); });
+      // Stop only once every queued entity is written
+      if (write_queue_.empty()) { return; }
+      request = std::move(write_queue_.front());
+      write_queue_.pop_front();
+    }
+    writer_space_cv_.notify_one();
+
+    try {
+      write_entity(request.entity, request.log_time);
+    } catch (const std::exception& e) {
+      HOLOSCAN_LOG_ERROR("Recorder '{}' writer thread failed: {}", name(), e.what());
+      {
+        std::lock_guard<std::mutex> lock(writer_mutex_);
+        writer_error_ = e.what();
+        write_queue_.clear();
+      }
+      writer_space_cv_.notify_all();
+      return;
+    }
+  }
+}
+
+void VideoStreamRecorderOp::compute(InputContext& op_input, OutputContext& op_output,
+                                    ExecutionContext& context) {
+  // avoid warning about unused variable
+  (void)op_output;
+  (void)context;
+
+  auto entity = op_input.receive<gxf::Entity>("input");
+  const uint64_t log_time = std::chrono::system_clock::now().time_since_epoch().count();
+
+  if (!writer_thread_.joinable()) {
+    {
+      std::lock_guard<std::mutex> lock(writer_mutex_);
+      ++statistics_.frames_received;
+    }
+    write_entity(entity, log_time);
+    return;
+  }
+
+  std::unique_lock<std::mutex> lock(writer_mutex_);
+  ++statistics_.frames_received;
+  if (write_queue_.size() >= queue_size_.get() && writer_error_.empty()) {
+    if (drop_on_overflow_) {
+      ++statistics_.frames_dropped;
+      return;
+    }
+    // Apply backpressure rather than losing frames
+    const auto wait_start = std::chrono::steady_clock::now();
+    writer_space_cv_.wait(lock, [this]() {
+      return write_queue_.size() < queue_size_.get() || !writer_error_.empty();
+    });
+    ++statistics_.backpressure_waits;
+    statistics_.backpressure_time_ns += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                            std::chrono::steady_clock::now() - wait_start)
+                                            .count();
+  }
+  if (!writer_error_.empty()) {
+    throw std::runtime_error(fmt::format("Failed to record entity: {}", writer_error_));
+  }
+
+  write_queue_.push_back(RecordRequest{entity, log_time});
+  statistics_.max_queue_depth =
+      std::max<uint64_t>(statistics_.max_queue_depth, write_queue_.size());
+  lock.unlock();
+  writer_ready_cv_.notify_one();
 }
 
 }  // namespace holoscan::ops
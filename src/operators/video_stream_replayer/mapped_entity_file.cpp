@@ -0,0 +1,268 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/operators/video_stream_replayer/mapped_entity_file.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#include "holoscan/logger/logger.hpp"
+
+namespace holoscan::ops {
+
+MappedFile::~MappedFile() {
+  close();
+}
+
+void MappedFile::open(const std::string& filename) {
+  close();
+
+  int fd = ::open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    throw std::runtime_error(
+        fmt::format("Could not open file '{}': {}", filename, std::strerror(errno)));
+  }
+
+  struct stat file_stat {};
+  if (fstat(fd, &file_stat) != 0) {
+    int error = errno;
+    ::close(fd);
+    throw std::runtime_error(
+        fmt::format("Could not get the size of file '{}': {}", filename, std::strerror(error)));
+  }
+
+  size_ = static_cast<size_t>(file_stat.st_size);
+  if (size_ > 0) {
+    void* data = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data == MAP_FAILED) {
+      int error = errno;
+      ::close(fd);
+      size_ = 0;
+      throw std::runtime_error(
+          fmt::format("Could not map file '{}': {}", filename, std::strerror(error)));
+    }
+    data_ = static_cast<uint8_t*>(data);
+  }
+  // The mapping stays valid after the descriptor is closed
+  ::close(fd);
+}
+
+void MappedFile::close() {
+  if (data_ != nullptr) { munmap(data_, size_); }
+  data_ = nullptr;
+  size_ = 0;
+}
+
+void MappedFile::will_need(size_t offset, size_t size) const {
+  if (data_ == nullptr || offset >= size_) { return; }
+  // madvise() needs a page-aligned address
+  static const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  const size_t begin = offset - offset % page_size;
+  const size_t end = std::min(offset + size, size_);
+  madvise(data_ + begin, end - begin, MADV_WILLNEED);
+}
+
+void MappedFileEndpoint::set_range(const MappedFile* file, size_t offset, size_t size) {
+  file_ = file;
+  position_ = std::min(offset, file->size());
+  end_ = std::min(offset + size, file->size());
+}
+
+gxf_result_t MappedFileEndpoint::write_abi(const void* data, size_t size, size_t* bytes_written) {
+  (void)data;
+  (void)size;
+  (void)bytes_written;
+  return GXF_NOT_IMPLEMENTED;
+}
+
+gxf_result_t MappedFileEndpoint::read_abi(void* data, size_t size, size_t* bytes_read) {
+  if (data == nullptr || bytes_read == nullptr) { return GXF_ARGUMENT_NULL; }
+  if (file_ == nullptr) { return GXF_FAILURE; }
+
+  const size_t count = std::min(size, remaining());
+  std::memcpy(data, file_->data() + position_, count);
+  position_ += count;
+  *bytes_read = count;
+  return count == size ? GXF_SUCCESS : GXF_FAILURE;
+}
+
+void MappedEntityRecording::open(const std::string& path) {
+  close();
+
+  const std::string index_filename = path + nvidia::gxf::FileStream::kIndexFileExtension;
+  const std::string entity_filename = path + nvidia::gxf::FileStream::kBinaryFileExtension;
+
+  // Load the whole index table up front
+  MappedFile index_file;
+  index_file.open(index_filename);
+  const size_t count = index_file.size() / sizeof(nvidia::gxf::EntityIndex);
+  if (index_file.size() % sizeof(nvidia::gxf::EntityIndex) != 0) {
+    HOLOSCAN_LOG_WARN("Index file '{}' ends with a truncated entry, which is ignored",
+                      index_filename);
+  }
+  indices_.resize(count);
+  if (count > 0) {
+    std::memcpy(indices_.data(), index_file.data(), count * sizeof(nvidia::gxf::EntityIndex));
+  }
+  index_file.close();
+
+  last_frame_ = -1;
+  delta_frames_.assign(count, false);
+
+  sorted_ = std::is_sorted(indices_.begin(), indices_.end(), [](const auto& a, const auto& b) {
+    return a.log_time < b.log_time;
+  });
+
+  entity_file_.open(entity_filename);
+}
+
+void MappedEntityRecording::close() {
+  entity_file_.close();
+  indices_.clear();
+  sorted_ = true;
+  last_frame_ = -1;
+  delta_frames_.clear();
+}
+
+size_t MappedEntityRecording::frame_at_time(uint64_t log_time) const {
+  if (sorted_) {
+    auto it = std::lower_bound(
+        indices_.begin(), indices_.end(), log_time, [](const auto& index, uint64_t time) {
+          return index.log_time < time;
+        });
+    return static_cast<size_t>(it - indices_.begin());
+  }
+  for (size_t frame = 0; frame < indices_.size(); ++frame) {
+    if (indices_[frame].log_time >= log_time) { return frame; }
+  }
+  return indices_.size();
+}
+
+nvidia::gxf::Expected<nvidia::gxf::Entity> MappedEntityRecording::read(
+    gxf_context_t context, nvidia::gxf::EntitySerializer* serializer, size_t frame,
+    size_t next_frame) {
+  if (frame >= indices_.size()) { return nvidia::gxf::Unexpected{GXF_ARGUMENT_OUT_OF_RANGE}; }
+
+  if (next_frame < indices_.size()) {
+    const auto& next = indices_[next_frame];
+    entity_file_.will_need(next.data_offset, next.data_size);
+  }
+
+  auto entity = deserialize(context, serializer, frame);
+  if (!entity && static_cast<int64_t>(frame) != last_frame_ + 1 && frame > 0) {
+    // The frame may be a delta to a frame that was not read just before it
+    entity = read_from_keyframe(context, serializer, frame);
+  }
+  return entity;
+}
+
+nvidia::gxf::Expected<nvidia::gxf::Entity> MappedEntityRecording::deserialize(
+    gxf_context_t context, nvidia::gxf::EntitySerializer* serializer, size_t frame) {
+  const auto& index = indices_[frame];
+  endpoint_.set_range(&entity_file_, index.data_offset, index.data_size);
+  auto entity = serializer->deserializeEntity(context, &endpoint_);
+  last_frame_ = entity ? static_cast<int64_t>(frame) : -1;
+  return entity;
+}
+
+nvidia::gxf::Expected<nvidia::gxf::Entity> MappedEntityRecording::read_from_keyframe(
+    gxf_context_t context, nvidia::gxf::EntitySerializer* serializer, size_t frame) {
+  delta_frames_[frame] = true;
+
+  // Walk back to the closest frame that decodes without the one before it
+  size_t keyframe = frame;
+  while (keyframe > 0) {
+    --keyframe;
+    if (delta_frames_[keyframe]) { continue; }
+    if (deserialize(context, serializer, keyframe)) { break; }
+    delta_frames_[keyframe] = true;
+  }
+  if (last_frame_ != static_cast<int64_t>(keyframe)) {
+    HOLOSCAN_LOG_ERROR("No keyframe found before frame {} of the recording", frame);
+    return nvidia::gxf::Unexpected{GXF_FAILURE};
+  }
+
+  // Decode forward, the references are kept by the serializer
+  for (size_t skipped = keyframe + 1; skipped < frame; ++skipped) {
+    auto entity = deserialize(context, serializer, skipped);
+    if (!entity) { return nvidia::gxf::ForwardError(entity); }
+  }
+  return deserialize(context, serializer, frame);
+}
+
+void PlaybackCursor::reset(int64_t range_begin, int64_t range_end, Mode mode, bool repeat) {
+  range_begin_ = range_begin;
+  range_end_ = range_end;
+  mode_ = mode;
+  repeat_ = repeat;
+  direction_ = mode == Mode::kReverse ? -1 : 1;
+  cursor_ = direction_ > 0 ? range_begin_ : range_end_ - 1;
+  jumped_ = false;
+}
+
+bool PlaybackCursor::next(int64_t* frame, bool* rewound) {
+  *rewound = false;
+  if (cursor_ < range_begin_ || cursor_ >= range_end_) {
+    if (range_begin_ >= range_end_) { return false; }
+    if (mode_ == Mode::kPingPong && direction_ > 0 && range_end_ - range_begin_ > 1) {
+      // Turn around at the end of the range
+      direction_ = -1;
+      cursor_ = range_end_ - 2;
+    } else if (!repeat_) {
+      return false;
+    } else if (mode_ == Mode::kPingPong) {
+      // Turn around at the beginning of the range
+      direction_ = 1;
+      cursor_ = std::min(range_begin_ + 1, range_end_ - 1);
+      *rewound = range_end_ - range_begin_ == 1;
+    } else {
+      cursor_ = direction_ > 0 ? range_begin_ : range_end_ - 1;
+      *rewound = true;
+    }
+  }
+  if (jumped_) {
+    *rewound = true;
+    jumped_ = false;
+  }
+
+  *frame = cursor_;
+  cursor_ += direction_;
+  return true;
+}
+
+int64_t PlaybackCursor::upcoming() const {
+  return cursor_ >= range_begin_ && cursor_ < range_end_ ? cursor_ : -1;
+}
+
+void PlaybackCursor::seek(uint64_t frame) {
+  const int64_t last_frame = std::max(range_begin_, range_end_ - 1);
+  const auto clamped_frame = static_cast<int64_t>(
+      std::min(frame, static_cast<uint64_t>(std::numeric_limits<int64_t>::max())));
+  cursor_ = std::clamp(clamped_frame, range_begin_, last_frame);
+  jumped_ = true;
+}
+
+}  // namespace holoscan::ops
@@ -17,15 +17,23 @@
 
 #include "holoscan/operators/video_stream_replayer/video_stream_replayer.hpp"
 
+#include <yaml-cpp/yaml.h>
+
+#include <algorithm>
+#include <any>
 #include <chrono>
 #include <cinttypes>
+#include <limits>
 #include <string>
 #include <thread>
+#include <typeinfo>
+#include <utility>
 
 #include "gxf/core/expected.hpp"
 #include "gxf/serialization/entity_serializer.hpp"
 
 #include "holoscan/core/conditions/gxf/boolean.hpp"
+#include "holoscan/core/conditions/gxf/target_time.hpp"
 #include "holoscan/core/execution_context.hpp"
 #include "holoscan/core/executor.hpp"
 #include "holoscan/core/fragment.hpp"
@@ -86,13 +94,54 @@ void VideoStreamReplayerOp::setup(OperatorSpec& spec) {
              "the count "
              "is less than the number of frames in the video, it would be finished early.",
              0UL);
+  spec.param(prefetch_size_,
+             "prefetch_size",
+             "Prefetch size",
+             "Number of entities to read ahead on a background thread. If zero value is specified, "
+             "entities are read in compute() (default: 0).",
+             0UL);
+  spec.param(memory_mapped_,
+             "memory_mapped",
+             "Memory-mapped playback",
+             "Load the whole index up front and deserialize entities from a memory mapping of the "
+             "recording, which allows seeking (default: false).",
+             false);
+  spec.param(start_frame_,
+             "start_frame",
+             "Start frame",
+             "First frame of the playback range (default: 0).",
+             0UL);
+  spec.param(end_frame_,
+             "end_frame",
+             "End frame",
+             "Frame after the last one of the playback range. If zero value is specified, the "
+             "range ends with the recording (default: 0).",
+             0UL);
+  spec.param(playback_mode_,
+             "playback_mode",
+             "Playback mode",
+             "Order in which the playback range is played: 'forward', 'reverse' or 'ping_pong' "
+             "(default: 'forward').",
+             std::string("forward"));
+  spec.param(verify_checksum_,
+             "verify_checksum",
+             "Verify checksum",
+             "Verify the checksum of each entity while deserializing it. Corrupted entities are "
+             "then handled according to 'ignore_corrupted_entities' (default: false).",
+             false);
 }
 
 void VideoStreamReplayerOp::initialize() {
   // Set up prerequisite parameters before calling GXFOperator::initialize()
   auto frag = fragment();
+  // Forward the verification argument to the serializer, which is created before our own
+  // parameters are set
+  ArgList serializer_args;
+  for (const auto& arg : args()) {
+    if (arg.name() == "verify_checksum") { serializer_args.add(arg); }
+  }
   auto entity_serializer =
-      frag->make_resource<holoscan::VideoStreamSerializer>("entity_serializer");
+      frag->make_resource<holoscan::VideoStreamSerializer>("entity_serializer", serializer_args);
   add_arg(Arg("entity_serializer") = entity_serializer);
 
   // Find if there is an argument for 'boolean_scheduling_term'
@@ -107,6 +156,24 @@ void VideoStreamReplayerOp::initialize() {
     add_arg(boolean_scheduling_term_.get());
   }
 
+  // Pace realtime playback through the scheduler rather than by sleeping in compute(). The
+  // condition must be added before the parameters are set, so 'realtime' is read from the
+  // arguments. Non-realtime playback keeps being scheduled as fast as the downstream allows.
+  bool realtime = true;
+  for (auto& arg : args()) {
+    if (arg.name() != "realtime") { continue; }
+    auto& value = arg.value();
+    if (value.type() == typeid(bool)) {
+      realtime = std::any_cast<bool>(value);
+    } else if (value.type() == typeid(YAML::Node)) {
+      realtime = std::any_cast<YAML::Node>(value).as<bool>();
+    }
+  }
+  if (realtime) {
+    target_time_condition_ = frag->make_condition<holoscan::TargetTimeCondition>("target_time");
+    add_arg(target_time_condition_);
+  }
+
   // Operator::initialize must occur after all arguments have been added
   Operator::initialize();
 
@@ -121,6 +188,49 @@ void VideoStreamReplayerOp::initialize() {
     path += name();
   }
 
+  // Ranges, reverse and ping-pong playback need random access to the recording
+  use_memory_mapping_ = memory_mapped_.get() || start_frame_.get() > 0 || end_frame_.get() > 0 ||
+                        playback_mode_.get() != "forward";
+
+  playback_index_ = 0;
+  playback_count_ = 0;
+  last_log_time_ = 0;
+  playback_time_offset_ = 0;
+  playback_start_timestamp_ = 0;
+
+  if (use_memory_mapping_) {
+    PlaybackCursor::Mode playback_mode;
+    if (playback_mode_.get() == "forward") {
+      playback_mode = PlaybackCursor::Mode::kForward;
+    } else if (playback_mode_.get() == "reverse") {
+      playback_mode = PlaybackCursor::Mode::kReverse;
+    } else if (playback_mode_.get() == "ping_pong") {
+      playback_mode = PlaybackCursor::Mode::kPingPong;
+    } else {
+      throw std::runtime_error(fmt::format("Unsupported playback_mode '{}'", playback_mode_.get()));
+    }
+
+    recording_.open(path);
+
+    const auto frame_count = static_cast<int64_t>(recording_.size());
+    const int64_t range_begin = std::min(static_cast<int64_t>(start_frame_.get()), frame_count);
+    const int64_t range_end = end_frame_.get() > 0
+                                  ? std::min(static_cast<int64_t>(end_frame_.get()), frame_count)
+                                  : frame_count;
+    if (range_begin >= range_end) {
+      HOLOSCAN_LOG_WARN("Playback range [{}, {}) of '{}' is empty ({} frames)",
+                        start_frame_.get(),
+                        end_frame_.get(),
+                        path,
+                        frame_count);
+    }
+    cursor_.reset(range_begin, range_end, playback_mode, repeat_.get());
+    seek_frame_ = -1;
+
+    boolean_scheduling_term_.get()->enable_tick();
+    return;
+  }
+
   // Filenames for index and data
   const std::string index_filename = path + nvidia::gxf::FileStream::kIndexFileExtension;
   const std::string entity_filename = path + nvidia::gxf::FileStream::kBinaryFileExtension;
@@ -144,17 +254,17 @@ void VideoStreamReplayerOp::initialize() {
   }
 
   boolean_scheduling_term_.get()->enable_tick();
-
-  playback_index_ = 0;
-  playback_count_ = 0;
-  index_start_timestamp_ = 0;
-  index_last_timestamp_ = 0;
-  index_timestamp_duration_ = 0;
-  index_frame_count_ = 1;
-  playback_start_timestamp_ = 0;
 }
 
 VideoStreamReplayerOp::~VideoStreamReplayerOp() {
+  // Make sure the prefetch thread no longer uses the file streams
+  stop_prefetching();
+
+  if (use_memory_mapping_) {
+    recording_.close();
+    return;
+  }
+
   // for the GXF codelet, this code is in a deinitialize() method
 
   // Close binary file stream
@@ -172,111 +282,282 @@ VideoStreamReplayerOp::~VideoStreamReplayerOp() {
   }
 }
 
-void VideoStreamReplayerOp::compute(InputContext& op_input, OutputContext& op_output,
-                                    ExecutionContext& context) {
-  // avoid warning about unused variable
-  (void)op_input;
+void VideoStreamReplayerOp::start() {
+  // Get the underlying GXF EntitySerializer once instead of on every tick
+  gxf_context_t context = fragment()->executor().context();
+  auto vs_serializer =
+      std::dynamic_pointer_cast<holoscan::VideoStreamSerializer>(entity_serializer_.get());
+  auto entity_serializer = nvidia::gxf::Handle<nvidia::gxf::EntitySerializer>::Create(
+      context, vs_serializer.get()->gxf_cid());
+  if (!entity_serializer) {
+    throw std::runtime_error("Could not get the entity serializer of the video stream replayer");
+  }
+  entity_serializer_ptr_ = entity_serializer.value().get();
 
-  for (size_t i = 0; i < batch_size_; i++) {
-    // Read entity index from index file
-    // Break if index not found and clear stream errors
-    nvidia::gxf::EntityIndex index;
-    nvidia::gxf::Expected<size_t> size = index_file_stream_.readTrivialType(&index);
-    if (!size) {
-      if (repeat_) {
-        // Rewind index stream
-        index_file_stream_.clear();
-        if (!index_file_stream_.setReadOffset(0)) {
-          HOLOSCAN_LOG_ERROR("Could not rewind index file");
-        }
-        size = index_file_stream_.readTrivialType(&index);
+  if (prefetch_size_.get() > 0) { start_prefetching(context); }
+}
 
-        // Rewind entity stream
-        entity_file_stream_.clear();
-        if (!entity_file_stream_.setReadOffset(0)) {
-          HOLOSCAN_LOG_ERROR("Could not rewind entity file");
-        }
+void VideoStreamReplayerOp::stop() {
+  stop_prefetching();
+  has_pending_entity_ = false;
+  pending_entity_ = nvidia::gxf::Entity();
+  if (target_time_condition_) { target_time_condition_->clear_target_time(); }
+}
+
+void VideoStreamReplayerOp::seek(uint64_t frame) {
+  if (!use_memory_mapping_) {
+    HOLOSCAN_LOG_ERROR("Seeking requires the 'memory_mapped' parameter of '{}' to be set", name());
+    return;
+  }
+  seek_frame_ = static_cast<int64_t>(
+      std::min(frame, static_cast<uint64_t>(std::numeric_limits<int64_t>::max())));
+}
+
+uint64_t VideoStreamReplayerOp::frame_at_time(uint64_t log_time) const {
+  if (!use_memory_mapping_) {
+    HOLOSCAN_LOG_ERROR("Looking up frames requires the 'memory_mapped' parameter of '{}' to be set",
+                       name());
+    return 0;
+  }
+  return recording_.frame_at_time(log_time);
+}
+
+uint64_t VideoStreamReplayerOp::frame_count() const {
+  return use_memory_mapping_ ? recording_.size() : 0;
+}
+
+void VideoStreamReplayerOp::apply_seek(gxf_context_t context, uint64_t frame) {
+  // Drop whatever was read ahead from the previous position
+  const bool prefetching = prefetch_thread_.joinable();
+  stop_prefetching();
+  has_pending_entity_ = false;
+  pending_entity_ = nvidia::gxf::Entity();
+
+  cursor_.seek(frame);
+
+  if (prefetching) { start_prefetching(context); }
+}
+
+void VideoStreamReplayerOp::start_prefetching(gxf_context_t context) {
+  prefetch_stopping_ = false;
+  prefetch_queue_.clear();
+  prefetch_thread_ = std::thread([this, context]() { prefetch_entities(context); });
+}
 
-        // Initialize the frame index
-        playback_index_ = 0;
+void VideoStreamReplayerOp::stop_prefetching() {
+  {
+    std::lock_guard<std::mutex> lock(prefetch_mutex_);
+    prefetch_stopping_ = true;
+  }
+  prefetch_space_cv_.notify_all();
+  if (prefetch_thread_.joinable()) { prefetch_thread_.join(); }
+  prefetch_queue_.clear();
+}
+
+VideoStreamReplayerOp::ReplayEntity VideoStreamReplayerOp::read_entity(gxf_context_t context) {
+  if (use_memory_mapping_) { return read_mapped_entity(context); }
+
+  ReplayEntity item;
+  while (true) {
+    // Read entity index from index file
+    // Stop if index not found and clear stream errors
+    nvidia::gxf::Expected<size_t> size = index_file_stream_.readTrivialType(&item.index);
+    if (!size && repeat_) {
+      // Rewind index stream
+      index_file_stream_.clear();
+      if (!index_file_stream_.setReadOffset(0)) {
+        HOLOSCAN_LOG_ERROR("Could not rewind index file");
+      }
+      size = index_file_stream_.readTrivialType(&item.index);
+
+      // Rewind entity stream
+      entity_file_stream_.clear();
+      if (!entity_file_stream_.setReadOffset(0)) {
+        HOLOSCAN_LOG_ERROR("Could not rewind entity file");
       }
+      item.rewound = true;
     }
-    if ((!size && !repeat_) || (count_ > 0 && playback_count_ >= count_)) {
-      HOLOSCAN_LOG_INFO("Reach end of file or playback count reaches to the limit. Stop ticking.");
-      auto bool_cond = boolean_scheduling_term_.get();
-      bool_cond->disable_tick();
+    if (!size) {
       index_file_stream_.clear();
-      break;
+      item.end = true;
+      return item;
     }
 
-    // dynamic cast from holoscan::Resource to holoscan::VideoStreamSerializer
-    auto vs_serializer =
-        std::dynamic_pointer_cast<holoscan::VideoStreamSerializer>(entity_serializer_.get());
-    // get underlying GXF EntitySerializer
-    auto entity_serializer = nvidia::gxf::Handle<nvidia::gxf::EntitySerializer>::Create(
-        context.context(), vs_serializer.get()->gxf_cid());
     // Read entity from binary file
     nvidia::gxf::Expected<nvidia::gxf::Entity> entity =
-        entity_serializer.value()->deserializeEntity(context.context(), &entity_file_stream_);
+        entity_serializer_ptr_->deserializeEntity(context, &entity_file_stream_);
     if (!entity) {
       if (ignore_corrupted_entities_) {
+        // Resume reading at the next entity, wherever deserialization stopped
+        HOLOSCAN_LOG_WARN("Skipping corrupted entity at offset {} of '{}'",
+                          item.index.data_offset,
+                          name());
+        entity_file_stream_.clear();
+        if (!entity_file_stream_.setReadOffset(item.index.data_offset + item.index.data_size)) {
+          HOLOSCAN_LOG_ERROR("Could not skip corrupted entity");
+        }
         continue;
-      } else {
-        auto code = nvidia::gxf::ToResultCode(entity);
-        throw std::runtime_error(
-            fmt::format("failed reading entity from entity_file_stream with code {}", code));
       }
+      item.error = nvidia::gxf::ToResultCode(entity);
+      return item;
     }
+    item.entity = std::move(entity.value());
+    return item;
+  }
+}
 
-    int64_t time_to_delay = 0;
+VideoStreamReplayerOp::ReplayEntity VideoStreamReplayerOp::read_mapped_entity(
+    gxf_context_t context) {
+  ReplayEntity item;
+  while (true) {
+    int64_t frame = 0;
+    bool rewound = false;
+    if (!cursor_.next(&frame, &rewound)) {
+      item.end = true;
+      return item;
+    }
+    item.rewound |= rewound;
 
-    if (playback_count_ == 0) {
-      playback_start_timestamp_ = std::chrono::system_clock::now().time_since_epoch().count();
-      index_start_timestamp_ = index.log_time;
+    const int64_t next_frame = cursor_.upcoming();
+    item.index = recording_.index(frame);
+    nvidia::gxf::Expected<nvidia::gxf::Entity> entity =
+        recording_.read(context,
+                        entity_serializer_ptr_,
+                        static_cast<size_t>(frame),
+                        next_frame >= 0 ? static_cast<size_t>(next_frame) : recording_.size());
+    if (!entity) {
+      if (ignore_corrupted_entities_) { continue; }
+      item.error = nvidia::gxf::ToResultCode(entity);
+      return item;
     }
-    // Update last timestamp
-    if (index.log_time > index_last_timestamp_) {
-      index_last_timestamp_ = index.log_time;
-      index_frame_count_ = playback_count_ + 1;
-      index_timestamp_duration_ = index_last_timestamp_ - index_start_timestamp_;
+    item.entity = std::move(entity.value());
+    return item;
+  }
+}
+
+void VideoStreamReplayerOp::prefetch_entities(gxf_context_t context) {
+  while (true) {
+    ReplayEntity item = read_entity(context);
+    const bool last = item.end || item.error != GXF_SUCCESS;
+    {
+      std::unique_lock<std::mutex> lock(prefetch_mutex_);
+      prefetch_space_cv_.wait(lock, [this]() {
+        return prefetch_stopping_ || prefetch_queue_.size() < prefetch_size_.get();
+      });
+      if (prefetch_stopping_) { return; }
+      prefetch_queue_.push_back(std::move(item));
+    }
+    prefetch_ready_cv_.notify_one();
+    if (last) { return; }
+  }
+}
+
+VideoStreamReplayerOp::ReplayEntity VideoStreamReplayerOp::next_entity(gxf_context_t context) {
+  if (!prefetch_thread_.joinable()) { return read_entity(context); }
+
+  // Wait for the prefetch thread only if it is behind
+  std::unique_lock<std::mutex> lock(prefetch_mutex_);
+  prefetch_ready_cv_.wait(lock, [this]() { return !prefetch_queue_.empty(); });
+  ReplayEntity item = std::move(prefetch_queue_.front());
+  prefetch_queue_.pop_front();
+  lock.unlock();
+  prefetch_space_cv_.notify_one();
+  return item;
+}
+
+bool VideoStreamReplayerOp::fetch_pending_entity(gxf_context_t context) {
+  if (count_ > 0 && playback_count_ >= count_) { return false; }
+
+  ReplayEntity item = next_entity(context);
+  if (item.error != GXF_SUCCESS) {
+    throw std::runtime_error(
+        fmt::format("failed reading entity from entity_file_stream with code {}", item.error));
+  }
+  if (item.end) { return false; }
+  if (item.rewound) {
+    // Initialize the frame index
+    playback_index_ = 0;
+  }
+
+  // Accumulate the time between consecutive frames, in either direction. Frames following a
+  // rewind or a seek are played right after the previous one.
+  const uint64_t log_time = item.index.log_time;
+  if (playback_count_ == 0) {
+    playback_start_timestamp_ = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                    std::chrono::steady_clock::now().time_since_epoch())
+                                    .count();
+    playback_time_offset_ = 0;
+  } else if (!item.rewound) {
+    playback_time_offset_ +=
+        log_time > last_log_time_ ? log_time - last_log_time_ : last_log_time_ - log_time;
+  }
+  last_log_time_ = log_time;
+
+  // Calculate the time at which the entity is due, based on frame rate or timestamps.
+  if (frame_rate_ > 0.f) {
+    pending_due_time_ = playback_start_timestamp_ +
+                        static_cast<int64_t>(1000000000 / frame_rate_) * playback_count_;
+  } else {
+    pending_due_time_ = playback_start_timestamp_ + static_cast<int64_t>(playback_time_offset_);
+  }
+
+  pending_entity_ = std::move(item.entity);
+  has_pending_entity_ = true;
+  return true;
+}
+
+void VideoStreamReplayerOp::compute(InputContext& op_input, OutputContext& op_output,
+                                    ExecutionContext& context) {
+  // avoid warning about unused variable
+  (void)op_input;
+
+  const int64_t seek_frame = seek_frame_.exchange(-1);
+  if (seek_frame >= 0) { apply_seek(context.context(), static_cast<uint64_t>(seek_frame)); }
+
+  bool end_of_stream = false;
+  for (size_t i = 0; i < batch_size_; i++) {
+    if (!has_pending_entity_ && !fetch_pending_entity(context.context())) {
+      end_of_stream = true;
+      break;
     }
 
-    // Delay if realtime is specified
+    // If realtime is specified and the entity is not due yet, let the scheduler wait for it
+    // instead of sleeping here.
     if (realtime_) {
-      // Calculate the delay time based on frame rate or timestamps.
-      uint64_t current_timestamp = std::chrono::system_clock::now().time_since_epoch().count();
-      int64_t time_delta = static_cast<int64_t>(current_timestamp - playback_start_timestamp_);
-      if (frame_rate_ > 0.f) {
-        time_to_delay =
-            static_cast<int64_t>(1000000000 / frame_rate_) * playback_count_ - time_delta;
-      } else {
-        // Get timestamp from entity
-        uint64_t timestamp = index.log_time;
-        time_to_delay = static_cast<int64_t>((timestamp - index_start_timestamp_) +
-                                             index_timestamp_duration_ *
-                                                 (playback_count_ / index_frame_count_)) -
-                        time_delta;
-      }
-/*
-      if (time_to_delay < 0 && (playback_count_ % index_frame_count_ != 0)) {
-        HOLOSCAN_LOG_INFO(
-            fmt::format("Playing video stream is lagging behind (count: % {} , delay: {} ns)",
-                        playback_count_,
-                        time_to_delay));
+      const int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                              std::chrono::steady_clock::now().time_since_epoch())
+                              .count();
+      if (pending_due_time_ > now) {
+        target_time_condition_->target_time(pending_due_time_);
+        return;
       }
-*/
     }
 
-    if (time_to_delay > 0) { std::this_thread::sleep_for(std::chrono::nanoseconds(time_to_delay)); }
-
     // emit the entity
-    auto result = gxf::Entity(std::move(entity.value()));
+    auto result = gxf::Entity(std::move(pending_entity_));
+    has_pending_entity_ = false;
     op_output.emit(result);
 
     // Increment frame counter and index
     ++playback_count_;
     ++playback_index_;
   }
+
+  // Look ahead so that the scheduler knows when the next entity is due
+  if (!end_of_stream && realtime_ && !has_pending_entity_ &&
+      !fetch_pending_entity(context.context())) {
+    end_of_stream = true;
+  }
+
+  if (end_of_stream) {
+    HOLOSCAN_LOG_INFO("Reach end of file or playback count reaches to the limit. Stop ticking.");
+    auto bool_cond = boolean_scheduling_term_.get();
+    bool_cond->disable_tick();
+    if (target_time_condition_) { target_time_condition_->clear_target_time(); }
+    return;
+  }
+
+  if (realtime_) { target_time_condition_->target_time(pending_due_time_); }
 }
 
 }  // namespace holoscan::ops
@@ -15,9 +15,6 @@
  * limitations under the License.
  */
 
-#ifndef HOLOSCAN_UTILS_HOLOINFER_HPP
-#define HOLOSCAN_UTILS_HOLOINFER_HPP
-
 #include <map>
 #include <memory>
 #include <string>
@@ -36,11 +33,94 @@ namespace HoloInfer = holoscan::inference;
 
 namespace holoscan::utils {
 
+namespace {
+
+/// Host copy of device uint8 data before its normalization, kept across calls of a thread
+thread_local std::vector<uint8_t> normalization_staging;
+
+/**
+ * Gets the inference toolkit data type of a tensor. GXF has no float16 primitive type, float16
+ * tensors are custom tensors with 2 bytes per element.
+ */
+HoloInfer::holoinfer_datatype get_datatype(nvidia::gxf::PrimitiveType element_type,
+                                           uint64_t bytes_per_element) {
+  switch (element_type) {
+    case nvidia::gxf::PrimitiveType::kFloat32:
+      return HoloInfer::holoinfer_datatype::hFloat;
+    case nvidia::gxf::PrimitiveType::kUnsigned8:
+      return HoloInfer::holoinfer_datatype::hUInt8;
+    case nvidia::gxf::PrimitiveType::kInt8:
+      return HoloInfer::holoinfer_datatype::hInt8;
+    case nvidia::gxf::PrimitiveType::kInt32:
+      return HoloInfer::holoinfer_datatype::hInt32;
+    case nvidia::gxf::PrimitiveType::kInt64:
+      return HoloInfer::holoinfer_datatype::hInt64;
+    case nvidia::gxf::PrimitiveType::kCustom:
+      if (bytes_per_element == 2) { return HoloInfer::holoinfer_datatype::hFloat16; }
+      return HoloInfer::holoinfer_datatype::hUnsupported;
+    default:
+      return HoloInfer::holoinfer_datatype::hUnsupported;
+  }
+}
+
+/**
+ * Gets the GXF element type of an inference toolkit data type, float16 being a custom type.
+ */
+nvidia::gxf::PrimitiveType get_element_type(HoloInfer::holoinfer_datatype datatype) {
+  switch (datatype) {
+    case HoloInfer::holoinfer_datatype::hFloat:
+      return nvidia::gxf::PrimitiveType::kFloat32;
+    case HoloInfer::holoinfer_datatype::hUInt8:
+      return nvidia::gxf::PrimitiveType::kUnsigned8;
+    case HoloInfer::holoinfer_datatype::hInt8:
+      return nvidia::gxf::PrimitiveType::kInt8;
+    case HoloInfer::holoinfer_datatype::hInt32:
+      return nvidia::gxf::PrimitiveType::kInt32;
+    case HoloInfer::holoinfer_datatype::hInt64:
+      return nvidia::gxf::PrimitiveType::kInt64;
+    default:
+      return nvidia::gxf::PrimitiveType::kCustom;
+  }
+}
+
+gxf_result_t copy_data(void* destination, const void* source, size_t bytes, cudaMemcpyKind kind,
+                       const std::string& module, const std::string& message) {
+  if (kind == cudaMemcpyHostToHost) {
+    memcpy(destination, source, bytes);
+    return GXF_SUCCESS;
+  }
+  cudaError_t cuda_result = cudaMemcpy(destination, source, bytes, kind);
+  if (cuda_result != cudaSuccess) {
+    return HoloInfer::report_error(
+        module, message + " cudaMemcpy::" + std::string(cudaGetErrorString(cuda_result)));
+  }
+  return GXF_SUCCESS;
+}
+
+/**
+ * Whether the elements of a tensor are stored in row-major order without padding, dimensions of
+ * size 1 having any stride.
+ */
+bool is_contiguous(const nvidia::gxf::Tensor& tensor) {
+  uint64_t stride = tensor.bytes_per_element();
+  for (int32_t d = static_cast<int32_t>(tensor.rank()) - 1; d >= 0; --d) {
+    const uint64_t dimension = tensor.shape().dimension(d);
+    if (dimension > 1 && tensor.stride(d) != stride) { return false; }
+    stride *= dimension;
+  }
+  return true;
+}
+
+}  // namespace
+
 gxf_result_t multiai_get_data_per_model(InputContext& op_input,
                                         const std::vector<std::string>& in_tensors,
                                         HoloInfer::DataMap& data_per_input_tensor,
                                         std::map<std::string, std::vector<int>>& dims_per_tensor,
-                                        bool cuda_buffer_out, const std::string& module) {
+                                        ReceivedMessages& received_messages, bool cuda_buffer_out,
+                                        const std::string& module,
+                                        const std::vector<float>& input_mean,
+                                        const std::vector<float>& input_std) {
   try {
     HoloInfer::TimePoint s_time, e_time;
     HoloInfer::timer_init(s_time);
@@ -49,22 +129,32 @@ gxf_result_t multiai_get_data_per_model(InputContext& op_input,
 
     if (cuda_buffer_out) { to = nvidia::gxf::MemoryStorageType::kDevice; }
 
-    auto messages = op_input.receive<std::vector<holoscan::gxf::Entity>>("receivers");
+    // Replacing the messages releases the ones aliased by the previous extraction
+    auto& messages = received_messages.messages;
+    auto& message_index_per_tensor = received_messages.message_index_per_tensor;
+    messages = op_input.receive<std::vector<holoscan::gxf::Entity>>("receivers");
     for (unsigned int i = 0; i < in_tensors.size(); ++i) {
-      // nvidia::gxf::Handle<nvidia::gxf::Tensor> in_tensor;
+      const auto& tensor_name = in_tensors[i];
       std::shared_ptr<holoscan::Tensor> in_tensor;
-      for (unsigned int j = 0; j < messages.size(); ++j) {
-        const auto& in_message = messages[j];
-        const auto maybe_tensor = in_message.get<holoscan::Tensor>(in_tensors[i].c_str(), false);
+
+      // look in the message the tensor was found in before, then search all messages
+      const auto cached_index = message_index_per_tensor.find(tensor_name);
+      if (cached_index != message_index_per_tensor.end() &&
+          cached_index->second < messages.size()) {
+        const auto& message = messages[cached_index->second];
+        in_tensor = message.get<holoscan::Tensor>(tensor_name.c_str(), false);
+      }
+      for (unsigned int j = 0; !in_tensor && j < messages.size(); ++j) {
+        const auto maybe_tensor = messages[j].get<holoscan::Tensor>(tensor_name.c_str(), false);
         if (maybe_tensor) {
-          // break out if the expected tensor name was found in this message
+          // the search ends with the message the tensor was found in
           in_tensor = maybe_tensor;
-          break;
+          message_index_per_tensor[tensor_name] = j;
         }
       }
       if (!in_tensor)
         return HoloInfer::report_error(module,
-                                       "Data_per_tensor, Tensor " + in_tensors[i] + " not found");
+                                       "Data_per_tensor, Tensor " + tensor_name + " not found");
 
       // convert from Tensor to GXFTensor so code below can be re-used as-is.
       // (otherwise cannot easily get element_type, storage_type)
@@ -74,7 +164,8 @@ gxf_result_t multiai_get_data_per_model(InputContext& op_input,
       auto element_type = in_tensor_gxf.element_type();
       auto storage_type = in_tensor_gxf.storage_type();
 
-      if (element_type != nvidia::gxf::PrimitiveType::kFloat32) {
+      auto datatype = get_datatype(element_type, in_tensor_gxf.bytes_per_element());
+      if (datatype == HoloInfer::holoinfer_datatype::hUnsupported) {
         return HoloInfer::report_error(module, "Data extraction, element type not supported");
       }
       if (!(storage_type != nvidia::gxf::MemoryStorageType::kHost ||
@@ -88,62 +179,84 @@ gxf_result_t multiai_get_data_per_model(InputContext& op_input,
                                        "Input storage type in data extraction not supported");
       }
 
-      std::vector<int> dims;
-      for (unsigned int i = 0; i < in_tensor_gxf.shape().rank(); ++i)
-        dims.push_back(in_tensor_gxf.shape().dimension(i));
-
-      size_t buffer_size = std::accumulate(dims.begin(), dims.end(), 1, std::multiplies<size_t>());
-
-      if (data_per_input_tensor.find(in_tensors[i]) == data_per_input_tensor.end()) {
-        auto db = std::make_shared<HoloInfer::DataBuffer>();
-        db->host_buffer.resize(buffer_size);
-        db->device_buffer->resize(buffer_size);
+      // uint8 tensors are normalized to float32 when a mean and std are given
+      bool normalize = datatype == HoloInfer::holoinfer_datatype::hUInt8 && !input_mean.empty();
+      auto buffer_type = normalize ? HoloInfer::holoinfer_datatype::hFloat : datatype;
 
-        data_per_input_tensor.insert({in_tensors[i], std::move(db)});
+      // dimensions are updated in place, keeping their allocation
+      auto& dims = dims_per_tensor[tensor_name];
+      dims.resize(in_tensor_gxf.shape().rank());
+      for (unsigned int d = 0; d < dims.size(); ++d) {
+        dims[d] = in_tensor_gxf.shape().dimension(d);
       }
 
-      dims_per_tensor[in_tensors[i]] = std::move(dims);
-
-      if (to == nvidia::gxf::MemoryStorageType::kHost) {
-        std::vector<float> in_tensor_ptr(buffer_size, 0);
+      size_t buffer_size = std::accumulate(dims.begin(), dims.end(), 1, std::multiplies<size_t>());
+      size_t bytes = buffer_size * HoloInfer::get_element_size(datatype);
 
+      auto db_iter = data_per_input_tensor.find(tensor_name);
+      if (db_iter == data_per_input_tensor.end()) {
+        db_iter = data_per_input_tensor
+                      .insert({tensor_name, std::make_shared<HoloInfer::DataBuffer>(buffer_type)})
+                      .first;
+      }
+      auto& db = db_iter->second;
+      if (db->get_datatype() != buffer_type) { db->set_datatype(buffer_type); }
+      db->device_buffer->resize(buffer_size);
+
+      gxf_result_t result = GXF_SUCCESS;
+      if (to == nvidia::gxf::MemoryStorageType::kHost || normalize) {
+        // Host data is aliased or copied by the host buffer, device data is fetched into the host
+        // buffer, or into the staging buffer for the normalization on the host
+        void* host_data = in_tensor_data;
         if (storage_type == nvidia::gxf::MemoryStorageType::kDevice) {
-          cudaError_t cuda_result = cudaMemcpy(static_cast<void*>(in_tensor_ptr.data()),
-                                               static_cast<const void*>(in_tensor_data),
-                                               buffer_size * sizeof(float),
-                                               cudaMemcpyDeviceToHost);
-          if (cuda_result != cudaSuccess) {
-            return HoloInfer::report_error(module,
-                                           "Data extraction, error in DtoH cudaMemcpy::" +
-                                               std::string(cudaGetErrorString(cuda_result)));
+          void* destination = nullptr;
+          if (normalize) {
+            normalization_staging.resize(bytes);
+            destination = normalization_staging.data();
+            host_data = destination;
+          } else {
+            db->host_buffer.resize(buffer_size);
+            destination = db->host_buffer.data();
+            host_data = nullptr;
           }
-
-        } else if (storage_type == nvidia::gxf::MemoryStorageType::kHost) {
-          memcpy(in_tensor_ptr.data(),
-                 static_cast<float*>(in_tensor_data),
-                 buffer_size * sizeof(float));
+          result = copy_data(destination,
+                             in_tensor_data,
+                             bytes,
+                             cudaMemcpyDeviceToHost,
+                             module,
+                             "Data extraction, error in DtoH");
+          if (result != GXF_SUCCESS) { return result; }
         }
-        data_per_input_tensor.at(in_tensors[i])->host_buffer = std::move(in_tensor_ptr);
-
-      } else {
-        if (to == nvidia::gxf::MemoryStorageType::kDevice) {
-          void* device_buff = data_per_input_tensor.at(in_tensors[i])->device_buffer->data();
-          if (storage_type == nvidia::gxf::MemoryStorageType::kDevice) {
-            cudaError_t cuda_result = cudaMemcpy(static_cast<void*>(device_buff),
-                                                 static_cast<const void*>(in_tensor_data),
-                                                 buffer_size * sizeof(float),
-                                                 cudaMemcpyDeviceToDevice);
-
-            if (cuda_result != cudaSuccess) {
-              return HoloInfer::report_error(module,
-                                             "Data extraction, error in DtoD cudaMemcpy::" +
-                                                 std::string(cudaGetErrorString(cuda_result)));
-            }
-          } else {
-            return HoloInfer::report_error(module, "Data extraction parameters not supported.");
+        if (host_data != nullptr) {
+          const bool alias = storage_type == nvidia::gxf::MemoryStorageType::kHost &&
+                             to == nvidia::gxf::MemoryStorageType::kHost &&
+                             is_contiguous(in_tensor_gxf);
+          auto status = HoloInfer::update_host_buffer(
+              *db, host_data, datatype, buffer_size, alias, input_mean, input_std);
+          if (status.get_code() != HoloInfer::holoinfer_code::H_SUCCESS) {
+            return HoloInfer::report_error(module, "Data extraction, " + status.get_message());
           }
         }
+        if (to == nvidia::gxf::MemoryStorageType::kDevice) {
+          result = copy_data(db->device_buffer->data(),
+                             db->host_buffer.data(),
+                             db->host_buffer.get_bytes(),
+                             cudaMemcpyHostToDevice,
+                             module,
+                             "Data extraction, error in HtoD");
+        }
+      } else {
+        if (storage_type != nvidia::gxf::MemoryStorageType::kDevice) {
+          return HoloInfer::report_error(module, "Data extraction parameters not supported.");
+        }
+        result = copy_data(db->device_buffer->data(),
+                           in_tensor_data,
+                           bytes,
+                           cudaMemcpyDeviceToDevice,
+                           module,
+                           "Data extraction, error in DtoD");
       }
+      if (result != GXF_SUCCESS) { return result; }
     }
 
     HoloInfer::timer_init(e_time);
@@ -157,13 +270,9 @@ gxf_result_t multiai_transmit_data_per_model(
     gxf_context_t& cont, const HoloInfer::Mappings& model_to_tensor_map,
     HoloInfer::DataMap& input_data_map, OutputContext& op_output,
     const std::vector<std::string>& out_tensors, HoloInfer::DimType& tensor_out_dims_map,
-    bool cuda_buffer_in, bool cuda_buffer_out, const nvidia::gxf::PrimitiveType& element_type,
+    bool cuda_buffer_in, bool cuda_buffer_out,
     const nvidia::gxf::Handle<nvidia::gxf::Allocator>& allocator_, const std::string& module) {
   try {
-    if (element_type != nvidia::gxf::PrimitiveType::kFloat32) {
-      return HoloInfer::report_error(module, "Element type to be transmitted not supported");
-    }
-
     nvidia::gxf::MemoryStorageType from = nvidia::gxf::MemoryStorageType::kHost;
     nvidia::gxf::MemoryStorageType to = nvidia::gxf::MemoryStorageType::kHost;
 
@@ -216,91 +325,47 @@ gxf_result_t multiai_transmit_data_per_model(
 
       size_t buffer_size = std::accumulate(dims.begin(), dims.end(), 1, std::multiplies<size_t>());
 
+      // The tensor is transmitted with the data type of its buffer
+      auto& current_model_output = input_data_map.at(out_tensors[i]);
+      auto datatype = current_model_output->get_datatype();
+      uint32_t element_size = HoloInfer::get_element_size(datatype);
+      if (element_size == 0) {
+        return HoloInfer::report_error(module, "Element type to be transmitted not supported");
+      }
+
+      out_tensor.value()->reshapeCustom(output_shape,
+                                        get_element_type(datatype),
+                                        element_size,
+                                        nvidia::gxf::Unexpected{GXF_UNINITIALIZED_VALUE},
+                                        to,
+                                        allocator_);
+      if (!out_tensor.value()->pointer())
+        return HoloInfer::report_error(module, "Inference Toolkit, Out tensor buffer allocation");
+
+      void* out_tensor_data = out_tensor.value()->pointer();
+      size_t bytes = buffer_size * element_size;
+
+      gxf_result_t result = GXF_SUCCESS;
       if (from == nvidia::gxf::MemoryStorageType::kHost) {
-        if (to == nvidia::gxf::MemoryStorageType::kHost) {
-          out_tensor.value()->reshape<float>(
-              output_shape, nvidia::gxf::MemoryStorageType::kHost, allocator_);
-          if (!out_tensor.value()->pointer())
-            return HoloInfer::report_error(module,
-                                           "Inference Toolkit, Out tensor buffer allocation");
-
-          nvidia::gxf::Expected<float*> out_tensor_data = out_tensor.value()->data<float>();
-          if (!out_tensor_data)
-            return HoloInfer::report_error(module, "Inference Toolkit, Getting out tensor data");
-
-          auto current_model_output = input_data_map.at(out_tensors[i]);
-          memcpy(out_tensor_data.value(),
-                 current_model_output->host_buffer.data(),
-                 buffer_size * sizeof(float));
-        } else {  // to is on device
-          out_tensor.value()->reshape<float>(
-              output_shape, nvidia::gxf::MemoryStorageType::kDevice, allocator_);
-          if (!out_tensor.value()->pointer())
-            return HoloInfer::report_error(module,
-                                           "Inference Toolkit, Out tensor buffer allocation");
-
-          nvidia::gxf::Expected<float*> out_tensor_data = out_tensor.value()->data<float>();
-          if (!out_tensor_data)
-            return HoloInfer::report_error(module, "Inference Toolkit, Getting out tensor data");
-
-          auto current_model_dev_buff = input_data_map.at(out_tensors[i])->host_buffer.data();
-          cudaError_t cuda_result = cudaMemcpy(static_cast<void*>(out_tensor_data.value()),
-                                               static_cast<const void*>(current_model_dev_buff),
-                                               buffer_size * sizeof(float),
-                                               cudaMemcpyHostToDevice);
-          if (cuda_result != cudaSuccess) {
-            return HoloInfer::report_error("Inference Toolkit",
-                                           "Data extraction, error in DtoD cudaMemcpy::" +
-                                               std::string(cudaGetErrorString(cuda_result)));
-          }
-        }
+        result = copy_data(out_tensor_data,
+                           current_model_output->host_buffer.data(),
+                           bytes,
+                           to == nvidia::gxf::MemoryStorageType::kHost ? cudaMemcpyHostToHost
+                                                                       : cudaMemcpyHostToDevice,
+                           "Inference Toolkit",
+                           "Data transmission, error in HtoD");
       } else {
-        if (from == nvidia::gxf::MemoryStorageType::kDevice) {
-          if (to == nvidia::gxf::MemoryStorageType::kDevice) {
-            out_tensor.value()->reshape<float>(
-                output_shape, nvidia::gxf::MemoryStorageType::kDevice, allocator_);
-            if (!out_tensor.value()->pointer())
-              return HoloInfer::report_error(module,
-                                             "Inference Toolkit, Out tensor buffer allocation");
-
-            nvidia::gxf::Expected<float*> out_tensor_data = out_tensor.value()->data<float>();
-            if (!out_tensor_data)
-              return HoloInfer::report_error(module, "Inference Toolkit, Getting out tensor data");
-
-            void* current_model_dev_buff = input_data_map.at(out_tensors[i])->device_buffer->data();
-            cudaError_t cuda_result = cudaMemcpy(static_cast<void*>(out_tensor_data.value()),
-                                                 static_cast<const void*>(current_model_dev_buff),
-                                                 buffer_size * sizeof(float),
-                                                 cudaMemcpyDeviceToDevice);
-            if (cuda_result != cudaSuccess) {
-              return HoloInfer::report_error("Inference Toolkit",
-                                             "Data extraction, error in DtoD cudaMemcpy::" +
-                                                 std::string(cudaGetErrorString(cuda_result)));
-            }
-          } else {  // to is on host
-            out_tensor.value()->reshape<float>(
-                output_shape, nvidia::gxf::MemoryStorageType::kHost, allocator_);
-            if (!out_tensor.value()->pointer())
-              return HoloInfer::report_error(module,
-                                             "Inference Toolkit, Out tensor buffer allocation");
-
-            nvidia::gxf::Expected<float*> out_tensor_data = out_tensor.value()->data<float>();
-            if (!out_tensor_data)
-              return HoloInfer::report_error(module, "Inference Toolkit, Getting out tensor data");
-
-            void* current_model_dev_buff = input_data_map.at(out_tensors[i])->device_buffer->data();
-            cudaError_t cuda_result = cudaMemcpy(static_cast<void*>(out_tensor_data.value()),
-                                                 static_cast<const void*>(current_model_dev_buff),
-                                                 buffer_size * sizeof(float),
-                                                 cudaMemcpyDeviceToHost);
-            if (cuda_result != cudaSuccess) {
-              return HoloInfer::report_error("Inference Toolkit",
-                                             "Data extraction, error in DtoH cudaMemcpy::" +
-                                                 std::string(cudaGetErrorString(cuda_result)));
-            }
-          }
-        }
+        result = copy_data(out_tensor_data,
+                           current_model_output->device_buffer->data(),
+                           bytes,
+                           to == nvidia::gxf::MemoryStorageType::kHost ? cudaMemcpyDeviceToHost
+                                                                       : cudaMemcpyDeviceToDevice,
+                           "Inference Toolkit",
+                           to == nvidia::gxf::MemoryStorageType::kHost
+                               ? "Data transmission, error in DtoH"
+                               : "Data transmission, error in DtoD");
       }
+      if (result != GXF_SUCCESS) { return result; }
     }
 
     // single transmitter used
@@ -317,5 +382,3 @@ gxf_result_t multiai_transmit_data_per_model(
 }
 
 }  // namespace holoscan::utils
-
-#endif /* HOLOSCAN_UTILS_HOLOINFER_HPP */
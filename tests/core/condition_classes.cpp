@@ -18,6 +18,7 @@
 #include <gtest/gtest.h>
 #include <gxf/core/gxf.h>
 
+#include <chrono>
 #include <string>
 
 #include "common/assert.hpp"
@@ -29,9 +30,11 @@
 #include "holoscan/core/conditions/gxf/count.hpp"
 #include "holoscan/core/conditions/gxf/downstream_affordable.hpp"
 #include "holoscan/core/conditions/gxf/message_available.hpp"
+#include "holoscan/core/conditions/gxf/target_time.hpp"
 #include "holoscan/core/config.hpp"
 #include "holoscan/core/executor.hpp"
 #include "holoscan/core/graph.hpp"
+#include "holoscan/core/gxf/target_time_scheduling_term.hpp"
 #include "../utils.hpp"
 
 using namespace std::string_literals;
@@ -197,4 +200,53 @@ TEST(ConditionClasses, TestMessageAvailableConditionSizeMethods) {
   EXPECT_EQ(condition->front_stage_max_size(), 5);
 }
 
+TEST(ConditionClasses, TestTargetTimeCondition) {
+  Fragment F;
+  const std::string name{"target-time-condition"};
+  auto condition = F.make_condition<TargetTimeCondition>(name);
+  EXPECT_EQ(condition->name(), name);
+  EXPECT_EQ(typeid(condition), typeid(std::make_shared<TargetTimeCondition>()));
+  EXPECT_EQ(std::string(condition->gxf_typename()), "holoscan::gxf::TargetTimeSchedulingTerm"s);
+}
+
+TEST(ConditionClasses, TestTargetTimeConditionMethods) {
+  Fragment F;
+  auto condition = F.make_condition<TargetTimeCondition>("target-time-condition");
+  EXPECT_EQ(condition->target_time(), 0);
+
+  // the target is kept until the GXF component is created by initialize()
+  condition->target_time(123456789);
+  EXPECT_EQ(condition->target_time(), 123456789);
+  condition->clear_target_time();
+  EXPECT_EQ(condition->target_time(), 0);
+}
+
+TEST(ConditionClasses, TestTargetTimeSchedulingTerm) {
+  gxf::TargetTimeSchedulingTerm term;
+  nvidia::gxf::SchedulingConditionType type = nvidia::gxf::SchedulingConditionType::NEVER;
+  int64_t target_timestamp = 0;
+
+  // ready when no target is set
+  EXPECT_EQ(term.check_abi(1000, &type, &target_timestamp), GXF_SUCCESS);
+  EXPECT_EQ(type, nvidia::gxf::SchedulingConditionType::READY);
+
+  // waits for a target in the future, expressed in the scheduler's clock
+  const int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                          std::chrono::steady_clock::now().time_since_epoch())
+                          .count();
+  term.set_target_time(now + 1'000'000'000);
+  EXPECT_EQ(term.check_abi(1000, &type, &target_timestamp), GXF_SUCCESS);
+  EXPECT_EQ(type, nvidia::gxf::SchedulingConditionType::WAIT_TIME);
+  EXPECT_GT(target_timestamp, 1000);
+  EXPECT_LE(target_timestamp, 1000 + 1'000'000'000);
+
+  // ready once the target has passed
+  term.set_target_time(now - 1);
+  EXPECT_EQ(term.check_abi(1000, &type, &target_timestamp), GXF_SUCCESS);
+  EXPECT_EQ(type, nvidia::gxf::SchedulingConditionType::READY);
+
+  term.clear_target_time();
+  EXPECT_EQ(term.target_time(), 0);
+}
+
 }  // namespace holoscan
@@ -141,4 +141,59 @@ TEST_F(TestWithGXFContext, TESTIOSpecResource) {
   auto resource = F.make_resource<UnboundedAllocator>(name);
   spec.resource(resource);
 }
+
+TEST(IOSpec, TestIOSpecConnectorPtr) {
+  OperatorSpec op_spec = OperatorSpec();
+  IOSpec spec = IOSpec(&op_spec, std::string("a"), IOSpec::IOType::kInput,
+                       &typeid(holoscan::gxf::Entity));
+  EXPECT_EQ(spec.connector_ptr(), nullptr);
+
+  int dummy = 0;
+  spec.connector_ptr(&dummy);
+  EXPECT_EQ(spec.connector_ptr(), &dummy);
+
+  // Setting a new resource invalidates the resolved connector.
+  spec.resource(nullptr);
+  EXPECT_EQ(spec.connector_ptr(), nullptr);
+}
+
+TEST(IOSpec, TestIOSpecConnector) {
+  OperatorSpec op_spec = OperatorSpec();
+  IOSpec input = IOSpec(&op_spec, std::string("a"), IOSpec::IOType::kInput,
+                        &typeid(holoscan::gxf::Entity));
+  EXPECT_EQ(input.connector_type(), IOSpec::ConnectorType::kDefault);
+  EXPECT_EQ(input.resource(), nullptr);
+
+  input.connector(IOSpec::ConnectorType::kLockFree, Arg("capacity", 4UL), Arg("policy", 0UL));
+  EXPECT_EQ(input.connector_type(), IOSpec::ConnectorType::kLockFree);
+  auto receiver = std::dynamic_pointer_cast<LockFreeReceiver>(input.resource());
+  ASSERT_NE(receiver, nullptr);
+  EXPECT_EQ(receiver->args().size(), 2);
+
+  input.connector(IOSpec::ConnectorType::kDefault);
+  EXPECT_EQ(input.resource(), nullptr);
+
+  IOSpec output = IOSpec(&op_spec, std::string("b"), IOSpec::IOType::kOutput,
+                         &typeid(holoscan::gxf::Entity));
+  output.connector(IOSpec::ConnectorType::kLockFree);
+  EXPECT_NE(std::dynamic_pointer_cast<LockFreeTransmitter>(output.resource()), nullptr);
+  output.connector(IOSpec::ConnectorType::kDoubleBuffer, Arg("capacity", 2UL));
+  EXPECT_NE(std::dynamic_pointer_cast<DoubleBufferTransmitter>(output.resource()), nullptr);
+}
+
+TEST(IOSpec, TestIOSpecPortHandle) {
+  OperatorSpec op_spec = OperatorSpec();
+
+  InputPort<int> in;
+  EXPECT_FALSE(in);
+  EXPECT_EQ(in.spec(), nullptr);
+  in = op_spec.input<int>("in");
+  EXPECT_TRUE(in);
+  EXPECT_EQ(in.spec(), op_spec.inputs()["in"].get());
+
+  OutputPort<holoscan::gxf::Entity> out = op_spec.output<holoscan::gxf::Entity>("out");
+  EXPECT_TRUE(out);
+  EXPECT_EQ(out.spec()->name(), "out");
+  EXPECT_EQ(out.spec()->io_type(), IOSpec::IOType::kOutput);
+}
 }  // namespace holoscan
@@ -0,0 +1,197 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "holoscan/core/gxf/lock_free_queue.hpp"
+
+namespace holoscan::gxf {
+
+TEST(LockFreeQueue, TestSPSCQueuePushPop) {
+  SPSCQueue<int> queue(3);
+  EXPECT_EQ(queue.capacity(), 3u);
+  EXPECT_EQ(queue.size(), 0u);
+
+  int value = 0;
+  EXPECT_FALSE(queue.try_pop(value));
+  EXPECT_TRUE(queue.try_push(1));
+  EXPECT_TRUE(queue.try_push(2));
+  EXPECT_TRUE(queue.try_push(3));
+  EXPECT_FALSE(queue.try_push(4));
+  EXPECT_EQ(queue.size(), 3u);
+
+  EXPECT_TRUE(queue.peek(2, value));
+  EXPECT_EQ(value, 3);
+  EXPECT_FALSE(queue.peek(3, value));
+
+  // Wrap around the end of the ring
+  for (int i = 1; i <= 10; ++i) {
+    EXPECT_TRUE(queue.try_pop(value));
+    EXPECT_EQ(value, i);
+    EXPECT_TRUE(queue.try_push(i + 3));
+  }
+  EXPECT_EQ(queue.size(), 3u);
+}
+
+TEST(LockFreeQueue, TestSPSCQueueZeroCapacity) {
+  SPSCQueue<int> queue(0);
+  EXPECT_EQ(queue.capacity(), 1u);
+  EXPECT_TRUE(queue.try_push(1));
+  EXPECT_FALSE(queue.try_push(2));
+}
+
+TEST(LockFreeQueue, TestMPMCQueuePushPop) {
+  MPMCQueue<int> queue(3);
+  EXPECT_EQ(queue.capacity(), 3u);
+
+  int value = 0;
+  EXPECT_FALSE(queue.try_pop(value));
+  EXPECT_TRUE(queue.try_push(1));
+  EXPECT_TRUE(queue.try_push(2));
+  EXPECT_TRUE(queue.try_push(3));
+  EXPECT_FALSE(queue.try_push(4));
+  EXPECT_EQ(queue.size(), 3u);
+
+  EXPECT_TRUE(queue.peek(0, value));
+  EXPECT_EQ(value, 1);
+  EXPECT_FALSE(queue.peek(3, value));
+
+  for (int i = 1; i <= 10; ++i) {
+    EXPECT_TRUE(queue.try_pop(value));
+    EXPECT_EQ(value, i);
+    EXPECT_TRUE(queue.try_push(i + 3));
+  }
+  EXPECT_EQ(queue.size(), 3u);
+}
+
+TEST(LockFreeQueue, TestMPMCQueueCapacityOne) {
+  // The default connector capacity; the ring still needs two slots internally.
+  MPMCQueue<int> queue(1);
+  EXPECT_EQ(queue.capacity(), 1u);
+
+  int value = 0;
+  EXPECT_TRUE(queue.try_push(1));
+  EXPECT_FALSE(queue.try_push(2));
+  EXPECT_EQ(queue.size(), 1u);
+  EXPECT_TRUE(queue.peek(0, value));
+  EXPECT_EQ(value, 1);
+  EXPECT_FALSE(queue.peek(1, value));
+
+  for (int i = 1; i <= 10; ++i) {
+    EXPECT_TRUE(queue.try_pop(value));
+    EXPECT_EQ(value, i);
+    EXPECT_FALSE(queue.try_pop(value));
+    EXPECT_TRUE(queue.try_push(i + 1));
+    EXPECT_FALSE(queue.try_push(i + 2));
+  }
+  EXPECT_EQ(queue.size(), 1u);
+
+  MPMCQueue<int> zero_queue(0);
+  EXPECT_EQ(zero_queue.capacity(), 1u);
+  EXPECT_TRUE(zero_queue.try_push(1));
+  EXPECT_FALSE(zero_queue.try_push(2));
+}
+
+TEST(LockFreeQueue, TestSPSCQueueThreads) {
+  constexpr uint64_t kCount = 100000;
+  SPSCQueue<uint64_t> queue(16);
+
+  std::thread producer([&queue]() {
+    for (uint64_t i = 1; i <= kCount; ++i) {
+      while (!queue.try_push(i)) { std::this_thread::yield(); }
+    }
+  });
+
+  // Values must arrive in order, without gaps.
+  uint64_t expected = 1;
+  uint64_t value = 0;
+  while (expected <= kCount) {
+    if (queue.try_pop(value)) {
+      ASSERT_EQ(value, expected);
+      ++expected;
+    } else {
+      std::this_thread::yield();
+    }
+  }
+  producer.join();
+  EXPECT_EQ(queue.size(), 0u);
+}
+
+TEST(LockFreeQueue, TestMPMCQueueThreads) {
+  constexpr uint64_t kCountPerProducer = 20000;
+  constexpr int kNumProducers = 4;
+  MPMCQueue<uint64_t> queue(8);
+
+  std::vector<std::thread> producers;
+  for (int p = 0; p < kNumProducers; ++p) {
+    producers.emplace_back([&queue]() {
+      for (uint64_t i = 1; i <= kCountPerProducer; ++i) {
+        while (!queue.try_push(i)) { std::this_thread::yield(); }
+      }
+    });
+  }
+
+  uint64_t sum = 0;
+  uint64_t received = 0;
+  uint64_t value = 0;
+  while (received < kCountPerProducer * kNumProducers) {
+    if (queue.try_pop(value)) {
+      sum += value;
+      ++received;
+    } else {
+      std::this_thread::yield();
+    }
+  }
+  for (auto& producer : producers) { producer.join(); }
+
+  EXPECT_EQ(sum, kNumProducers * kCountPerProducer * (kCountPerProducer + 1) / 2);
+  EXPECT_EQ(queue.size(), 0u);
+}
+
+class MPMCQueueDropOldest : public ::testing::TestWithParam<size_t> {};
+
+TEST_P(MPMCQueueDropOldest, TestOrder) {
+  // A producer that drops the oldest value while the consumer pops must never lose the newest.
+  constexpr uint64_t kCount = 50000;
+  MPMCQueue<uint64_t> queue(GetParam());
+
+  std::thread producer([&queue]() {
+    uint64_t dropped = 0;
+    for (uint64_t i = 1; i <= kCount; ++i) {
+      while (!queue.try_push(i)) { queue.try_pop(dropped); }
+    }
+  });
+
+  uint64_t last = 0;
+  uint64_t value = 0;
+  while (last < kCount) {
+    if (queue.try_pop(value)) {
+      ASSERT_GT(value, last);
+      last = value;
+    }
+  }
+  producer.join();
+}
+
+INSTANTIATE_TEST_CASE_P(LockFreeQueue, MPMCQueueDropOldest,
+                        ::testing::Values(size_t{1}, size_t{2}));
+
+}  // namespace holoscan::gxf
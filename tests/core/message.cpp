@@ -0,0 +1,124 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <any>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "holoscan/core/gxf/message_pool.hpp"
+#include "holoscan/core/message.hpp"
+#include "../utils.hpp"
+
+namespace holoscan {
+
+TEST(Message, TestMessageAnyValue) {
+  Message message;
+  message.set_value(std::any(std::string("abc")));
+  EXPECT_EQ(std::any_cast<std::string>(message.value()), "abc");
+  EXPECT_FALSE(message.holds_shared_value(typeid(std::string)));
+}
+
+TEST(Message, TestMessageSharedValue) {
+  auto data = std::make_shared<int>(7);
+  Message message;
+  message.set_value(data);
+
+  EXPECT_TRUE(message.holds_shared_value(typeid(int)));
+  EXPECT_FALSE(message.holds_shared_value(typeid(float)));
+  EXPECT_EQ(message.shared_value(typeid(int)), data);
+  EXPECT_EQ(message.shared_value(typeid(float)), nullptr);
+  EXPECT_EQ(message.as<int>(), data);
+
+  // The shared pointer is still available as std::any.
+  {
+    auto value = message.value();
+    ASSERT_EQ(value.type(), typeid(std::shared_ptr<int>));
+    EXPECT_EQ(std::any_cast<std::shared_ptr<int>>(value), data);
+  }
+
+  // Setting a non-shared-pointer value replaces the shared pointer.
+  message.set_value(std::any(1.0));
+  EXPECT_FALSE(message.holds_shared_value(typeid(int)));
+  EXPECT_EQ(data.use_count(), 1);
+
+  message.set_value(data);
+  message.reset();
+  EXPECT_FALSE(message.value().has_value());
+  EXPECT_EQ(data.use_count(), 1);
+}
+
+TEST_F(TestWithGXFContext, TestMessagePool) {
+  gxf::MessagePool pool(F.executor().context(), 2);
+  EXPECT_EQ(pool.capacity(), 2);
+
+  Message* message1 = nullptr;
+  std::optional<nvidia::gxf::Entity> entity1 = pool.acquire(message1).value();
+  ASSERT_NE(message1, nullptr);
+  auto eid1 = entity1->eid();
+  message1->set_value(std::make_shared<int>(1));
+
+  // The first entity is still referenced, so a new one is created.
+  Message* message2 = nullptr;
+  std::optional<nvidia::gxf::Entity> entity2 = pool.acquire(message2).value();
+  EXPECT_NE(entity2->eid(), eid1);
+  EXPECT_EQ(pool.size(), 2);
+
+  // The pool is full and all entities are in use, so the new entity is not pooled.
+  Message* message3 = nullptr;
+  std::optional<nvidia::gxf::Entity> entity3 = pool.acquire(message3).value();
+  EXPECT_EQ(pool.size(), 2);
+
+  // Once released, the first entity is handed out again with an empty message.
+  entity1.reset();
+  Message* message4 = nullptr;
+  auto entity4 = pool.acquire(message4).value();
+  EXPECT_EQ(entity4.eid(), eid1);
+  EXPECT_EQ(message4, message1);
+  EXPECT_FALSE(message4->value().has_value());
+}
+
+TEST_F(TestWithGXFContext, TestMessagePoolReleasesPayloads) {
+  gxf::MessagePool pool(F.executor().context(), 2);
+
+  Message* message1 = nullptr;
+  std::optional<nvidia::gxf::Entity> entity1 = pool.acquire(message1).value();
+  auto payload1 = std::make_shared<int>(1);
+  std::weak_ptr<int> weak_payload1 = payload1;
+  message1->set_value(std::move(payload1));
+
+  Message* message2 = nullptr;
+  std::optional<nvidia::gxf::Entity> entity2 = pool.acquire(message2).value();
+  auto payload2 = std::make_shared<int>(2);
+  std::weak_ptr<int> weak_payload2 = payload2;
+  message2->set_value(std::move(payload2));
+  ASSERT_EQ(pool.size(), 2);
+
+  // Both consumers release their entity; the next emit destroys both payloads, not only the one
+  // of the entity handed out again.
+  entity1.reset();
+  entity2.reset();
+  EXPECT_FALSE(weak_payload1.expired());
+  Message* message3 = nullptr;
+  auto entity3 = pool.acquire(message3).value();
+  EXPECT_TRUE(weak_payload1.expired());
+  EXPECT_TRUE(weak_payload2.expired());
+}
+
+}  // namespace holoscan
@@ -0,0 +1,140 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/profiler.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace holoscan {
+
+TEST(Profiler, TestDefault) {
+  Profiler profiler;
+  EXPECT_FALSE(profiler.enabled());
+  EXPECT_EQ(profiler.output_file(), "");
+  EXPECT_TRUE(profiler.operator_profiles().empty());
+
+  profiler.enable();
+  EXPECT_TRUE(profiler.enabled());
+  profiler.enable(false);
+  EXPECT_FALSE(profiler.enabled());
+}
+
+TEST(Profiler, TestRegisterOperator) {
+  Profiler profiler;
+  EXPECT_EQ(profiler.register_operator("tx"), 0);
+  EXPECT_EQ(profiler.register_operator("rx"), 1);
+  // registering the same name again returns the existing index
+  EXPECT_EQ(profiler.register_operator("tx"), 0);
+
+  auto profiles = profiler.operator_profiles();
+  ASSERT_EQ(profiles.size(), 2);
+  EXPECT_EQ(profiles[0].name, "tx");
+  EXPECT_EQ(profiles[1].name, "rx");
+  EXPECT_EQ(profiles[0].count, 0);
+}
+
+TEST(Profiler, TestRecordStatistics) {
+  Profiler profiler;
+  auto index = profiler.register_operator("op");
+
+  // 100 ticks every 10 ms, taking 1 ms, 2 ms, ..., 100 ms
+  int64_t start_ns = 1'000'000;
+  for (int i = 1; i <= 100; ++i) {
+    profiler.record(index, start_ns, start_ns + i * 1'000'000);
+    start_ns += 10'000'000;
+  }
+
+  auto profiles = profiler.operator_profiles();
+  ASSERT_EQ(profiles.size(), 1);
+  const auto& profile = profiles[0];
+  EXPECT_EQ(profile.count, 100);
+  EXPECT_DOUBLE_EQ(profile.min_ms, 1.0);
+  EXPECT_DOUBLE_EQ(profile.max_ms, 100.0);
+  EXPECT_DOUBLE_EQ(profile.mean_ms, 50.5);
+  EXPECT_DOUBLE_EQ(profile.total_ms, 5050.0);
+  // percentiles are estimated within 6.25%
+  EXPECT_NEAR(profile.p50_ms, 50.0, 50.0 * 0.0625);
+  EXPECT_NEAR(profile.p99_ms, 99.0, 99.0 * 0.0625);
+  EXPECT_DOUBLE_EQ(profile.interval_mean_ms, 10.0);
+  EXPECT_DOUBLE_EQ(profile.interval_p50_ms, 10.0);
+  EXPECT_DOUBLE_EQ(profile.interval_max_ms, 10.0);
+  EXPECT_DOUBLE_EQ(profile.throughput_hz, 100.0);
+
+  profiler.reset();
+  profiles = profiler.operator_profiles();
+  ASSERT_EQ(profiles.size(), 1);
+  EXPECT_EQ(profiles[0].count, 0);
+  EXPECT_EQ(profiles[0].max_ms, 0.0);
+}
+
+TEST(Profiler, TestRecordFromMultipleThreads) {
+  Profiler profiler;
+  auto index = profiler.register_operator("op");
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&profiler, index]() {
+      for (int i = 0; i < 1000; ++i) {
+        int64_t start_ns = Profiler::now_ns();
+        profiler.record(index, start_ns, start_ns + 1000);
+      }
+    });
+  }
+  for (auto& thread : threads) { thread.join(); }
+
+  auto profiles = profiler.operator_profiles();
+  ASSERT_EQ(profiles.size(), 1);
+  EXPECT_EQ(profiles[0].count, 4000);
+  EXPECT_DOUBLE_EQ(profiles[0].mean_ms, 0.001);
+}
+
+TEST(Profiler, TestRegisterAfterRecord) {
+  Profiler profiler;
+  auto first = profiler.register_operator("first");
+  profiler.record(first, 0, 1000);
+
+  // the thread buffer is replaced when more operators are registered
+  auto second = profiler.register_operator("second");
+  profiler.record(second, 0, 2000);
+  profiler.record(first, 10000, 11000);
+
+  auto profiles = profiler.operator_profiles();
+  ASSERT_EQ(profiles.size(), 2);
+  EXPECT_EQ(profiles[0].count, 2);
+  EXPECT_EQ(profiles[1].count, 1);
+}
+
+TEST(Profiler, TestOutputFormats) {
+  Profiler profiler;
+  auto index = profiler.register_operator("op,1");
+  profiler.record(index, 0, 1'000'000);
+
+  std::string csv = profiler.to_csv();
+  EXPECT_EQ(csv.find("name,count,total_ms,"), 0);
+  EXPECT_NE(csv.find("\"op,1\",1,1.000000,"), std::string::npos);
+
+  std::string json = profiler.to_json();
+  EXPECT_NE(json.find("\"operators\": ["), std::string::npos);
+  EXPECT_NE(json.find("{\"name\": \"op,1\", \"count\": 1, \"total_ms\": 1.000000"),
+            std::string::npos);
+}
+
+}  // namespace holoscan
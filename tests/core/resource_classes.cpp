@@ -33,6 +33,8 @@
 #include "holoscan/core/resources/gxf/cuda_stream_pool.hpp"
 #include "holoscan/core/resources/gxf/double_buffer_receiver.hpp"
 #include "holoscan/core/resources/gxf/double_buffer_transmitter.hpp"
+#include "holoscan/core/resources/gxf/lock_free_receiver.hpp"
+#include "holoscan/core/resources/gxf/lock_free_transmitter.hpp"
 #include "holoscan/core/resources/gxf/std_component_serializer.hpp"
 #include "holoscan/core/resources/gxf/unbounded_allocator.hpp"
 #include "holoscan/core/resources/gxf/video_stream_serializer.hpp"
@@ -112,6 +114,32 @@ TEST_F(ResourceClassesWithGXFContext, TestDoubleBufferTransmitterDefaultConstruc
   auto resource = F.make_resource<DoubleBufferTransmitter>();
 }
 
+TEST_F(ResourceClassesWithGXFContext, TestLockFreeReceiver) {
+  const std::string name{"receiver"};
+  ArgList arglist{
+      Arg{"capacity", 4UL},
+      Arg{"policy", 0UL},
+      Arg{"multi_producer", true},
+  };
+  auto resource = F.make_resource<LockFreeReceiver>(name, arglist);
+  EXPECT_EQ(resource->name(), name);
+  EXPECT_EQ(typeid(resource), typeid(std::make_shared<LockFreeReceiver>(arglist)));
+  EXPECT_EQ(std::string(resource->gxf_typename()), "holoscan::gxf::LockFreeReceiver"s);
+}
+
+TEST_F(ResourceClassesWithGXFContext, TestLockFreeTransmitter) {
+  const std::string name{"transmitter"};
+  ArgList arglist{
+      Arg{"capacity", 4UL},
+      Arg{"policy", 3UL},
+      Arg{"block_timeout_ms", 10UL},
+  };
+  auto resource = F.make_resource<LockFreeTransmitter>(name, arglist);
+  EXPECT_EQ(resource->name(), name);
+  EXPECT_EQ(typeid(resource), typeid(std::make_shared<LockFreeTransmitter>(arglist)));
+  EXPECT_EQ(std::string(resource->gxf_typename()), "holoscan::gxf::LockFreeTransmitter"s);
+}
+
 TEST_F(ResourceClassesWithGXFContext, TestStdComponentSerializer) {
   const std::string name{"std-component-serializer"};
   auto resource = F.make_resource<StdComponentSerializer>(name);
@@ -0,0 +1,93 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <gxf/core/gxf.h>
+
+#include <memory>
+#include <string>
+
+#include "holoscan/core/arg.hpp"
+#include "holoscan/core/component_spec.hpp"
+#include "holoscan/core/fragment.hpp"
+#include "holoscan/core/scheduler.hpp"
+#include "holoscan/core/schedulers/gxf/event_based_scheduler.hpp"
+#include "holoscan/core/schedulers/gxf/greedy_scheduler.hpp"
+#include "holoscan/core/schedulers/gxf/multithread_scheduler.hpp"
+#include "../utils.hpp"
+
+using namespace std::string_literals;
+
+namespace holoscan {
+
+TEST(SchedulerClasses, TestGreedyScheduler) {
+  Fragment F;
+  const std::string name{"greedy-scheduler"};
+  auto scheduler = F.make_scheduler<GreedyScheduler>(name, Arg{"stop_on_deadlock", false});
+  EXPECT_EQ(scheduler->name(), name);
+  EXPECT_EQ(typeid(scheduler), typeid(std::make_shared<GreedyScheduler>()));
+  EXPECT_EQ(std::string(scheduler->gxf_typename()), "nvidia::gxf::GreedyScheduler"s);
+}
+
+TEST(SchedulerClasses, TestGreedySchedulerDefaultConstructor) {
+  Fragment F;
+  auto scheduler = F.make_scheduler<GreedyScheduler>();
+}
+
+TEST(SchedulerClasses, TestMultiThreadScheduler) {
+  Fragment F;
+  const std::string name{"multithread-scheduler"};
+  ArgList arglist{Arg{"worker_thread_number", 4L}, Arg{"check_recession_period_ms", 2.0}};
+  auto scheduler = F.make_scheduler<MultiThreadScheduler>(name, arglist);
+  EXPECT_EQ(scheduler->name(), name);
+  EXPECT_EQ(typeid(scheduler), typeid(std::make_shared<MultiThreadScheduler>(arglist)));
+  EXPECT_EQ(std::string(scheduler->gxf_typename()), "nvidia::gxf::MultiThreadScheduler"s);
+  EXPECT_EQ(scheduler->args().size(), 2);
+}
+
+TEST(SchedulerClasses, TestMultiThreadSchedulerDefaultConstructor) {
+  Fragment F;
+  auto scheduler = F.make_scheduler<MultiThreadScheduler>();
+}
+
+TEST(SchedulerClasses, TestEventBasedScheduler) {
+  Fragment F;
+  const std::string name{"event-based-scheduler"};
+  auto scheduler = F.make_scheduler<EventBasedScheduler>(name, Arg{"worker_thread_number", 2L});
+  EXPECT_EQ(scheduler->name(), name);
+  EXPECT_EQ(std::string(scheduler->gxf_typename()), "nvidia::gxf::EventBasedScheduler"s);
+}
+
+TEST(SchedulerClasses, TestFragmentDefaultScheduler) {
+  Fragment F;
+  auto scheduler = F.scheduler();
+  ASSERT_TRUE(scheduler);
+  EXPECT_TRUE(std::dynamic_pointer_cast<GreedyScheduler>(scheduler) != nullptr);
+
+  // the same scheduler is returned on subsequent calls
+  EXPECT_EQ(F.scheduler(), scheduler);
+}
+
+TEST(SchedulerClasses, TestFragmentSetScheduler) {
+  Fragment F;
+  auto scheduler =
+      F.make_scheduler<MultiThreadScheduler>("multithread", Arg{"worker_thread_number", 2L});
+  F.scheduler(scheduler);
+  EXPECT_EQ(F.scheduler(), scheduler);
+}
+
+}  // namespace holoscan
@@ -0,0 +1,308 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "bayer_demosaic/bayer_to_rgb.hpp"
+#include "utils/row_worker_pool.hpp"
+
+namespace nvidia {
+namespace holoscan {
+
+namespace {
+
+constexpr BayerGridPosition kGridPositions[] = {BayerGridPosition::kBGGR,
+                                                BayerGridPosition::kRGGB,
+                                                BayerGridPosition::kGBRG,
+                                                BayerGridPosition::kGRBG};
+constexpr BayerInterpolation kInterpolations[] = {BayerInterpolation::kBilinear,
+                                                  BayerInterpolation::kGradientCorrected};
+
+// Color (0 red, 1 green, 2 blue) of a pixel of the Bayer pattern
+int BayerColor(BayerGridPosition position, uint32_t row, uint32_t column) {
+  static const int kPatterns[4][2][2] = {
+      {{2, 1}, {1, 0}}, {{0, 1}, {1, 2}}, {{1, 2}, {0, 1}}, {{1, 0}, {2, 1}}};
+  return kPatterns[static_cast<int>(position)][row % 2][column % 2];
+}
+
+int64_t Mirror(int64_t index, int64_t size) {
+  if (size == 1) { return 0; }
+  while (index < 0 || index >= size) { index = index < 0 ? -index : 2 * size - 2 - index; }
+  return index;
+}
+
+// 5x5 filters of each missing color, from the Bayer samples around the pixel
+struct Filter {
+  int weights[5][5];
+  int scale;
+};
+
+// Bilinear interpolation, rounded to the nearest value
+constexpr Filter kBilinearCross = {
+    {{0, 0, 0, 0, 0}, {0, 0, 1, 0, 0}, {0, 1, 0, 1, 0}, {0, 0, 1, 0, 0}, {0, 0, 0, 0, 0}}, 4};
+constexpr Filter kBilinearDiagonal = {
+    {{0, 0, 0, 0, 0}, {0, 1, 0, 1, 0}, {0, 0, 0, 0, 0}, {0, 1, 0, 1, 0}, {0, 0, 0, 0, 0}}, 4};
+constexpr Filter kBilinearHorizontal = {
+    {{0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 1, 0, 1, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}}, 2};
+constexpr Filter kBilinearVertical = {
+    {{0, 0, 0, 0, 0}, {0, 0, 1, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 1, 0, 0}, {0, 0, 0, 0, 0}}, 2};
+
+// Malvar, He and Cutler, "High-quality linear interpolation for demosaicing of Bayer-patterned
+// color images", 2004
+constexpr Filter kMalvarGreen = {{{0, 0, -2, 0, 0},
+                                  {0, 0, 4, 0, 0},
+                                  {-2, 4, 8, 4, -2},
+                                  {0, 0, 4, 0, 0},
+                                  {0, 0, -2, 0, 0}},
+                                 16};
+constexpr Filter kMalvarHorizontal = {{{0, 0, 1, 0, 0},
+                                       {0, -2, 0, -2, 0},
+                                       {-2, 8, 10, 8, -2},
+                                       {0, -2, 0, -2, 0},
+                                       {0, 0, 1, 0, 0}},
+                                      16};
+constexpr Filter kMalvarVertical = {{{0, 0, -2, 0, 0},
+                                     {0, -2, 8, -2, 0},
+                                     {1, 0, 10, 0, 1},
+                                     {0, -2, 8, -2, 0},
+                                     {0, 0, -2, 0, 0}},
+                                    16};
+constexpr Filter kMalvarDiagonal = {{{0, 0, -3, 0, 0},
+                                     {0, 4, 0, 4, 0},
+                                     {-3, 0, 12, 0, -3},
+                                     {0, 4, 0, 4, 0},
+                                     {0, 0, -3, 0, 0}},
+                                    16};
+
+// Scalar demosaicing of one pixel at a time, applying the filters of the missing colors
+template <typename T>
+std::vector<T> ReferenceDemosaic(const std::vector<T>& bayer, uint32_t width, uint32_t height,
+                                 BayerGridPosition position, BayerInterpolation interpolation,
+                                 uint32_t channels, T alpha) {
+  const bool is_malvar = interpolation == BayerInterpolation::kGradientCorrected;
+  const int64_t max_value = std::numeric_limits<T>::max();
+  std::vector<T> rgb(static_cast<size_t>(width) * height * channels);
+  for (uint32_t y = 0; y < height; y++) {
+    for (uint32_t x = 0; x < width; x++) {
+      const int color = BayerColor(position, y, x);
+      T* pixel = &rgb[(static_cast<size_t>(y) * width + x) * channels];
+      for (int c = 0; c < 3; c++) {
+        const Filter* filter = nullptr;
+        if (c == color) {
+          pixel[c] = bayer[static_cast<size_t>(y) * width + x];
+          continue;
+        } else if (c == 1) {
+          filter = is_malvar ? &kMalvarGreen : &kBilinearCross;
+        } else if (color != 1) {
+          filter = is_malvar ? &kMalvarDiagonal : &kBilinearDiagonal;
+        } else if (BayerColor(position, y, x + 1) == c) {
+          filter = is_malvar ? &kMalvarHorizontal : &kBilinearHorizontal;
+        } else {
+          filter = is_malvar ? &kMalvarVertical : &kBilinearVertical;
+        }
+
+        int64_t sum = 0;
+        for (int dy = -2; dy <= 2; dy++) {
+          for (int dx = -2; dx <= 2; dx++) {
+            const int64_t row = Mirror(static_cast<int64_t>(y) + dy, height);
+            const int64_t column = Mirror(static_cast<int64_t>(x) + dx, width);
+            sum += filter->weights[dy + 2][dx + 2] * bayer[row * width + column];
+          }
+        }
+        // round half up
+        const int64_t value =
+            static_cast<int64_t>(std::floor(static_cast<double>(sum) / filter->scale + 0.5));
+        pixel[c] = static_cast<T>(std::clamp<int64_t>(value, 0, max_value));
+      }
+      if (channels == 4) { pixel[3] = alpha; }
+    }
+  }
+  return rgb;
+}
+
+template <typename T>
+std::vector<T> RandomBayer(uint32_t width, uint32_t height) {
+  std::mt19937 generator(42);
+  std::uniform_int_distribution<int> distribution(0, std::numeric_limits<T>::max());
+  std::vector<T> bayer(static_cast<size_t>(width) * height);
+  for (auto& value : bayer) { value = static_cast<T>(distribution(generator)); }
+  return bayer;
+}
+
+// Samples a scene of one RGB color per pixel with the Bayer pattern
+std::vector<uint8_t> Mosaic(const std::vector<uint8_t>& scene, uint32_t width, uint32_t height,
+                            BayerGridPosition position) {
+  std::vector<uint8_t> bayer(static_cast<size_t>(width) * height);
+  for (uint32_t y = 0; y < height; y++) {
+    for (uint32_t x = 0; x < width; x++) {
+      bayer[y * width + x] = scene[(y * width + x) * 3 + BayerColor(position, y, x)];
+    }
+  }
+  return bayer;
+}
+
+}  // namespace
+
+TEST(BayerToRGB, Parse) {
+  BayerGridPosition position;
+  EXPECT_TRUE(ParseBayerGridPosition(0, &position));
+  EXPECT_EQ(position, BayerGridPosition::kBGGR);
+  EXPECT_TRUE(ParseBayerGridPosition(3, &position));
+  EXPECT_EQ(position, BayerGridPosition::kGRBG);
+  EXPECT_FALSE(ParseBayerGridPosition(4, &position));
+
+  BayerInterpolation interpolation;
+  EXPECT_TRUE(ParseBayerInterpolation(0, &interpolation));
+  EXPECT_EQ(interpolation, BayerInterpolation::kBilinear);
+  EXPECT_TRUE(ParseBayerInterpolation(2, &interpolation));
+  EXPECT_EQ(interpolation, BayerInterpolation::kBilinear);
+  EXPECT_TRUE(ParseBayerInterpolation(4, &interpolation));
+  EXPECT_EQ(interpolation, BayerInterpolation::kGradientCorrected);
+  EXPECT_FALSE(ParseBayerInterpolation(1, &interpolation));
+}
+
+TEST(BayerToRGB, UniformColor) {
+  // a uniform scene is restored exactly, up to the borders
+  const uint32_t width = 10;
+  const uint32_t height = 6;
+  const uint8_t color[3] = {200, 90, 30};
+  std::vector<uint8_t> scene(width * height * 3);
+  for (size_t i = 0; i < scene.size(); i++) { scene[i] = color[i % 3]; }
+
+  for (auto position : kGridPositions) {
+    const auto bayer = Mosaic(scene, width, height, position);
+    for (auto interpolation : kInterpolations) {
+      std::vector<uint8_t> rgba(width * height * 4);
+      DemosaicBayer(bayer.data(), width, rgba.data(), width * 4, width, height, 0, height,
+                    position, interpolation, 4, 128);
+      for (size_t i = 0; i < rgba.size(); i++) {
+        ASSERT_EQ(rgba[i], i % 4 == 3 ? 128 : color[i % 4])
+            << "index " << i << ", position " << static_cast<int>(position) << ", interpolation "
+            << static_cast<int>(interpolation);
+      }
+    }
+  }
+}
+
+TEST(BayerToRGB, MatchesReference8Bit) {
+  // odd sizes and padded rows
+  for (const auto& size : {std::pair<uint32_t, uint32_t>{64, 32}, {37, 19}, {3, 3}, {1, 2}}) {
+    const uint32_t width = size.first;
+    const uint32_t height = size.second;
+    const auto bayer = RandomBayer<uint8_t>(width, height);
+    std::vector<uint8_t> padded_bayer((width + 5) * height);
+    for (uint32_t y = 0; y < height; y++) {
+      std::copy_n(&bayer[y * width], width, &padded_bayer[y * (width + 5)]);
+    }
+
+    for (auto position : kGridPositions) {
+      for (auto interpolation : kInterpolations) {
+        for (uint32_t channels : {3u, 4u}) {
+          const auto expected =
+              ReferenceDemosaic<uint8_t>(bayer, width, height, position, interpolation, channels,
+                                         255);
+          std::vector<uint8_t> rgb(width * height * channels);
+          DemosaicBayer(padded_bayer.data(), width + 5, rgb.data(), width * channels, width,
+                        height, 0, height, position, interpolation, channels, 255);
+          ASSERT_EQ(rgb, expected) << width << "x" << height << ", position "
+                                   << static_cast<int>(position) << ", interpolation "
+                                   << static_cast<int>(interpolation) << ", channels "
+                                   << channels;
+        }
+      }
+    }
+  }
+}
+
+TEST(BayerToRGB, MatchesReference16Bit) {
+  const uint32_t width = 45;
+  const uint32_t height = 22;
+  const auto bayer = RandomBayer<uint16_t>(width, height);
+  for (auto position : kGridPositions) {
+    for (auto interpolation : kInterpolations) {
+      for (uint32_t channels : {3u, 4u}) {
+        const auto expected = ReferenceDemosaic<uint16_t>(
+            bayer, width, height, position, interpolation, channels, 1000);
+        std::vector<uint16_t> rgb(width * height * channels);
+        DemosaicBayer(bayer.data(), width * 2, rgb.data(), width * channels * 2, width, height, 0,
+                      height, position, interpolation, channels, 1000);
+        ASSERT_EQ(rgb, expected) << "position " << static_cast<int>(position)
+                                 << ", interpolation " << static_cast<int>(interpolation)
+                                 << ", channels " << channels;
+      }
+    }
+  }
+}
+
+TEST(BayerToRGB, GradientCorrectedEdges) {
+  // a diagonal edge between two colors, the gradient-corrected interpolation has smaller errors
+  const uint32_t width = 64;
+  const uint32_t height = 64;
+  std::vector<uint8_t> scene(width * height * 3);
+  for (uint32_t y = 0; y < height; y++) {
+    for (uint32_t x = 0; x < width; x++) {
+      const bool is_bright = x + y / 2 > width / 2;
+      for (int c = 0; c < 3; c++) {
+        scene[(y * width + x) * 3 + c] = is_bright ? 220 - 30 * c : 20 + 10 * c;
+      }
+    }
+  }
+  const auto bayer = Mosaic(scene, width, height, BayerGridPosition::kRGGB);
+
+  double squared_errors[2] = {};
+  for (int i = 0; i < 2; i++) {
+    std::vector<uint8_t> rgb(scene.size());
+    DemosaicBayer(bayer.data(), width, rgb.data(), width * 3, width, height, 0, height,
+                  BayerGridPosition::kRGGB, kInterpolations[i], 3, 255);
+    for (size_t j = 0; j < rgb.size(); j++) {
+      squared_errors[i] += std::pow(static_cast<double>(rgb[j]) - scene[j], 2);
+    }
+  }
+  EXPECT_LT(squared_errors[1], squared_errors[0]);
+}
+
+TEST(BayerToRGB, RowWorkerPool) {
+  const uint32_t width = 640;
+  const uint32_t height = 61;
+  const auto bayer = RandomBayer<uint8_t>(width, height);
+
+  for (auto interpolation : kInterpolations) {
+    std::vector<uint8_t> expected(width * 3 * height);
+    DemosaicBayer(bayer.data(), width, expected.data(), width * 3, width, height, 0, height,
+                  BayerGridPosition::kGBRG, interpolation, 3, 255);
+
+    for (size_t thread_count : {2, 3, 8}) {
+      RowWorkerPool pool(thread_count);
+      std::vector<uint8_t> rgb(expected.size());
+      pool.run(height, [&](size_t begin_row, size_t end_row) {
+        DemosaicBayer(bayer.data(), width, rgb.data(), width * 3, width, height, begin_row,
+                      end_row, BayerGridPosition::kGBRG, interpolation, 3, 255);
+      });
+      ASSERT_EQ(expected, rgb) << "thread count: " << thread_count;
+    }
+  }
+}
+
+}  // namespace holoscan
+}  // namespace nvidia
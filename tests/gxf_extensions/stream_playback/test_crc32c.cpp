@@ -0,0 +1,83 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "stream_playback/crc32c.hpp"
+
+namespace nvidia {
+namespace holoscan {
+namespace stream_playback {
+
+TEST(Crc32c, KnownVectors) {
+  EXPECT_EQ(Crc32c(nullptr, 0), 0u);
+  EXPECT_EQ(Crc32c("123456789", 9), 0xe3069283u);
+
+  // Test vectors of RFC 3720, appendix B.4
+  std::vector<uint8_t> data(32, 0);
+  EXPECT_EQ(Crc32c(data.data(), data.size()), 0x8a9136aau);
+  std::fill(data.begin(), data.end(), 0xff);
+  EXPECT_EQ(Crc32c(data.data(), data.size()), 0x62a8ab43u);
+  std::iota(data.begin(), data.end(), 0);
+  EXPECT_EQ(Crc32c(data.data(), data.size()), 0x46dd794eu);
+
+  for (const auto crc32c : {Crc32c, Crc32cSlicingBy8}) {
+    EXPECT_EQ(crc32c("123456789", 9, 0), 0xe3069283u);
+    EXPECT_EQ(crc32c(data.data(), data.size(), 0), 0x46dd794eu);
+  }
+}
+
+TEST(Crc32c, HardwareMatchesSlicingBy8) {
+  if (!HasHardwareCrc32c()) { GTEST_SKIP() << "No CRC32 instructions on this CPU"; }
+
+  std::mt19937 generator(42);
+  std::vector<uint8_t> data(4096 + 15);
+  for (auto& value : data) { value = static_cast<uint8_t>(generator()); }
+
+  // Unaligned starts and sizes which are not multiples of the 8 bytes processed at once
+  for (size_t offset = 0; offset < 8; offset++) {
+    for (size_t size : {0, 1, 7, 8, 9, 63, 64, 1000, 4096}) {
+      EXPECT_EQ(Crc32c(data.data() + offset, size), Crc32cSlicingBy8(data.data() + offset, size))
+          << "offset " << offset << ", size " << size;
+    }
+  }
+}
+
+TEST(Crc32c, Incremental) {
+  std::mt19937 generator(7);
+  std::vector<uint8_t> data(1000);
+  for (auto& value : data) { value = static_cast<uint8_t>(generator()); }
+
+  const uint32_t expected = Crc32c(data.data(), data.size());
+  for (size_t split : {0, 1, 5, 8, 13, 500, 999, 1000}) {
+    const uint32_t head = Crc32c(data.data(), split);
+    EXPECT_EQ(Crc32c(data.data() + split, data.size() - split, head), expected) << split;
+    const uint32_t software_head = Crc32cSlicingBy8(data.data(), split);
+    EXPECT_EQ(Crc32cSlicingBy8(data.data() + split, data.size() - split, software_head), expected)
+        << split;
+  }
+}
+
+}  // namespace stream_playback
+}  // namespace holoscan
+}  // namespace nvidia
@@ -0,0 +1,417 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Round trips entities through the VideoStreamSerializer of the stream_playback extension, which
+// is loaded with the default extensions of a Fragment's GXF context.
+
+#include <gtest/gtest.h>
+#include <yaml-cpp/yaml.h>
+
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "gxf/core/entity.hpp"
+#include "gxf/serialization/entity_serializer.hpp"
+#include "gxf/std/allocator.hpp"
+#include "gxf/std/tensor.hpp"
+#include "holoscan/core/executor.hpp"
+#include "holoscan/core/fragment.hpp"
+#include "stream_playback/crc32c.hpp"
+#include "stream_playback/entity_compression.hpp"
+#include "stream_playback/video_stream_serializer.hpp"
+
+namespace nvidia {
+namespace holoscan {
+namespace stream_playback {
+
+namespace {
+
+constexpr int32_t kRows = 256;
+constexpr int32_t kColumns = 256;
+constexpr uint64_t kChunkSize = 16 * 1024;
+
+// Frame with a gradient background and a square moving with the frame index
+std::vector<uint8_t> MovingSquareFrame(size_t index) {
+  std::vector<uint8_t> frame(kRows * kColumns);
+  for (int32_t row = 0; row < kRows; row++) {
+    for (int32_t column = 0; column < kColumns; column++) {
+      const bool in_square = row >= 32 && row < 64 && column >= static_cast<int32_t>(index * 8) &&
+                             column < static_cast<int32_t>(index * 8 + 32);
+      frame[row * kColumns + column] = in_square ? 255 : static_cast<uint8_t>(row + column);
+    }
+  }
+  return frame;
+}
+
+std::vector<uint8_t> RandomFrame(uint32_t seed) {
+  std::mt19937 generator(seed);
+  std::vector<uint8_t> frame(kRows * kColumns);
+  for (auto& value : frame) { value = static_cast<uint8_t>(generator()); }
+  return frame;
+}
+
+// Serialized entity holding a single component, split in the parts of the compressed format
+struct StoredEntity {
+  VideoStreamSerializer::EntityHeader entity_header;
+  VideoStreamSerializer::CompressedComponentHeader compressed_header;
+  std::vector<CompressedChunk> chunk_table;
+  // Offset of the chunk table in the serialized entity
+  size_t chunk_table_offset;
+};
+
+StoredEntity ParseStoredEntity(const uint8_t* data, const std::string& component_name) {
+  StoredEntity stored;
+  size_t offset = 0;
+  std::memcpy(&stored.entity_header, data + offset, sizeof(stored.entity_header));
+  offset += sizeof(stored.entity_header) + sizeof(VideoStreamSerializer::ComponentHeader) +
+            component_name.size();
+  std::memcpy(&stored.compressed_header, data + offset, sizeof(stored.compressed_header));
+  offset += sizeof(stored.compressed_header);
+  stored.chunk_table_offset = offset;
+  stored.chunk_table.resize(stored.compressed_header.chunk_count);
+  std::memcpy(stored.chunk_table.data(), data + offset,
+              stored.chunk_table.size() * sizeof(CompressedChunk));
+  return stored;
+}
+
+class VideoStreamSerializerTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    context_ = fragment_.executor().context();
+    ASSERT_NE(context_, nullptr);
+
+    gxf_tid_t tid;
+    ASSERT_EQ(GxfComponentTypeId(context_, "nvidia::gxf::UnboundedAllocator", &tid), GXF_SUCCESS);
+    const auto allocator = gxf::Entity::New(context_).assign_to(allocator_entity_).and_then([&]() {
+      return allocator_entity_.add(tid, "allocator");
+    });
+    ASSERT_TRUE(allocator);
+    ASSERT_TRUE(allocator_entity_.activate());
+    gxf::Handle<gxf::Allocator>::Create(context_, allocator.value().cid()).assign_to(allocator_);
+    ASSERT_TRUE(allocator_);
+  }
+
+  // Creates a VideoStreamSerializer with the given parameters, in an entity of its own
+  gxf::Expected<gxf::Handle<gxf::EntitySerializer>> CreateSerializer(const YAML::Node& parameters) {
+    gxf_tid_t component_serializer_tid;
+    gxf_tid_t serializer_tid;
+    if (GxfComponentTypeId(context_, "nvidia::gxf::StdComponentSerializer",
+                           &component_serializer_tid) != GXF_SUCCESS ||
+        GxfComponentTypeId(context_, "nvidia::holoscan::stream_playback::VideoStreamSerializer",
+                           &serializer_tid) != GXF_SUCCESS) {
+      return gxf::Unexpected{GXF_FACTORY_UNKNOWN_CLASS_NAME};
+    }
+
+    gxf::Entity entity;
+    gxf::UntypedHandle component_serializer = gxf::UntypedHandle::Null();
+    gxf::UntypedHandle serializer = gxf::UntypedHandle::Null();
+    auto result = gxf::Entity::New(context_)
+                      .assign_to(entity)
+                      .and_then([&]() {
+                        return entity.add(component_serializer_tid, "component_serializer");
+                      })
+                      .assign_to(component_serializer)
+                      .and_then([&]() { return entity.add(serializer_tid, "serializer"); })
+                      .assign_to(serializer);
+    if (!result) { return gxf::ForwardError(result); }
+
+    gxf_result_t code = GxfParameterSetHandle(context_, component_serializer.cid(), "allocator",
+                                              allocator_->cid());
+    YAML::Node component_serializers = YAML::Load("[component_serializer]");
+    if (code == GXF_SUCCESS) {
+      code = GxfParameterSetFromYamlNode(context_, serializer.cid(), "component_serializers",
+                                         &component_serializers, "");
+    }
+    for (const auto& parameter : parameters) {
+      if (code != GXF_SUCCESS) { break; }
+      YAML::Node value = parameter.second;
+      code = GxfParameterSetFromYamlNode(context_, serializer.cid(),
+                                         parameter.first.as<std::string>().c_str(), &value, "");
+    }
+    if (code != GXF_SUCCESS) { return gxf::Unexpected{code}; }
+
+    result = entity.activate();
+    if (!result) { return gxf::ForwardError(result); }
+    serializer_entities_.push_back(entity);
+    return gxf::Handle<gxf::EntitySerializer>::Create(context_, serializer.cid());
+  }
+
+  // Creates an entity holding the frame as a tensor in host memory
+  gxf::Expected<gxf::Entity> CreateFrameEntity(const std::vector<uint8_t>& frame) {
+    gxf::Entity entity;
+    gxf::Handle<gxf::Tensor> tensor = gxf::Handle<gxf::Tensor>::Null();
+    auto result = gxf::Entity::New(context_)
+                      .assign_to(entity)
+                      .and_then([&]() { return entity.add<gxf::Tensor>(kTensorName); })
+                      .assign_to(tensor)
+                      .and_then([&]() {
+                        return tensor->reshape<uint8_t>(gxf::Shape{kRows, kColumns},
+                                                        gxf::MemoryStorageType::kSystem,
+                                                        allocator_);
+                      });
+    if (!result) { return gxf::ForwardError(result); }
+    std::memcpy(tensor->pointer(), frame.data(), frame.size());
+    return entity;
+  }
+
+  // Serializes the frames to memory, keeping the offset of each entity
+  void SerializeFrames(gxf::Handle<gxf::EntitySerializer> writer,
+                       const std::vector<std::vector<uint8_t>>& frames, MemoryEndpoint* endpoint,
+                       std::vector<size_t>* offsets = nullptr) {
+    for (const auto& frame : frames) {
+      auto entity = CreateFrameEntity(frame);
+      ASSERT_TRUE(entity);
+      if (offsets) { offsets->push_back(endpoint->buffer().size()); }
+      const auto size = writer->serializeEntity(entity.value(), endpoint);
+      ASSERT_TRUE(size);
+    }
+  }
+
+  // Deserializes an entity and returns the frame it holds, or an empty frame on failure
+  std::vector<uint8_t> DeserializeFrame(gxf::Handle<gxf::EntitySerializer> reader,
+                                        MemoryEndpoint* endpoint) {
+    auto entity = gxf::Entity::New(context_);
+    if (!entity || !reader->deserializeEntity(entity.value(), endpoint)) { return {}; }
+    const auto tensor = entity.value().get<gxf::Tensor>(kTensorName);
+    if (!tensor || tensor.value()->size() != static_cast<uint64_t>(kRows * kColumns)) {
+      return {};
+    }
+    const auto* data = static_cast<const uint8_t*>(tensor.value()->pointer());
+    return std::vector<uint8_t>(data, data + tensor.value()->size());
+  }
+
+  static constexpr const char* kTensorName = "frame";
+
+  ::holoscan::Fragment fragment_;
+  gxf_context_t context_ = nullptr;
+  gxf::Entity allocator_entity_;
+  gxf::Handle<gxf::Allocator> allocator_ = gxf::Handle<gxf::Allocator>::Null();
+  std::vector<gxf::Entity> serializer_entities_;
+};
+
+YAML::Node SerializerParameters(const std::string& compression, bool delta_encoding,
+                                uint64_t keyframe_interval = 30) {
+  YAML::Node parameters;
+  parameters["compression"] = compression;
+  parameters["delta_encoding"] = delta_encoding;
+  parameters["keyframe_interval"] = keyframe_interval;
+  parameters["compression_chunk_size"] = kChunkSize;
+  parameters["compression_threads"] = 2;
+  return parameters;
+}
+
+class VideoStreamSerializerRoundTripTest
+    : public VideoStreamSerializerTest,
+      public ::testing::WithParamInterface<std::tuple<std::string, bool>> {};
+
+}  // namespace
+
+TEST_P(VideoStreamSerializerRoundTripTest, RoundTrip) {
+  const auto [compression, delta_encoding] = GetParam();
+  const auto writer = CreateSerializer(SerializerParameters(compression, delta_encoding));
+  ASSERT_TRUE(writer);
+  auto reader_parameters = SerializerParameters("none", false);
+  reader_parameters["verify_checksum"] = true;
+  const auto reader = CreateSerializer(reader_parameters);
+  ASSERT_TRUE(reader);
+
+  std::vector<std::vector<uint8_t>> frames;
+  for (size_t i = 0; i < 8; i++) { frames.push_back(MovingSquareFrame(i)); }
+  MemoryEndpoint endpoint;
+  std::vector<size_t> offsets;
+  SerializeFrames(writer.value(), frames, &endpoint, &offsets);
+
+  if (compression != "none" || delta_encoding) {
+    // The frames compress, and all but the first one are deltas when delta encoding is enabled
+    for (size_t i = 0; i < frames.size(); i++) {
+      const auto stored = ParseStoredEntity(endpoint.buffer().data() + offsets[i], kTensorName);
+      EXPECT_EQ(stored.compressed_header.reference_sequence,
+                delta_encoding && i > 0 ? i - 1 : VideoStreamSerializer::kNoReference);
+      EXPECT_EQ(stored.chunk_table.size(),
+                (stored.compressed_header.raw_size + kChunkSize - 1) / kChunkSize);
+      if (compression != "none") {
+        uint64_t stored_size = 0;
+        for (const auto& chunk : stored.chunk_table) { stored_size += chunk.stored_size; }
+        EXPECT_LT(stored_size, stored.compressed_header.raw_size);
+      }
+    }
+  }
+
+  for (const auto& frame : frames) {
+    EXPECT_EQ(DeserializeFrame(reader.value(), &endpoint), frame);
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(VideoStreamSerializer, VideoStreamSerializerRoundTripTest,
+                         ::testing::Combine(::testing::Values("none", "lz4", "zstd"),
+                                            ::testing::Bool()));
+
+TEST_F(VideoStreamSerializerTest, IncompressibleChunksAreStoredAsIs) {
+  const auto writer = CreateSerializer(SerializerParameters("lz4", false));
+  ASSERT_TRUE(writer);
+  const auto reader = CreateSerializer(SerializerParameters("none", false));
+  ASSERT_TRUE(reader);
+
+  const std::vector<std::vector<uint8_t>> frames = {RandomFrame(1), RandomFrame(2)};
+  MemoryEndpoint endpoint;
+  std::vector<size_t> offsets;
+  SerializeFrames(writer.value(), frames, &endpoint, &offsets);
+
+  for (size_t offset : offsets) {
+    const auto stored = ParseStoredEntity(endpoint.buffer().data() + offset, kTensorName);
+    ASSERT_GT(stored.chunk_table.size(), 1u);
+    for (const auto& chunk : stored.chunk_table) { EXPECT_EQ(chunk.stored_size, chunk.raw_size); }
+  }
+  for (const auto& frame : frames) {
+    EXPECT_EQ(DeserializeFrame(reader.value(), &endpoint), frame);
+  }
+}
+
+TEST_F(VideoStreamSerializerTest, KeyframeInterval) {
+  constexpr uint64_t kKeyframeInterval = 3;
+  const auto writer = CreateSerializer(SerializerParameters("lz4", true, kKeyframeInterval));
+  ASSERT_TRUE(writer);
+
+  std::vector<std::vector<uint8_t>> frames;
+  for (size_t i = 0; i < 8; i++) { frames.push_back(MovingSquareFrame(i)); }
+  MemoryEndpoint endpoint;
+  std::vector<size_t> offsets;
+  SerializeFrames(writer.value(), frames, &endpoint, &offsets);
+
+  for (size_t i = 0; i < frames.size(); i++) {
+    const auto stored = ParseStoredEntity(endpoint.buffer().data() + offsets[i], kTensorName);
+    EXPECT_EQ(stored.entity_header.sequence_number, i);
+    EXPECT_EQ(stored.compressed_header.reference_sequence,
+              i % kKeyframeInterval == 0 ? VideoStreamSerializer::kNoReference : i - 1);
+  }
+
+  // Replay can start from any keyframe
+  const auto reader = CreateSerializer(SerializerParameters("none", false));
+  ASSERT_TRUE(reader);
+  MemoryEndpoint from_keyframe;
+  const auto& buffer = endpoint.buffer();
+  ASSERT_TRUE(from_keyframe.write(buffer.data() + offsets[kKeyframeInterval],
+                                  buffer.size() - offsets[kKeyframeInterval]));
+  for (size_t i = kKeyframeInterval; i < frames.size(); i++) {
+    EXPECT_EQ(DeserializeFrame(reader.value(), &from_keyframe), frames[i]);
+  }
+}
+
+TEST_F(VideoStreamSerializerTest, CorruptedChunkTableFails) {
+  const auto writer = CreateSerializer(SerializerParameters("zstd", false));
+  ASSERT_TRUE(writer);
+  const auto reader = CreateSerializer(SerializerParameters("none", false));
+  ASSERT_TRUE(reader);
+
+  MemoryEndpoint endpoint;
+  SerializeFrames(writer.value(), {MovingSquareFrame(0)}, &endpoint);
+  auto& buffer = endpoint.buffer();
+  const auto stored = ParseStoredEntity(buffer.data(), kTensorName);
+  ASSERT_GT(stored.chunk_table.size(), 1u);
+
+  // Move a byte from the first chunk to the second one, so that the table no longer matches the
+  // size of the component
+  CompressedChunk first = stored.chunk_table[0];
+  first.raw_size -= 1;
+  std::memcpy(buffer.data() + stored.chunk_table_offset, &first, sizeof(first));
+
+  EXPECT_TRUE(DeserializeFrame(reader.value(), &endpoint).empty());
+}
+
+TEST_F(VideoStreamSerializerTest, DeltaWithoutReferenceFails) {
+  const auto writer = CreateSerializer(SerializerParameters("lz4", true, 0));
+  ASSERT_TRUE(writer);
+  const auto reader = CreateSerializer(SerializerParameters("none", false));
+  ASSERT_TRUE(reader);
+
+  MemoryEndpoint endpoint;
+  std::vector<size_t> offsets;
+  SerializeFrames(writer.value(), {MovingSquareFrame(0), MovingSquareFrame(1)}, &endpoint,
+                  &offsets);
+  const auto& buffer = endpoint.buffer();
+  const auto stored = ParseStoredEntity(buffer.data() + offsets[1], kTensorName);
+  ASSERT_EQ(stored.compressed_header.reference_sequence, 0u);
+
+  // The second entity is a delta to the first one, which the reader never saw
+  MemoryEndpoint delta_only;
+  ASSERT_TRUE(delta_only.write(buffer.data() + offsets[1], buffer.size() - offsets[1]));
+  EXPECT_TRUE(DeserializeFrame(reader.value(), &delta_only).empty());
+}
+
+TEST_F(VideoStreamSerializerTest, ChecksumTrailer) {
+  for (const char* compression : {"none", "lz4"}) {
+    const auto writer = CreateSerializer(SerializerParameters(compression, false));
+    ASSERT_TRUE(writer);
+
+    MemoryEndpoint endpoint;
+    std::vector<size_t> offsets;
+    SerializeFrames(writer.value(), {MovingSquareFrame(0), MovingSquareFrame(1)}, &endpoint,
+                    &offsets);
+    const auto& buffer = endpoint.buffer();
+    offsets.push_back(buffer.size());
+    for (size_t i = 0; i + 1 < offsets.size(); i++) {
+      VideoStreamSerializer::EntityHeader header;
+      std::memcpy(&header, buffer.data() + offsets[i], sizeof(header));
+      EXPECT_NE(header.flags & VideoStreamSerializer::kChecksumFlag, 0u);
+      EXPECT_EQ(header.serialized_size, 0u);
+
+      VideoStreamSerializer::EntityTrailer trailer;
+      std::memcpy(&trailer, buffer.data() + offsets[i + 1] - sizeof(trailer), sizeof(trailer));
+      const size_t payload_offset = offsets[i] + sizeof(header);
+      const size_t payload_size = offsets[i + 1] - sizeof(trailer) - payload_offset;
+      EXPECT_EQ(trailer.serialized_size, payload_size) << compression;
+      EXPECT_EQ(trailer.checksum, Crc32c(buffer.data() + payload_offset, payload_size))
+          << compression;
+    }
+  }
+}
+
+TEST_F(VideoStreamSerializerTest, VerifyChecksumDetectsCorruption) {
+  const auto writer = CreateSerializer(SerializerParameters("none", false));
+  ASSERT_TRUE(writer);
+  auto verify_parameters = SerializerParameters("none", false);
+  verify_parameters["verify_checksum"] = true;
+  const auto verifying_reader = CreateSerializer(verify_parameters);
+  ASSERT_TRUE(verifying_reader);
+  const auto reader = CreateSerializer(SerializerParameters("none", false));
+  ASSERT_TRUE(reader);
+
+  const auto frame = MovingSquareFrame(0);
+  MemoryEndpoint endpoint;
+  SerializeFrames(writer.value(), {frame}, &endpoint);
+  // Flip a byte of the tensor data, which deserializes without error
+  auto corrupted = endpoint.buffer();
+  corrupted[corrupted.size() / 2] ^= 0xff;
+
+  MemoryEndpoint verified;
+  ASSERT_TRUE(verified.write(corrupted.data(), corrupted.size()));
+  EXPECT_TRUE(DeserializeFrame(verifying_reader.value(), &verified).empty());
+
+  MemoryEndpoint unverified;
+  ASSERT_TRUE(unverified.write(corrupted.data(), corrupted.size()));
+  const auto read_frame = DeserializeFrame(reader.value(), &unverified);
+  ASSERT_EQ(read_frame.size(), frame.size());
+  EXPECT_NE(read_frame, frame);
+}
+
+}  // namespace stream_playback
+}  // namespace holoscan
+}  // namespace nvidia
@@ -0,0 +1,226 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// These tests capture from the vivid virtual V4L2 driver, they are skipped when no vivid device
+// is available. Load the driver with:
+//
+//   sudo modprobe vivid
+//
+// or set HOLOSCAN_TEST_V4L2_DEVICE to the path of the device to use.
+
+#include <fcntl.h>
+#include <gtest/gtest.h>
+#include <linux/videodev2.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gxf/core/entity.hpp"
+#include "gxf/multimedia/video.hpp"
+#include "holoscan/core/executor.hpp"
+#include "holoscan/core/fragment.hpp"
+#include "v4l2/v4l2_device.hpp"
+
+namespace nvidia {
+namespace holoscan {
+
+namespace {
+
+constexpr uint32_t kWidth = 640;
+constexpr uint32_t kHeight = 480;
+constexpr int kTimeoutMs = 2000;
+
+/// Returns the path of the first vivid capture device, or an empty string
+std::string FindVividDevice() {
+  if (const char* path = std::getenv("HOLOSCAN_TEST_V4L2_DEVICE")) { return path; }
+
+  for (int i = 0; i < 64; i++) {
+    const std::string path = "/dev/video" + std::to_string(i);
+    const int fd = open(path.c_str(), O_RDWR | O_NONBLOCK);
+    if (fd < 0) { continue; }
+    v4l2_capability caps = {};
+    const bool is_vivid_capture = ioctl(fd, VIDIOC_QUERYCAP, &caps) == 0 &&
+                                  std::strcmp(reinterpret_cast<char*>(caps.driver), "vivid") == 0 &&
+                                  (caps.device_caps & V4L2_CAP_VIDEO_CAPTURE);
+    close(fd);
+    if (is_vivid_capture) { return path; }
+  }
+  return {};
+}
+
+class V4L2DeviceTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    path_ = FindVividDevice();
+    if (path_.empty()) { GTEST_SKIP() << "No vivid V4L2 device"; }
+  }
+
+  std::string path_;
+};
+
+}  // namespace
+
+TEST(V4L2Device, ParseParameters) {
+  EXPECT_EQ(ParseV4L2PixelFormat("YUYV").value(), V4L2_PIX_FMT_YUYV);
+  EXPECT_EQ(ParseV4L2PixelFormat("NV12").value(), V4L2_PIX_FMT_NV12);
+  EXPECT_EQ(ParseV4L2PixelFormat("MJPG").value(), V4L2_PIX_FMT_MJPEG);
+  EXPECT_EQ(ParseV4L2PixelFormat("MJPEG").value(), V4L2_PIX_FMT_MJPEG);
+  EXPECT_EQ(ParseV4L2PixelFormat("GREY").value(), V4L2_PIX_FMT_GREY);
+  EXPECT_FALSE(ParseV4L2PixelFormat("RGB3"));
+
+  EXPECT_EQ(ParseV4L2Memory("mmap").value(), V4L2Memory::kMmap);
+  EXPECT_EQ(ParseV4L2Memory("userptr").value(), V4L2Memory::kUserPtr);
+  EXPECT_FALSE(ParseV4L2Memory("dmabuf"));
+}
+
+TEST_F(V4L2DeviceTest, Formats) {
+  const struct {
+    uint32_t pixel_format;
+    uint32_t min_bytes_per_line;
+    uint32_t min_size;
+  } formats[] = {{V4L2_PIX_FMT_YUYV, kWidth * 2, kWidth * 2 * kHeight},
+                 {V4L2_PIX_FMT_NV12, kWidth, kWidth * kHeight * 3 / 2},
+                 {V4L2_PIX_FMT_GREY, kWidth, kWidth * kHeight}};
+  for (const auto& format : formats) {
+    for (auto memory : {V4L2Memory::kMmap, V4L2Memory::kUserPtr}) {
+      V4L2Device device;
+      ASSERT_TRUE(device.open(path_, kWidth, kHeight, format.pixel_format, memory, 3, 2));
+      EXPECT_EQ(device.pixelFormat(), format.pixel_format);
+      EXPECT_EQ(device.width(), kWidth);
+      EXPECT_EQ(device.height(), kHeight);
+      EXPECT_GE(device.bytesPerLine(), format.min_bytes_per_line);
+      EXPECT_GE(device.sizeImage(), format.min_size);
+
+      for (int i = 0; i < 4; i++) {
+        V4L2Frame frame;
+        auto dequeued = device.dequeue(kTimeoutMs, &frame);
+        ASSERT_TRUE(dequeued);
+        ASSERT_TRUE(dequeued.value()) << "No frame captured in " << kTimeoutMs << " ms";
+        EXPECT_NE(frame.data, nullptr);
+        EXPECT_GE(frame.bytes_used, format.min_size);
+        ASSERT_TRUE(device.queue(frame.index));
+      }
+      EXPECT_TRUE(device.stop());
+    }
+  }
+}
+
+TEST_F(V4L2DeviceTest, UnsupportedFormat) {
+  // vivid does not capture compressed formats
+  V4L2Device device;
+  EXPECT_FALSE(
+      device.open(path_, kWidth, kHeight, V4L2_PIX_FMT_MJPEG, V4L2Memory::kMmap, 2, 1));
+}
+
+TEST_F(V4L2DeviceTest, InFlightBuffers) {
+  V4L2Device device;
+  // more in-flight buffers than allowed, the driver keeps one buffer
+  ASSERT_TRUE(device.open(path_, kWidth, kHeight, V4L2_PIX_FMT_YUYV, V4L2Memory::kMmap, 3, 5));
+  ASSERT_EQ(device.numBuffers(), 3);
+  ASSERT_EQ(device.maxInFlight(), 2);
+
+  std::vector<V4L2Frame> frames(2);
+  for (auto& frame : frames) {
+    auto dequeued = device.dequeue(kTimeoutMs, &frame);
+    ASSERT_TRUE(dequeued && dequeued.value());
+  }
+  EXPECT_EQ(device.inFlight(), 2);
+  EXPECT_NE(frames[0].index, frames[1].index);
+
+  // the limit is reached, dequeue returns without a frame once the timeout expires
+  V4L2Frame frame;
+  auto dequeued = device.dequeue(10, &frame);
+  ASSERT_TRUE(dequeued);
+  EXPECT_FALSE(dequeued.value());
+
+  // returning a buffer lets the capture continue, with the held buffer still valid
+  ASSERT_TRUE(device.queue(frames[0].index));
+  dequeued = device.dequeue(kTimeoutMs, &frame);
+  ASSERT_TRUE(dequeued && dequeued.value());
+  EXPECT_NE(frame.index, frames[1].index);
+  std::memset(frames[1].data, 0, frames[1].bytes_used);
+
+  // buffers released after the stream is stopped are not queued
+  EXPECT_TRUE(device.stop());
+  EXPECT_TRUE(device.queue(frames[1].index));
+  EXPECT_TRUE(device.queue(frame.index));
+  EXPECT_EQ(device.inFlight(), 0);
+  EXPECT_FALSE(device.queue(device.numBuffers()));
+}
+
+TEST_F(V4L2DeviceTest, WrappedFrame) {
+  ::holoscan::Fragment fragment;
+  const gxf_context_t context = fragment.executor().context();
+  ASSERT_NE(context, nullptr);
+
+  auto device = std::make_shared<V4L2Device>();
+  ASSERT_TRUE(device->open(path_, kWidth, kHeight, V4L2_PIX_FMT_YUYV, V4L2Memory::kMmap, 3, 1));
+
+  // Publishing copies the entity, the buffer is held by the copy once the source drops its own
+  std::optional<gxf::Entity> published;
+  V4L2Frame frame;
+  {
+    auto dequeued = device->dequeue(kTimeoutMs, &frame);
+    ASSERT_TRUE(dequeued && dequeued.value());
+    auto message = gxf::Entity::New(context);
+    ASSERT_TRUE(message);
+    auto video_buffer = message.value().add<gxf::VideoBuffer>();
+    ASSERT_TRUE(video_buffer);
+    ASSERT_TRUE(WrapV4L2Frame(device, frame, video_buffer.value().get()));
+
+    EXPECT_EQ(video_buffer.value()->pointer(), frame.data);
+    EXPECT_EQ(video_buffer.value()->storage_type(), gxf::MemoryStorageType::kSystem);
+    const auto info = video_buffer.value()->video_frame_info();
+    EXPECT_EQ(info.width, kWidth);
+    EXPECT_EQ(info.height, kHeight);
+    ASSERT_EQ(info.color_planes.size(), 1);
+    EXPECT_EQ(info.color_planes[0].stride, device->bytesPerLine());
+    published = message.value();
+  }
+  EXPECT_EQ(device->inFlight(), 1);
+
+  V4L2Frame next;
+  auto dequeued = device->dequeue(10, &next);
+  ASSERT_TRUE(dequeued);
+  EXPECT_FALSE(dequeued.value());
+
+  // A dequeue waiting for a buffer wakes up when the last copy of the entity is destroyed
+  std::thread consumer([&published] {
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    published.reset();
+  });
+  dequeued = device->dequeue(kTimeoutMs, &next);
+  consumer.join();
+  ASSERT_TRUE(dequeued);
+  ASSERT_TRUE(dequeued.value()) << "No buffer returned in " << kTimeoutMs << " ms";
+  EXPECT_EQ(device->inFlight(), 1);
+
+  ASSERT_TRUE(device->queue(next.index));
+  EXPECT_EQ(device->inFlight(), 0);
+  EXPECT_TRUE(device->stop());
+}
+
+}  // namespace holoscan
+}  // namespace nvidia
@@ -0,0 +1,178 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "utils/row_worker_pool.hpp"
+#include "v4l2/yuyv_to_rgba.hpp"
+
+namespace nvidia {
+namespace holoscan {
+
+namespace {
+
+constexpr YUVColorMatrix kColorMatrices[] = {YUVColorMatrix::kBT601Full,
+                                             YUVColorMatrix::kBT601Limited,
+                                             YUVColorMatrix::kBT709Full,
+                                             YUVColorMatrix::kBT709Limited};
+
+// Scalar floating point conversion of one pixel, from the definition of the color matrices
+void ReferenceYUVToRGB(YUVColorMatrix matrix, int y, int cb, int cr, uint8_t* rgb) {
+  const bool is_bt709 =
+      matrix == YUVColorMatrix::kBT709Full || matrix == YUVColorMatrix::kBT709Limited;
+  const bool is_limited =
+      matrix == YUVColorMatrix::kBT601Limited || matrix == YUVColorMatrix::kBT709Limited;
+  const double kr = is_bt709 ? 0.2126 : 0.299;
+  const double kb = is_bt709 ? 0.0722 : 0.114;
+  const double kg = 1.0 - kr - kb;
+
+  const double luma = is_limited ? (y - 16) * 255.0 / 219.0 : y;
+  const double pb = is_limited ? (cb - 128) * 255.0 / 224.0 : cb - 128;
+  const double pr = is_limited ? (cr - 128) * 255.0 / 224.0 : cr - 128;
+
+  const double values[3] = {
+      luma + 2.0 * (1.0 - kr) * pr,
+      luma - 2.0 * kb * (1.0 - kb) / kg * pb - 2.0 * kr * (1.0 - kr) / kg * pr,
+      luma + 2.0 * (1.0 - kb) * pb};
+  for (int i = 0; i < 3; i++) {
+    rgb[i] = static_cast<uint8_t>(std::clamp(std::lround(values[i]), 0l, 255l));
+  }
+}
+
+void ReferenceYUYVToRGBA(YUVColorMatrix matrix, const uint8_t* yuyv, size_t yuyv_pitch,
+                         uint8_t* rgba, size_t rgba_pitch, uint32_t width, uint32_t height) {
+  for (uint32_t row = 0; row < height; row++) {
+    for (uint32_t x = 0; x < width; x++) {
+      const uint8_t* pair = yuyv + row * yuyv_pitch + (x / 2) * 4;
+      uint8_t* pixel = rgba + row * rgba_pitch + x * 4;
+      ReferenceYUVToRGB(matrix, pair[(x % 2) * 2], pair[1], pair[3], pixel);
+      pixel[3] = 255;
+    }
+  }
+}
+
+std::vector<uint8_t> RandomYUYV(size_t size) {
+  std::mt19937 generator(42);
+  std::uniform_int_distribution<int> distribution(0, 255);
+  std::vector<uint8_t> yuyv(size);
+  for (auto& value : yuyv) { value = static_cast<uint8_t>(distribution(generator)); }
+  return yuyv;
+}
+
+}  // namespace
+
+TEST(YUYVToRGBA, ParseColorMatrix) {
+  YUVColorMatrix matrix;
+  EXPECT_TRUE(ParseYUVColorMatrix("bt601_full", &matrix));
+  EXPECT_EQ(matrix, YUVColorMatrix::kBT601Full);
+  EXPECT_TRUE(ParseYUVColorMatrix("bt601_limited", &matrix));
+  EXPECT_EQ(matrix, YUVColorMatrix::kBT601Limited);
+  EXPECT_TRUE(ParseYUVColorMatrix("bt709_full", &matrix));
+  EXPECT_EQ(matrix, YUVColorMatrix::kBT709Full);
+  EXPECT_TRUE(ParseYUVColorMatrix("bt709_limited", &matrix));
+  EXPECT_EQ(matrix, YUVColorMatrix::kBT709Limited);
+  EXPECT_FALSE(ParseYUVColorMatrix("bt2020", &matrix));
+}
+
+TEST(YUYVToRGBA, Range) {
+  const struct {
+    YUVColorMatrix matrix;
+    uint8_t black;
+    uint8_t white;
+  } ranges[] = {{YUVColorMatrix::kBT601Full, 0, 255},
+                {YUVColorMatrix::kBT601Limited, 16, 235},
+                {YUVColorMatrix::kBT709Full, 0, 255},
+                {YUVColorMatrix::kBT709Limited, 16, 235}};
+  for (const auto& range : ranges) {
+    const uint8_t yuyv[] = {range.black, 128, range.white, 128};
+    uint8_t rgba[8] = {};
+    ConvertYUYVToRGBA(
+        yuyv, sizeof(yuyv), rgba, sizeof(rgba), 2, 0, 1, GetYUVToRGBCoefficients(range.matrix));
+
+    const uint8_t expected[] = {0, 0, 0, 255, 255, 255, 255, 255};
+    for (int i = 0; i < 8; i++) {
+      ASSERT_EQ(expected[i], rgba[i]) << "Failed at index: " << i;
+    }
+  }
+}
+
+TEST(YUYVToRGBA, MatchesReference) {
+  // an odd width and padded rows
+  for (uint32_t width : {1920u, 33u}) {
+    const uint32_t height = 17;
+    const size_t yuyv_pitch = (width + 1) / 2 * 4 + 12;
+    const size_t rgba_pitch = width * 4 + 20;
+    const std::vector<uint8_t> yuyv = RandomYUYV(yuyv_pitch * height);
+
+    for (auto matrix : kColorMatrices) {
+      std::vector<uint8_t> expected(rgba_pitch * height, 0x5a);
+      std::vector<uint8_t> rgba(rgba_pitch * height, 0x5a);
+      ReferenceYUYVToRGBA(matrix, yuyv.data(), yuyv_pitch, expected.data(), rgba_pitch, width,
+                          height);
+      ConvertYUYVToRGBA(yuyv.data(), yuyv_pitch, rgba.data(), rgba_pitch, width, 0, height,
+                        GetYUVToRGBCoefficients(matrix));
+
+      // the fixed-point results are within one of the rounded floating point results, the
+      // padding is not written
+      for (size_t i = 0; i < rgba.size(); i++) {
+        ASSERT_LE(std::abs(expected[i] - rgba[i]), 1)
+            << "Failed at index: " << i << ", width: " << width
+            << ", matrix: " << static_cast<int>(matrix);
+      }
+    }
+  }
+}
+
+TEST(YUYVToRGBA, RowWorkerPool) {
+  const uint32_t width = 640;
+  const uint32_t height = 61;
+  const std::vector<uint8_t> yuyv = RandomYUYV(width * 2 * height);
+  const auto coefficients = GetYUVToRGBCoefficients(YUVColorMatrix::kBT709Limited);
+
+  std::vector<uint8_t> expected(width * 4 * height);
+  ConvertYUYVToRGBA(
+      yuyv.data(), width * 2, expected.data(), width * 4, width, 0, height, coefficients);
+
+  for (size_t thread_count : {1, 2, 3, 8, 100}) {
+    RowWorkerPool pool(thread_count);
+    ASSERT_EQ(pool.threadCount(), thread_count);
+    // run several times to reuse the threads
+    for (int run = 0; run < 3; run++) {
+      std::vector<uint8_t> rgba(expected.size());
+      std::atomic<uint32_t> converted_rows{0};
+      pool.run(height, [&](size_t begin_row, size_t end_row) {
+        ConvertYUYVToRGBA(yuyv.data(), width * 2, rgba.data(), width * 4, width, begin_row,
+                          end_row, coefficients);
+        converted_rows += end_row - begin_row;
+      });
+      ASSERT_EQ(converted_rows, height) << "thread count: " << thread_count;
+      ASSERT_EQ(expected, rgba) << "thread count: " << thread_count;
+    }
+  }
+}
+
+}  // namespace holoscan
+}  // namespace nvidia
@@ -17,6 +17,31 @@
 
 #include "multiai_tests.hpp"
 
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+/// Number of heap allocations made through operator new, to check steady state allocations
+std::atomic<size_t> allocation_count{0};
+
+}  // namespace
+
+void* operator new(std::size_t size) {
+  allocation_count.fetch_add(1, std::memory_order_relaxed);
+  if (void* ptr = std::malloc(size == 0 ? 1 : size)) { return ptr; }
+  throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+  std::free(ptr);
+}
+
 void holoinfer_assert(const HoloInfer::InferStatus& status, const std::string& module,
                       const std::string& test_name, HoloInfer::holoinfer_code assert_type) {
   status.display_message();
@@ -47,6 +72,13 @@ HoloInfer::InferStatus create_specifications() {
                                                              enable_fp16,
                                                              input_on_cuda,
                                                              output_on_cuda);
+  multiai_specs_->inference_threads_ = inference_threads;
+  multiai_specs_->batch_size_ = batch_size;
+  multiai_specs_->batch_timeout_us_ = batch_timeout_us;
+  multiai_specs_->intra_op_threads_ = intra_op_threads;
+  multiai_specs_->parallel_execution_ = parallel_execution;
+  multiai_specs_->graph_optimization_level_ = graph_optimization_level;
+  multiai_specs_->optimized_model_cache_path_ = optimized_model_cache_path;
 
   holoscan_infer_context_ = std::make_unique<HoloInfer::InferContext>();
   auto status = holoscan_infer_context_->set_inference_params(multiai_specs_);
@@ -111,6 +143,26 @@ void parameter_test() {
   holoinfer_assert(status, test_module, test_name, HoloInfer::holoinfer_code::H_ERROR);
   inference_map.at("plax_chamber") = original_name;
 
+  std::map<std::string, std::vector<std::string>> inference_multi_map;
+  for (const auto& inference : inference_map) {
+    inference_multi_map[inference.first] = {inference.second};
+  }
+  inference_multi_map.at("plax_chamber").push_back("plax_cham_infer_1");
+  test_name = "inference_map check 3";
+  status = HoloInfer::multiai_inference_validity_check(
+      model_path_map, pre_processor_map, inference_multi_map, in_tensor_names, out_tensor_names);
+  holoinfer_assert(status, test_module, test_name, HoloInfer::holoinfer_code::H_ERROR);
+
+  auto multi_out_tensor_names = out_tensor_names;
+  multi_out_tensor_names.push_back("plax_cham_infer_1");
+  test_name = "inference_map with several outputs per model";
+  status = HoloInfer::multiai_inference_validity_check(model_path_map,
+                                                       pre_processor_map,
+                                                       inference_multi_map,
+                                                       in_tensor_names,
+                                                       multi_out_tensor_names);
+  holoinfer_assert(status, test_module, test_name, HoloInfer::holoinfer_code::H_SUCCESS);
+
   status = call_parameter_check();
   test_name = "Input parameter set check";
   holoinfer_assert(status, test_module, test_name, HoloInfer::holoinfer_code::H_SUCCESS);
@@ -190,9 +242,7 @@ HoloInfer::InferStatus prepare_for_inference() {
 
     db->host_buffer.resize(buffer_size);
     db->device_buffer->resize(buffer_size);
-
-    std::vector<float> data_in(buffer_size, 0);
-    db->host_buffer = std::move(data_in);
+    std::fill_n(db->host_buffer.data_as<float>(), buffer_size, 0.f);
 
     multiai_specs_->data_per_tensor_.insert({td.first, std::move(db)});
   }
@@ -275,6 +325,25 @@ void inference_tests() {
   status = do_inference();
   holoinfer_assert(status, test_module, test_name, HoloInfer::holoinfer_code::H_SUCCESS);
 
+  test_name = "TRT backend, Latency reported per model";
+  status = do_inference();
+  for (const auto& model : model_path_map) {
+    const auto& latencies = holoscan_infer_context_->get_latencies();
+    auto latency = latencies.find(model.first);
+    if (latency == latencies.end() || latency->second.count() == 0) {
+      status.set_code(HoloInfer::holoinfer_code::H_ERROR);
+    }
+  }
+  holoinfer_assert(status, test_module, test_name, HoloInfer::holoinfer_code::H_SUCCESS);
+
+  test_name = "TRT backend, Parallel inference on two threads";
+  inference_threads = 2;
+  status = prepare_for_inference();
+  status = do_mapping();
+  status = do_inference();
+  holoinfer_assert(status, test_module, test_name, HoloInfer::holoinfer_code::H_SUCCESS);
+  inference_threads = 0;
+
   test_name = "TRT backend, Basic sequential end-to-end cuda inference";
   parallel_inference = false;
   status = prepare_for_inference();
@@ -337,6 +406,104 @@ void inference_tests() {
   status = do_inference();
   holoinfer_assert(status, test_module, test_name, HoloInfer::holoinfer_code::H_SUCCESS);
 
+  test_name = "ONNX backend, Several inputs mapped by tensor name";
+  auto multi_input_map = pre_processor_map;
+  multi_input_map.at("plax_chamber").push_back("aortic_pre_proc");
+  HoloInfer::DataMap multi_input_data;
+  status = HoloInfer::map_data_to_model_from_tensor(
+      multi_input_map, multi_input_data, multiai_specs_->data_per_tensor_);
+  if (multi_input_data.find("plax_cham_pre_proc") == multi_input_data.end() ||
+      multi_input_data.find("plax_chamber") != multi_input_data.end()) {
+    status = HoloInfer::InferStatus(HoloInfer::holoinfer_code::H_ERROR, "Not keyed by tensor");
+  }
+  holoinfer_assert(status, test_module, test_name, HoloInfer::holoinfer_code::H_SUCCESS);
+
+  test_name = "ONNX backend, Input tensors not matching the model inputs";
+  multiai_specs_ = std::make_shared<HoloInfer::MultiAISpecs>(
+      backend, model_path_map, inference_map, is_engine_path, infer_on_cpu, parallel_inference,
+      enable_fp16, input_on_cuda, output_on_cuda);
+  multiai_specs_->input_tensor_map_ = multi_input_map;
+  holoscan_infer_context_ = std::make_unique<HoloInfer::InferContext>();
+  status = holoscan_infer_context_->set_inference_params(multiai_specs_);
+  holoinfer_assert(status, test_module, test_name, HoloInfer::holoinfer_code::H_ERROR);
+
+  test_name = "ONNX backend, Batched inference on CPU";
+  parallel_inference = true;
+  batch_size = 4;
+  batch_timeout_us = 1000;
+  status = prepare_for_inference();
+  status = do_mapping();
+  status = do_inference();
+  holoinfer_assert(status, test_module, test_name, HoloInfer::holoinfer_code::H_SUCCESS);
+
+  // Each context runs the models sequentially, and the leader of a shared model holds its request
+  // until the request of the other context joins the batch
+  test_name = "ONNX backend, Two contexts sharing the models";
+  parallel_inference = false;
+  batch_size = 2;
+  batch_timeout_us = 5'000'000;
+  status = prepare_for_inference();
+  status = do_mapping();
+  auto first_context = std::move(holoscan_infer_context_);
+  auto first_specs = std::move(multiai_specs_);
+  status = prepare_for_inference();
+  status = do_mapping();
+  HoloInfer::InferStatus first_status;
+  auto start = std::chrono::steady_clock::now();
+  std::thread first_thread([&]() {
+    first_status = first_context->execute_inference(first_specs->data_per_model_,
+                                                    first_specs->output_per_model_);
+  });
+  status = do_inference();
+  first_thread.join();
+  if (first_status.get_code() != HoloInfer::holoinfer_code::H_SUCCESS) { status = first_status; }
+  if (std::chrono::steady_clock::now() - start >= std::chrono::microseconds(batch_timeout_us)) {
+    status = HoloInfer::InferStatus(HoloInfer::holoinfer_code::H_ERROR, "Batch timed out");
+  }
+  holoinfer_assert(status, test_module, test_name, HoloInfer::holoinfer_code::H_SUCCESS);
+  first_context.reset();
+  first_specs.reset();
+  batch_size = 1;
+  batch_timeout_us = 0;
+  parallel_inference = false;
+
+  test_name = "ONNX backend, Input buffer type not matching the model";
+  status = prepare_for_inference();
+  status = do_mapping();
+  multiai_specs_->data_per_model_.at("plax_chamber")->set_datatype(
+      HoloInfer::holoinfer_datatype::hUInt8);
+  status = do_inference();
+  holoinfer_assert(status, test_module, test_name, HoloInfer::holoinfer_code::H_ERROR);
+  multiai_specs_->data_per_model_.at("plax_chamber")->set_datatype(
+      HoloInfer::holoinfer_datatype::hFloat);
+
+  test_name = "ONNX backend, Unknown graph optimization level";
+  graph_optimization_level = "maximum";
+  status = prepare_for_inference();
+  holoinfer_assert(status, test_module, test_name, HoloInfer::holoinfer_code::H_ERROR);
+
+  test_name = "ONNX backend, Session options and optimized model saved to cache";
+  graph_optimization_level = "all";
+  intra_op_threads = 2;
+  parallel_execution = true;
+  optimized_model_cache_path = "onnx_model_cache";
+  std::filesystem::remove_all(optimized_model_cache_path);
+  status = prepare_for_inference();
+  status = do_mapping();
+  status = do_inference();
+  holoinfer_assert(status, test_module, test_name, HoloInfer::holoinfer_code::H_SUCCESS);
+
+  test_name = "ONNX backend, Optimized model loaded from cache";
+  status = prepare_for_inference();
+  status = do_mapping();
+  status = do_inference();
+  holoinfer_assert(status, test_module, test_name, HoloInfer::holoinfer_code::H_SUCCESS);
+  std::filesystem::remove_all(optimized_model_cache_path);
+  graph_optimization_level = "extended";
+  intra_op_threads = 1;
+  parallel_execution = false;
+  optimized_model_cache_path = "";
+
   if (is_x86_64) {
     test_name = "ONNX backend, Basic sequential inference on GPU";
     infer_on_cpu = false;
@@ -373,9 +540,364 @@ void inference_tests() {
   }
 }
 
+void data_type_tests() {
+  std::string test_module = "Data types";
+
+  std::string test_name = "Data buffer, Type change keeps the number of elements";
+  auto status = HoloInfer::InferStatus();
+  HoloInfer::DataBuffer db(HoloInfer::holoinfer_datatype::hUInt8);
+  db.host_buffer.resize(12);
+  db.set_datatype(HoloInfer::holoinfer_datatype::hInt64);
+  if (db.host_buffer.size() != 12 || db.host_buffer.get_bytes() != 96 ||
+      db.device_buffer->get_datatype() != HoloInfer::holoinfer_datatype::hInt64) {
+    status = HoloInfer::InferStatus(HoloInfer::holoinfer_code::H_ERROR, "Wrong buffer size");
+  }
+  holoinfer_assert(status, test_module, test_name, HoloInfer::holoinfer_code::H_SUCCESS);
+
+  test_name = "Data buffer, uint8 normalization to float32";
+  // Enough pixels to cover the vectorized blocks and the remainder
+  std::vector<uint8_t> pixels(3 * 101);
+  for (size_t i = 0; i < pixels.size(); i++) { pixels[i] = static_cast<uint8_t>(i * 7); }
+  std::vector<float> mean = {123.675f, 116.28f, 103.53f};
+  std::vector<float> std_dev = {58.395f, 57.12f, 57.375f};
+  std::vector<float> normalized(pixels.size());
+  status = HoloInfer::normalize_uint8_to_float(
+      pixels.data(), normalized.data(), pixels.size(), mean, std_dev);
+  for (size_t i = 0; i < pixels.size(); i++) {
+    float expected = (pixels[i] - mean[i % 3]) / std_dev[i % 3];
+    if (std::abs(normalized[i] - expected) > 1e-4f) {
+      status = HoloInfer::InferStatus(HoloInfer::holoinfer_code::H_ERROR, "Wrong value");
+    }
+  }
+  holoinfer_assert(status, test_module, test_name, HoloInfer::holoinfer_code::H_SUCCESS);
+
+  test_name = "Data buffer, Host buffer update reuses its storage";
+  HoloInfer::DataBuffer extracted;
+  std::vector<float> frame(12, 1.f);
+  status = HoloInfer::update_host_buffer(
+      extracted, frame.data(), HoloInfer::holoinfer_datatype::hFloat, frame.size(), false);
+  const void* storage = extracted.host_buffer.data();
+  std::fill(frame.begin(), frame.end(), 2.f);
+  if (status.get_code() == HoloInfer::holoinfer_code::H_SUCCESS) {
+    status = HoloInfer::update_host_buffer(
+        extracted, frame.data(), HoloInfer::holoinfer_datatype::hFloat, 8, false);
+  }
+  if (extracted.host_buffer.data() != storage || extracted.host_buffer.size() != 8 ||
+      extracted.host_buffer.data_as<float>()[7] != 2.f) {
+    status = HoloInfer::InferStatus(HoloInfer::holoinfer_code::H_ERROR, "Storage not reused");
+  }
+  holoinfer_assert(status, test_module, test_name, HoloInfer::holoinfer_code::H_SUCCESS);
+
+  test_name = "Data buffer, Host buffer update aliases the data";
+  status = HoloInfer::update_host_buffer(
+      extracted, frame.data(), HoloInfer::holoinfer_datatype::hFloat, frame.size(), true);
+  if (extracted.host_buffer.data() != frame.data() ||
+      extracted.host_buffer.size() != frame.size()) {
+    status = HoloInfer::InferStatus(HoloInfer::holoinfer_code::H_ERROR, "Data not aliased");
+  }
+  holoinfer_assert(status, test_module, test_name, HoloInfer::holoinfer_code::H_SUCCESS);
+
+  test_name = "Data buffer, Host buffer update normalizes uint8 data";
+  status = HoloInfer::update_host_buffer(extracted,
+                                         pixels.data(),
+                                         HoloInfer::holoinfer_datatype::hUInt8,
+                                         pixels.size(),
+                                         false,
+                                         mean,
+                                         std_dev);
+  if (extracted.host_buffer.get_datatype() != HoloInfer::holoinfer_datatype::hFloat ||
+      extracted.host_buffer.data() == pixels.data() ||
+      extracted.host_buffer.size() != pixels.size() ||
+      std::abs(extracted.host_buffer.data_as<float>()[4] - normalized[4]) > 1e-4f) {
+    status = HoloInfer::InferStatus(HoloInfer::holoinfer_code::H_ERROR, "Wrong normalization");
+  }
+  holoinfer_assert(status, test_module, test_name, HoloInfer::holoinfer_code::H_SUCCESS);
+
+  test_name = "Data buffer, Host buffer updates do not allocate after warm-up";
+  const std::vector<float> no_normalization;
+  const struct {
+    void* data;
+    HoloInfer::holoinfer_datatype type;
+    size_t count;
+    bool alias;
+    bool normalize;
+  } updates[] = {
+      {frame.data(), HoloInfer::holoinfer_datatype::hFloat, frame.size(), false, false},
+      {frame.data(), HoloInfer::holoinfer_datatype::hFloat, frame.size(), true, false},
+      {pixels.data(), HoloInfer::holoinfer_datatype::hUInt8, pixels.size(), false, true}};
+  status = HoloInfer::InferStatus();
+  for (const auto& update : updates) {
+    HoloInfer::DataBuffer buffer;
+    size_t allocations = 0;
+    for (int frame_index = 0; frame_index < 4; frame_index++) {
+      // The first frame is the warm-up
+      if (frame_index == 1) { allocations = allocation_count.load(); }
+      auto update_status =
+          HoloInfer::update_host_buffer(buffer,
+                                        update.data,
+                                        update.type,
+                                        update.count,
+                                        update.alias,
+                                        update.normalize ? mean : no_normalization,
+                                        update.normalize ? std_dev : no_normalization);
+      if (update_status.get_code() != HoloInfer::holoinfer_code::H_SUCCESS) {
+        status = update_status;
+      }
+    }
+    if (allocation_count.load() != allocations) {
+      status = HoloInfer::InferStatus(HoloInfer::holoinfer_code::H_ERROR,
+                                      "Allocation after warm-up");
+    }
+  }
+  holoinfer_assert(status, test_module, test_name, HoloInfer::holoinfer_code::H_SUCCESS);
+
+  test_name = "Data buffer, Normalization with mean and std of different sizes";
+  std_dev.pop_back();
+  status = HoloInfer::normalize_uint8_to_float(
+      pixels.data(), normalized.data(), pixels.size(), mean, std_dev);
+  holoinfer_assert(status, test_module, test_name, HoloInfer::holoinfer_code::H_ERROR);
+}
+
+void processing_tests() {
+  std::string test_module = "Data processing";
+  HoloInfer::ProcessorContext processor;
+  HoloInfer::MultiMappings tensor_oper_map = {{"landmarks", {"max_per_channel_scaled"}}};
+  HoloInfer::Mappings in_out_tensor_map = {{"landmarks", "landmarks_scaled"}};
+  auto status = processor.initialize(tensor_oper_map);
+  holoinfer_assert(
+      status, test_module, "Processor initialization", HoloInfer::holoinfer_code::H_SUCCESS);
+
+  // Small outputs are processed on the calling thread, large ones by worker threads
+  for (int size : {16, 512}) {
+    std::string test_name = "Max per channel scaled, " + std::to_string(size) + "x" +
+                            std::to_string(size) + "x4";
+    HoloInfer::DataMap inferred_result_map = {
+        {"landmarks", std::make_shared<HoloInfer::DataBuffer>()}};
+    std::map<std::string, std::vector<int>> dims = {{"landmarks", {1, size, size, 4}}};
+    auto& result = inferred_result_map.at("landmarks")->host_buffer;
+    result.resize(size * size * 4);
+    float* data = result.data_as<float>();
+    std::fill_n(data, result.size(), -5.f);
+
+    // channel 1 has a single max, channel 2 equal maxima of which the first is reported
+    auto set = [&](int row, int col, int channel, float value) {
+      data[(row * size + col) * 4 + channel] = value;
+    };
+    set(size / 4, size / 2, 1, 3.f);
+    set(size / 2, 3, 2, 7.f);
+    set(size - 2, 1, 2, 7.f);
+    set(size - 1, size - 1, 3, 0.f);
+    set(size - 1, 2, 0, 100.f);
+
+    status = processor.process(tensor_oper_map, in_out_tensor_map, inferred_result_map, dims);
+    if (status.get_code() == HoloInfer::holoinfer_code::H_SUCCESS) {
+      const float s = static_cast<float>(size);
+      const std::vector<float> expected = {
+          0.f, 0.f, 0.25f, 0.5f, 0.5f, 3 / s, (s - 1) / s, (s - 1) / s};
+      const auto& processed = processor.get_processed_data().at("landmarks_scaled")->host_buffer;
+      if (processed.size() != expected.size() ||
+          !std::equal(expected.begin(), expected.end(), processed.data_as<float>())) {
+        status = HoloInfer::InferStatus(HoloInfer::holoinfer_code::H_ERROR, "Wrong locations");
+      }
+    }
+    holoinfer_assert(status, test_module, test_name, HoloInfer::holoinfer_code::H_SUCCESS);
+  }
+
+  // Runs operations on a tensor, returning the output or an empty vector on error
+  auto run_operations = [&](const std::vector<std::string>& operations,
+                            const std::vector<int>& in_dims,
+                            const std::vector<float>& in_data,
+                            std::vector<int64_t>& out_dims) {
+    HoloInfer::ProcessorContext context;
+    HoloInfer::MultiMappings oper_map = {{"scores", operations}};
+    HoloInfer::Mappings out_map = {{"scores", "scores_processed"}};
+    HoloInfer::DataMap result_map = {{"scores", std::make_shared<HoloInfer::DataBuffer>()}};
+    auto& result = result_map.at("scores")->host_buffer;
+    result.resize(in_data.size());
+    std::copy(in_data.begin(), in_data.end(), result.data_as<float>());
+    std::map<std::string, std::vector<int>> dims = {{"scores", in_dims}};
+
+    std::vector<float> out;
+    status = context.initialize(oper_map);
+    if (status.get_code() == HoloInfer::holoinfer_code::H_SUCCESS) {
+      status = context.process(oper_map, out_map, result_map, dims);
+    }
+    if (status.get_code() == HoloInfer::holoinfer_code::H_SUCCESS) {
+      const auto& processed = context.get_processed_data().at("scores_processed")->host_buffer;
+      out.assign(processed.data_as<float>(), processed.data_as<float>() + processed.size());
+      out_dims = context.get_processed_data_dims().at("scores");
+    }
+    return out;
+  };
+  auto expect = [&](const std::vector<float>& out,
+                    const std::vector<int64_t>& out_dims,
+                    const std::vector<float>& expected,
+                    const std::vector<int64_t>& expected_dims) {
+    bool equal = out.size() == expected.size() && out_dims == expected_dims;
+    for (size_t i = 0; equal && i < out.size(); i++) {
+      equal = std::abs(out[i] - expected[i]) < 1e-5f;
+    }
+    if (status.get_code() == HoloInfer::holoinfer_code::H_SUCCESS && !equal) {
+      status = HoloInfer::InferStatus(HoloInfer::holoinfer_code::H_ERROR, "Wrong output");
+    }
+  };
+
+  std::vector<int64_t> out_dims;
+  std::string test_name = "Operation chain, softmax and argmax";
+  auto out = run_operations({"softmax", "argmax"}, {2, 3}, {1, 3, 2, 0, -1, -2}, out_dims);
+  expect(out, out_dims, {1, 0}, {2});
+  holoinfer_assert(status, test_module, test_name, HoloInfer::holoinfer_code::H_SUCCESS);
+
+  test_name = "Operation chain, softmax";
+  const float e = std::exp(1.f);
+  out = run_operations({"softmax"}, {1, 2}, {1, 0}, out_dims);
+  expect(out, out_dims, {e / (e + 1), 1 / (e + 1)}, {1, 2});
+  holoinfer_assert(status, test_module, test_name, HoloInfer::holoinfer_code::H_SUCCESS);
+
+  test_name = "Operation chain, sigmoid, print and threshold";
+  out = run_operations({"sigmoid", "print", "threshold,0.5"}, {4}, {-2, 0, 1, 3}, out_dims);
+  expect(out, out_dims, {0, 1, 1, 1}, {4});
+  holoinfer_assert(status, test_module, test_name, HoloInfer::holoinfer_code::H_SUCCESS);
+
+  test_name = "Operation chain, top_k";
+  out = run_operations({"top_k,2"}, {1, 4}, {0.1f, 0.7f, 0.1f, 0.2f}, out_dims);
+  expect(out, out_dims, {1, 0.7f, 3, 0.2f}, {1, 2, 2});
+  holoinfer_assert(status, test_module, test_name, HoloInfer::holoinfer_code::H_SUCCESS);
+
+  test_name = "Operation chain, nms";
+  // the second box overlaps the first one, the last one is below the score threshold
+  out = run_operations({"nms,0.5,0.3"},
+                       {1, 4, 5},
+                       {0, 0, 10, 10, 0.8f, 1, 1, 10, 10, 0.9f, 20, 20, 30, 30, 0.6f,
+                        40, 40, 50, 50, 0.2f},
+                       out_dims);
+  expect(out, out_dims, {1, 1, 10, 10, 0.9f, 20, 20, 30, 30, 0.6f}, {1, 2, 5});
+  holoinfer_assert(status, test_module, test_name, HoloInfer::holoinfer_code::H_SUCCESS);
+
+  test_name = "Operation chain, resize_mask";
+  out = run_operations({"resize_mask,4,2"}, {1, 2, 2, 1}, {1, 2, 3, 4}, out_dims);
+  expect(out, out_dims, {1, 2, 1, 2, 3, 4, 3, 4}, {1, 4, 2, 1});
+  holoinfer_assert(status, test_module, test_name, HoloInfer::holoinfer_code::H_SUCCESS);
+
+  test_name = "Operation chain, Invalid argument";
+  run_operations({"threshold,high"}, {4}, {-2, 0, 1, 3}, out_dims);
+  holoinfer_assert(status, test_module, test_name, HoloInfer::holoinfer_code::H_ERROR);
+
+  test_name = "Operation chain, Unsupported operation";
+  run_operations({"median"}, {4}, {-2, 0, 1, 3}, out_dims);
+  holoinfer_assert(status, test_module, test_name, HoloInfer::holoinfer_code::H_ERROR);
+
+  test_name = "Operation chain, Registered operation";
+  status = HoloInfer::register_process_operation(
+      "scale",
+      [](const std::vector<std::string>& args, HoloInfer::ProcessOperation& operation) {
+        float factor = std::stof(args.at(0));
+        operation = [factor](auto& in_dims, auto& in_data, auto& out_dims, auto& out_data) {
+          out_data.resize(in_data.size());
+          for (size_t i = 0; i < in_data.size(); i++) {
+            out_data.template data_as<float>()[i] = in_data.template data_as<float>()[i] * factor;
+          }
+          out_dims = in_dims;
+          return HoloInfer::InferStatus();
+        };
+        return HoloInfer::InferStatus();
+      });
+  out = run_operations({"scale,2", "argmax"}, {3}, {1, 3, 2}, out_dims);
+  expect(out, out_dims, {1}, {1});
+  holoinfer_assert(status, test_module, test_name, HoloInfer::holoinfer_code::H_SUCCESS);
+
+  test_name = "Operation chain, Registered operation throwing on its arguments";
+  run_operations({"scale,twice"}, {3}, {1, 3, 2}, out_dims);
+  holoinfer_assert(status, test_module, test_name, HoloInfer::holoinfer_code::H_ERROR);
+
+  test_name = "Operation chain, Last operation without output";
+  out = run_operations({"scale,2", "print"}, {3}, {1, 3, 2}, out_dims);
+  expect(out, out_dims, {2, 6, 4}, {3});
+  holoinfer_assert(status, test_module, test_name, HoloInfer::holoinfer_code::H_SUCCESS);
+}
+
+struct TestRequest {
+  int64_t batch = 1;
+  bool done = false;
+};
+
+void batching_tests() {
+  std::string test_module = "Batching tests";
+  using Batcher = HoloInfer::RequestBatcher<TestRequest>;
+  const auto timeout = std::chrono::seconds(30);
+
+  // Sizes of the batches run, only written by the leader of the batcher
+  std::vector<int64_t> batches;
+  auto run = [&batches](std::vector<TestRequest*>& requests) {
+    int64_t batch = 0;
+    for (const auto* request : requests) { batch += request->batch; }
+    batches.push_back(batch);
+  };
+  auto check = [&batches](const std::vector<int64_t>& expected,
+                          std::chrono::steady_clock::time_point start) {
+    if (batches != expected) {
+      return HoloInfer::InferStatus(HoloInfer::holoinfer_code::H_ERROR,
+                                    "Unexpected batches: " + std::to_string(batches.size()));
+    }
+    if (std::chrono::steady_clock::now() - start >= std::chrono::seconds(10)) {
+      return HoloInfer::InferStatus(HoloInfer::holoinfer_code::H_ERROR, "Waited for the timeout");
+    }
+    return HoloInfer::InferStatus();
+  };
+
+  HoloInfer::InferStatus status;
+  std::string test_name = "Single user runs without waiting for the batch to fill";
+  {
+    Batcher batcher(4, timeout);
+    batcher.attach();
+    TestRequest request;
+    batches.clear();
+    auto start = std::chrono::steady_clock::now();
+    batcher.submit(request, run);
+    status = check({1}, start);
+    holoinfer_assert(status, test_module, test_name, HoloInfer::holoinfer_code::H_SUCCESS);
+  }
+
+  test_name = "Requests of two users run in one call";
+  {
+    Batcher batcher(2, timeout);
+    batcher.attach();
+    batcher.attach();
+    TestRequest requests[2];
+    batches.clear();
+    auto start = std::chrono::steady_clock::now();
+    std::thread other([&]() { batcher.submit(requests[1], run); });
+    batcher.submit(requests[0], run);
+    other.join();
+    status = check({2}, start);
+    holoinfer_assert(status, test_module, test_name, HoloInfer::holoinfer_code::H_SUCCESS);
+  }
+
+  test_name = "Detaching the other user stops the wait";
+  {
+    Batcher batcher(2, timeout);
+    batcher.attach();
+    batcher.attach();
+    TestRequest request;
+    batches.clear();
+    auto start = std::chrono::steady_clock::now();
+    std::thread other([&]() {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      batcher.detach();
+    });
+    batcher.submit(request, run);
+    other.join();
+    status = check({1}, start);
+    holoinfer_assert(status, test_module, test_name, HoloInfer::holoinfer_code::H_SUCCESS);
+  }
+}
+
 int main() {
   parameter_test();
   parameter_setup_test();
+  data_type_tests();
+  processing_tests();
+  batching_tests();
   inference_tests();
   clear_specs();
 
@@ -17,8 +17,15 @@
 #ifndef _TEST_HOLOSCAN_MULTIAI_H
 #define _TEST_HOLOSCAN_MULTIAI_H
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <filesystem>
 #include <string>
+#include <thread>
+#include <vector>
 
+#include <infer/request_batcher.hpp>
 #include "test_infer_settings.hpp"
 
 void holoinfer_assert(const HoloInfer::InferStatus& status, const std::string& module,
@@ -33,5 +40,8 @@ HoloInfer::InferStatus prepare_for_inference();
 HoloInfer::InferStatus do_mapping();
 HoloInfer::InferStatus do_inference();
 void inference_tests();
+void data_type_tests();
+void processing_tests();
+void batching_tests();
 
 #endif
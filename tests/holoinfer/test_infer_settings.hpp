@@ -52,6 +52,13 @@ std::map<std::string, std::string> inference_map = {{"plax_chamber", "plax_cham_
                                                     {"bmode_perspective", "bmode_infer"}};
 
 bool parallel_inference = true;
+size_t inference_threads = 0;
+size_t batch_size = 1;
+int64_t batch_timeout_us = 0;
+int32_t intra_op_threads = 1;
+bool parallel_execution = false;
+std::string graph_optimization_level = "extended";  // NOLINT
+std::string optimized_model_cache_path = "";        // NOLINT
 bool infer_on_cpu = false;
 bool enable_fp16 = false;
 bool input_on_cuda = true;
@@ -0,0 +1,540 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <cuda_runtime_api.h>
+#include <npp.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include <holoscan/operators/format_converter/format_converter_cpu.hpp>
+#include <holoscan/utils/row_worker_pool.hpp>
+
+namespace holoscan::ops::format_converter {
+
+namespace {
+
+constexpr int32_t kRows = 67;
+constexpr int32_t kColumns = 93;
+
+// NppiInterpolationMode values
+constexpr int32_t kNearest = 1;
+constexpr int32_t kLinear = 2;
+constexpr int32_t kCubic = 4;
+
+std::vector<uint8_t> random_image(int32_t rows, int32_t columns, int32_t channels,
+                                  uint32_t seed = 1) {
+  std::vector<uint8_t> image(static_cast<size_t>(rows) * columns * channels);
+  std::srand(seed);
+  for (auto& value : image) { value = static_cast<uint8_t>(std::rand() & 0xff); }
+  return image;
+}
+
+/// Smooth image, the interpolations and the chroma subsampling change its values only slightly
+std::vector<uint8_t> gradient_image(int32_t rows, int32_t columns, int32_t channels) {
+  std::vector<uint8_t> image(static_cast<size_t>(rows) * columns * channels);
+  for (int32_t y = 0; y < rows; y++) {
+    for (int32_t x = 0; x < columns; x++) {
+      for (int32_t c = 0; c < channels; c++) {
+        image[(static_cast<size_t>(y) * columns + x) * channels + c] =
+            static_cast<uint8_t>(20 + x * 160 / columns + y * 40 / rows + c * 10);
+      }
+    }
+  }
+  return image;
+}
+
+int32_t max_difference(const std::vector<uint8_t>& a, const std::vector<uint8_t>& b) {
+  EXPECT_EQ(a.size(), b.size());
+  int32_t difference = 0;
+  for (size_t i = 0; i < std::min(a.size(), b.size()); i++) {
+    difference = std::max(difference, std::abs(static_cast<int32_t>(a[i]) - b[i]));
+  }
+  return difference;
+}
+
+bool has_cuda_device() {
+  int device_count = 0;
+  return cudaGetDeviceCount(&device_count) == cudaSuccess && device_count > 0;
+}
+
+/// Device copy of a host buffer, for the comparisons with NPP
+template <typename T>
+class DeviceBuffer {
+ public:
+  explicit DeviceBuffer(size_t size) : size_(size) {
+    if (cudaMalloc(&data_, size_ * sizeof(T)) != cudaSuccess) {
+      throw std::runtime_error("cudaMalloc failed");
+    }
+  }
+  explicit DeviceBuffer(const std::vector<T>& host) : DeviceBuffer(host.size()) {
+    cudaMemcpy(data_, host.data(), size_ * sizeof(T), cudaMemcpyHostToDevice);
+  }
+  ~DeviceBuffer() { cudaFree(data_); }
+
+  T* data() { return static_cast<T*>(data_); }
+  std::vector<T> host() const {
+    std::vector<T> host(size_);
+    cudaMemcpy(host.data(), data_, size_ * sizeof(T), cudaMemcpyDeviceToHost);
+    return host;
+  }
+
+ private:
+  void* data_ = nullptr;
+  size_t size_;
+};
+
+}  // namespace
+
+TEST(FormatConverterCpu, SwapChannelsRGBToRGBA) {
+  const auto rgb = random_image(kRows, kColumns, 3);
+  std::vector<uint8_t> rgba(static_cast<size_t>(kRows) * kColumns * 4);
+
+  const int32_t order[4] = {2, 1, 0, kFillChannel};
+  RowWorkerPool row_worker_pool(4);
+  for (auto* pool : {static_cast<RowWorkerPool*>(nullptr), &row_worker_pool}) {
+    cpu_swap_channels(rgb.data(), 3, rgba.data(), 4, kRows, kColumns, order, 128, pool);
+    for (size_t i = 0; i < static_cast<size_t>(kRows) * kColumns; i++) {
+      ASSERT_EQ(rgba[4 * i], rgb[3 * i + 2]);
+      ASSERT_EQ(rgba[4 * i + 1], rgb[3 * i + 1]);
+      ASSERT_EQ(rgba[4 * i + 2], rgb[3 * i]);
+      ASSERT_EQ(rgba[4 * i + 3], 128);
+    }
+  }
+}
+
+TEST(FormatConverterCpu, SwapChannelsRGBAToRGB) {
+  const auto rgba = random_image(kRows, kColumns, 4);
+  std::vector<uint8_t> rgb(static_cast<size_t>(kRows) * kColumns * 3);
+
+  cpu_swap_channels(rgba.data(), 4, rgb.data(), 3, kRows, kColumns, nullptr);
+  for (size_t i = 0; i < static_cast<size_t>(kRows) * kColumns; i++) {
+    for (size_t c = 0; c < 3; c++) { ASSERT_EQ(rgb[3 * i + c], rgba[4 * i + c]); }
+  }
+
+  const int32_t order[3] = {3, 0, 1};
+  cpu_swap_channels(rgba.data(), 4, rgb.data(), 3, kRows, kColumns, order);
+  for (size_t i = 0; i < static_cast<size_t>(kRows) * kColumns; i++) {
+    for (size_t c = 0; c < 3; c++) { ASSERT_EQ(rgb[3 * i + c], rgba[4 * i + order[c]]); }
+  }
+}
+
+TEST(FormatConverterCpu, InvalidChannelOrder) {
+  const auto rgb = random_image(kRows, kColumns, 3);
+  std::vector<uint8_t> out(static_cast<size_t>(kRows) * kColumns * 3);
+  const int32_t order[3] = {0, 1, 3};
+  EXPECT_THROW(cpu_swap_channels(rgb.data(), 3, out.data(), 3, kRows, kColumns, order),
+               std::runtime_error);
+}
+
+TEST(FormatConverterCpu, Scale) {
+  const auto rgb = random_image(kRows, kColumns, 3);
+  const size_t size = rgb.size();
+  std::vector<float> scaled(size);
+  std::vector<uint8_t> restored(size);
+
+  RowWorkerPool row_worker_pool(4);
+  for (auto* pool : {static_cast<RowWorkerPool*>(nullptr), &row_worker_pool}) {
+    cpu_scale(rgb.data(), 3, scaled.data(), 3, kRows, kColumns, nullptr, -1.f, 1.f, pool);
+    for (size_t i = 0; i < size; i++) {
+      ASSERT_NEAR(scaled[i], -1.f + 2.f * rgb[i] / 255.f, 1e-5f);
+    }
+    cpu_scale(scaled.data(), 3, restored.data(), 3, kRows, kColumns, nullptr, -1.f, 1.f, pool);
+    ASSERT_EQ(restored, rgb);
+  }
+
+  // saturation
+  const std::vector<float> out_of_range = {-2.f, 2.f, 0.5f};
+  std::vector<uint8_t> saturated(3);
+  cpu_scale(out_of_range.data(), 3, saturated.data(), 3, 1, 1, nullptr, 0.f, 1.f);
+  EXPECT_EQ(saturated, (std::vector<uint8_t>{0, 255, 128}));
+}
+
+TEST(FormatConverterCpu, ScaleRGBAToFloat32) {
+  const auto rgba = random_image(kRows, kColumns, 4);
+  std::vector<float> scaled(static_cast<size_t>(kRows) * kColumns * 3);
+
+  const int32_t order[3] = {2, 1, 0};
+  cpu_scale(rgba.data(), 4, scaled.data(), 3, kRows, kColumns, order, 0.f, 1.f);
+  for (size_t i = 0; i < static_cast<size_t>(kRows) * kColumns; i++) {
+    for (size_t c = 0; c < 3; c++) {
+      ASSERT_NEAR(scaled[3 * i + c], rgba[4 * i + order[c]] / 255.f, 1e-6f);
+    }
+  }
+}
+
+TEST(FormatConverterCpu, ResizeNearest) {
+  const auto rgb = random_image(kRows, kColumns, 3);
+  std::vector<uint8_t> resized(static_cast<size_t>(kRows) * 2 * kColumns * 2 * 3);
+
+  cpu_resize(rgb.data(), kRows, kColumns, 3, resized.data(), kRows * 2, kColumns * 2, kNearest);
+  for (int32_t y = 0; y < kRows * 2; y++) {
+    for (int32_t x = 0; x < kColumns * 2; x++) {
+      for (int32_t c = 0; c < 3; c++) {
+        ASSERT_EQ(resized[(static_cast<size_t>(y) * kColumns * 2 + x) * 3 + c],
+                  rgb[(static_cast<size_t>(y / 2) * kColumns + x / 2) * 3 + c]);
+      }
+    }
+  }
+}
+
+TEST(FormatConverterCpu, ResizeLinear) {
+  // halving the size averages the pairs of pixels
+  const auto rgba = random_image(kRows * 2, kColumns * 2, 4);
+  std::vector<uint8_t> resized(static_cast<size_t>(kRows) * kColumns * 4);
+
+  cpu_resize(rgba.data(), kRows * 2, kColumns * 2, 4, resized.data(), kRows, kColumns, kLinear);
+  const size_t src_step = static_cast<size_t>(kColumns) * 2 * 4;
+  for (int32_t y = 0; y < kRows; y++) {
+    for (int32_t x = 0; x < kColumns; x++) {
+      for (int32_t c = 0; c < 4; c++) {
+        const size_t src = 2 * y * src_step + 2 * x * 4 + c;
+        const float mean =
+            (rgba[src] + rgba[src + 4] + rgba[src + src_step] + rgba[src + src_step + 4]) / 4.f;
+        ASSERT_NEAR(resized[(static_cast<size_t>(y) * kColumns + x) * 4 + c], mean, 0.51f);
+      }
+    }
+  }
+}
+
+TEST(FormatConverterCpu, ResizeConstant) {
+  const std::vector<uint8_t> constant(static_cast<size_t>(kRows) * kColumns * 3, 77);
+  for (int32_t mode : {kNearest, kLinear, kCubic, 5, 6, 7}) {
+    std::vector<uint8_t> resized(static_cast<size_t>(41) * 150 * 3);
+    cpu_resize(constant.data(), kRows, kColumns, 3, resized.data(), 41, 150, mode);
+    ASSERT_EQ(resized, std::vector<uint8_t>(resized.size(), 77)) << "mode " << mode;
+  }
+}
+
+TEST(FormatConverterCpu, ResizeWorkers) {
+  const auto rgb = random_image(kRows, kColumns, 3);
+  std::vector<uint8_t> expected(static_cast<size_t>(300) * 200 * 3);
+  std::vector<uint8_t> resized(expected.size());
+  for (int32_t mode : {kNearest, kLinear, kCubic}) {
+    cpu_resize(rgb.data(), kRows, kColumns, 3, expected.data(), 300, 200, mode);
+    // 3 splits the rows unevenly, 16 gives each thread its own row buffer
+    for (size_t thread_count : {1u, 3u, 16u}) {
+      RowWorkerPool row_worker_pool(thread_count);
+      cpu_resize(rgb.data(), kRows, kColumns, 3, resized.data(), 300, 200, mode, &row_worker_pool);
+      ASSERT_EQ(resized, expected) << "mode " << mode << ", " << thread_count << " threads";
+    }
+  }
+}
+
+TEST(FormatConverterCpu, ResizeUnsupportedMode) {
+  EXPECT_FALSE(cpu_resize_mode_supported(8));
+  EXPECT_FALSE(cpu_resize_mode_supported(16));
+  const std::vector<uint8_t> rgb(3 * 4 * 4);
+  std::vector<uint8_t> resized(3 * 2 * 2);
+  EXPECT_THROW(cpu_resize(rgb.data(), 4, 4, 3, resized.data(), 2, 2, 16), std::runtime_error);
+}
+
+TEST(FormatConverterCpu, PreprocessMatchesChain) {
+  // 300 output columns make three tiles, the last one partial
+  constexpr int32_t kDstRows = 45;
+  constexpr int32_t kDstColumns = 300;
+  const auto rgba = random_image(kRows, kColumns, 4);
+  const int32_t order[3] = {2, 1, 0};
+  const float mean[3] = {0.485f, 0.456f, 0.406f};
+  const float std_dev[3] = {0.229f, 0.224f, 0.225f};
+  float factors[3];
+  float offsets[3];
+  for (int32_t c = 0; c < 3; c++) {
+    factors[c] = 1.f / 255.f / std_dev[c];
+    offsets[c] = -mean[c] / std_dev[c];
+  }
+
+  const size_t pixels = static_cast<size_t>(kDstRows) * kDstColumns;
+  std::vector<uint8_t> resized(pixels * 4);
+  std::vector<float> scaled(pixels * 3);
+  std::vector<float> fused(pixels * 3);
+  for (int32_t mode : {kNearest, kLinear, kCubic, 5}) {
+    cpu_resize(rgba.data(), kRows, kColumns, 4, resized.data(), kDstRows, kDstColumns, mode);
+    cpu_scale(resized.data(), 4, scaled.data(), 3, kDstRows, kDstColumns, order, 0.f, 1.f);
+
+    for (bool planar : {false, true}) {
+      cpu_preprocess(rgba.data(), kRows, kColumns, 4, fused.data(), kDstRows, kDstColumns, 3,
+                     order, factors, offsets, planar, mode);
+      for (size_t i = 0; i < pixels; i++) {
+        for (size_t c = 0; c < 3; c++) {
+          const float expected = (scaled[3 * i + c] - mean[c]) / std_dev[c];
+          const float value = planar ? fused[c * pixels + i] : fused[3 * i + c];
+          // the chain rounds the resized values to 8 bits
+          ASSERT_NEAR(value, expected, 0.51f * factors[c])
+              << "mode " << mode << ", planar " << planar << ", pixel " << i;
+        }
+      }
+    }
+  }
+}
+
+TEST(FormatConverterCpu, PreprocessWithoutResize) {
+  // every output value is an input value, whatever the resize mode
+  const auto rgb = random_image(kRows, kColumns, 3);
+  const float factors[3] = {2.f, 2.f, 2.f};
+  const float offsets[3] = {-1.f, -1.f, -1.f};
+  std::vector<float> fused(rgb.size());
+  RowWorkerPool row_worker_pool(3);
+  for (auto* pool : {static_cast<RowWorkerPool*>(nullptr), &row_worker_pool}) {
+    cpu_preprocess(rgb.data(), kRows, kColumns, 3, fused.data(), kRows, kColumns, 3, nullptr,
+                   factors, offsets, false, kCubic, pool);
+    for (size_t i = 0; i < rgb.size(); i++) {
+      ASSERT_EQ(fused[i], rgb[i] * 2.f - 1.f) << "value " << i;
+    }
+  }
+}
+
+TEST(FormatConverterCpu, PreprocessWorkers) {
+  const auto rgb = random_image(kRows, kColumns, 3);
+  const float factors[3] = {1.f, 1.f, 1.f};
+  const float offsets[3] = {0.f, 0.f, 0.f};
+  std::vector<float> expected(static_cast<size_t>(300) * 200 * 3);
+  std::vector<float> fused(expected.size());
+  cpu_preprocess(rgb.data(), kRows, kColumns, 3, expected.data(), 300, 200, 3, nullptr, factors,
+                 offsets, true, kLinear);
+  for (size_t thread_count : {1u, 3u, 16u}) {
+    RowWorkerPool row_worker_pool(thread_count);
+    cpu_preprocess(rgb.data(), kRows, kColumns, 3, fused.data(), 300, 200, 3, nullptr, factors,
+                   offsets, true, kLinear, &row_worker_pool);
+    ASSERT_EQ(fused, expected) << thread_count << " threads";
+  }
+}
+
+TEST(FormatConverterCpu, PreprocessInvalidChannelOrder) {
+  const std::vector<uint8_t> rgb(3 * 4 * 4);
+  std::vector<float> out(4 * 2 * 2);
+  const float factors[4] = {1.f, 1.f, 1.f, 1.f};
+  const float offsets[4] = {0.f, 0.f, 0.f, 0.f};
+  const int32_t fill_order[4] = {0, 1, 2, kFillChannel};
+  EXPECT_THROW(cpu_preprocess(rgb.data(), 4, 4, 3, out.data(), 2, 2, 4, fill_order, factors,
+                              offsets, false, kLinear),
+               std::runtime_error);
+  const int32_t out_of_range_order[3] = {0, 1, 3};
+  EXPECT_THROW(cpu_preprocess(rgb.data(), 4, 4, 3, out.data(), 2, 2, 3, out_of_range_order,
+                              factors, offsets, false, kLinear),
+               std::runtime_error);
+}
+
+TEST(FormatConverterCpu, YUV420RoundTrip) {
+  constexpr int32_t kEvenRows = 64;
+  constexpr int32_t kEvenColumns = 96;
+  const auto rgb = gradient_image(kEvenRows, kEvenColumns, 3);
+
+  std::vector<uint8_t> y(kEvenRows * kEvenColumns);
+  std::vector<uint8_t> u(kEvenRows / 2 * kEvenColumns / 2);
+  std::vector<uint8_t> v(u.size());
+  uint8_t* yuv[3] = {y.data(), u.data(), v.data()};
+  const int32_t steps[3] = {kEvenColumns, kEvenColumns / 2, kEvenColumns / 2};
+  cpu_rgb_to_yuv420(rgb.data(), kEvenRows, kEvenColumns, yuv, steps);
+
+  std::vector<uint8_t> rgba(static_cast<size_t>(kEvenRows) * kEvenColumns * 4);
+  const uint8_t* const_yuv[3] = {y.data(), u.data(), v.data()};
+  cpu_yuv420_to_rgb(const_yuv, steps, rgba.data(), 4, kEvenRows, kEvenColumns);
+
+  std::vector<uint8_t> rgb_out(rgb.size());
+  cpu_swap_channels(rgba.data(), 4, rgb_out.data(), 3, kEvenRows, kEvenColumns, nullptr);
+  EXPECT_LE(max_difference(rgb_out, rgb), 12);
+  for (size_t i = 0; i < static_cast<size_t>(kEvenRows) * kEvenColumns; i++) {
+    ASSERT_EQ(rgba[4 * i + 3], 255);
+  }
+}
+
+TEST(FormatConverterCpu, YUV420Gray) {
+  // gray pixels have no chroma, odd sizes have a partial last chroma block
+  const std::vector<uint8_t> rgb(static_cast<size_t>(kRows) * kColumns * 3, 100);
+  const int32_t steps[3] = {kColumns, (kColumns + 1) / 2, (kColumns + 1) / 2};
+  std::vector<uint8_t> y(static_cast<size_t>(kRows) * steps[0]);
+  std::vector<uint8_t> u(static_cast<size_t>((kRows + 1) / 2) * steps[1]);
+  std::vector<uint8_t> v(u.size());
+  uint8_t* yuv[3] = {y.data(), u.data(), v.data()};
+  cpu_rgb_to_yuv420(rgb.data(), kRows, kColumns, yuv, steps);
+  EXPECT_EQ(y, std::vector<uint8_t>(y.size(), 100));
+  EXPECT_EQ(u, std::vector<uint8_t>(u.size(), 128));
+  EXPECT_EQ(v, std::vector<uint8_t>(v.size(), 128));
+}
+
+TEST(FormatConverterCpu, NV12ToRGB709) {
+  // BT.709 limited range: Y = 16 is black and Y = 235 is white
+  constexpr int32_t kNV12Rows = 4;
+  constexpr int32_t kNV12Columns = 6;
+  std::vector<uint8_t> nv12(kNV12Rows * kNV12Columns * 3 / 2, 128);
+  for (int32_t x = 0; x < kNV12Columns; x++) {
+    for (int32_t row = 0; row < kNV12Rows; row++) {
+      nv12[row * kNV12Columns + x] = x < kNV12Columns / 2 ? 16 : 235;
+    }
+  }
+  std::vector<uint8_t> rgb(kNV12Rows * kNV12Columns * 3);
+  cpu_nv12_to_rgb_709hdtv(nv12.data(),
+                          nv12.data() + kNV12Rows * kNV12Columns,
+                          kNV12Columns,
+                          rgb.data(),
+                          kNV12Rows,
+                          kNV12Columns);
+  for (int32_t row = 0; row < kNV12Rows; row++) {
+    for (int32_t x = 0; x < kNV12Columns; x++) {
+      for (int32_t c = 0; c < 3; c++) {
+        EXPECT_EQ(rgb[(row * kNV12Columns + x) * 3 + c], x < kNV12Columns / 2 ? 0 : 255);
+      }
+    }
+  }
+}
+
+// Comparisons with the NPP functions used for inputs in device memory, skipped without a GPU
+
+TEST(FormatConverterCpu, ResizeMatchesNpp) {
+  if (!has_cuda_device()) { GTEST_SKIP() << "No CUDA device"; }
+
+  const auto rgb = gradient_image(kRows, kColumns, 3);
+  const NppiSize src_size = {kColumns, kRows};
+  const NppiRect src_roi = {0, 0, kColumns, kRows};
+  for (const auto& dst_size : {NppiSize{160, 120}, NppiSize{50, 31}}) {
+    const NppiRect dst_roi = {0, 0, dst_size.width, dst_size.height};
+    for (int32_t mode : {kNearest, kLinear, kCubic}) {
+      std::vector<uint8_t> resized(static_cast<size_t>(dst_size.width) * dst_size.height * 3);
+      cpu_resize(
+          rgb.data(), kRows, kColumns, 3, resized.data(), dst_size.height, dst_size.width, mode);
+
+      DeviceBuffer<uint8_t> src(rgb);
+      DeviceBuffer<uint8_t> dst(resized.size());
+      ASSERT_EQ(nppiResize_8u_C3R(src.data(),
+                                  kColumns * 3,
+                                  src_size,
+                                  src_roi,
+                                  dst.data(),
+                                  dst_size.width * 3,
+                                  dst_size,
+                                  dst_roi,
+                                  mode),
+                NPP_SUCCESS);
+      EXPECT_LE(max_difference(resized, dst.host()), mode == kNearest ? 0 : 8)
+          << "mode " << mode << ", " << dst_size.width << "x" << dst_size.height;
+    }
+  }
+}
+
+TEST(FormatConverterCpu, ConversionsMatchNpp) {
+  if (!has_cuda_device()) { GTEST_SKIP() << "No CUDA device"; }
+
+  constexpr int32_t kEvenRows = 64;
+  constexpr int32_t kEvenColumns = 96;
+  const NppiSize roi = {kEvenColumns, kEvenRows};
+  const auto rgb = gradient_image(kEvenRows, kEvenColumns, 3);
+  const auto rgba = random_image(kEvenRows, kEvenColumns, 4);
+  const size_t pixels = static_cast<size_t>(kEvenRows) * kEvenColumns;
+
+  // uint8 -> float32
+  {
+    std::vector<float> scaled(pixels * 3);
+    cpu_scale(rgb.data(), 3, scaled.data(), 3, kEvenRows, kEvenColumns, nullptr, 0.f, 1.f);
+    DeviceBuffer<uint8_t> src(rgb);
+    DeviceBuffer<float> dst(scaled.size());
+    ASSERT_EQ(nppiScale_8u32f_C3R(src.data(),
+                                  kEvenColumns * 3,
+                                  dst.data(),
+                                  kEvenColumns * 3 * sizeof(float),
+                                  roi,
+                                  0.f,
+                                  1.f),
+              NPP_SUCCESS);
+    const auto expected = dst.host();
+    for (size_t i = 0; i < scaled.size(); i++) { ASSERT_NEAR(scaled[i], expected[i], 1e-5f); }
+
+    // float32 -> uint8
+    std::vector<uint8_t> restored(rgb.size());
+    cpu_scale(scaled.data(), 3, restored.data(), 3, kEvenRows, kEvenColumns, nullptr, 0.f, 1.f);
+    DeviceBuffer<uint8_t> restored_npp(rgb.size());
+    ASSERT_EQ(nppiScale_32f8u_C3R(dst.data(),
+                                  kEvenColumns * 3 * sizeof(float),
+                                  restored_npp.data(),
+                                  kEvenColumns * 3,
+                                  roi,
+                                  0.f,
+                                  1.f),
+              NPP_SUCCESS);
+    EXPECT_LE(max_difference(restored, restored_npp.host()), 1);
+  }
+
+  // rgba8888 -> rgb888
+  {
+    const int order[3] = {2, 1, 0};
+    std::vector<uint8_t> swapped(pixels * 3);
+    cpu_swap_channels(rgba.data(), 4, swapped.data(), 3, kEvenRows, kEvenColumns, order);
+    DeviceBuffer<uint8_t> src(rgba);
+    DeviceBuffer<uint8_t> dst(swapped.size());
+    ASSERT_EQ(
+        nppiSwapChannels_8u_C4C3R(
+            src.data(), kEvenColumns * 4, dst.data(), kEvenColumns * 3, roi, order),
+        NPP_SUCCESS);
+    EXPECT_EQ(swapped, dst.host());
+  }
+
+  // rgb888 -> yuv420 -> rgb888
+  {
+    const int32_t steps[3] = {kEvenColumns, kEvenColumns / 2, kEvenColumns / 2};
+    std::vector<uint8_t> yuv(pixels * 3 / 2);
+    uint8_t* yuv_planes[3] = {yuv.data(), yuv.data() + pixels, yuv.data() + pixels * 5 / 4};
+    cpu_rgb_to_yuv420(rgb.data(), kEvenRows, kEvenColumns, yuv_planes, steps);
+
+    DeviceBuffer<uint8_t> src(rgb);
+    DeviceBuffer<uint8_t> yuv_npp(yuv.size());
+    Npp8u* yuv_npp_planes[3] = {
+        yuv_npp.data(), yuv_npp.data() + pixels, yuv_npp.data() + pixels * 5 / 4};
+    int npp_steps[3] = {steps[0], steps[1], steps[2]};
+    ASSERT_EQ(
+        nppiRGBToYUV420_8u_C3P3R(src.data(), kEvenColumns * 3, yuv_npp_planes, npp_steps, roi),
+        NPP_SUCCESS);
+    EXPECT_LE(max_difference(yuv, yuv_npp.host()), 2);
+
+    std::vector<uint8_t> rgb_out(rgb.size());
+    const uint8_t* const_yuv_planes[3] = {yuv_planes[0], yuv_planes[1], yuv_planes[2]};
+    cpu_yuv420_to_rgb(const_yuv_planes, steps, rgb_out.data(), 3, kEvenRows, kEvenColumns);
+    DeviceBuffer<uint8_t> rgb_npp(rgb.size());
+    DeviceBuffer<uint8_t> yuv_in(yuv);
+    const Npp8u* yuv_in_planes[3] = {
+        yuv_in.data(), yuv_in.data() + pixels, yuv_in.data() + pixels * 5 / 4};
+    ASSERT_EQ(nppiYUV420ToRGB_8u_P3C3R(
+                  yuv_in_planes, npp_steps, rgb_npp.data(), kEvenColumns * 3, roi),
+              NPP_SUCCESS);
+    EXPECT_LE(max_difference(rgb_out, rgb_npp.host()), 2);
+  }
+
+  // nv12 -> rgb888
+  {
+    const auto nv12 = random_image(kEvenRows * 3 / 2, kEvenColumns, 1);
+    std::vector<uint8_t> rgb_out(pixels * 3);
+    cpu_nv12_to_rgb_709hdtv(nv12.data(),
+                            nv12.data() + pixels,
+                            kEvenColumns,
+                            rgb_out.data(),
+                            kEvenRows,
+                            kEvenColumns);
+    DeviceBuffer<uint8_t> src(nv12);
+    DeviceBuffer<uint8_t> dst(rgb_out.size());
+    const Npp8u* planes[2] = {src.data(), src.data() + pixels};
+    ASSERT_EQ(nppiNV12ToRGB_709HDTV_8u_P2C3R(planes, kEvenColumns, dst.data(), kEvenColumns * 3,
+                                             roi),
+              NPP_SUCCESS);
+    EXPECT_LE(max_difference(rgb_out, dst.host()), 2);
+  }
+}
+
+}  // namespace holoscan::ops::format_converter
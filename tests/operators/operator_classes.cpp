@@ -44,6 +44,7 @@
 #include "holoscan/operators/holoviz/holoviz.hpp"
 #include "holoscan/operators/multiai_inference/multiai_inference.hpp"
 #include "holoscan/operators/multiai_postprocessor/multiai_postprocessor.hpp"
+#include "holoscan/operators/preprocessor/preprocessor.hpp"
 #include "holoscan/operators/segmentation_postprocessor/segmentation_postprocessor.hpp"
 #include "holoscan/operators/tensor_rt/tensor_rt_inference.hpp"
 #include "holoscan/operators/video_stream_recorder/video_stream_recorder.hpp"
@@ -160,6 +161,43 @@ TEST_F(OperatorClassesWithGXFContext, TestFormatConverterOp) {
   }
 }
 
+TEST_F(OperatorClassesWithGXFContext, TestPreprocessorOp) {
+  const std::string name{"preprocessor"};
+
+  ArgList args{
+      Arg{"in_tensor_name", "in"s},
+      Arg{"out_tensor_name", "out"s},
+      Arg{"resize_width", 640},
+      Arg{"resize_height", 480},
+      Arg{"resize_mode", 2},
+      Arg{"out_channel_order", std::vector<int>{{2, 1, 0}}},
+      Arg{"scale_min", 0.f},
+      Arg{"scale_max", 1.f},
+      Arg{"mean", std::vector<float>{{0.485f, 0.456f, 0.406f}}},
+      Arg{"std", std::vector<float>{{0.229f, 0.224f, 0.225f}}},
+      Arg{"out_layout", "chw"s},
+      Arg{"pool", F.make_resource<UnboundedAllocator>("pool")},
+  };
+  testing::internal::CaptureStderr();
+
+  auto op = F.make_operator<ops::PreprocessorOp>(name, args);
+  EXPECT_EQ(op->name(), name);
+  EXPECT_EQ(typeid(op), typeid(std::make_shared<ops::PreprocessorOp>(args)));
+
+  std::string log_output = testing::internal::GetCapturedStderr();
+  auto error_pos = log_output.find("[error]");
+  if (error_pos != std::string::npos) {
+    // Initializing a native operator outside the context of app.run() will result in the
+    // following error being logged because the GXFWrapper will not yet have been created for
+    // the operator:
+    //   [error] [gxf_executor.cpp:452] Unable to get GXFWrapper for Operator 'preprocessor'
+
+    // GXFWrapper was mentioned and no additional error was logged
+    EXPECT_TRUE(log_output.find("GXFWrapper", error_pos + 1) != std::string::npos);
+    EXPECT_TRUE(log_output.find("[error]", error_pos + 1) == std::string::npos);
+  }
+}
+
 TEST_F(OperatorClassesWithGXFContext, TestTensorRTInferenceOp) {
   const std::string name{"segmentation_inference"};
 
@@ -222,6 +260,8 @@ TEST_F(OperatorClassesWithGXFContext, TestVideoStreamReplayerOp) {
   auto op = F.make_operator<ops::VideoStreamReplayerOp>(name, args);
   EXPECT_EQ(op->name(), name);
   EXPECT_EQ(typeid(op), typeid(std::make_shared<ops::VideoStreamReplayerOp>(args)));
+  // Realtime playback is paced by a target time condition
+  EXPECT_EQ(op->conditions().count("target_time"), 1);
 
   std::string log_output = testing::internal::GetCapturedStderr();
   auto error_pos = log_output.find("[error]");
@@ -237,6 +277,24 @@ TEST_F(OperatorClassesWithGXFContext, TestVideoStreamReplayerOp) {
   }
 }
 
+TEST_F(OperatorClassesWithGXFContext, TestVideoStreamReplayerOpNotRealtime) {
+  const std::string name{"replayer"};
+  const std::string sample_data_path = std::string(std::getenv("HOLOSCAN_SAMPLE_DATA_PATH"));
+  ArgList args{
+      Arg{"directory", sample_data_path + "/endoscopy/video"s},
+      Arg{"basename", "surgical_video"s},
+      Arg{"realtime", false},
+  };
+  testing::internal::CaptureStderr();
+
+  auto op = F.make_operator<ops::VideoStreamReplayerOp>(name, args);
+
+  // Without pacing, the replayer keeps its previous scheduling
+  EXPECT_EQ(op->conditions().count("target_time"), 0);
+
+  testing::internal::GetCapturedStderr();
+}
+
 TEST_F(OperatorClassesWithGXFContext, TestSegmentationPostprocessorOp) {
   const std::string name{"segmentation_postprocessor"};
 
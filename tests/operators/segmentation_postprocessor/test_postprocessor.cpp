@@ -20,7 +20,12 @@
 #include <cuda.h>
 #include <cuda_runtime_api.h>
 
+#include <iterator>
+#include <memory>
+#include <vector>
+
 #include <holoscan/operators/segmentation_postprocessor/segmentation_postprocessor.cuh>
+#include <holoscan/utils/row_worker_pool.hpp>
 
 // This test data is generated in python as follows:
 //
@@ -168,3 +173,110 @@ TEST(SegmentationPostprocessor, Argmax) {
     ASSERT_EQ(kArgmaxOutputData[i], host_output_data[i]) << "Failed at index: " << i;
   }
 }
+
+namespace {
+
+constexpr holoscan::ops::segmentation_postprocessor::Shape kArgmaxShape = {19, 10, 5};
+
+std::vector<float> argmax_input_data(holoscan::ops::segmentation_postprocessor::DataFormat format) {
+  const auto shape = kArgmaxShape;
+  std::vector<float> data(std::begin(kArgmaxInputData), std::end(kArgmaxInputData));
+  if (format == holoscan::ops::segmentation_postprocessor::DataFormat::kNCHW) {
+    for (int32_t y = 0; y < shape.height; y++) {
+      for (int32_t x = 0; x < shape.width; x++) {
+        for (int32_t c = 0; c < shape.channels; c++) {
+          data[(c * shape.height + y) * shape.width + x] =
+              kArgmaxInputData[(y * shape.width + x) * shape.channels + c];
+        }
+      }
+    }
+  }
+  return data;
+}
+
+}  // namespace
+
+TEST(SegmentationPostprocessor, CpuArgmax) {
+  using holoscan::ops::segmentation_postprocessor::DataFormat;
+  using holoscan::ops::segmentation_postprocessor::output_type_t;
+
+  const auto shape = kArgmaxShape;
+  ASSERT_EQ(sizeof(kArgmaxOutputData), shape.height * shape.width * sizeof(output_type_t));
+
+  for (auto format : {DataFormat::kHWC, DataFormat::kNHWC, DataFormat::kNCHW}) {
+    const std::vector<float> input_data = argmax_input_data(format);
+    // 0 runs on the calling thread, 4 splits the rows unevenly, 32 is more than the row count
+    for (size_t thread_count : {0u, 1u, 4u, 32u}) {
+      auto row_worker_pool =
+          thread_count ? std::make_unique<holoscan::RowWorkerPool>(thread_count) : nullptr;
+      std::vector<output_type_t> output_data(sizeof(kArgmaxOutputData), 0xff);
+      holoscan::ops::segmentation_postprocessor::cpu_postprocess(
+          holoscan::ops::segmentation_postprocessor::NetworkOutputType::kSoftmax,
+          format,
+          shape,
+          input_data.data(),
+          output_data.data(),
+          row_worker_pool.get());
+
+      for (uint32_t i = 0; i < output_data.size(); i++) {
+        ASSERT_EQ(kArgmaxOutputData[i], output_data[i])
+            << "Failed at index: " << i << ", format: " << format
+            << ", thread count: " << thread_count;
+      }
+    }
+  }
+}
+
+TEST(SegmentationPostprocessor, CpuArgmaxNegative) {
+  using holoscan::ops::segmentation_postprocessor::output_type_t;
+
+  // same as the CUDA kernel, channel 0 is selected when no value is larger than 0
+  const holoscan::ops::segmentation_postprocessor::Shape shape = {1, 3, 3};
+  const float input_data[] = {-3.f, -1.f, -2.f, -1.f, 2.f, 2.f, 0.f, 0.f, 1.f};
+  const output_type_t expected_data[] = {0, 1, 2};
+  output_type_t output_data[3] = {};
+
+  holoscan::ops::segmentation_postprocessor::cpu_postprocess(
+      holoscan::ops::segmentation_postprocessor::NetworkOutputType::kSoftmax,
+      holoscan::ops::segmentation_postprocessor::DataFormat::kHWC,
+      shape,
+      input_data,
+      output_data);
+
+  for (uint32_t i = 0; i < 3; i++) {
+    ASSERT_EQ(expected_data[i], output_data[i]) << "Failed at index: " << i;
+  }
+}
+
+TEST(SegmentationPostprocessor, CpuSigmoid) {
+  using holoscan::ops::segmentation_postprocessor::DataFormat;
+  using holoscan::ops::segmentation_postprocessor::output_type_t;
+
+  // a one channel network output, thresholded at 0.5
+  holoscan::ops::segmentation_postprocessor::Shape shape = kArgmaxShape;
+  shape.width = shape.width * shape.channels;
+  shape.channels = 1;
+  std::vector<float> input_data(std::begin(kArgmaxInputData), std::end(kArgmaxInputData));
+  for (size_t i = 0; i < input_data.size(); i++) { input_data[i] = input_data[i] * 2.f + 0.3f; }
+
+  // the pool is reused for every format, like by the operator from one frame to the next
+  holoscan::RowWorkerPool row_worker_pool(4);
+  for (auto format : {DataFormat::kHWC, DataFormat::kNHWC, DataFormat::kNCHW}) {
+    for (auto* pool : {static_cast<holoscan::RowWorkerPool*>(nullptr), &row_worker_pool}) {
+      std::vector<output_type_t> output_data(input_data.size(), 0xff);
+      holoscan::ops::segmentation_postprocessor::cpu_postprocess(
+          holoscan::ops::segmentation_postprocessor::NetworkOutputType::kSigmoid,
+          format,
+          shape,
+          input_data.data(),
+          output_data.data(),
+          pool);
+
+      for (size_t i = 0; i < output_data.size(); i++) {
+        ASSERT_EQ(input_data[i] >= 0.5f ? 1 : 0, output_data[i])
+            << "Failed at index: " << i << ", format: " << format
+            << ", pool: " << (pool != nullptr);
+      }
+    }
+  }
+}
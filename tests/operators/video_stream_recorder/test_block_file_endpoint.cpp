@@ -0,0 +1,104 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <holoscan/operators/video_stream_recorder/block_file_endpoint.hpp>
+
+namespace holoscan::ops {
+
+namespace {
+
+std::vector<uint8_t> read_file(const std::string& filename) {
+  std::ifstream file(filename, std::ios::binary);
+  return std::vector<uint8_t>(std::istreambuf_iterator<char>(file),
+                              std::istreambuf_iterator<char>());
+}
+
+// Write `count` bytes following a simple pattern, in chunks of `chunk` bytes.
+std::vector<uint8_t> write_pattern(BlockFileEndpoint& endpoint, size_t count, size_t chunk) {
+  std::vector<uint8_t> data(count);
+  for (size_t i = 0; i < count; ++i) { data[i] = static_cast<uint8_t>(i * 7 + 3); }
+  for (size_t offset = 0; offset < count; offset += chunk) {
+    size_t bytes_written = 0;
+    const size_t size = std::min(chunk, count - offset);
+    EXPECT_EQ(endpoint.write_abi(data.data() + offset, size, &bytes_written), GXF_SUCCESS);
+    EXPECT_EQ(bytes_written, size);
+  }
+  return data;
+}
+
+}  // namespace
+
+class BlockFileEndpointTest : public ::testing::TestWithParam<bool> {};
+
+TEST_P(BlockFileEndpointTest, TestWritesCoalescedBlocks) {
+  const std::string filename = ::testing::TempDir() + "block_file_endpoint.bin";
+  BlockFileEndpoint endpoint;
+  ASSERT_TRUE(endpoint.open(filename, 10000, GetParam()));
+  ASSERT_TRUE(endpoint.is_open());
+
+  // the block size is rounded up to the alignment, and chunks straddle blocks
+  auto expected = write_pattern(endpoint, 50001, 333);
+  EXPECT_EQ(endpoint.size(), expected.size());
+
+  // flush in the middle of a block, then keep writing after it
+  ASSERT_TRUE(endpoint.flush());
+  auto more = write_pattern(endpoint, 1234, 100);
+  expected.insert(expected.end(), more.begin(), more.end());
+  ASSERT_TRUE(endpoint.sync());
+
+  ASSERT_TRUE(endpoint.close());
+  EXPECT_FALSE(endpoint.is_open());
+  EXPECT_EQ(read_file(filename), expected);
+}
+
+TEST_P(BlockFileEndpointTest, TestEmptyFile) {
+  const std::string filename = ::testing::TempDir() + "block_file_endpoint_empty.bin";
+  BlockFileEndpoint endpoint;
+  ASSERT_TRUE(endpoint.open(filename, 4096, GetParam()));
+  ASSERT_TRUE(endpoint.close());
+  EXPECT_TRUE(read_file(filename).empty());
+}
+
+INSTANTIATE_TEST_CASE_P(BlockFileEndpointTests, BlockFileEndpointTest,
+                        ::testing::Values(false, true));
+
+TEST(BlockFileEndpoint, TestClosedEndpoint) {
+  BlockFileEndpoint endpoint;
+  uint8_t data[4] = {};
+  size_t count = 0;
+  EXPECT_EQ(endpoint.write_abi(data, sizeof(data), &count), GXF_FAILURE);
+  EXPECT_EQ(endpoint.read_abi(data, sizeof(data), &count), GXF_NOT_IMPLEMENTED);
+  EXPECT_FALSE(endpoint.flush());
+  EXPECT_TRUE(endpoint.close());
+}
+
+TEST(BlockFileEndpoint, TestOpenMissingDirectory) {
+  BlockFileEndpoint endpoint;
+  EXPECT_FALSE(endpoint.open(::testing::TempDir() + "missing/dir/file.bin", 4096, false));
+  EXPECT_FALSE(endpoint.is_open());
+}
+
+}  // namespace holoscan::ops
@@ -0,0 +1,214 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <holoscan/operators/video_stream_replayer/mapped_entity_file.hpp>
+
+namespace holoscan::ops {
+
+namespace {
+
+// Write an index file with the given log times, and an entity file in which entity `i` is
+// `i + 1` bytes of value `i`.
+std::string write_recording(const std::string& name, const std::vector<uint64_t>& log_times) {
+  const std::string path = ::testing::TempDir() + name;
+  FILE* index_file = fopen((path + nvidia::gxf::FileStream::kIndexFileExtension).c_str(), "wb");
+  FILE* entity_file = fopen((path + nvidia::gxf::FileStream::kBinaryFileExtension).c_str(), "wb");
+  uint64_t offset = 0;
+  for (size_t i = 0; i < log_times.size(); ++i) {
+    nvidia::gxf::EntityIndex index{log_times[i], i + 1, offset};
+    fwrite(&index, sizeof(index), 1, index_file);
+    std::vector<uint8_t> data(i + 1, static_cast<uint8_t>(i));
+    fwrite(data.data(), 1, data.size(), entity_file);
+    offset += data.size();
+  }
+  fclose(index_file);
+  fclose(entity_file);
+  return path;
+}
+
+// Play up to `max_frames` frames and return them, with -1 after a frame flagged as rewound
+std::vector<int64_t> play(PlaybackCursor& cursor, size_t max_frames) {
+  std::vector<int64_t> frames;
+  int64_t frame = 0;
+  bool rewound = false;
+  for (size_t i = 0; i < max_frames && cursor.next(&frame, &rewound); ++i) {
+    if (rewound) { frames.push_back(-1); }
+    frames.push_back(frame);
+  }
+  return frames;
+}
+
+}  // namespace
+
+TEST(MappedEntityFile, TestMappedFileMissing) {
+  MappedFile file;
+  EXPECT_THROW(file.open(::testing::TempDir() + "does_not_exist"), std::runtime_error);
+  EXPECT_EQ(file.data(), nullptr);
+  EXPECT_EQ(file.size(), 0);
+}
+
+TEST(MappedEntityFile, TestEndpointReadsRange) {
+  const std::string path = write_recording("mapped_endpoint", {0, 10, 20, 30});
+  MappedFile file;
+  file.open(path + nvidia::gxf::FileStream::kBinaryFileExtension);
+  ASSERT_EQ(file.size(), 1 + 2 + 3 + 4);
+
+  // entity 2 is 3 bytes of value 2 at offset 3
+  MappedFileEndpoint endpoint;
+  endpoint.set_range(&file, 3, 3);
+  uint8_t data[4] = {};
+  size_t bytes_read = 0;
+  EXPECT_EQ(endpoint.read_abi(data, 2, &bytes_read), GXF_SUCCESS);
+  EXPECT_EQ(bytes_read, 2);
+  EXPECT_EQ(endpoint.remaining(), 1);
+  EXPECT_EQ(data[0], 2);
+  EXPECT_EQ(data[1], 2);
+
+  // reading past the end of the range is a failure
+  EXPECT_EQ(endpoint.read_abi(data, 4, &bytes_read), GXF_FAILURE);
+  EXPECT_EQ(bytes_read, 1);
+  EXPECT_EQ(endpoint.remaining(), 0);
+
+  EXPECT_EQ(endpoint.write_abi(data, 1, &bytes_read), GXF_NOT_IMPLEMENTED);
+}
+
+TEST(MappedEntityFile, TestRecordingIndex) {
+  const std::string path = write_recording("mapped_sorted", {100, 200, 200, 300, 400});
+  MappedEntityRecording recording;
+  recording.open(path);
+  ASSERT_EQ(recording.size(), 5);
+  EXPECT_EQ(recording.index(3).log_time, 300);
+  EXPECT_EQ(recording.index(3).data_offset, 1 + 2 + 3);
+  EXPECT_EQ(recording.index(3).data_size, 4);
+
+  EXPECT_EQ(recording.frame_at_time(0), 0);
+  EXPECT_EQ(recording.frame_at_time(100), 0);
+  EXPECT_EQ(recording.frame_at_time(150), 1);
+  EXPECT_EQ(recording.frame_at_time(200), 1);
+  EXPECT_EQ(recording.frame_at_time(400), 4);
+  EXPECT_EQ(recording.frame_at_time(401), 5);
+
+  recording.close();
+  EXPECT_EQ(recording.size(), 0);
+}
+
+TEST(MappedEntityFile, TestRecordingIndexUnsorted) {
+  const std::string path = write_recording("mapped_unsorted", {300, 100, 400, 200});
+  MappedEntityRecording recording;
+  recording.open(path);
+  ASSERT_EQ(recording.size(), 4);
+
+  // the first frame in recording order wins
+  EXPECT_EQ(recording.frame_at_time(50), 0);
+  EXPECT_EQ(recording.frame_at_time(350), 2);
+  EXPECT_EQ(recording.frame_at_time(500), 4);
+}
+
+TEST(PlaybackCursor, TestForward) {
+  PlaybackCursor cursor;
+  cursor.reset(2, 5, PlaybackCursor::Mode::kForward, false);
+  EXPECT_EQ(cursor.upcoming(), 2);
+  EXPECT_EQ(play(cursor, 10), (std::vector<int64_t>{2, 3, 4}));
+  EXPECT_EQ(cursor.upcoming(), -1);
+
+  // Without repeat, playback stays stopped
+  int64_t frame = 0;
+  bool rewound = false;
+  EXPECT_FALSE(cursor.next(&frame, &rewound));
+}
+
+TEST(PlaybackCursor, TestForwardRepeat) {
+  PlaybackCursor cursor;
+  cursor.reset(2, 5, PlaybackCursor::Mode::kForward, true);
+  EXPECT_EQ(play(cursor, 7), (std::vector<int64_t>{2, 3, 4, -1, 2, 3, 4, -1, 2}));
+}
+
+TEST(PlaybackCursor, TestReverse) {
+  PlaybackCursor cursor;
+  cursor.reset(2, 5, PlaybackCursor::Mode::kReverse, false);
+  EXPECT_EQ(play(cursor, 10), (std::vector<int64_t>{4, 3, 2}));
+
+  cursor.reset(2, 5, PlaybackCursor::Mode::kReverse, true);
+  EXPECT_EQ(play(cursor, 5), (std::vector<int64_t>{4, 3, 2, -1, 4, 3}));
+}
+
+TEST(PlaybackCursor, TestPingPong) {
+  // The direction changes at both ends, without repeating the frames at the turning points
+  PlaybackCursor cursor;
+  cursor.reset(2, 5, PlaybackCursor::Mode::kPingPong, true);
+  EXPECT_EQ(play(cursor, 9), (std::vector<int64_t>{2, 3, 4, 3, 2, 3, 4, 3, 2}));
+
+  // Without repeat, playback stops when it is back at the beginning
+  cursor.reset(2, 5, PlaybackCursor::Mode::kPingPong, false);
+  EXPECT_EQ(play(cursor, 10), (std::vector<int64_t>{2, 3, 4, 3, 2}));
+}
+
+TEST(PlaybackCursor, TestSingleFrameRange) {
+  PlaybackCursor cursor;
+  cursor.reset(3, 4, PlaybackCursor::Mode::kPingPong, true);
+  EXPECT_EQ(play(cursor, 3), (std::vector<int64_t>{3, -1, 3, -1, 3}));
+
+  cursor.reset(3, 4, PlaybackCursor::Mode::kPingPong, false);
+  EXPECT_EQ(play(cursor, 3), (std::vector<int64_t>{3}));
+}
+
+TEST(PlaybackCursor, TestEmptyRange) {
+  PlaybackCursor cursor;
+  cursor.reset(4, 4, PlaybackCursor::Mode::kForward, true);
+  EXPECT_EQ(play(cursor, 3), (std::vector<int64_t>{}));
+  cursor.seek(0);
+  EXPECT_EQ(play(cursor, 3), (std::vector<int64_t>{}));
+}
+
+TEST(PlaybackCursor, TestSeek) {
+  PlaybackCursor cursor;
+  cursor.reset(2, 6, PlaybackCursor::Mode::kForward, false);
+  EXPECT_EQ(play(cursor, 1), (std::vector<int64_t>{2}));
+
+  // A seek is flagged as a rewind
+  cursor.seek(4);
+  EXPECT_EQ(play(cursor, 10), (std::vector<int64_t>{-1, 4, 5}));
+
+  // Seeks outside of the range are clamped to it
+  cursor.seek(0);
+  EXPECT_EQ(play(cursor, 1), (std::vector<int64_t>{-1, 2}));
+  cursor.seek(100);
+  EXPECT_EQ(play(cursor, 10), (std::vector<int64_t>{-1, 5}));
+  cursor.seek(std::numeric_limits<uint64_t>::max());
+  EXPECT_EQ(play(cursor, 10), (std::vector<int64_t>{-1, 5}));
+}
+
+TEST(PlaybackCursor, TestSeekKeepsDirection) {
+  PlaybackCursor cursor;
+  cursor.reset(0, 5, PlaybackCursor::Mode::kPingPong, false);
+  EXPECT_EQ(play(cursor, 6), (std::vector<int64_t>{0, 1, 2, 3, 4, 3}));
+
+  // Playing in reverse when the seek is applied
+  cursor.seek(1);
+  EXPECT_EQ(play(cursor, 10), (std::vector<int64_t>{-1, 1, 0}));
+}
+
+}  // namespace holoscan::ops
@@ -0,0 +1,239 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <gxf/core/gxf.h>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include <holoscan/holoscan.hpp>
+#include "../config.hpp"
+#include "common/assert.hpp"
+
+static HoloscanTestConfig test_config;
+
+namespace holoscan {
+
+namespace ops {
+
+class LockFreeTxOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(LockFreeTxOp)
+
+  LockFreeTxOp() = default;
+
+  void setup(OperatorSpec& spec) override {
+    spec.output<int>("out").connector(IOSpec::ConnectorType::kLockFree, Arg("capacity", 2UL));
+  }
+
+  void compute(InputContext&, OutputContext& op_output, ExecutionContext&) override {
+    auto value = std::make_shared<int>(value_++);
+    op_output.emit(value, "out");
+  };
+
+ private:
+  int value_ = 1;
+};
+
+class LockFreeRxOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(LockFreeRxOp)
+
+  LockFreeRxOp() = default;
+
+  void setup(OperatorSpec& spec) override {
+    spec.input<int>("in").connector(IOSpec::ConnectorType::kLockFree, Arg("capacity", 4UL));
+  }
+
+  void compute(InputContext& op_input, OutputContext&, ExecutionContext&) override {
+    auto value = op_input.receive<int>("in");
+    if (value) {
+      // Messages must arrive in order and without gaps.
+      if (*value != last_ + 1) { ++out_of_order_; }
+      last_ = *value;
+      sum_ += *value;
+    }
+    ++count_;
+  };
+
+  int sum() const { return sum_; }
+  int count() const { return count_; }
+  int out_of_order() const { return out_of_order_; }
+
+ private:
+  int sum_ = 0;
+  int count_ = 0;
+  int last_ = 0;
+  int out_of_order_ = 0;
+};
+
+// Receiver with room for every message, since the scheduling term of each transmitter only sees
+// its own pushes
+class FanInRxOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(FanInRxOp)
+
+  FanInRxOp() = default;
+
+  void setup(OperatorSpec& spec) override {
+    spec.input<int>("in").connector(IOSpec::ConnectorType::kLockFree, Arg("capacity", 256UL));
+  }
+
+  void compute(InputContext& op_input, OutputContext&, ExecutionContext&) override {
+    auto value = op_input.receive<int>("in");
+    if (value) { sum_ += *value; }
+    ++count_;
+  };
+
+  int sum() const { return sum_; }
+  int count() const { return count_; }
+
+ private:
+  int sum_ = 0;
+  int count_ = 0;
+};
+
+class BlockingRxOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(BlockingRxOp)
+
+  BlockingRxOp() = default;
+
+  void setup(OperatorSpec& spec) override {
+    spec.input<int>("in").connector(
+        IOSpec::ConnectorType::kLockFree, Arg("capacity", 1UL), Arg("policy", 3UL));
+  }
+
+  void compute(InputContext& op_input, OutputContext&, ExecutionContext&) override {
+    op_input.receive<int>("in");
+  };
+};
+
+}  // namespace ops
+
+class LockFreeConnectorApp : public holoscan::Application {
+ public:
+  void compose() override {
+    using namespace holoscan;
+    auto tx = make_operator<ops::LockFreeTxOp>("tx", make_condition<CountCondition>(100));
+    rx_ = make_operator<ops::LockFreeRxOp>("rx");
+    add_flow(tx, rx_);
+  }
+
+  std::shared_ptr<ops::LockFreeRxOp> rx_;
+};
+
+class LockFreeFanInApp : public holoscan::Application {
+ public:
+  void compose() override {
+    using namespace holoscan;
+    auto tx1 = make_operator<ops::LockFreeTxOp>("tx1", make_condition<CountCondition>(100));
+    auto tx2 = make_operator<ops::LockFreeTxOp>("tx2", make_condition<CountCondition>(100));
+    rx_ = make_operator<ops::FanInRxOp>("rx");
+    add_flow(tx1, rx_);
+    add_flow(tx2, rx_);
+  }
+
+  std::shared_ptr<ops::FanInRxOp> rx_;
+};
+
+class BlockingConnectorApp : public holoscan::Application {
+ public:
+  void compose() override {
+    using namespace holoscan;
+    auto tx = make_operator<ops::LockFreeTxOp>("tx", make_condition<CountCondition>(10));
+    auto rx = make_operator<ops::BlockingRxOp>("rx");
+    add_flow(tx, rx);
+  }
+};
+
+TEST(LockFreeConnectorApp, TestLockFreeConnectorGreedyScheduler) {
+  load_env_log_level();
+
+  auto app = make_application<LockFreeConnectorApp>();
+
+  const std::string config_file = test_config.get_test_data_file("minimal.yaml");
+  app->config(config_file);
+
+  app->run();
+
+  ASSERT_TRUE(app->rx_);
+  EXPECT_EQ(app->rx_->count(), 100);
+  EXPECT_EQ(app->rx_->sum(), 5050);
+  EXPECT_EQ(app->rx_->out_of_order(), 0);
+}
+
+TEST(LockFreeConnectorApp, TestLockFreeConnectorMultiThreadScheduler) {
+  load_env_log_level();
+
+  auto app = make_application<LockFreeConnectorApp>();
+
+  const std::string config_file = test_config.get_test_data_file("minimal.yaml");
+  app->config(config_file);
+  app->scheduler(app->make_scheduler<MultiThreadScheduler>(
+      "multithread", Arg("worker_thread_number", 2L), Arg("stop_on_deadlock", true)));
+
+  app->run();
+
+  ASSERT_TRUE(app->rx_);
+  EXPECT_EQ(app->rx_->count(), 100);
+  EXPECT_EQ(app->rx_->sum(), 5050);
+  EXPECT_EQ(app->rx_->out_of_order(), 0);
+}
+
+TEST(LockFreeConnectorApp, TestLockFreeConnectorFanIn) {
+  load_env_log_level();
+
+  auto app = make_application<LockFreeFanInApp>();
+
+  const std::string config_file = test_config.get_test_data_file("minimal.yaml");
+  app->config(config_file);
+  app->scheduler(app->make_scheduler<MultiThreadScheduler>(
+      "multithread", Arg("worker_thread_number", 2L), Arg("stop_on_deadlock", true)));
+
+  app->run();
+
+  // Both transmitters may push at the same time, so the receiver uses its multi-producer ring
+  ASSERT_TRUE(app->rx_);
+  auto rx_resource =
+      std::dynamic_pointer_cast<gxf::GXFResource>(app->rx_->spec()->inputs()["in"]->resource());
+  ASSERT_TRUE(rx_resource);
+  bool multi_producer = false;
+  gxf_context_t context = app->executor().context();
+  ASSERT_EQ(
+      GxfParameterGetBool(context, rx_resource->gxf_cid(), "multi_producer", &multi_producer),
+      GXF_SUCCESS);
+  EXPECT_TRUE(multi_producer);
+  EXPECT_EQ(app->rx_->count(), 200);
+  EXPECT_EQ(app->rx_->sum(), 2 * 5050);
+}
+
+TEST(LockFreeConnectorApp, TestBlockPolicyRejectedWithGreedyScheduler) {
+  load_env_log_level();
+
+  auto app = make_application<BlockingConnectorApp>();
+
+  const std::string config_file = test_config.get_test_data_file("minimal.yaml");
+  app->config(config_file);
+
+  // The consumer can't run while the producer waits for room on the single scheduler thread
+  EXPECT_THROW(app->run(), std::runtime_error);
+}
+
+}  // namespace holoscan
@@ -0,0 +1,193 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <gxf/core/gxf.h>
+
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include <holoscan/holoscan.hpp>
+#include "../config.hpp"
+#include "common/assert.hpp"
+
+static HoloscanTestConfig test_config;
+
+namespace holoscan {
+
+namespace ops {
+
+class ValueTxOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(ValueTxOp)
+
+  ValueTxOp() = default;
+
+  void setup(OperatorSpec& spec) override { spec.output<int>("out"); }
+
+  void compute(InputContext&, OutputContext& op_output, ExecutionContext&) override {
+    auto value = std::make_shared<int>(value_++);
+    op_output.emit(value, "out");
+  };
+
+ private:
+  int value_ = 1;
+};
+
+// Receiver that holds the thread for a while so that concurrent ticks can be observed.
+class SlowRxOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(SlowRxOp)
+
+  SlowRxOp() = default;
+
+  void setup(OperatorSpec& spec) override { spec.input<int>("in"); }
+
+  void compute(InputContext& op_input, OutputContext&, ExecutionContext&) override {
+    auto value = op_input.receive<int>("in");
+    (void)value;
+
+    int active = ++active_count;
+    int max_active = max_active_count.load();
+    while (active > max_active && !max_active_count.compare_exchange_weak(max_active, active)) {}
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    --active_count;
+    ++tick_count;
+  };
+
+  static void reset() {
+    active_count = 0;
+    max_active_count = 0;
+    tick_count = 0;
+  }
+
+  static inline std::atomic<int> active_count{0};
+  static inline std::atomic<int> max_active_count{0};
+  static inline std::atomic<int> tick_count{0};
+};
+
+}  // namespace ops
+
+class SchedulerBroadcastApp : public holoscan::Application {
+ public:
+  void compose() override {
+    using namespace holoscan;
+    auto tx = make_operator<ops::ValueTxOp>("tx", make_condition<CountCondition>(10));
+    auto rx1 = make_operator<ops::SlowRxOp>("rx1");
+    auto rx2 = make_operator<ops::SlowRxOp>("rx2");
+
+    add_flow(tx, rx1);
+    add_flow(tx, rx2);
+  }
+};
+
+TEST(SchedulerApp, TestGreedySchedulerRunsOperatorsSequentially) {
+  load_env_log_level();
+  ops::SlowRxOp::reset();
+
+  auto app = make_application<SchedulerBroadcastApp>();
+
+  const std::string config_file = test_config.get_test_data_file("minimal.yaml");
+  app->config(config_file);
+  app->scheduler(app->make_scheduler<GreedyScheduler>("greedy"));
+
+  app->run();
+
+  EXPECT_EQ(ops::SlowRxOp::tick_count.load(), 20);
+  EXPECT_EQ(ops::SlowRxOp::max_active_count.load(), 1);
+}
+
+TEST(SchedulerApp, TestMultiThreadSchedulerRunsOperatorsInParallel) {
+  load_env_log_level();
+  ops::SlowRxOp::reset();
+
+  auto app = make_application<SchedulerBroadcastApp>();
+
+  const std::string config_file = test_config.get_test_data_file("minimal.yaml");
+  app->config(config_file);
+  app->scheduler(app->make_scheduler<MultiThreadScheduler>(
+      "multithread", Arg("worker_thread_number", 2L), Arg("stop_on_deadlock", true)));
+
+  app->run();
+
+  // Both receivers are ready at the same time after each broadcast, so with two worker threads
+  // their ticks are expected to overlap.
+  EXPECT_EQ(ops::SlowRxOp::tick_count.load(), 20);
+  EXPECT_GE(ops::SlowRxOp::max_active_count.load(), 2);
+}
+
+TEST(SchedulerApp, TestSchedulerFromConfig) {
+  load_env_log_level();
+
+  auto app = make_application<SchedulerBroadcastApp>();
+
+  const std::string config_file = test_config.get_test_data_file("minimal.yaml");
+  app->config(config_file);
+
+  // 'minimal.yaml' has no 'scheduler' section, so the default scheduler is used.
+  auto scheduler = app->scheduler();
+  ASSERT_TRUE(scheduler);
+  EXPECT_TRUE(std::dynamic_pointer_cast<GreedyScheduler>(scheduler) != nullptr);
+}
+
+// Writes a configuration with the given 'scheduler' section and returns the scheduler created
+// from it by a new application
+static std::shared_ptr<Scheduler> scheduler_from_yaml(const std::string& file_name,
+                                                      const std::string& scheduler_yaml) {
+  const std::string config_file = test_config.temp_folder + "/" + file_name;
+  {
+    std::ofstream config(config_file);
+    config << "scheduler:\n" << scheduler_yaml;
+  }
+  auto app = make_application<SchedulerBroadcastApp>();
+  app->config(config_file);
+  return app->scheduler();
+}
+
+TEST(SchedulerApp, TestSchedulerFromConfigTypes) {
+  load_env_log_level();
+
+  auto greedy = scheduler_from_yaml("scheduler_greedy.yaml", "  type: greedy\n");
+  EXPECT_TRUE(std::dynamic_pointer_cast<GreedyScheduler>(greedy) != nullptr);
+
+  auto multi_thread = scheduler_from_yaml(
+      "scheduler_multi_thread.yaml", "  type: multi_thread\n  worker_thread_number: 3\n");
+  ASSERT_TRUE(std::dynamic_pointer_cast<MultiThreadScheduler>(multi_thread) != nullptr);
+  // The keys other than 'type' are passed to the scheduler
+  ASSERT_EQ(multi_thread->args().size(), 1);
+  EXPECT_EQ(multi_thread->args()[0].name(), "worker_thread_number");
+
+  auto event_based = scheduler_from_yaml("scheduler_event_based.yaml", "  type: event_based\n");
+  EXPECT_TRUE(std::dynamic_pointer_cast<EventBasedScheduler>(event_based) != nullptr);
+}
+
+TEST(SchedulerApp, TestSchedulerFromConfigInvalidType) {
+  load_env_log_level();
+
+  // A misspelled type must not fall back to another scheduler
+  EXPECT_THROW(scheduler_from_yaml("scheduler_invalid.yaml", "  type: multithread\n"),
+               std::runtime_error);
+}
+
+}  // namespace holoscan
@@ -18,7 +18,9 @@
 #include <gtest/gtest.h>
 #include <gxf/core/gxf.h>
 
+#include <memory>
 #include <string>
+#include <vector>
 
 #include <holoscan/holoscan.hpp>
 #include "../config.hpp"
@@ -33,6 +35,85 @@ static HoloscanTestConfig test_config;
 
 namespace holoscan {
 
+namespace ops {
+
+class SharedValueTxOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(SharedValueTxOp)
+
+  SharedValueTxOp() = default;
+
+  void setup(OperatorSpec& spec) override { spec.output<int>("out"); }
+
+  void compute(InputContext&, OutputContext& op_output, ExecutionContext&) override {
+    auto value = std::make_shared<int>(value_++);
+    sent_.push_back(value.get());
+    op_output.emit(value, "out");
+  };
+
+  std::vector<const int*> sent_;
+
+ private:
+  int value_ = 1;
+};
+
+class SharedValueRxOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(SharedValueRxOp)
+
+  SharedValueRxOp() = default;
+
+  void setup(OperatorSpec& spec) override { spec.input<int>("in"); }
+
+  void compute(InputContext& op_input, OutputContext&, ExecutionContext&) override {
+    auto value = op_input.receive<int>("in");
+    received_.push_back(value.get());
+  };
+
+  std::vector<const int*> received_;
+};
+
+class TwoSlotRxOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(TwoSlotRxOp)
+
+  TwoSlotRxOp() = default;
+
+  void setup(OperatorSpec& spec) override {
+    spec.input<int>("in").connector(IOSpec::ConnectorType::kDoubleBuffer, Arg("capacity", 2UL));
+  }
+
+  void compute(InputContext& op_input, OutputContext&, ExecutionContext&) override {
+    op_input.receive<int>("in");
+    ++count_;
+  };
+
+  int count_ = 0;
+};
+
+// Transmitter whose port waits for room for two messages in each downstream receiver
+class MinSizeTxOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(MinSizeTxOp)
+
+  MinSizeTxOp() = default;
+
+  void setup(OperatorSpec& spec) override {
+    spec.output<int>("out").condition(ConditionType::kDownstreamMessageAffordable,
+                                      Arg("min_size", 2UL));
+  }
+
+  void compute(InputContext&, OutputContext& op_output, ExecutionContext&) override {
+    auto value = std::make_shared<int>(value_++);
+    op_output.emit(value, "out");
+  };
+
+ private:
+  int value_ = 1;
+};
+
+}  // namespace ops
+
 class NativeMultiBroadcastsApp : public holoscan::Application {
  public:
   void compose() override {
@@ -78,4 +159,103 @@ TEST(NativeOperatorMultiBroadcastsApp, TestNativeOperatorMultiBroadcastsApp) {
   EXPECT_EQ(count, 4);
 }
 
+class NativeSharedBroadcastApp : public holoscan::Application {
+ public:
+  void compose() override {
+    using namespace holoscan;
+    tx_ = make_operator<ops::SharedValueTxOp>("tx", make_condition<CountCondition>(10));
+    rx1_ = make_operator<ops::SharedValueRxOp>("rx1");
+    rx2_ = make_operator<ops::SharedValueRxOp>("rx2");
+    rx3_ = make_operator<ops::SharedValueRxOp>("rx3");
+
+    add_flow(tx_, rx1_);
+    add_flow(tx_, rx2_);
+    add_flow(tx_, rx3_);
+  }
+
+  std::shared_ptr<ops::SharedValueTxOp> tx_;
+  std::shared_ptr<ops::SharedValueRxOp> rx1_;
+  std::shared_ptr<ops::SharedValueRxOp> rx2_;
+  std::shared_ptr<ops::SharedValueRxOp> rx3_;
+};
+
+TEST(NativeOperatorMultiBroadcastsApp, TestNativeOperatorBroadcastSharesMessage) {
+  load_env_log_level();
+
+  auto app = make_application<NativeSharedBroadcastApp>();
+
+  const std::string config_file = test_config.get_test_data_file("minimal.yaml");
+  app->config(config_file);
+
+  app->run();
+
+  // Every receiver gets the very object that was emitted (no copy per consumer).
+  ASSERT_EQ(app->tx_->sent_.size(), 10u);
+  EXPECT_EQ(app->rx1_->received_, app->tx_->sent_);
+  EXPECT_EQ(app->rx2_->received_, app->tx_->sent_);
+  EXPECT_EQ(app->rx3_->received_, app->tx_->sent_);
+
+  // The fan-out is done by the operator itself, without a separate Broadcast entity.
+  gxf_uid_t broadcast_eid = 0;
+  EXPECT_NE(GxfEntityFind(app->executor().context(), "_broadcast_tx_out", &broadcast_eid),
+            GXF_SUCCESS);
+}
+
+class NativeMinSizeBroadcastApp : public holoscan::Application {
+ public:
+  void compose() override {
+    using namespace holoscan;
+    tx_ = make_operator<ops::MinSizeTxOp>("tx", make_condition<CountCondition>(10));
+    rx1_ = make_operator<ops::TwoSlotRxOp>("rx1");
+    rx2_ = make_operator<ops::TwoSlotRxOp>("rx2");
+    rx3_ = make_operator<ops::TwoSlotRxOp>("rx3");
+
+    add_flow(tx_, rx1_);
+    add_flow(tx_, rx2_);
+    add_flow(tx_, rx3_);
+  }
+
+  std::shared_ptr<ops::MinSizeTxOp> tx_;
+  std::shared_ptr<ops::TwoSlotRxOp> rx1_;
+  std::shared_ptr<ops::TwoSlotRxOp> rx2_;
+  std::shared_ptr<ops::TwoSlotRxOp> rx3_;
+};
+
+TEST(NativeOperatorMultiBroadcastsApp, TestNativeOperatorBroadcastKeepsConditions) {
+  load_env_log_level();
+
+  auto app = make_application<NativeMinSizeBroadcastApp>();
+
+  const std::string config_file = test_config.get_test_data_file("minimal.yaml");
+  app->config(config_file);
+
+  app->run();
+
+  EXPECT_EQ(app->rx1_->count_, 10);
+  EXPECT_EQ(app->rx2_->count_, 10);
+  EXPECT_EQ(app->rx3_->count_, 10);
+
+  // One additional transmitter per additional target
+  auto& out_spec = app->tx_->spec()->outputs()["out"];
+  EXPECT_EQ(out_spec->fanout_connector_ptrs().size(), 2u);
+
+  // The additional transmitters wait for the same room as the one of the port
+  gxf_context_t context = app->executor().context();
+  auto tx_resource = std::dynamic_pointer_cast<gxf::GXFResource>(out_spec->resource());
+  ASSERT_TRUE(tx_resource);
+  gxf_tid_t term_tid;
+  ASSERT_EQ(
+      GxfComponentTypeId(context, "nvidia::gxf::DownstreamReceptiveSchedulingTerm", &term_tid),
+      GXF_SUCCESS);
+  for (const char* term_name : {"__condition_fanout_out_1_0", "__condition_fanout_out_2_0"}) {
+    gxf_uid_t term_cid = 0;
+    ASSERT_EQ(
+        GxfComponentFind(context, tx_resource->gxf_eid(), term_tid, term_name, nullptr, &term_cid),
+        GXF_SUCCESS);
+    uint64_t min_size = 0;
+    ASSERT_EQ(GxfParameterGetUInt64(context, term_cid, "min_size", &min_size), GXF_SUCCESS);
+    EXPECT_EQ(min_size, 2u);
+  }
+}
+
 }  // namespace holoscan
@@ -18,6 +18,9 @@
 #include <gtest/gtest.h>
 #include <gxf/core/gxf.h>
 
+#include <cstdio>
+#include <fstream>
+#include <sstream>
 #include <string>
 
 #include <holoscan/holoscan.hpp>
@@ -63,4 +66,34 @@ TEST(NativeOperatorPingApp, TestNativeOperatorPingApp) {
   EXPECT_TRUE(log_output.find("value2: 100") != std::string::npos);
 }
 
+TEST(NativeOperatorPingApp, TestNativeOperatorPingAppProfiler) {
+  load_env_log_level();
+
+  auto app = make_application<NativeOpApp>();
+
+  const std::string config_file = test_config.get_test_data_file("minimal.yaml");
+  app->config(config_file);
+
+  const std::string output_file = "native_operator_ping_app_profile.csv";
+  app->profiler().enable();
+  app->profiler().output_file(output_file);
+
+  app->run();
+
+  auto profiles = app->profiler().operator_profiles();
+  ASSERT_EQ(profiles.size(), 2);
+  for (const auto& profile : profiles) {
+    EXPECT_EQ(profile.count, 10) << "operator: " << profile.name;
+    EXPECT_GE(profile.max_ms, profile.min_ms);
+  }
+
+  std::ifstream file(output_file);
+  ASSERT_TRUE(file.good());
+  std::stringstream contents;
+  contents << file.rdbuf();
+  EXPECT_TRUE(contents.str().find("\ntx,10,") != std::string::npos);
+  EXPECT_TRUE(contents.str().find("\nrx,10,") != std::string::npos);
+  std::remove(output_file.c_str());
+}
+
 }  // namespace holoscan
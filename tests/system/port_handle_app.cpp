@@ -0,0 +1,119 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <gxf/core/gxf.h>
+
+#include <memory>
+#include <string>
+
+#include <holoscan/holoscan.hpp>
+#include "../config.hpp"
+#include "common/assert.hpp"
+
+static HoloscanTestConfig test_config;
+
+namespace holoscan {
+
+namespace ops {
+
+class PortHandleTxOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(PortHandleTxOp)
+
+  PortHandleTxOp() = default;
+
+  void setup(OperatorSpec& spec) override {
+    out_ = spec.output<int>("out");
+    spec.output<int>("out_by_name");
+  }
+
+  void compute(InputContext&, OutputContext& op_output, ExecutionContext&) override {
+    auto value = std::make_shared<int>(value_++);
+    op_output.emit(value, out_);
+    op_output.emit(value, "out_by_name");
+  };
+
+ private:
+  OutputPort<int> out_;
+  int value_ = 1;
+};
+
+class PortHandleRxOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(PortHandleRxOp)
+
+  PortHandleRxOp() = default;
+
+  void setup(OperatorSpec& spec) override {
+    in_ = spec.input<int>("in");
+    in_by_name_ = spec.input<int>("in_by_name");
+  }
+
+  void compute(InputContext& op_input, OutputContext&, ExecutionContext&) override {
+    // Mix handle-based and name-based receive() on the two ports.
+    auto value = op_input.receive(in_);
+    auto value_by_name = op_input.receive<int>("in_by_name");
+    if (value && value_by_name && *value == *value_by_name) { sum_ += *value; }
+    ++count_;
+  };
+
+  int sum() const { return sum_; }
+  int count() const { return count_; }
+  IOSpec* in_spec() const { return in_.spec(); }
+
+ private:
+  InputPort<int> in_;
+  InputPort<int> in_by_name_;
+  int sum_ = 0;
+  int count_ = 0;
+};
+
+}  // namespace ops
+
+class PortHandleApp : public holoscan::Application {
+ public:
+  void compose() override {
+    using namespace holoscan;
+    auto tx = make_operator<ops::PortHandleTxOp>("tx", make_condition<CountCondition>(10));
+    rx_ = make_operator<ops::PortHandleRxOp>("rx");
+    add_flow(tx, rx_, {{"out", "in"}, {"out_by_name", "in_by_name"}});
+  }
+
+  std::shared_ptr<ops::PortHandleRxOp> rx_;
+};
+
+TEST(PortHandleApp, TestPortHandleApp) {
+  load_env_log_level();
+
+  auto app = make_application<PortHandleApp>();
+
+  const std::string config_file = test_config.get_test_data_file("minimal.yaml");
+  app->config(config_file);
+
+  app->run();
+
+  ASSERT_TRUE(app->rx_);
+  EXPECT_EQ(app->rx_->count(), 10);
+  EXPECT_EQ(app->rx_->sum(), 55);
+
+  // The receiver is resolved once when the operator starts.
+  ASSERT_NE(app->rx_->in_spec(), nullptr);
+  EXPECT_NE(app->rx_->in_spec()->connector_ptr(), nullptr);
+}
+
+}  // namespace holoscan
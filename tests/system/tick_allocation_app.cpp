@@ -0,0 +1,154 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <gxf/core/gxf.h>
+
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <string>
+
+#include <holoscan/holoscan.hpp>
+#include "../config.hpp"
+#include "common/assert.hpp"
+
+static HoloscanTestConfig test_config;
+
+namespace {
+
+// Heap allocations made on the current thread while counting is enabled. The operators below
+// only disable counting while creating the payload so that the framework's tick path, including
+// emit() and receive(), is counted.
+thread_local bool count_allocations = false;
+thread_local size_t allocation_count = 0;
+
+}  // namespace
+
+void* operator new(std::size_t size) {
+  if (count_allocations) { ++allocation_count; }
+  if (void* ptr = std::malloc(size ? size : 1)) { return ptr; }
+  throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+  std::free(ptr);
+}
+
+namespace holoscan {
+
+namespace ops {
+
+class AllocTxOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(AllocTxOp)
+
+  AllocTxOp() = default;
+
+  void setup(OperatorSpec& spec) override { out_ = spec.output<int>("out"); }
+
+  void compute(InputContext&, OutputContext& op_output, ExecutionContext&) override {
+    count_allocations = false;
+    auto value = std::make_shared<int>(value_++);
+    count_allocations = true;
+    op_output.emit(value, out_);
+  };
+
+ private:
+  OutputPort<int> out_;
+  int value_ = 1;
+};
+
+class AllocRxOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(AllocRxOp)
+
+  AllocRxOp() = default;
+
+  static constexpr int kWarmupTicks = 10;
+
+  void setup(OperatorSpec& spec) override { in_ = spec.input<int>("in"); }
+
+  void compute(InputContext& op_input, OutputContext&, ExecutionContext& context) override {
+    auto value = op_input.receive(in_);
+    if (value) { sum_ += *value; }
+
+    count_allocations = false;
+    // Allocations made since the end of the warm-up.
+    if (count_ >= kWarmupTicks) { steady_state_allocations_ = allocation_count - warmup_count_; }
+
+    if (count_ == 0) { first_context_ = &context; }
+    if (&context != first_context_) { ++context_changes_; }
+    if (++count_ == kWarmupTicks) { warmup_count_ = allocation_count; }
+    count_allocations = true;
+  };
+
+  int count() const { return count_; }
+  int sum() const { return sum_; }
+  size_t steady_state_allocations() const { return steady_state_allocations_; }
+  int context_changes() const { return context_changes_; }
+
+ private:
+  InputPort<int> in_;
+  int count_ = 0;
+  int sum_ = 0;
+  size_t warmup_count_ = 0;
+  size_t steady_state_allocations_ = 0;
+  ExecutionContext* first_context_ = nullptr;
+  int context_changes_ = 0;
+};
+
+}  // namespace ops
+
+class TickAllocationApp : public holoscan::Application {
+ public:
+  void compose() override {
+    using namespace holoscan;
+    auto tx = make_operator<ops::AllocTxOp>("tx", make_condition<CountCondition>(100));
+    rx_ = make_operator<ops::AllocRxOp>("rx");
+    add_flow(tx, rx_);
+  }
+
+  std::shared_ptr<ops::AllocRxOp> rx_;
+};
+
+TEST(TickAllocationApp, TestSteadyStateTickDoesNotAllocate) {
+  load_env_log_level();
+
+  auto app = make_application<TickAllocationApp>();
+
+  const std::string config_file = test_config.get_test_data_file("minimal.yaml");
+  app->config(config_file);
+
+  app->run();
+  count_allocations = false;
+
+  ASSERT_TRUE(app->rx_);
+  EXPECT_EQ(app->rx_->count(), 100);
+  EXPECT_EQ(app->rx_->sum(), 5050);
+  // The execution context is created once and reused for every tick.
+  EXPECT_EQ(app->rx_->context_changes(), 0);
+  // Once the pipeline is running, message entities are recycled and the payload is passed without
+  // std::any, so no heap allocation happens other than creating the payload.
+  EXPECT_EQ(app->rx_->steady_state_allocations(), 0u);
+}
+
+}  // namespace holoscan
@@ -0,0 +1,349 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <gxf/core/gxf.h>
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <holoscan/holoscan.hpp>
+#include <holoscan/operators/video_stream_recorder/video_stream_recorder.hpp>
+#include <holoscan/operators/video_stream_replayer/video_stream_replayer.hpp>
+#include "../config.hpp"
+#include "common/assert.hpp"
+#include "gxf/std/allocator.hpp"
+#include "gxf/std/tensor.hpp"
+
+using namespace std::string_literals;
+
+static HoloscanTestConfig test_config;
+
+namespace holoscan {
+
+namespace {
+
+constexpr int32_t kRows = 64;
+constexpr int32_t kColumns = 256;
+constexpr uint8_t kFrameCount = 5;
+constexpr uint8_t kCorruptedFrame = 2;
+
+const std::string kBasename = "replayer_checksum_test";
+
+// Delta-encoded recording with keyframes at frames 0, 4 and 8
+constexpr uint8_t kDeltaFrameCount = 10;
+constexpr uint64_t kKeyframeInterval = 4;
+const std::string kDeltaBasename = "replayer_delta_test";
+
+}  // namespace
+
+namespace ops {
+
+// Emits host tensors filled with the index of the frame
+class FrameTxOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(FrameTxOp)
+
+  FrameTxOp() = default;
+
+  void setup(OperatorSpec& spec) override {
+    spec.output<gxf::Entity>("out");
+    spec.param(allocator_, "allocator", "Allocator", "Allocator of the frames");
+  }
+
+  void compute(InputContext&, OutputContext& op_output, ExecutionContext& context) override {
+    auto message = nvidia::gxf::Entity::New(context.context());
+    if (!message) { throw std::runtime_error("Failed to create the frame entity"); }
+    auto tensor = message.value().add<nvidia::gxf::Tensor>("frame");
+    if (!tensor) { throw std::runtime_error("Failed to add the frame tensor"); }
+    auto allocator = nvidia::gxf::Handle<nvidia::gxf::Allocator>::Create(
+        context.context(), allocator_.get()->gxf_cid());
+    if (!allocator || !tensor.value()->reshape<uint8_t>(nvidia::gxf::Shape{kRows, kColumns},
+                                                        nvidia::gxf::MemoryStorageType::kSystem,
+                                                        allocator.value())) {
+      throw std::runtime_error("Failed to allocate the frame tensor");
+    }
+    std::memset(tensor.value()->pointer(), frame_++, tensor.value()->size());
+
+    auto result = gxf::Entity(std::move(message.value()));
+    op_output.emit(result);
+  };
+
+ private:
+  Parameter<std::shared_ptr<Allocator>> allocator_;
+  uint8_t frame_ = 0;
+};
+
+// Keeps the value of the frames it receives
+class FrameRxOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(FrameRxOp)
+
+  FrameRxOp() = default;
+
+  void setup(OperatorSpec& spec) override { spec.input<gxf::Entity>("in"); }
+
+  void compute(InputContext& op_input, OutputContext&, ExecutionContext&) override {
+    auto message = op_input.receive<gxf::Entity>("in");
+    const auto tensor =
+        static_cast<nvidia::gxf::Entity&>(message).get<nvidia::gxf::Tensor>("frame");
+    if (!tensor) { throw std::runtime_error("No frame tensor in the replayed entity"); }
+    frames_.push_back(*static_cast<const uint8_t*>(tensor.value()->pointer()));
+    if (seek_replayer_ && frames_.back() == seek_after_frame_) {
+      seek_replayer_->seek(seek_frame_);
+      seek_replayer_.reset();
+    }
+  };
+
+  // Seek the replayer to `frame` once `after_frame` was received
+  void seek_after(std::shared_ptr<VideoStreamReplayerOp> replayer, uint8_t after_frame,
+                  uint64_t frame) {
+    seek_replayer_ = std::move(replayer);
+    seek_after_frame_ = after_frame;
+    seek_frame_ = frame;
+  }
+
+  const std::vector<uint8_t>& frames() const { return frames_; }
+
+ private:
+  std::vector<uint8_t> frames_;
+  std::shared_ptr<VideoStreamReplayerOp> seek_replayer_;
+  uint8_t seek_after_frame_ = 0;
+  uint64_t seek_frame_ = 0;
+};
+
+}  // namespace ops
+
+class RecorderApp : public holoscan::Application {
+ public:
+  void compose() override {
+    using namespace holoscan;
+    auto tx = make_operator<ops::FrameTxOp>(
+        "tx",
+        make_condition<CountCondition>(kFrameCount),
+        Arg("allocator", make_resource<UnboundedAllocator>("allocator")));
+    auto recorder = make_operator<ops::VideoStreamRecorderOp>(
+        "recorder", Arg("directory", test_config.temp_folder), Arg("basename", kBasename));
+    add_flow(tx, recorder);
+  }
+};
+
+class DeltaRecorderApp : public holoscan::Application {
+ public:
+  void compose() override {
+    using namespace holoscan;
+    auto tx = make_operator<ops::FrameTxOp>(
+        "tx",
+        make_condition<CountCondition>(kDeltaFrameCount),
+        Arg("allocator", make_resource<UnboundedAllocator>("allocator")));
+    auto recorder = make_operator<ops::VideoStreamRecorderOp>(
+        "recorder",
+        Arg("directory", test_config.temp_folder),
+        Arg("basename", kDeltaBasename),
+        Arg("delta_encoding", true),
+        Arg("keyframe_interval", kKeyframeInterval));
+    add_flow(tx, recorder);
+  }
+};
+
+class DeltaReplayerApp : public holoscan::Application {
+ public:
+  DeltaReplayerApp(std::string playback_mode, uint64_t start_frame, int seek_after_frame,
+                   uint64_t seek_frame)
+      : playback_mode_(std::move(playback_mode)),
+        start_frame_(start_frame),
+        seek_after_frame_(seek_after_frame),
+        seek_frame_(seek_frame) {}
+
+  void compose() override {
+    using namespace holoscan;
+    replayer_ = make_operator<ops::VideoStreamReplayerOp>("replayer",
+                                                          Arg("directory", test_config.temp_folder),
+                                                          Arg("basename", kDeltaBasename),
+                                                          Arg("realtime", false),
+                                                          Arg("repeat", false),
+                                                          Arg("memory_mapped", true),
+                                                          Arg("playback_mode", playback_mode_),
+                                                          Arg("start_frame", start_frame_),
+                                                          Arg("ignore_corrupted_entities", false));
+    rx_ = make_operator<ops::FrameRxOp>("rx");
+    if (seek_after_frame_ >= 0) {
+      rx_->seek_after(replayer_, static_cast<uint8_t>(seek_after_frame_), seek_frame_);
+    }
+    add_flow(replayer_, rx_);
+  }
+
+  std::vector<uint8_t> frames() const { return rx_ ? rx_->frames() : std::vector<uint8_t>{}; }
+
+ private:
+  std::string playback_mode_;
+  uint64_t start_frame_;
+  int seek_after_frame_;
+  uint64_t seek_frame_;
+  std::shared_ptr<ops::VideoStreamReplayerOp> replayer_;
+  std::shared_ptr<ops::FrameRxOp> rx_;
+};
+
+class ReplayerApp : public holoscan::Application {
+ public:
+  ReplayerApp(bool verify_checksum, bool ignore_corrupted_entities, bool memory_mapped)
+      : verify_checksum_(verify_checksum),
+        ignore_corrupted_entities_(ignore_corrupted_entities),
+        memory_mapped_(memory_mapped) {}
+
+  void compose() override {
+    using namespace holoscan;
+    auto replayer =
+        make_operator<ops::VideoStreamReplayerOp>("replayer",
+                                                  Arg("directory", test_config.temp_folder),
+                                                  Arg("basename", kBasename),
+                                                  Arg("realtime", false),
+                                                  Arg("repeat", false),
+                                                  Arg("memory_mapped", memory_mapped_),
+                                                  Arg("verify_checksum", verify_checksum_),
+                                                  Arg("ignore_corrupted_entities",
+                                                      ignore_corrupted_entities_));
+    rx_ = make_operator<ops::FrameRxOp>("rx");
+    add_flow(replayer, rx_);
+  }
+
+  std::vector<uint8_t> frames() const { return rx_ ? rx_->frames() : std::vector<uint8_t>{}; }
+
+ private:
+  bool verify_checksum_;
+  bool ignore_corrupted_entities_;
+  bool memory_mapped_;
+  std::shared_ptr<ops::FrameRxOp> rx_;
+};
+
+class VideoStreamReplayerChecksumTest : public ::testing::TestWithParam<bool> {
+ protected:
+  // Records kFrameCount frames, and flips a byte in the middle of the data of kCorruptedFrame
+  void SetUp() override {
+    load_env_log_level();
+
+    auto recorder = make_application<RecorderApp>();
+    recorder->config(test_config.get_test_data_file("minimal.yaml"));
+    recorder->run();
+
+    // EntityIndex entries of the recording: log time, data size and data offset
+    std::ifstream index_file(test_config.temp_folder + "/" + kBasename + ".gxf_index",
+                             std::ios::binary);
+    uint64_t index[3] = {};
+    for (uint8_t i = 0; i <= kCorruptedFrame; i++) {
+      ASSERT_TRUE(index_file.read(reinterpret_cast<char*>(index), sizeof(index)));
+    }
+    std::fstream entity_file(test_config.temp_folder + "/" + kBasename + ".gxf_entities",
+                             std::ios::binary | std::ios::in | std::ios::out);
+    const auto offset = static_cast<std::streamoff>(index[2] + index[1] / 2);
+    char byte = 0;
+    ASSERT_TRUE(entity_file.seekg(offset).read(&byte, 1));
+    byte ^= static_cast<char>(0xff);
+    ASSERT_TRUE(entity_file.seekp(offset).write(&byte, 1));
+  }
+
+  std::shared_ptr<ReplayerApp> make_replayer(bool verify_checksum,
+                                             bool ignore_corrupted_entities) {
+    auto app = make_application<ReplayerApp>(
+        verify_checksum, ignore_corrupted_entities, GetParam());
+    app->config(test_config.get_test_data_file("minimal.yaml"));
+    return app;
+  }
+};
+
+TEST_P(VideoStreamReplayerChecksumTest, TestCorruptedEntityReplayedWithoutVerification) {
+  auto app = make_replayer(false, false);
+  app->run();
+
+  // The corrupted byte is not the first one of the frame
+  EXPECT_EQ(app->frames(), std::vector<uint8_t>({0, 1, 2, 3, 4}));
+}
+
+TEST_P(VideoStreamReplayerChecksumTest, TestCorruptedEntitySkipped) {
+  auto app = make_replayer(true, true);
+
+  testing::internal::CaptureStderr();
+  app->run();
+  std::string log_output = testing::internal::GetCapturedStderr();
+
+  EXPECT_EQ(app->frames(), std::vector<uint8_t>({0, 1, 3, 4}));
+  EXPECT_TRUE(log_output.find("Checksum mismatch for entity 2") != std::string::npos);
+}
+
+TEST_P(VideoStreamReplayerChecksumTest, TestCorruptedEntityFails) {
+  auto app = make_replayer(true, false);
+
+  EXPECT_EXIT(app->run(), testing::ExitedWithCode(1), "Checksum mismatch for entity 2");
+}
+
+class VideoStreamReplayerDeltaTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    load_env_log_level();
+
+    auto recorder = make_application<DeltaRecorderApp>();
+    recorder->config(test_config.get_test_data_file("minimal.yaml"));
+    recorder->run();
+  }
+
+  // Seeks to `seek_frame` once `seek_after_frame` was received, unless it is negative
+  std::shared_ptr<DeltaReplayerApp> make_replayer(const std::string& playback_mode,
+                                                  uint64_t start_frame = 0,
+                                                  int seek_after_frame = -1,
+                                                  uint64_t seek_frame = 0) {
+    auto app = make_application<DeltaReplayerApp>(
+        playback_mode, start_frame, seek_after_frame, seek_frame);
+    app->config(test_config.get_test_data_file("minimal.yaml"));
+    return app;
+  }
+};
+
+TEST_F(VideoStreamReplayerDeltaTest, TestStartFrameBetweenKeyframes) {
+  auto app = make_replayer("forward", 6);
+  app->run();
+
+  EXPECT_EQ(app->frames(), std::vector<uint8_t>({6, 7, 8, 9}));
+}
+
+TEST_F(VideoStreamReplayerDeltaTest, TestReverse) {
+  auto app = make_replayer("reverse");
+  app->run();
+
+  EXPECT_EQ(app->frames(), std::vector<uint8_t>({9, 8, 7, 6, 5, 4, 3, 2, 1, 0}));
+}
+
+TEST_F(VideoStreamReplayerDeltaTest, TestSeek) {
+  // Seek from the first group of frames to a delta frame of the second one
+  auto app = make_replayer("forward", 0, 1, 6);
+  app->run();
+
+  EXPECT_EQ(app->frames(), std::vector<uint8_t>({0, 1, 6, 7, 8, 9}));
+}
+
+INSTANTIATE_TEST_SUITE_P(VideoStreamReplayerApp, VideoStreamReplayerChecksumTest,
+                         ::testing::Bool(),
+                         [](const ::testing::TestParamInfo<bool>& info) {
+                           return info.param ? "MemoryMapped"s : "Streamed"s;
+                         });
+
+}  // namespace holoscan